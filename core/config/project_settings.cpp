@@ -1342,6 +1342,8 @@ ProjectSettings::ProjectSettings() {
 	GLOBAL_DEF_RST_BASIC(PropertyInfo(Variant::INT, "gui/fonts/dynamic_fonts/line_join", PROPERTY_HINT_ENUM, "Round,Bevel,Miter Variable,Miter Fixed"), 0);
 	GLOBAL_DEF_RST_BASIC(PropertyInfo(Variant::INT, "gui/fonts/dynamic_fonts/line_cap", PROPERTY_HINT_ENUM, "Butt,Round,Square"), 0);
 	GLOBAL_DEF_RST_BASIC(PropertyInfo(Variant::FLOAT, "gui/fonts/dynamic_fonts/miter_limit"), 0.0);
+	GLOBAL_DEF_RST("gui/fonts/dynamic_fonts/persistent_glyph_cache", false);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::STRING, "gui/fonts/dynamic_fonts/persistent_glyph_cache_path", PROPERTY_HINT_DIR), "user://font_cache");
 
 	GLOBAL_DEF_BASIC(PropertyInfo(Variant::INT, "rendering/textures/canvas_textures/default_texture_filter", PROPERTY_HINT_ENUM, "Nearest,Linear,Linear Mipmap,Nearest Mipmap"), 0);
 	GLOBAL_DEF_BASIC(PropertyInfo(Variant::INT, "rendering/textures/canvas_textures/default_texture_repeat", PROPERTY_HINT_ENUM, "Disable,Enable,Mirror"), 0);
@@ -595,6 +595,7 @@ void RemoteDebugger::poll_events(bool p_is_idle) {
 		for (int i = 0; i < ScriptServer::get_language_count(); i++) {
 			ScriptServer::get_language(i)->reload_all_scripts();
 		}
+		ScriptServer::notify_script_changed();
 		reload_all_scripts = false;
 	}
 }
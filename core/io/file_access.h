@@ -88,6 +88,7 @@ public:
 	typedef Ref<FileAccess> (*CreateFunc)();
 	bool big_endian = false;
 	bool real_is_double = false;
+	bool read_only_data = false;
 
 	virtual BitField<UnixPermissionFlags> _get_unix_permissions(const String &p_file) = 0;
 	virtual Error _set_unix_permissions(const String &p_file, BitField<UnixPermissionFlags> p_permissions) = 0;
@@ -149,6 +150,13 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const; ///< get an array of bytes
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	// Read-only view of the next p_length bytes, valid until the file is closed. Advances the position like get_buffer().
+	// Returns nullptr (and does not move) when the file can't provide one, callers must then fall back to get_buffer().
+	virtual const uint8_t *get_mapped_buffer(uint64_t p_length) const { return nullptr; }
+	// Marks the file as data that nothing truncates or rewrites while it is open (e.g. a PCK), so it may be memory-mapped.
+	// Reading a mapping past the end of a file truncated meanwhile crashes, so other files only map as exported res:// data.
+	void set_read_only_data(bool p_enable) { read_only_data = p_enable; }
+	bool is_read_only_data() const { return read_only_data; }
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
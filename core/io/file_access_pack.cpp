@@ -337,6 +337,21 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return to_read;
 }
 
+const uint8_t *FileAccessPack::get_mapped_buffer(uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(f.is_null(), nullptr, "File must be opened before use.");
+
+	if (eof || pos > pf.size || p_length > pf.size - pos) {
+		return nullptr;
+	}
+
+	// The pack file is kept positioned at off + pos, so this maps straight into the pack.
+	const uint8_t *data = f->get_mapped_buffer(p_length);
+	if (data) {
+		pos += p_length;
+	}
+	return data;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
@@ -376,6 +391,7 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f(FileAccess::open(pf.pack, FileAccess::READ)) {
 	ERR_FAIL_COND_MSG(f.is_null(), "Can't open pack-referenced file '" + String(pf.pack) + "'.");
 
+	f->set_read_only_data(true);
 	f->seek(pf.offset);
 	off = pf.offset;
 
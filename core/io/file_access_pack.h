@@ -171,6 +171,7 @@ public:
 	virtual uint8_t get_8() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_mapped_buffer(uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -32,9 +32,11 @@
 
 #include "core/error/error_list.h"
 #include "core/error/error_macros.h"
+#include "core/io/image_kernels.h"
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_map.h"
 #include "core/variant/dictionary.h"
@@ -379,6 +381,44 @@ int Image::get_mipmap_count() const {
 	}
 }
 
+// Images with fewer pixels are processed on the calling thread, splitting them costs more than it saves.
+static const int64_t IMAGE_PARALLEL_MIN_PIXELS = 256 * 256;
+
+template <class F>
+struct ImageRowsTask {
+	const F *kernel = nullptr;
+	int height = 0;
+	int rows_per_task = 0;
+
+	static void process(void *p_userdata, uint32_t p_index) {
+		const ImageRowsTask *task = (const ImageRowsTask *)p_userdata;
+		int from = p_index * task->rows_per_task;
+		(*task->kernel)(from, MIN(from + task->rows_per_task, task->height));
+	}
+};
+
+// Calls p_kernel(from_row, to_row) over row ranges covering p_height rows, spread over the worker thread pool for large images.
+// Kernels must only write to the rows they are given.
+template <class F>
+static void _process_rows(int64_t p_pixels, int p_height, const F &p_kernel) {
+	WorkerThreadPool *wtp = WorkerThreadPool::get_singleton();
+	// Pool threads waiting on nested groups can starve the pool, images processed from tasks stay on their thread.
+	if (p_pixels < IMAGE_PARALLEL_MIN_PIXELS || p_height < 2 || wtp == nullptr || wtp->get_thread_count() < 2 || wtp->get_thread_index() >= 0) {
+		p_kernel(0, p_height);
+		return;
+	}
+
+	ImageRowsTask<F> task;
+	task.kernel = &p_kernel;
+	task.height = p_height;
+	int tasks = MIN(p_height, wtp->get_thread_count() * 4);
+	task.rows_per_task = (p_height + tasks - 1) / tasks;
+	tasks = (p_height + task.rows_per_task - 1) / task.rows_per_task;
+
+	WorkerThreadPool::GroupID group = wtp->add_native_group_task(&ImageRowsTask<F>::process, &task, tasks, -1, true, String("ImageProcessRows"));
+	wtp->wait_for_group_task_completion(group);
+}
+
 //using template generates perfectly optimized code due to constant expression reduction and unused variable removal present in all compilers
 template <uint32_t read_bytes, bool read_alpha, uint32_t write_bytes, bool write_alpha, bool read_gray, bool write_gray>
 static void _convert(int p_width, int p_height, const uint8_t *p_src, uint8_t *p_dst) {
@@ -439,24 +479,27 @@ void Image::convert(Format p_new_format) {
 		ERR_FAIL_MSG("Cannot convert to <-> from compressed formats. Use compress() and decompress() instead.");
 
 	} else if (format > FORMAT_RGBA8 || p_new_format > FORMAT_RGBA8) {
-		//use put/set pixel which is slower but works with non byte formats
+		//use get/set color which is slower but works with non byte formats
 		Image new_img(width, height, mipmaps, p_new_format);
 
 		for (int mip = 0; mip < mipmap_count; mip++) {
-			Ref<Image> src_mip = get_image_from_mipmap(mip);
-			Ref<Image> new_mip = new_img.get_image_from_mipmap(mip);
-
-			for (int y = 0; y < src_mip->height; y++) {
-				for (int x = 0; x < src_mip->width; x++) {
-					new_mip->set_pixel(x, y, src_mip->get_pixel(x, y));
-				}
-			}
-
 			int mip_offset = 0;
 			int mip_size = 0;
-			new_img.get_mipmap_offset_and_size(mip, mip_offset, mip_size);
-
-			memcpy(new_img.data.ptrw() + mip_offset, new_mip->data.ptr(), mip_size);
+			int mip_width = 0;
+			int mip_height = 0;
+			get_mipmap_offset_size_and_dimensions(mip, mip_offset, mip_size, mip_width, mip_height);
+
+			const uint8_t *rptr = data.ptr() + mip_offset;
+			uint8_t *wptr = new_img.data.ptrw() + new_img.get_mipmap_offset(mip);
+
+			_process_rows((int64_t)mip_width * mip_height, mip_height, [&](int p_from, int p_to) {
+				for (int y = p_from; y < p_to; y++) {
+					for (int x = 0; x < mip_width; x++) {
+						uint32_t ofs = y * mip_width + x;
+						new_img._set_color_at_ofs(wptr, ofs, _get_color_at_ofs(rptr, ofs));
+					}
+				}
+			});
 		}
 
 		_copy_internals_from(new_img);
@@ -468,7 +511,104 @@ void Image::convert(Format p_new_format) {
 
 	int conversion_type = format | p_new_format << 8;
 
-	for (int mip = 0; mip < mipmap_count; mip++) {
+	void (*convert_func)(int, int, const uint8_t *, uint8_t *) = nullptr;
+	switch (conversion_type) {
+		case FORMAT_L8 | (FORMAT_LA8 << 8):
+			convert_func = _convert<1, false, 1, true, true, true>;
+			break;
+		case FORMAT_L8 | (FORMAT_R8 << 8):
+			convert_func = _convert<1, false, 1, false, true, false>;
+			break;
+		case FORMAT_L8 | (FORMAT_RG8 << 8):
+			convert_func = _convert<1, false, 2, false, true, false>;
+			break;
+		case FORMAT_L8 | (FORMAT_RGB8 << 8):
+			convert_func = _convert<1, false, 3, false, true, false>;
+			break;
+		case FORMAT_L8 | (FORMAT_RGBA8 << 8):
+			convert_func = _convert<1, false, 3, true, true, false>;
+			break;
+		case FORMAT_LA8 | (FORMAT_L8 << 8):
+			convert_func = _convert<1, true, 1, false, true, true>;
+			break;
+		case FORMAT_LA8 | (FORMAT_R8 << 8):
+			convert_func = _convert<1, true, 1, false, true, false>;
+			break;
+		case FORMAT_LA8 | (FORMAT_RG8 << 8):
+			convert_func = _convert<1, true, 2, false, true, false>;
+			break;
+		case FORMAT_LA8 | (FORMAT_RGB8 << 8):
+			convert_func = _convert<1, true, 3, false, true, false>;
+			break;
+		case FORMAT_LA8 | (FORMAT_RGBA8 << 8):
+			convert_func = _convert<1, true, 3, true, true, false>;
+			break;
+		case FORMAT_R8 | (FORMAT_L8 << 8):
+			convert_func = _convert<1, false, 1, false, false, true>;
+			break;
+		case FORMAT_R8 | (FORMAT_LA8 << 8):
+			convert_func = _convert<1, false, 1, true, false, true>;
+			break;
+		case FORMAT_R8 | (FORMAT_RG8 << 8):
+			convert_func = _convert<1, false, 2, false, false, false>;
+			break;
+		case FORMAT_R8 | (FORMAT_RGB8 << 8):
+			convert_func = _convert<1, false, 3, false, false, false>;
+			break;
+		case FORMAT_R8 | (FORMAT_RGBA8 << 8):
+			convert_func = _convert<1, false, 3, true, false, false>;
+			break;
+		case FORMAT_RG8 | (FORMAT_L8 << 8):
+			convert_func = _convert<2, false, 1, false, false, true>;
+			break;
+		case FORMAT_RG8 | (FORMAT_LA8 << 8):
+			convert_func = _convert<2, false, 1, true, false, true>;
+			break;
+		case FORMAT_RG8 | (FORMAT_R8 << 8):
+			convert_func = _convert<2, false, 1, false, false, false>;
+			break;
+		case FORMAT_RG8 | (FORMAT_RGB8 << 8):
+			convert_func = _convert<2, false, 3, false, false, false>;
+			break;
+		case FORMAT_RG8 | (FORMAT_RGBA8 << 8):
+			convert_func = _convert<2, false, 3, true, false, false>;
+			break;
+		case FORMAT_RGB8 | (FORMAT_L8 << 8):
+			convert_func = _convert<3, false, 1, false, false, true>;
+			break;
+		case FORMAT_RGB8 | (FORMAT_LA8 << 8):
+			convert_func = _convert<3, false, 1, true, false, true>;
+			break;
+		case FORMAT_RGB8 | (FORMAT_R8 << 8):
+			convert_func = _convert<3, false, 1, false, false, false>;
+			break;
+		case FORMAT_RGB8 | (FORMAT_RG8 << 8):
+			convert_func = _convert<3, false, 2, false, false, false>;
+			break;
+		case FORMAT_RGB8 | (FORMAT_RGBA8 << 8):
+			convert_func = ImageKernels::convert_rgb8_to_rgba8;
+			break;
+		case FORMAT_RGBA8 | (FORMAT_L8 << 8):
+			convert_func = _convert<3, true, 1, false, false, true>;
+			break;
+		case FORMAT_RGBA8 | (FORMAT_LA8 << 8):
+			convert_func = _convert<3, true, 1, true, false, true>;
+			break;
+		case FORMAT_RGBA8 | (FORMAT_R8 << 8):
+			convert_func = _convert<3, true, 1, false, false, false>;
+			break;
+		case FORMAT_RGBA8 | (FORMAT_RG8 << 8):
+			convert_func = _convert<3, true, 2, false, false, false>;
+			break;
+		case FORMAT_RGBA8 | (FORMAT_RGB8 << 8):
+			convert_func = ImageKernels::convert_rgba8_to_rgb8;
+			break;
+	}
+
+	const int src_pixel_size = get_format_pixel_size(format);
+	const int dst_pixel_size = get_format_pixel_size(p_new_format);
+
+	for (int mip = 0; mip < mipmap_count && convert_func; mip++) {
 		int mip_offset = 0;
 		int mip_size = 0;
 		int mip_width = 0;
@@ -478,98 +618,9 @@ void Image::convert(Format p_new_format) {
 		const uint8_t *rptr = data.ptr() + mip_offset;
 		uint8_t *wptr = new_img.data.ptrw() + new_img.get_mipmap_offset(mip);
 
-		switch (conversion_type) {
-			case FORMAT_L8 | (FORMAT_LA8 << 8):
-				_convert<1, false, 1, true, true, true>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_L8 | (FORMAT_R8 << 8):
-				_convert<1, false, 1, false, true, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_L8 | (FORMAT_RG8 << 8):
-				_convert<1, false, 2, false, true, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_L8 | (FORMAT_RGB8 << 8):
-				_convert<1, false, 3, false, true, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_L8 | (FORMAT_RGBA8 << 8):
-				_convert<1, false, 3, true, true, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_LA8 | (FORMAT_L8 << 8):
-				_convert<1, true, 1, false, true, true>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_LA8 | (FORMAT_R8 << 8):
-				_convert<1, true, 1, false, true, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_LA8 | (FORMAT_RG8 << 8):
-				_convert<1, true, 2, false, true, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_LA8 | (FORMAT_RGB8 << 8):
-				_convert<1, true, 3, false, true, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_LA8 | (FORMAT_RGBA8 << 8):
-				_convert<1, true, 3, true, true, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_R8 | (FORMAT_L8 << 8):
-				_convert<1, false, 1, false, false, true>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_R8 | (FORMAT_LA8 << 8):
-				_convert<1, false, 1, true, false, true>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_R8 | (FORMAT_RG8 << 8):
-				_convert<1, false, 2, false, false, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_R8 | (FORMAT_RGB8 << 8):
-				_convert<1, false, 3, false, false, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_R8 | (FORMAT_RGBA8 << 8):
-				_convert<1, false, 3, true, false, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RG8 | (FORMAT_L8 << 8):
-				_convert<2, false, 1, false, false, true>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RG8 | (FORMAT_LA8 << 8):
-				_convert<2, false, 1, true, false, true>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RG8 | (FORMAT_R8 << 8):
-				_convert<2, false, 1, false, false, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RG8 | (FORMAT_RGB8 << 8):
-				_convert<2, false, 3, false, false, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RG8 | (FORMAT_RGBA8 << 8):
-				_convert<2, false, 3, true, false, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RGB8 | (FORMAT_L8 << 8):
-				_convert<3, false, 1, false, false, true>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RGB8 | (FORMAT_LA8 << 8):
-				_convert<3, false, 1, true, false, true>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RGB8 | (FORMAT_R8 << 8):
-				_convert<3, false, 1, false, false, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RGB8 | (FORMAT_RG8 << 8):
-				_convert<3, false, 2, false, false, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RGB8 | (FORMAT_RGBA8 << 8):
-				_convert<3, false, 3, true, false, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RGBA8 | (FORMAT_L8 << 8):
-				_convert<3, true, 1, false, false, true>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RGBA8 | (FORMAT_LA8 << 8):
-				_convert<3, true, 1, true, false, true>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RGBA8 | (FORMAT_R8 << 8):
-				_convert<3, true, 1, false, false, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RGBA8 | (FORMAT_RG8 << 8):
-				_convert<3, true, 2, false, false, false>(mip_width, mip_height, rptr, wptr);
-				break;
-			case FORMAT_RGBA8 | (FORMAT_RGB8 << 8):
-				_convert<3, true, 3, false, false, false>(mip_width, mip_height, rptr, wptr);
-				break;
-		}
+		_process_rows((int64_t)mip_width * mip_height, mip_height, [&](int p_from, int p_to) {
+			convert_func(mip_width, p_to - p_from, rptr + p_from * mip_width * src_pixel_size, wptr + p_from * mip_width * dst_pixel_size);
+		});
 	}
 
 	_copy_internals_from(new_img);
@@ -594,7 +645,7 @@ static double _bicubic_interp_kernel(double x) {
 }
 
 template <int CC, class T>
-static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_y_from, uint32_t p_dst_y_to) {
 	// get source image size
 	int width = p_src_width;
 	int height = p_src_height;
@@ -609,7 +660,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int xmax = width - 1;
 	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
+	for (uint32_t y = p_dst_y_from; y < p_dst_y_to; y++) {
 		// Y coordinates
 		oy = (double)y * yfac - 0.5f;
 		oy1 = (int)oy;
@@ -681,7 +732,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 }
 
 template <int CC, class T>
-static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_y_from, uint32_t p_dst_y_to) {
 	enum {
 		FRAC_BITS = 8,
 		FRAC_LEN = (1 << FRAC_BITS),
@@ -689,7 +740,7 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 		FRAC_MASK = FRAC_LEN - 1
 	};
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+	for (uint32_t i = p_dst_y_from; i < p_dst_y_to; i++) {
 		// Add 0.5 in order to interpolate based on pixel center
 		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
 		// Calculate nearest src pixel center above current, and truncate to get y index
@@ -771,8 +822,8 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 }
 
 template <int CC, class T>
-static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_y_from, uint32_t p_dst_y_to) {
+	for (uint32_t i = p_dst_y_from; i < p_dst_y_to; i++) {
 		uint32_t src_yofs = i * p_src_height / p_dst_height;
 		uint32_t y_ofs = src_yofs * p_src_width * CC;
 
@@ -791,6 +842,14 @@ static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict
 	}
 }
 
+typedef void (*ImageScaleRowsFunc)(const uint8_t *__restrict, uint8_t *__restrict, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t);
+
+static void _scale_rows(ImageScaleRowsFunc p_func, const uint8_t *p_src, uint8_t *p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_process_rows((int64_t)p_dst_width * p_dst_height, p_dst_height, [&](int p_from, int p_to) {
+		p_func(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height, p_from, p_to);
+	});
+}
+
 #define LANCZOS_TYPE 3
 
 static float _lanczos(float p_x) {
@@ -813,48 +872,61 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 
 		float scale_factor = MAX(x_scale, 1); // A larger kernel is required only when downscaling
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
+		int32_t kernel_size = half_kernel * 2;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		// The kernel of a column is used by all its pixels, create them once for all rows.
+		float *kernels = memnew_arr(float, dst_width * kernel_size);
+		int32_t *kernel_start = memnew_arr(int32_t, dst_width);
+		int32_t *kernel_end = memnew_arr(int32_t, dst_width);
 
 		for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
 			// The corresponding point on the source image
 			float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
-			int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
-			int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
+			kernel_start[buffer_x] = MAX(0, int32_t(src_x) - half_kernel + 1);
+			kernel_end[buffer_x] = MIN(src_width - 1, int32_t(src_x) + half_kernel);
 
-			// Create the kernel used by all the pixels of the column
-			for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-				kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
+			for (int32_t target_x = kernel_start[buffer_x]; target_x <= kernel_end[buffer_x]; target_x++) {
+				kernels[buffer_x * kernel_size + target_x - kernel_start[buffer_x]] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
 			}
+		}
 
-			for (int32_t buffer_y = 0; buffer_y < src_height; buffer_y++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+		_process_rows((int64_t)src_height * dst_width, src_height, [&](int p_from, int p_to) {
+			for (int32_t buffer_y = p_from; buffer_y < p_to; buffer_y++) {
+				for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
+					const float *kernel = kernels + buffer_x * kernel_size;
+					int32_t start_x = kernel_start[buffer_x];
+					int32_t end_x = kernel_end[buffer_x];
 
-				for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-					float lanczos_val = kernel[target_x - start_x];
-					weight += lanczos_val;
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-					const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
+					for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+						float lanczos_val = kernel[target_x - start_x];
+						weight += lanczos_val;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						if constexpr (sizeof(T) == 2) { //half float
-							pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
-						} else {
-							pixel[i] += src_data[i] * lanczos_val;
+						const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
+
+						for (uint32_t i = 0; i < CC; i++) {
+							if constexpr (sizeof(T) == 2) { //half float
+								pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
+							} else {
+								pixel[i] += src_data[i] * lanczos_val;
+							}
 						}
 					}
-				}
 
-				float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
+					float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					for (uint32_t i = 0; i < CC; i++) {
+						dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					}
 				}
 			}
-		}
+		});
 
-		memdelete_arr(kernel);
+		memdelete_arr(kernels);
+		memdelete_arr(kernel_start);
+		memdelete_arr(kernel_end);
 	} // End of first pass
 
 	{ // SECOND PASS (vertical + result)
@@ -864,49 +936,51 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 		float scale_factor = MAX(y_scale, 1);
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		_process_rows((int64_t)dst_height * dst_width, dst_height, [&](int p_from, int p_to) {
+			float *kernel = memnew_arr(float, half_kernel * 2);
 
-		for (int32_t dst_y = 0; dst_y < dst_height; dst_y++) {
-			float buffer_y = (dst_y + 0.5f) * y_scale;
-			int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
-			int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
+			for (int32_t dst_y = p_from; dst_y < p_to; dst_y++) {
+				float buffer_y = (dst_y + 0.5f) * y_scale;
+				int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
+				int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
 
-			for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-				kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
-			}
+				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+					kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
+				}
 
-			for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+				for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-					float lanczos_val = kernel[target_y - start_y];
-					weight += lanczos_val;
+					for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+						float lanczos_val = kernel[target_y - start_y];
+						weight += lanczos_val;
 
-					float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
+						float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						pixel[i] += buffer_data[i] * lanczos_val;
+						for (uint32_t i = 0; i < CC; i++) {
+							pixel[i] += buffer_data[i] * lanczos_val;
+						}
 					}
-				}
-
-				T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					pixel[i] /= weight;
+					T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
 
-					if constexpr (sizeof(T) == 1) { //byte
-						dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
-					} else if constexpr (sizeof(T) == 2) { //half float
-						dst_data[i] = Math::make_half_float(pixel[i]);
-					} else { // float
-						dst_data[i] = pixel[i];
+					for (uint32_t i = 0; i < CC; i++) {
+						pixel[i] /= weight;
+
+						if constexpr (sizeof(T) == 1) { //byte
+							dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
+						} else if constexpr (sizeof(T) == 2) { //half float
+							dst_data[i] = Math::make_half_float(pixel[i]);
+						} else { // float
+							dst_data[i] = pixel[i];
+						}
 					}
 				}
 			}
-		}
 
-		memdelete_arr(kernel);
+			memdelete_arr(kernel);
+		});
 	} // End of second pass
 
 	memdelete_arr(buffer);
@@ -998,47 +1072,47 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 			if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 				switch (get_format_pixel_size(format)) {
 					case 1:
-						_scale_nearest<1, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_nearest<1, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 2:
-						_scale_nearest<2, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_nearest<2, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 3:
-						_scale_nearest<3, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_nearest<3, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_nearest<4, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_nearest<4, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 				switch (get_format_pixel_size(format)) {
 					case 4:
-						_scale_nearest<1, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_nearest<1, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_nearest<2, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_nearest<2, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 12:
-						_scale_nearest<3, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_nearest<3, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 16:
-						_scale_nearest<4, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_nearest<4, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 
 			} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 				switch (get_format_pixel_size(format)) {
 					case 2:
-						_scale_nearest<1, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_nearest<1, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_nearest<2, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_nearest<2, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 6:
-						_scale_nearest<3, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_nearest<3, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_nearest<4, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_nearest<4, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			}
@@ -1085,46 +1159,46 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 				if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 					switch (get_format_pixel_size(format)) {
 						case 1:
-							_scale_bilinear<1, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_rows(_scale_bilinear<1, uint8_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 2:
-							_scale_bilinear<2, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_rows(_scale_bilinear<2, uint8_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 3:
-							_scale_bilinear<3, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_rows(_scale_bilinear<3, uint8_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 4:
-							_scale_bilinear<4, uint8_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_rows(ImageKernels::scale_bilinear_rgba8, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 					switch (get_format_pixel_size(format)) {
 						case 4:
-							_scale_bilinear<1, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_rows(_scale_bilinear<1, float>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 8:
-							_scale_bilinear<2, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_rows(_scale_bilinear<2, float>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 12:
-							_scale_bilinear<3, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_rows(_scale_bilinear<3, float>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 16:
-							_scale_bilinear<4, float>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_rows(_scale_bilinear<4, float>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 					switch (get_format_pixel_size(format)) {
 						case 2:
-							_scale_bilinear<1, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_rows(_scale_bilinear<1, uint16_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 4:
-							_scale_bilinear<2, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_rows(_scale_bilinear<2, uint16_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 6:
-							_scale_bilinear<3, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_rows(_scale_bilinear<3, uint16_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 8:
-							_scale_bilinear<4, uint16_t>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_rows(_scale_bilinear<4, uint16_t>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				}
@@ -1141,46 +1215,46 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 			if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 				switch (get_format_pixel_size(format)) {
 					case 1:
-						_scale_cubic<1, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_cubic<1, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 2:
-						_scale_cubic<2, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_cubic<2, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 3:
-						_scale_cubic<3, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_cubic<3, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_cubic<4, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_cubic<4, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 				switch (get_format_pixel_size(format)) {
 					case 4:
-						_scale_cubic<1, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_cubic<1, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_cubic<2, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_cubic<2, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 12:
-						_scale_cubic<3, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_cubic<3, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 16:
-						_scale_cubic<4, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_cubic<4, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 				switch (get_format_pixel_size(format)) {
 					case 2:
-						_scale_cubic<1, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_cubic<1, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_cubic<2, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_cubic<2, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 6:
-						_scale_cubic<3, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_cubic<3, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_cubic<4, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_rows(_scale_cubic<4, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			}
@@ -2413,6 +2487,15 @@ Error Image::load(const String &p_path) {
 	return ImageLoader::load_image(p_path, this);
 }
 
+Error Image::load_region(const String &p_path, const Rect2i &p_region, int p_shrink) {
+#ifdef DEBUG_ENABLED
+	if (p_path.begins_with("res://") && ResourceLoader::exists(p_path)) {
+		WARN_PRINT("Loaded resource as image file, this will not work on export: '" + p_path + "'. Instead, import the image file as an Image resource and load it normally as a resource.");
+	}
+#endif
+	return ImageLoader::load_image_region(p_path, this, p_region, p_shrink);
+}
+
 Ref<Image> Image::load_from_file(const String &p_path) {
 #ifdef DEBUG_ENABLED
 	if (p_path.begins_with("res://") && ResourceLoader::exists(p_path)) {
@@ -2588,6 +2671,19 @@ Error Image::compress_from_channels(CompressMode p_mode, UsedChannels p_channels
 	return OK;
 }
 
+void Image::set_compression_thread_limit(int p_threads) {
+	compression_thread_limit = MAX(p_threads, 0);
+}
+
+int Image::get_compression_thread_count() {
+	const WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	int threads = pool ? pool->get_thread_count() : 1;
+	if (compression_thread_limit > 0) {
+		threads = MIN(threads, compression_thread_limit);
+	}
+	return MAX(threads, 1);
+}
+
 Image::Image(const char **p_xpm) {
 	width = 0;
 	height = 0;
@@ -2802,23 +2898,42 @@ void Image::blend_rect(const Ref<Image> &p_src, const Rect2i &p_src_rect, const
 	}
 
 	Ref<Image> img = p_src;
+	uint8_t *dst_ptr = data.ptrw();
+	const uint8_t *src_ptr = img->data.ptr();
+
+	// Rows are independent unless the image is blended onto itself.
+	int64_t pixels = (img.ptr() == this) ? 0 : (int64_t)dest_rect.size.x * dest_rect.size.y;
+
+	if (format == FORMAT_RGBA8 && img.ptr() != this) {
+		_process_rows(pixels, dest_rect.size.y, [&](int p_from, int p_to) {
+			for (int i = p_from; i < p_to; i++) {
+				const uint8_t *src_row = src_ptr + ((src_rect.position.y + i) * img->width + src_rect.position.x) * 4;
+				uint8_t *dst_row = dst_ptr + ((dest_rect.position.y + i) * width + dest_rect.position.x) * 4;
+				ImageKernels::blend_rgba8(src_row, dst_row, dest_rect.size.x);
+			}
+		});
+		return;
+	}
 
-	for (int i = 0; i < dest_rect.size.y; i++) {
-		for (int j = 0; j < dest_rect.size.x; j++) {
-			int src_x = src_rect.position.x + j;
-			int src_y = src_rect.position.y + i;
+	_process_rows(pixels, dest_rect.size.y, [&](int p_from, int p_to) {
+		for (int i = p_from; i < p_to; i++) {
+			for (int j = 0; j < dest_rect.size.x; j++) {
+				int src_x = src_rect.position.x + j;
+				int src_y = src_rect.position.y + i;
 
-			int dst_x = dest_rect.position.x + j;
-			int dst_y = dest_rect.position.y + i;
+				int dst_x = dest_rect.position.x + j;
+				int dst_y = dest_rect.position.y + i;
 
-			Color sc = img->get_pixel(src_x, src_y);
-			if (sc.a != 0) {
-				Color dc = get_pixel(dst_x, dst_y);
-				dc = dc.blend(sc);
-				set_pixel(dst_x, dst_y, dc);
+				Color sc = img->_get_color_at_ofs(src_ptr, src_y * img->width + src_x);
+				if (sc.a != 0) {
+					uint32_t dst_ofs = dst_y * width + dst_x;
+					Color dc = _get_color_at_ofs(dst_ptr, dst_ofs);
+					dc = dc.blend(sc);
+					_set_color_at_ofs(dst_ptr, dst_ofs, dc);
+				}
 			}
 		}
-	}
+	});
 }
 
 void Image::blend_rect_mask(const Ref<Image> &p_src, const Ref<Image> &p_mask, const Rect2i &p_src_rect, const Point2i &p_dest) {
@@ -2843,28 +2958,34 @@ void Image::blend_rect_mask(const Ref<Image> &p_src, const Ref<Image> &p_mask, c
 
 	Ref<Image> img = p_src;
 	Ref<Image> msk = p_mask;
-
-	for (int i = 0; i < dest_rect.size.y; i++) {
-		for (int j = 0; j < dest_rect.size.x; j++) {
-			int src_x = src_rect.position.x + j;
-			int src_y = src_rect.position.y + i;
-
-			// If the mask's pixel is transparent then we skip it
-			//Color c = msk->get_pixel(src_x, src_y);
-			//if (c.a == 0) continue;
-			if (msk->get_pixel(src_x, src_y).a != 0) {
-				int dst_x = dest_rect.position.x + j;
-				int dst_y = dest_rect.position.y + i;
-
-				Color sc = img->get_pixel(src_x, src_y);
-				if (sc.a != 0) {
-					Color dc = get_pixel(dst_x, dst_y);
-					dc = dc.blend(sc);
-					set_pixel(dst_x, dst_y, dc);
+	uint8_t *dst_ptr = data.ptrw();
+	const uint8_t *src_ptr = img->data.ptr();
+	const uint8_t *msk_ptr = msk->data.ptr();
+
+	// Rows are independent unless the image is blended onto itself.
+	int64_t pixels = (img.ptr() == this || msk.ptr() == this) ? 0 : (int64_t)dest_rect.size.x * dest_rect.size.y;
+	_process_rows(pixels, dest_rect.size.y, [&](int p_from, int p_to) {
+		for (int i = p_from; i < p_to; i++) {
+			for (int j = 0; j < dest_rect.size.x; j++) {
+				int src_x = src_rect.position.x + j;
+				int src_y = src_rect.position.y + i;
+
+				// If the mask's pixel is transparent then we skip it
+				if (msk->_get_color_at_ofs(msk_ptr, src_y * msk->width + src_x).a != 0) {
+					int dst_x = dest_rect.position.x + j;
+					int dst_y = dest_rect.position.y + i;
+
+					Color sc = img->_get_color_at_ofs(src_ptr, src_y * img->width + src_x);
+					if (sc.a != 0) {
+						uint32_t dst_ofs = dst_y * width + dst_x;
+						Color dc = _get_color_at_ofs(dst_ptr, dst_ofs);
+						dc = dc.blend(sc);
+						_set_color_at_ofs(dst_ptr, dst_ofs, dc);
+					}
 				}
 			}
 		}
-	}
+	});
 }
 
 // Repeats `p_pixel` `p_count` times in consecutive memory.
@@ -2938,6 +3059,7 @@ void (*Image::_image_compress_bptc_func)(Image *, Image::UsedChannels) = nullptr
 void (*Image::_image_compress_etc1_func)(Image *) = nullptr;
 void (*Image::_image_compress_etc2_func)(Image *, Image::UsedChannels) = nullptr;
 void (*Image::_image_compress_astc_func)(Image *, Image::ASTCFormat) = nullptr;
+int Image::compression_thread_limit = 0;
 void (*Image::_image_decompress_bc)(Image *) = nullptr;
 void (*Image::_image_decompress_bptc)(Image *) = nullptr;
 void (*Image::_image_decompress_etc1)(Image *) = nullptr;
@@ -3658,6 +3780,7 @@ void Image::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("is_empty"), &Image::is_empty);
 
 	ClassDB::bind_method(D_METHOD("load", "path"), &Image::load);
+	ClassDB::bind_method(D_METHOD("load_region", "path", "region", "shrink"), &Image::load_region, DEFVAL(1));
 	ClassDB::bind_static_method("Image", D_METHOD("load_from_file", "path"), &Image::load_from_file);
 	ClassDB::bind_method(D_METHOD("save_png", "path"), &Image::save_png);
 	ClassDB::bind_method(D_METHOD("save_png_to_buffer"), &Image::save_png_to_buffer);
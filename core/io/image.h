@@ -155,6 +155,9 @@ public:
 	static void (*_image_compress_etc2_func)(Image *, UsedChannels p_channels);
 	static void (*_image_compress_astc_func)(Image *, ASTCFormat p_format);
 
+	// Maximum number of worker threads texture compressors may use, 0 uses all of them.
+	static int compression_thread_limit;
+
 	static void (*_image_decompress_bc)(Image *);
 	static void (*_image_decompress_bptc)(Image *);
 	static void (*_image_decompress_etc1)(Image *);
@@ -289,6 +292,7 @@ public:
 	Vector<uint8_t> get_data() const;
 
 	Error load(const String &p_path);
+	Error load_region(const String &p_path, const Rect2i &p_region, int p_shrink = 1);
 	static Ref<Image> load_from_file(const String &p_path);
 	Error save_png(const String &p_path) const;
 	Error save_jpg(const String &p_path, float p_quality = 0.75) const;
@@ -355,6 +359,9 @@ public:
 
 	Error compress(CompressMode p_mode, CompressSource p_source = COMPRESS_SOURCE_GENERIC, ASTCFormat p_astc_format = ASTC_FORMAT_4x4);
 	Error compress_from_channels(CompressMode p_mode, UsedChannels p_channels, ASTCFormat p_astc_format = ASTC_FORMAT_4x4);
+
+	static void set_compression_thread_limit(int p_threads);
+	static int get_compression_thread_count();
 	Error decompress();
 	bool is_compressed() const;
 
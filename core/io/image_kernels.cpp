@@ -0,0 +1,633 @@
+/**************************************************************************/
+/*  image_kernels.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "image_kernels.h"
+
+#include "core/error/error_macros.h"
+#include "core/math/color.h"
+#include "core/os/memory.h"
+
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define IMAGE_KERNELS_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+// MSVC accepts any intrinsic without a target attribute.
+#define IMAGE_KERNELS_TARGET(m_isa)
+#else
+#define IMAGE_KERNELS_TARGET(m_isa) __attribute__((target(m_isa)))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+// NEON is always available on AArch64.
+#define IMAGE_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+int ImageKernels::level = -1;
+
+ImageKernels::Level ImageKernels::_detect_level() {
+#if defined(IMAGE_KERNELS_X86)
+#ifdef _MSC_VER
+	int info[4];
+	__cpuid(info, 0);
+	const int max_leaf = info[0];
+	__cpuid(info, 1);
+	const bool sse4_1 = info[2] & (1 << 19);
+	// AVX registers can only be used when the OS saves them (OSXSAVE, then XCR0 bits 1 and 2).
+	const bool avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6;
+	bool avx2 = false;
+	if (avx && max_leaf >= 7) {
+		__cpuidex(info, 7, 0);
+		avx2 = info[1] & (1 << 5);
+	}
+#else
+	__builtin_cpu_init();
+	const bool sse4_1 = __builtin_cpu_supports("sse4.1");
+	const bool avx2 = __builtin_cpu_supports("avx2");
+#endif
+	if (avx2) {
+		return LEVEL_AVX2;
+	}
+	if (sse4_1) {
+		return LEVEL_SSE4_1;
+	}
+	return LEVEL_SCALAR;
+#elif defined(IMAGE_KERNELS_NEON)
+	return LEVEL_NEON;
+#else
+	return LEVEL_SCALAR;
+#endif
+}
+
+bool ImageKernels::is_level_supported(Level p_level) {
+	const Level detected = _detect_level();
+	switch (p_level) {
+		case LEVEL_SCALAR:
+			return true;
+		case LEVEL_SSE4_1:
+			return detected == LEVEL_SSE4_1 || detected == LEVEL_AVX2;
+		case LEVEL_AVX2:
+		case LEVEL_NEON:
+			return detected == p_level;
+		default:
+			return false;
+	}
+}
+
+const char *ImageKernels::get_level_name(Level p_level) {
+	static const char *names[LEVEL_MAX] = { "Scalar", "SSE4.1", "AVX2", "NEON" };
+	ERR_FAIL_INDEX_V(p_level, LEVEL_MAX, "");
+	return names[p_level];
+}
+
+ImageKernels::Level ImageKernels::get_level() {
+	if (level < 0) {
+		level = _detect_level();
+	}
+	return Level(level);
+}
+
+void ImageKernels::set_level(Level p_level) {
+	if (p_level == LEVEL_MAX) {
+		level = _detect_level();
+		return;
+	}
+	ERR_FAIL_COND_MSG(!is_level_supported(p_level), "This CPU doesn't support the requested image kernel level.");
+	level = p_level;
+}
+
+static _FORCE_INLINE_ uint32_t _load_u32(const uint8_t *p_ptr) {
+	uint32_t value;
+	memcpy(&value, p_ptr, sizeof(uint32_t));
+	return value;
+}
+
+/* CONVERT */
+
+// The SIMD versions process whole blocks and return how many pixels they did, the scalar ones finish the rest.
+
+static void _convert_rgba8_to_rgb8_scalar(const uint8_t *p_src, uint8_t *p_dst, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i * 3 + 0] = p_src[i * 4 + 0];
+		p_dst[i * 3 + 1] = p_src[i * 4 + 1];
+		p_dst[i * 3 + 2] = p_src[i * 4 + 2];
+	}
+}
+
+static void _convert_rgb8_to_rgba8_scalar(const uint8_t *p_src, uint8_t *p_dst, int64_t p_count) {
+	for (int64_t i = 0; i < p_count; i++) {
+		p_dst[i * 4 + 0] = p_src[i * 3 + 0];
+		p_dst[i * 4 + 1] = p_src[i * 3 + 1];
+		p_dst[i * 4 + 2] = p_src[i * 3 + 2];
+		p_dst[i * 4 + 3] = 255;
+	}
+}
+
+#ifdef IMAGE_KERNELS_X86
+// Byte shuffles gain nothing from 256-bit registers here, the AVX2 level uses these too.
+
+IMAGE_KERNELS_TARGET("sse4.1")
+static int64_t _convert_rgba8_to_rgb8_sse4_1(const uint8_t *p_src, uint8_t *p_dst, int64_t p_count) {
+	const __m128i pack = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+	int64_t i = 0;
+	for (; i + 16 <= p_count; i += 16) {
+		// 16 pixels, each register holds the RGB of 4 of them in its first 12 bytes.
+		const __m128i *src = (const __m128i *)(p_src + i * 4);
+		__m128i a = _mm_shuffle_epi8(_mm_loadu_si128(src + 0), pack);
+		__m128i b = _mm_shuffle_epi8(_mm_loadu_si128(src + 1), pack);
+		__m128i c = _mm_shuffle_epi8(_mm_loadu_si128(src + 2), pack);
+		__m128i d = _mm_shuffle_epi8(_mm_loadu_si128(src + 3), pack);
+
+		__m128i *dst = (__m128i *)(p_dst + i * 3);
+		_mm_storeu_si128(dst + 0, _mm_or_si128(a, _mm_slli_si128(b, 12)));
+		_mm_storeu_si128(dst + 1, _mm_or_si128(_mm_srli_si128(b, 4), _mm_slli_si128(c, 8)));
+		_mm_storeu_si128(dst + 2, _mm_or_si128(_mm_srli_si128(c, 8), _mm_slli_si128(d, 4)));
+	}
+	return i;
+}
+
+IMAGE_KERNELS_TARGET("sse4.1")
+static int64_t _convert_rgb8_to_rgba8_sse4_1(const uint8_t *p_src, uint8_t *p_dst, int64_t p_count) {
+	const __m128i unpack = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+	const __m128i alpha = _mm_set1_epi32(int(0xFF000000));
+	int64_t i = 0;
+	for (; i + 16 <= p_count; i += 16) {
+		const __m128i *src = (const __m128i *)(p_src + i * 3);
+		__m128i a = _mm_loadu_si128(src + 0);
+		__m128i b = _mm_loadu_si128(src + 1);
+		__m128i c = _mm_loadu_si128(src + 2);
+
+		// Bring the 12 bytes of each group of 4 pixels to the start of a register.
+		__m128i *dst = (__m128i *)(p_dst + i * 4);
+		_mm_storeu_si128(dst + 0, _mm_or_si128(_mm_shuffle_epi8(a, unpack), alpha));
+		_mm_storeu_si128(dst + 1, _mm_or_si128(_mm_shuffle_epi8(_mm_alignr_epi8(b, a, 12), unpack), alpha));
+		_mm_storeu_si128(dst + 2, _mm_or_si128(_mm_shuffle_epi8(_mm_alignr_epi8(c, b, 8), unpack), alpha));
+		_mm_storeu_si128(dst + 3, _mm_or_si128(_mm_shuffle_epi8(_mm_srli_si128(c, 4), unpack), alpha));
+	}
+	return i;
+}
+#endif // IMAGE_KERNELS_X86
+
+#ifdef IMAGE_KERNELS_NEON
+static int64_t _convert_rgba8_to_rgb8_neon(const uint8_t *p_src, uint8_t *p_dst, int64_t p_count) {
+	int64_t i = 0;
+	for (; i + 16 <= p_count; i += 16) {
+		uint8x16x4_t rgba = vld4q_u8(p_src + i * 4);
+		uint8x16x3_t rgb;
+		rgb.val[0] = rgba.val[0];
+		rgb.val[1] = rgba.val[1];
+		rgb.val[2] = rgba.val[2];
+		vst3q_u8(p_dst + i * 3, rgb);
+	}
+	return i;
+}
+
+static int64_t _convert_rgb8_to_rgba8_neon(const uint8_t *p_src, uint8_t *p_dst, int64_t p_count) {
+	int64_t i = 0;
+	for (; i + 16 <= p_count; i += 16) {
+		uint8x16x3_t rgb = vld3q_u8(p_src + i * 3);
+		uint8x16x4_t rgba;
+		rgba.val[0] = rgb.val[0];
+		rgba.val[1] = rgb.val[1];
+		rgba.val[2] = rgb.val[2];
+		rgba.val[3] = vdupq_n_u8(255);
+		vst4q_u8(p_dst + i * 4, rgba);
+	}
+	return i;
+}
+#endif // IMAGE_KERNELS_NEON
+
+void ImageKernels::convert_rgba8_to_rgb8(int p_width, int p_height, const uint8_t *p_src, uint8_t *p_dst) {
+	const int64_t count = (int64_t)p_width * p_height;
+	int64_t done = 0;
+	switch (get_level()) {
+#ifdef IMAGE_KERNELS_X86
+		case LEVEL_SSE4_1:
+		case LEVEL_AVX2:
+			done = _convert_rgba8_to_rgb8_sse4_1(p_src, p_dst, count);
+			break;
+#endif
+#ifdef IMAGE_KERNELS_NEON
+		case LEVEL_NEON:
+			done = _convert_rgba8_to_rgb8_neon(p_src, p_dst, count);
+			break;
+#endif
+		default:
+			break;
+	}
+	_convert_rgba8_to_rgb8_scalar(p_src + done * 4, p_dst + done * 3, count - done);
+}
+
+void ImageKernels::convert_rgb8_to_rgba8(int p_width, int p_height, const uint8_t *p_src, uint8_t *p_dst) {
+	const int64_t count = (int64_t)p_width * p_height;
+	int64_t done = 0;
+	switch (get_level()) {
+#ifdef IMAGE_KERNELS_X86
+		case LEVEL_SSE4_1:
+		case LEVEL_AVX2:
+			done = _convert_rgb8_to_rgba8_sse4_1(p_src, p_dst, count);
+			break;
+#endif
+#ifdef IMAGE_KERNELS_NEON
+		case LEVEL_NEON:
+			done = _convert_rgb8_to_rgba8_neon(p_src, p_dst, count);
+			break;
+#endif
+		default:
+			break;
+	}
+	_convert_rgb8_to_rgba8_scalar(p_src + done * 3, p_dst + done * 4, count - done);
+}
+
+/* BILINEAR */
+
+// 8 bits of subpixel precision, like _scale_bilinear() in image.cpp.
+enum {
+	BILINEAR_FRAC_BITS = 8,
+	BILINEAR_FRAC_LEN = (1 << BILINEAR_FRAC_BITS),
+	BILINEAR_FRAC_HALF = (BILINEAR_FRAC_LEN >> 1),
+	BILINEAR_FRAC_MASK = BILINEAR_FRAC_LEN - 1
+};
+
+struct BilinearColumn {
+	uint32_t left = 0; // Byte offsets in a source row.
+	uint32_t right = 0;
+	uint32_t weights = 0; // The weight of the right pixel in the high 16 bits, the one of the left pixel in the low ones.
+};
+
+// The two source pixels around the center of destination pixel p_dst, and how close it is to the second one.
+static _FORCE_INLINE_ void _bilinear_sample(uint32_t p_dst, uint32_t p_src_size, uint32_t p_dst_size, uint32_t &r_from, uint32_t &r_to, uint32_t &r_frac) {
+	uint32_t fp = (p_dst + 0.5) * p_src_size * BILINEAR_FRAC_LEN / p_dst_size;
+	r_from = fp >= BILINEAR_FRAC_HALF ? (fp - BILINEAR_FRAC_HALF) >> BILINEAR_FRAC_BITS : 0;
+	r_to = (fp + BILINEAR_FRAC_HALF) >> BILINEAR_FRAC_BITS;
+	if (r_to >= p_src_size) {
+		r_to = p_src_size - 1;
+	}
+	r_frac = fp & BILINEAR_FRAC_MASK;
+	r_frac = r_frac >= BILINEAR_FRAC_HALF ? r_frac - BILINEAR_FRAC_HALF : r_frac + BILINEAR_FRAC_HALF;
+}
+
+// The fixed point steps of _scale_bilinear() add up to (sum of pixel * x weight * y weight) >> 16, which is what all versions compute.
+static void _scale_bilinear_row_scalar(const uint8_t *p_up, const uint8_t *p_down, const BilinearColumn *p_columns, uint32_t p_from, uint32_t p_to, uint32_t p_fy, uint8_t *p_dst) {
+	for (uint32_t j = p_from; j < p_to; j++) {
+		const BilinearColumn &column = p_columns[j];
+		const uint32_t fx = column.weights >> 16;
+		for (uint32_t l = 0; l < 4; l++) {
+			uint32_t up = p_up[column.left + l] * (BILINEAR_FRAC_LEN - fx) + p_up[column.right + l] * fx;
+			uint32_t down = p_down[column.left + l] * (BILINEAR_FRAC_LEN - fx) + p_down[column.right + l] * fx;
+			p_dst[j * 4 + l] = uint8_t((up * (BILINEAR_FRAC_LEN - p_fy) + down * p_fy) >> 16);
+		}
+	}
+}
+
+#ifdef IMAGE_KERNELS_X86
+// The left and right pixels are interleaved as 16-bit values, so a multiply-add applies both horizontal weights at once.
+
+IMAGE_KERNELS_TARGET("sse4.1")
+static _FORCE_INLINE_ __m128i _bilinear_pixel_sse4_1(const uint8_t *p_up, const uint8_t *p_down, const BilinearColumn &p_column, __m128i p_fy) {
+	const __m128i weights = _mm_set1_epi32(int(p_column.weights));
+	__m128i up = _mm_unpacklo_epi8(_mm_cvtsi32_si128(int(_load_u32(p_up + p_column.left))), _mm_cvtsi32_si128(int(_load_u32(p_up + p_column.right))));
+	__m128i down = _mm_unpacklo_epi8(_mm_cvtsi32_si128(int(_load_u32(p_down + p_column.left))), _mm_cvtsi32_si128(int(_load_u32(p_down + p_column.right))));
+	up = _mm_madd_epi16(_mm_cvtepu8_epi16(up), weights);
+	down = _mm_madd_epi16(_mm_cvtepu8_epi16(down), weights);
+	// up * (256 - fy) + down * fy, both are at most 65280 so this can't overflow.
+	__m128i sum = _mm_add_epi32(_mm_slli_epi32(up, BILINEAR_FRAC_BITS), _mm_mullo_epi32(_mm_sub_epi32(down, up), p_fy));
+	return _mm_srli_epi32(sum, 16);
+}
+
+IMAGE_KERNELS_TARGET("sse4.1")
+static uint32_t _scale_bilinear_row_sse4_1(const uint8_t *p_up, const uint8_t *p_down, const BilinearColumn *p_columns, uint32_t p_width, uint32_t p_fy, uint8_t *p_dst) {
+	const __m128i fy = _mm_set1_epi32(int(p_fy));
+	uint32_t j = 0;
+	for (; j + 4 <= p_width; j += 4) {
+		__m128i a = _bilinear_pixel_sse4_1(p_up, p_down, p_columns[j + 0], fy);
+		__m128i b = _bilinear_pixel_sse4_1(p_up, p_down, p_columns[j + 1], fy);
+		__m128i c = _bilinear_pixel_sse4_1(p_up, p_down, p_columns[j + 2], fy);
+		__m128i d = _bilinear_pixel_sse4_1(p_up, p_down, p_columns[j + 3], fy);
+		_mm_storeu_si128((__m128i *)(p_dst + j * 4), _mm_packus_epi16(_mm_packus_epi32(a, b), _mm_packus_epi32(c, d)));
+	}
+	return j;
+}
+
+// Two pixels per register, the first one in the low 128 bits.
+IMAGE_KERNELS_TARGET("avx2")
+static _FORCE_INLINE_ __m256i _bilinear_pixels_avx2(const uint8_t *p_up, const uint8_t *p_down, const BilinearColumn &p_first, const BilinearColumn &p_second, __m256i p_fy) {
+	const __m256i weights = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_set1_epi32(int(p_first.weights))), _mm_set1_epi32(int(p_second.weights)), 1);
+	__m128i up_first = _mm_unpacklo_epi8(_mm_cvtsi32_si128(int(_load_u32(p_up + p_first.left))), _mm_cvtsi32_si128(int(_load_u32(p_up + p_first.right))));
+	__m128i up_second = _mm_unpacklo_epi8(_mm_cvtsi32_si128(int(_load_u32(p_up + p_second.left))), _mm_cvtsi32_si128(int(_load_u32(p_up + p_second.right))));
+	__m128i down_first = _mm_unpacklo_epi8(_mm_cvtsi32_si128(int(_load_u32(p_down + p_first.left))), _mm_cvtsi32_si128(int(_load_u32(p_down + p_first.right))));
+	__m128i down_second = _mm_unpacklo_epi8(_mm_cvtsi32_si128(int(_load_u32(p_down + p_second.left))), _mm_cvtsi32_si128(int(_load_u32(p_down + p_second.right))));
+	__m256i up = _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm_unpacklo_epi64(up_first, up_second)), weights);
+	__m256i down = _mm256_madd_epi16(_mm256_cvtepu8_epi16(_mm_unpacklo_epi64(down_first, down_second)), weights);
+	__m256i sum = _mm256_add_epi32(_mm256_slli_epi32(up, BILINEAR_FRAC_BITS), _mm256_mullo_epi32(_mm256_sub_epi32(down, up), p_fy));
+	return _mm256_srli_epi32(sum, 16);
+}
+
+IMAGE_KERNELS_TARGET("avx2")
+static uint32_t _scale_bilinear_row_avx2(const uint8_t *p_up, const uint8_t *p_down, const BilinearColumn *p_columns, uint32_t p_width, uint32_t p_fy, uint8_t *p_dst) {
+	const __m256i fy = _mm256_set1_epi32(int(p_fy));
+	uint32_t j = 0;
+	for (; j + 4 <= p_width; j += 4) {
+		__m256i ab = _bilinear_pixels_avx2(p_up, p_down, p_columns[j + 0], p_columns[j + 1], fy);
+		__m256i cd = _bilinear_pixels_avx2(p_up, p_down, p_columns[j + 2], p_columns[j + 3], fy);
+		// Packing works within 128-bit lanes and gives a, c, b, d, put them back in order.
+		__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(ab, cd), 0xD8);
+		_mm_storeu_si128((__m128i *)(p_dst + j * 4), _mm_packus_epi16(_mm256_castsi256_si128(packed), _mm256_extracti128_si256(packed, 1)));
+	}
+	return j;
+}
+#endif // IMAGE_KERNELS_X86
+
+#ifdef IMAGE_KERNELS_NEON
+static _FORCE_INLINE_ uint32x4_t _bilinear_pixel_neon(const uint8_t *p_up, const uint8_t *p_down, const BilinearColumn &p_column, uint32_t p_fy) {
+	const uint16_t fx = p_column.weights >> 16;
+	const uint16_t inv_fx = p_column.weights & 0xFFFF;
+	// Left pixel in the low half, right pixel in the high half.
+	uint16x8_t up = vmovl_u8(vcreate_u8(uint64_t(_load_u32(p_up + p_column.left)) | (uint64_t(_load_u32(p_up + p_column.right)) << 32)));
+	uint16x8_t down = vmovl_u8(vcreate_u8(uint64_t(_load_u32(p_down + p_column.left)) | (uint64_t(_load_u32(p_down + p_column.right)) << 32)));
+	uint32x4_t up_sum = vmlal_n_u16(vmull_n_u16(vget_low_u16(up), inv_fx), vget_high_u16(up), fx);
+	uint32x4_t down_sum = vmlal_n_u16(vmull_n_u16(vget_low_u16(down), inv_fx), vget_high_u16(down), fx);
+	uint32x4_t sum = vmlaq_n_u32(vmulq_n_u32(up_sum, BILINEAR_FRAC_LEN - p_fy), down_sum, p_fy);
+	return vshrq_n_u32(sum, 16);
+}
+
+static uint32_t _scale_bilinear_row_neon(const uint8_t *p_up, const uint8_t *p_down, const BilinearColumn *p_columns, uint32_t p_width, uint32_t p_fy, uint8_t *p_dst) {
+	uint32_t j = 0;
+	for (; j + 4 <= p_width; j += 4) {
+		uint16x8_t ab = vcombine_u16(vmovn_u32(_bilinear_pixel_neon(p_up, p_down, p_columns[j + 0], p_fy)), vmovn_u32(_bilinear_pixel_neon(p_up, p_down, p_columns[j + 1], p_fy)));
+		uint16x8_t cd = vcombine_u16(vmovn_u32(_bilinear_pixel_neon(p_up, p_down, p_columns[j + 2], p_fy)), vmovn_u32(_bilinear_pixel_neon(p_up, p_down, p_columns[j + 3], p_fy)));
+		vst1q_u8(p_dst + j * 4, vcombine_u8(vmovn_u16(ab), vmovn_u16(cd)));
+	}
+	return j;
+}
+#endif // IMAGE_KERNELS_NEON
+
+void ImageKernels::scale_bilinear_rgba8(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_y_from, uint32_t p_dst_y_to) {
+	// The horizontal samples are the same for every row.
+	BilinearColumn *columns = memnew_arr(BilinearColumn, p_dst_width);
+	for (uint32_t j = 0; j < p_dst_width; j++) {
+		uint32_t left, right, frac;
+		_bilinear_sample(j, p_src_width, p_dst_width, left, right, frac);
+		columns[j].left = left * 4;
+		columns[j].right = right * 4;
+		columns[j].weights = (frac << 16) | (BILINEAR_FRAC_LEN - frac);
+	}
+
+	const Level current_level = get_level();
+	for (uint32_t i = p_dst_y_from; i < p_dst_y_to; i++) {
+		uint32_t up, down, fy;
+		_bilinear_sample(i, p_src_height, p_dst_height, up, down, fy);
+		const uint8_t *row_up = p_src + (size_t)up * p_src_width * 4;
+		const uint8_t *row_down = p_src + (size_t)down * p_src_width * 4;
+		uint8_t *row_dst = p_dst + (size_t)i * p_dst_width * 4;
+
+		uint32_t done = 0;
+		switch (current_level) {
+#ifdef IMAGE_KERNELS_X86
+			case LEVEL_SSE4_1:
+				done = _scale_bilinear_row_sse4_1(row_up, row_down, columns, p_dst_width, fy, row_dst);
+				break;
+			case LEVEL_AVX2:
+				done = _scale_bilinear_row_avx2(row_up, row_down, columns, p_dst_width, fy, row_dst);
+				break;
+#endif
+#ifdef IMAGE_KERNELS_NEON
+			case LEVEL_NEON:
+				done = _scale_bilinear_row_neon(row_up, row_down, columns, p_dst_width, fy, row_dst);
+				break;
+#endif
+			default:
+				break;
+		}
+		_scale_bilinear_row_scalar(row_up, row_down, columns, done, p_dst_width, fy, row_dst);
+	}
+
+	memdelete_arr(columns);
+}
+
+/* BLEND */
+
+static void _blend_rgba8_scalar(const uint8_t *p_src, uint8_t *p_dst, int p_count) {
+	for (int i = 0; i < p_count; i++) {
+		const uint8_t *src = p_src + i * 4;
+		if (src[3] == 0) {
+			continue;
+		}
+		uint8_t *dst = p_dst + i * 4;
+
+		// Same conversions as Image::_get_color_at_ofs() and Image::_set_color_at_ofs().
+		Color sc = Color(src[0] / 255.0, src[1] / 255.0, src[2] / 255.0, src[3] / 255.0);
+		Color dc = Color(dst[0] / 255.0, dst[1] / 255.0, dst[2] / 255.0, dst[3] / 255.0);
+		dc = dc.blend(sc);
+		dst[0] = uint8_t(CLAMP(dc.r * 255.0, 0, 255));
+		dst[1] = uint8_t(CLAMP(dc.g * 255.0, 0, 255));
+		dst[2] = uint8_t(CLAMP(dc.b * 255.0, 0, 255));
+		dst[3] = uint8_t(CLAMP(dc.a * 255.0, 0, 255));
+	}
+}
+
+// The SIMD versions follow the same float steps as Color::blend(), and convert back in double precision like the scalar code,
+// so the results match it. Lanes with zero source alpha keep the destination pixel.
+
+#ifdef IMAGE_KERNELS_X86
+IMAGE_KERNELS_TARGET("sse4.1")
+static _FORCE_INLINE_ __m128i _blend_channel_to_byte_sse4_1(__m128 p_value) {
+	const __m128d scale = _mm_set1_pd(255.0);
+	const __m128d zero = _mm_setzero_pd();
+	__m128d low = _mm_min_pd(_mm_max_pd(_mm_mul_pd(_mm_cvtps_pd(p_value), scale), zero), scale);
+	__m128d high = _mm_min_pd(_mm_max_pd(_mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(p_value, p_value)), scale), zero), scale);
+	return _mm_unpacklo_epi64(_mm_cvttpd_epi32(low), _mm_cvttpd_epi32(high));
+}
+
+IMAGE_KERNELS_TARGET("sse4.1")
+static int _blend_rgba8_sse4_1(const uint8_t *p_src, uint8_t *p_dst, int p_count) {
+	const __m128i byte_mask = _mm_set1_epi32(0xFF);
+	const __m128 max_value = _mm_set1_ps(255.0f);
+	const __m128 one = _mm_set1_ps(1.0f);
+	int i = 0;
+	for (; i + 4 <= p_count; i += 4) {
+		__m128i src = _mm_loadu_si128((const __m128i *)(p_src + i * 4));
+		__m128i src_alpha = _mm_srli_epi32(src, 24);
+		__m128i keep = _mm_cmpeq_epi32(src_alpha, _mm_setzero_si128());
+		if (_mm_movemask_epi8(keep) == 0xFFFF) {
+			continue;
+		}
+		__m128i dst = _mm_loadu_si128((const __m128i *)(p_dst + i * 4));
+
+		__m128 sr = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(src, byte_mask)), max_value);
+		__m128 sg = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(src, 8), byte_mask)), max_value);
+		__m128 sb = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(src, 16), byte_mask)), max_value);
+		__m128 sa = _mm_div_ps(_mm_cvtepi32_ps(src_alpha), max_value);
+		__m128 dr = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(dst, byte_mask)), max_value);
+		__m128 dg = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(dst, 8), byte_mask)), max_value);
+		__m128 db = _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(dst, 16), byte_mask)), max_value);
+		__m128 da = _mm_div_ps(_mm_cvtepi32_ps(_mm_srli_epi32(dst, 24)), max_value);
+
+		__m128 inv_sa = _mm_sub_ps(one, sa);
+		__m128 dst_weight = _mm_mul_ps(da, inv_sa);
+		__m128 ra = _mm_add_ps(dst_weight, sa);
+		__m128 rr = _mm_div_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(dr, da), inv_sa), _mm_mul_ps(sr, sa)), ra);
+		__m128 rg = _mm_div_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(dg, da), inv_sa), _mm_mul_ps(sg, sa)), ra);
+		__m128 rb = _mm_div_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(db, da), inv_sa), _mm_mul_ps(sb, sa)), ra);
+
+		__m128i result = _blend_channel_to_byte_sse4_1(rr);
+		result = _mm_or_si128(result, _mm_slli_epi32(_blend_channel_to_byte_sse4_1(rg), 8));
+		result = _mm_or_si128(result, _mm_slli_epi32(_blend_channel_to_byte_sse4_1(rb), 16));
+		result = _mm_or_si128(result, _mm_slli_epi32(_blend_channel_to_byte_sse4_1(ra), 24));
+		_mm_storeu_si128((__m128i *)(p_dst + i * 4), _mm_blendv_epi8(result, dst, keep));
+	}
+	return i;
+}
+
+IMAGE_KERNELS_TARGET("avx2")
+static _FORCE_INLINE_ __m256i _blend_channel_to_byte_avx2(__m256 p_value) {
+	const __m256d scale = _mm256_set1_pd(255.0);
+	const __m256d zero = _mm256_setzero_pd();
+	__m256d low = _mm256_min_pd(_mm256_max_pd(_mm256_mul_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(p_value)), scale), zero), scale);
+	__m256d high = _mm256_min_pd(_mm256_max_pd(_mm256_mul_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(p_value, 1)), scale), zero), scale);
+	return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm256_cvttpd_epi32(low)), _mm256_cvttpd_epi32(high), 1);
+}
+
+IMAGE_KERNELS_TARGET("avx2")
+static int _blend_rgba8_avx2(const uint8_t *p_src, uint8_t *p_dst, int p_count) {
+	const __m256i byte_mask = _mm256_set1_epi32(0xFF);
+	const __m256 max_value = _mm256_set1_ps(255.0f);
+	const __m256 one = _mm256_set1_ps(1.0f);
+	int i = 0;
+	for (; i + 8 <= p_count; i += 8) {
+		__m256i src = _mm256_loadu_si256((const __m256i *)(p_src + i * 4));
+		__m256i src_alpha = _mm256_srli_epi32(src, 24);
+		__m256i keep = _mm256_cmpeq_epi32(src_alpha, _mm256_setzero_si256());
+		if (_mm256_movemask_epi8(keep) == -1) {
+			continue;
+		}
+		__m256i dst = _mm256_loadu_si256((const __m256i *)(p_dst + i * 4));
+
+		__m256 sr = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_and_si256(src, byte_mask)), max_value);
+		__m256 sg = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(src, 8), byte_mask)), max_value);
+		__m256 sb = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(src, 16), byte_mask)), max_value);
+		__m256 sa = _mm256_div_ps(_mm256_cvtepi32_ps(src_alpha), max_value);
+		__m256 dr = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_and_si256(dst, byte_mask)), max_value);
+		__m256 dg = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(dst, 8), byte_mask)), max_value);
+		__m256 db = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(dst, 16), byte_mask)), max_value);
+		__m256 da = _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(dst, 24)), max_value);
+
+		__m256 inv_sa = _mm256_sub_ps(one, sa);
+		__m256 dst_weight = _mm256_mul_ps(da, inv_sa);
+		__m256 ra = _mm256_add_ps(dst_weight, sa);
+		__m256 rr = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(dr, da), inv_sa), _mm256_mul_ps(sr, sa)), ra);
+		__m256 rg = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(dg, da), inv_sa), _mm256_mul_ps(sg, sa)), ra);
+		__m256 rb = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(db, da), inv_sa), _mm256_mul_ps(sb, sa)), ra);
+
+		__m256i result = _blend_channel_to_byte_avx2(rr);
+		result = _mm256_or_si256(result, _mm256_slli_epi32(_blend_channel_to_byte_avx2(rg), 8));
+		result = _mm256_or_si256(result, _mm256_slli_epi32(_blend_channel_to_byte_avx2(rb), 16));
+		result = _mm256_or_si256(result, _mm256_slli_epi32(_blend_channel_to_byte_avx2(ra), 24));
+		_mm256_storeu_si256((__m256i *)(p_dst + i * 4), _mm256_blendv_epi8(result, dst, keep));
+	}
+	return i;
+}
+#endif // IMAGE_KERNELS_X86
+
+#ifdef IMAGE_KERNELS_NEON
+static _FORCE_INLINE_ uint32x4_t _blend_channel_to_byte_neon(float32x4_t p_value) {
+	const float64x2_t scale = vdupq_n_f64(255.0);
+	const float64x2_t zero = vdupq_n_f64(0.0);
+	float64x2_t low = vminq_f64(vmaxq_f64(vmulq_f64(vcvt_f64_f32(vget_low_f32(p_value)), scale), zero), scale);
+	float64x2_t high = vminq_f64(vmaxq_f64(vmulq_f64(vcvt_high_f64_f32(p_value), scale), zero), scale);
+	return vcombine_u32(vmovn_u64(vcvtq_u64_f64(low)), vmovn_u64(vcvtq_u64_f64(high)));
+}
+
+static int _blend_rgba8_neon(const uint8_t *p_src, uint8_t *p_dst, int p_count) {
+	const uint32x4_t byte_mask = vdupq_n_u32(0xFF);
+	const float32x4_t max_value = vdupq_n_f32(255.0f);
+	const float32x4_t one = vdupq_n_f32(1.0f);
+	int i = 0;
+	for (; i + 4 <= p_count; i += 4) {
+		uint32x4_t src = vreinterpretq_u32_u8(vld1q_u8(p_src + i * 4));
+		uint32x4_t src_alpha = vshrq_n_u32(src, 24);
+		uint32x4_t keep = vceqq_u32(src_alpha, vdupq_n_u32(0));
+		if (vminvq_u32(keep) != 0) {
+			continue;
+		}
+		uint32x4_t dst = vreinterpretq_u32_u8(vld1q_u8(p_dst + i * 4));
+
+		float32x4_t sr = vdivq_f32(vcvtq_f32_u32(vandq_u32(src, byte_mask)), max_value);
+		float32x4_t sg = vdivq_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(src, 8), byte_mask)), max_value);
+		float32x4_t sb = vdivq_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(src, 16), byte_mask)), max_value);
+		float32x4_t sa = vdivq_f32(vcvtq_f32_u32(src_alpha), max_value);
+		float32x4_t dr = vdivq_f32(vcvtq_f32_u32(vandq_u32(dst, byte_mask)), max_value);
+		float32x4_t dg = vdivq_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(dst, 8), byte_mask)), max_value);
+		float32x4_t db = vdivq_f32(vcvtq_f32_u32(vandq_u32(vshrq_n_u32(dst, 16), byte_mask)), max_value);
+		float32x4_t da = vdivq_f32(vcvtq_f32_u32(vshrq_n_u32(dst, 24)), max_value);
+
+		float32x4_t inv_sa = vsubq_f32(one, sa);
+		float32x4_t dst_weight = vmulq_f32(da, inv_sa);
+		float32x4_t ra = vaddq_f32(dst_weight, sa);
+		float32x4_t rr = vdivq_f32(vaddq_f32(vmulq_f32(vmulq_f32(dr, da), inv_sa), vmulq_f32(sr, sa)), ra);
+		float32x4_t rg = vdivq_f32(vaddq_f32(vmulq_f32(vmulq_f32(dg, da), inv_sa), vmulq_f32(sg, sa)), ra);
+		float32x4_t rb = vdivq_f32(vaddq_f32(vmulq_f32(vmulq_f32(db, da), inv_sa), vmulq_f32(sb, sa)), ra);
+
+		uint32x4_t result = _blend_channel_to_byte_neon(rr);
+		result = vorrq_u32(result, vshlq_n_u32(_blend_channel_to_byte_neon(rg), 8));
+		result = vorrq_u32(result, vshlq_n_u32(_blend_channel_to_byte_neon(rb), 16));
+		result = vorrq_u32(result, vshlq_n_u32(_blend_channel_to_byte_neon(ra), 24));
+		vst1q_u8(p_dst + i * 4, vreinterpretq_u8_u32(vbslq_u32(keep, dst, result)));
+	}
+	return i;
+}
+#endif // IMAGE_KERNELS_NEON
+
+void ImageKernels::blend_rgba8(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, int p_count) {
+	int done = 0;
+	switch (get_level()) {
+#ifdef IMAGE_KERNELS_X86
+		case LEVEL_SSE4_1:
+			done = _blend_rgba8_sse4_1(p_src, p_dst, p_count);
+			break;
+		case LEVEL_AVX2:
+			done = _blend_rgba8_avx2(p_src, p_dst, p_count);
+			break;
+#endif
+#ifdef IMAGE_KERNELS_NEON
+		case LEVEL_NEON:
+			done = _blend_rgba8_neon(p_src, p_dst, p_count);
+			break;
+#endif
+		default:
+			break;
+	}
+	_blend_rgba8_scalar(p_src + done * 4, p_dst + done * 4, p_count - done);
+}
@@ -0,0 +1,72 @@
+/**************************************************************************/
+/*  image_kernels.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef IMAGE_KERNELS_H
+#define IMAGE_KERNELS_H
+
+#include "core/typedefs.h"
+
+// Row kernels for the most common 8-bit Image operations.
+// Each kernel has a scalar version and SSE4.1, AVX2 or NEON versions, the widest one the CPU supports is picked at runtime.
+// All versions write the same bytes as the generic code in image.cpp.
+class ImageKernels {
+public:
+	enum Level {
+		LEVEL_SCALAR,
+		LEVEL_SSE4_1,
+		LEVEL_AVX2,
+		LEVEL_NEON,
+		LEVEL_MAX
+	};
+
+private:
+	static int level;
+
+	static Level _detect_level();
+
+public:
+	static bool is_level_supported(Level p_level);
+	static const char *get_level_name(Level p_level);
+
+	// The level used by the kernels, the best supported one unless overridden.
+	static Level get_level();
+	// Forces a supported level, for tests and benchmarks. LEVEL_MAX goes back to the detected one.
+	static void set_level(Level p_level);
+
+	static void convert_rgba8_to_rgb8(int p_width, int p_height, const uint8_t *p_src, uint8_t *p_dst);
+	static void convert_rgb8_to_rgba8(int p_width, int p_height, const uint8_t *p_src, uint8_t *p_dst);
+	// Same signature as the resize templates in image.cpp, writes destination rows [p_dst_y_from, p_dst_y_to).
+	static void scale_bilinear_rgba8(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_y_from, uint32_t p_dst_y_to);
+	// Blends p_count source pixels over the destination pixels like Color::blend(), pixels with zero source alpha are left untouched.
+	// The two rows must not overlap.
+	static void blend_rgba8(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, int p_count);
+};
+
+#endif // IMAGE_KERNELS_H
@@ -38,6 +38,164 @@ void ImageFormatLoader::_bind_methods() {
 	BIND_BITFIELD_FLAG(FLAG_CONVERT_COLORS);
 }
 
+bool ImageRegionWriter::is_format_supported(Image::Format p_format) {
+	switch (p_format) {
+		case Image::FORMAT_L8:
+		case Image::FORMAT_LA8:
+		case Image::FORMAT_R8:
+		case Image::FORMAT_RG8:
+		case Image::FORMAT_RGB8:
+		case Image::FORMAT_RGBA8:
+			return true;
+		default:
+			return false;
+	}
+}
+
+Error ImageRegionWriter::begin(int p_width, int p_height, Image::Format p_format, const Rect2i &p_region, int p_shrink) {
+	ERR_FAIL_COND_V(!is_format_supported(p_format), ERR_UNAVAILABLE);
+	ERR_FAIL_COND_V_MSG(p_shrink < 1, ERR_INVALID_PARAMETER, "Shrink factor must be at least 1.");
+
+	const Rect2i full(0, 0, p_width, p_height);
+	region = p_region.has_area() ? full.intersection(p_region) : full;
+	ERR_FAIL_COND_V_MSG(!region.has_area(), ERR_INVALID_PARAMETER, "Region is outside of the image.");
+
+	format = p_format;
+	shrink = p_shrink;
+	pixel_size = Image::get_format_pixel_size(p_format);
+	// Like shrink_x2(), trailing rows and columns that don't fill a whole box are dropped.
+	size = Size2i(MAX(region.size.width / shrink, 1), MAX(region.size.height / shrink, 1));
+	end_row = region.position.y + MIN(size.height * shrink, region.size.height);
+	band_rows = 0;
+
+	Error err = data.resize((int64_t)size.width * size.height * pixel_size);
+	ERR_FAIL_COND_V(err != OK, err);
+	if (shrink > 1) {
+		accum.resize(size.width * pixel_size);
+		memset(accum.ptr(), 0, accum.size() * sizeof(uint32_t));
+	} else {
+		accum.clear();
+	}
+	return OK;
+}
+
+void ImageRegionWriter::_flush_band(int p_dst_y) {
+	uint8_t *dst = data.ptrw() + (int64_t)p_dst_y * size.width * pixel_size;
+	uint32_t *acc = accum.ptr();
+	for (int x = 0; x < size.width; x++) {
+		const uint32_t count = MIN(shrink, region.size.width - x * shrink) * band_rows;
+		for (int c = 0; c < pixel_size; c++) {
+			dst[c] = (acc[c] + count / 2) / count;
+			acc[c] = 0;
+		}
+		dst += pixel_size;
+		acc += pixel_size;
+	}
+	band_rows = 0;
+}
+
+void ImageRegionWriter::write_row(int p_y, const uint8_t *p_row, int p_pixel_stride) {
+	if (p_y < region.position.y || p_y >= end_row) {
+		return;
+	}
+
+	const int stride = p_pixel_stride > 0 ? p_pixel_stride : pixel_size;
+	const uint8_t *src = p_row + (int64_t)region.position.x * stride;
+
+	if (shrink == 1) {
+		uint8_t *dst = data.ptrw() + (int64_t)(p_y - region.position.y) * size.width * pixel_size;
+		if (stride == pixel_size) {
+			memcpy(dst, src, size.width * pixel_size);
+		} else {
+			for (int x = 0; x < size.width; x++) {
+				for (int c = 0; c < pixel_size; c++) {
+					dst[c] = src[c];
+				}
+				dst += pixel_size;
+				src += stride;
+			}
+		}
+		return;
+	}
+
+	uint32_t *acc = accum.ptr();
+	for (int x = 0; x < size.width; x++) {
+		const int count = MIN(shrink, region.size.width - x * shrink);
+		for (int i = 0; i < count; i++) {
+			for (int c = 0; c < pixel_size; c++) {
+				acc[c] += src[c];
+			}
+			src += stride;
+		}
+		acc += pixel_size;
+	}
+
+	band_rows++;
+	if (band_rows == shrink || p_y == end_row - 1) {
+		_flush_band((p_y - region.position.y) / shrink);
+	}
+}
+
+Error ImageRegionWriter::finish(Ref<Image> p_image) {
+	ERR_FAIL_COND_V(p_image.is_null(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(format == Image::FORMAT_MAX, ERR_UNCONFIGURED);
+
+	p_image->set_data(size.width, size.height, false, format, data);
+	data = Vector<uint8_t>();
+	accum.clear();
+	format = Image::FORMAT_MAX;
+	return OK;
+}
+
+Error ImageRegionWriter::apply(Ref<Image> p_image, const Rect2i &p_region, int p_shrink) {
+	ERR_FAIL_COND_V(p_image.is_null() || p_image->is_empty(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V_MSG(p_shrink < 1, ERR_INVALID_PARAMETER, "Shrink factor must be at least 1.");
+
+	const Rect2i full(Point2i(), p_image->get_size());
+	if (p_shrink == 1 && (!p_region.has_area() || p_region.encloses(full))) {
+		return OK;
+	}
+
+	if (p_image->is_compressed()) {
+		Error err = p_image->decompress();
+		ERR_FAIL_COND_V(err != OK, err);
+	}
+	p_image->clear_mipmaps();
+
+	if (!is_format_supported(p_image->get_format())) {
+		// Not a byte format, crop and resample the decoded image instead.
+		const Rect2i region = p_region.has_area() ? full.intersection(p_region) : full;
+		ERR_FAIL_COND_V_MSG(!region.has_area(), ERR_INVALID_PARAMETER, "Region is outside of the image.");
+		Ref<Image> cropped = p_image->get_region(region);
+		if (p_shrink > 1) {
+			cropped->resize(MAX(region.size.width / p_shrink, 1), MAX(region.size.height / p_shrink, 1), Image::INTERPOLATE_BILINEAR);
+		}
+		p_image->copy_internals_from(cropped);
+		return OK;
+	}
+
+	ImageRegionWriter writer;
+	Error err = writer.begin(full.size.width, full.size.height, p_image->get_format(), p_region, p_shrink);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	const Vector<uint8_t> src = p_image->get_data();
+	const int64_t row_size = (int64_t)full.size.width * Image::get_format_pixel_size(p_image->get_format());
+	for (int y = writer.get_region().position.y; y < writer.get_end_row(); y++) {
+		writer.write_row(y, src.ptr() + y * row_size);
+	}
+	return writer.finish(p_image);
+}
+
+/////////////////
+
+Error ImageFormatLoader::load_image_region(Ref<Image> p_image, Ref<FileAccess> p_fileaccess, BitField<ImageFormatLoader::LoaderFlags> p_flags, const Rect2i &p_region, int p_shrink) {
+	Error err = load_image(p_image, p_fileaccess, p_flags);
+	if (err != OK) {
+		return err;
+	}
+	return ImageRegionWriter::apply(p_image, p_region, p_shrink);
+}
+
 bool ImageFormatLoader::recognize(const String &p_extension) const {
 	List<String> extensions;
 	get_recognized_extensions(&extensions);
@@ -109,6 +267,36 @@ Error ImageLoader::load_image(String p_file, Ref<Image> p_image, Ref<FileAccess>
 	return ERR_FILE_UNRECOGNIZED;
 }
 
+Error ImageLoader::load_image_region(String p_file, Ref<Image> p_image, const Rect2i &p_region, int p_shrink, Ref<FileAccess> p_custom, BitField<ImageFormatLoader::LoaderFlags> p_flags) {
+	ERR_FAIL_COND_V_MSG(p_image.is_null(), ERR_INVALID_PARAMETER, "It's not a reference to a valid Image object.");
+	ERR_FAIL_COND_V_MSG(p_shrink < 1, ERR_INVALID_PARAMETER, "Shrink factor must be at least 1.");
+
+	Ref<FileAccess> f = p_custom;
+	if (f.is_null()) {
+		Error err;
+		f = FileAccess::open(p_file, FileAccess::READ, &err);
+		ERR_FAIL_COND_V_MSG(f.is_null(), err, "Error opening file '" + p_file + "'.");
+	}
+
+	String extension = p_file.get_extension();
+
+	for (int i = 0; i < loader.size(); i++) {
+		if (!loader[i]->recognize(extension)) {
+			continue;
+		}
+		Error err = loader.write[i]->load_image_region(p_image, f, p_flags, p_region, p_shrink);
+		if (err != OK) {
+			ERR_PRINT("Error loading image: " + p_file);
+		}
+
+		if (err != ERR_FILE_UNRECOGNIZED) {
+			return err;
+		}
+	}
+
+	return ERR_FILE_UNRECOGNIZED;
+}
+
 void ImageLoader::get_recognized_extensions(List<String> *p_extensions) {
 	for (int i = 0; i < loader.size(); i++) {
 		loader[i]->get_recognized_extensions(p_extensions);
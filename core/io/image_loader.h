@@ -38,10 +38,46 @@
 #include "core/object/gdvirtual.gen.inc"
 #include "core/string/ustring.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/binder_common.h"
 
 class ImageLoader;
 
+// Collects decoded scanlines of a byte format image, keeping only the rows and
+// columns inside a region and box-filtering them down by an integer shrink
+// factor, so decoders never need to hold the full resolution image.
+class ImageRegionWriter {
+	Vector<uint8_t> data;
+	LocalVector<uint32_t> accum;
+	Image::Format format = Image::FORMAT_MAX;
+	Rect2i region;
+	Size2i size;
+	int shrink = 1;
+	int pixel_size = 0;
+	int end_row = 0;
+	int band_rows = 0;
+
+	void _flush_band(int p_dst_y);
+
+public:
+	static bool is_format_supported(Image::Format p_format);
+
+	Error begin(int p_width, int p_height, Image::Format p_format, const Rect2i &p_region, int p_shrink);
+	// Source rows past this one are not needed, decoders can stop early.
+	_FORCE_INLINE_ int get_end_row() const { return end_row; }
+	_FORCE_INLINE_ const Rect2i &get_region() const { return region; }
+	_FORCE_INLINE_ Size2i get_size() const { return size; }
+	_FORCE_INLINE_ uint8_t *ptrw() { return data.ptrw(); }
+
+	// Rows must be written in order. p_pixel_stride allows sources with padding
+	// between pixels, 0 means the pixel size of the format.
+	void write_row(int p_y, const uint8_t *p_row, int p_pixel_stride = 0);
+	Error finish(Ref<Image> p_image);
+
+	// Crops and shrinks an already decoded image in place.
+	static Error apply(Ref<Image> p_image, const Rect2i &p_region, int p_shrink);
+};
+
 class ImageFormatLoader : public RefCounted {
 	GDCLASS(ImageFormatLoader, RefCounted);
 
@@ -59,6 +95,9 @@ protected:
 	static void _bind_methods();
 
 	virtual Error load_image(Ref<Image> p_image, Ref<FileAccess> p_fileaccess, BitField<ImageFormatLoader::LoaderFlags> p_flags = FLAG_NONE, float p_scale = 1.0) = 0;
+	// Decodes only p_region (whole image when empty), shrunk by p_shrink. Loaders
+	// that can't decode partially fall back to a full decode.
+	virtual Error load_image_region(Ref<Image> p_image, Ref<FileAccess> p_fileaccess, BitField<ImageFormatLoader::LoaderFlags> p_flags, const Rect2i &p_region, int p_shrink);
 	virtual void get_recognized_extensions(List<String> *p_extensions) const = 0;
 	bool recognize(const String &p_extension) const;
 
@@ -92,6 +131,7 @@ class ImageLoader {
 protected:
 public:
 	static Error load_image(String p_file, Ref<Image> p_image, Ref<FileAccess> p_custom = Ref<FileAccess>(), BitField<ImageFormatLoader::LoaderFlags> p_flags = ImageFormatLoader::FLAG_NONE, float p_scale = 1.0);
+	static Error load_image_region(String p_file, Ref<Image> p_image, const Rect2i &p_region, int p_shrink = 1, Ref<FileAccess> p_custom = Ref<FileAccess>(), BitField<ImageFormatLoader::LoaderFlags> p_flags = ImageFormatLoader::FLAG_NONE);
 	static void get_recognized_extensions(List<String> *p_extensions);
 	static Ref<ImageFormatLoader> recognize(const String &p_extension);
 
@@ -37,6 +37,7 @@
 #include "core/io/marshalls.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 
 //#define print_bl(m_what) print_line(m_what)
@@ -106,11 +107,25 @@ void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	}
 }
 
+// Large payloads are copied straight from the file mapping when the file provides one.
+static const uint64_t MAPPED_READ_MIN_SIZE = 16384;
+
+static void read_payload(uint8_t *dst, const Ref<FileAccess> &f, uint64_t length) {
+	if (length >= MAPPED_READ_MIN_SIZE) {
+		const uint8_t *mapped = f->get_mapped_buffer(length);
+		if (mapped) {
+			memcpy(dst, mapped, length);
+			return;
+		}
+	}
+	f->get_buffer(dst, length);
+}
+
 static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	if (f->real_is_double) {
 		if constexpr (sizeof(real_t) == 8) {
 			// Ideal case with double-precision
-			f->get_buffer((uint8_t *)dst, count * sizeof(double));
+			read_payload((uint8_t *)dst, f, count * sizeof(double));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint64_t *dst = (uint64_t *)dst;
@@ -130,7 +145,7 @@ static Error read_reals(real_t *dst, Ref<FileAccess> &f, size_t count) {
 	} else {
 		if constexpr (sizeof(real_t) == 4) {
 			// Ideal case with float-precision
-			f->get_buffer((uint8_t *)dst, count * sizeof(float));
+			read_payload((uint8_t *)dst, f, count * sizeof(float));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *dst = (uint32_t *)dst;
@@ -166,7 +181,7 @@ StringName ResourceLoaderBinary::_get_string() {
 		return s;
 	}
 
-	return string_map[id];
+	return _get_tables().string_map[id];
 }
 
 Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
@@ -363,11 +378,13 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 				subname_count += 1; // has a property field, so we should count it as well
 			}
 
+			names.resize(name_count);
 			for (int i = 0; i < name_count; i++) {
-				names.push_back(_get_string());
+				names.write[i] = _get_string();
 			}
+			subnames.resize(subname_count);
 			for (uint32_t i = 0; i < subname_count; i++) {
-				subnames.push_back(_get_string());
+				subnames.write[i] = _get_string();
 			}
 
 			NodePath np = NodePath(names, subnames, absolute);
@@ -389,20 +406,22 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 				case OBJECT_INTERNAL_RESOURCE: {
 					uint32_t index = f->get_32();
 					String path;
+					const ResourceLoaderBinary &tables = _get_tables();
 
 					if (using_named_scene_ids) { // New format.
-						ERR_FAIL_INDEX_V((int)index, internal_resources.size(), ERR_PARSE_ERROR);
-						path = internal_resources[index].path;
+						ERR_FAIL_INDEX_V((int)index, tables.internal_resources.size(), ERR_PARSE_ERROR);
+						path = tables.internal_resources[index].path;
 					} else {
 						path += res_path + "::" + itos(index);
 					}
 
 					//always use internal cache for loading internal resources
-					if (!internal_index_cache.has(path)) {
+					const Ref<Resource> *cached = tables.internal_index_cache.getptr(path);
+					if (!cached) {
 						WARN_PRINT(String("Couldn't load resource (no cache): " + path).utf8().get_data());
 						r_v = Variant();
 					} else {
-						r_v = internal_index_cache[path];
+						r_v = *cached;
 					}
 				} break;
 				case OBJECT_EXTERNAL_RESOURCE: {
@@ -431,10 +450,16 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 				case OBJECT_EXTERNAL_RESOURCE_INDEX: {
 					//new file format, just refers to an index in the external list
 					int erindex = f->get_32();
+					const Vector<ExtResource> &ext_resources = _get_tables().external_resources;
 
-					if (erindex < 0 || erindex >= external_resources.size()) {
+					if (erindex < 0 || erindex >= ext_resources.size()) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
+					} else if (ext_resources[erindex].resolved) {
+						// Already waited for (and errors reported) by load(), may be null if broken dependencies are accepted.
+						if (ext_resources[erindex].resource.is_valid()) {
+							r_v = ext_resources[erindex].resource;
+						}
 					} else {
 						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
 						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
@@ -502,7 +527,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<uint8_t> array;
 			array.resize(len);
 			uint8_t *w = array.ptrw();
-			f->get_buffer(w, len);
+			read_payload(w, f, len);
 			_advance_padding(len);
 
 			r_v = array;
@@ -514,7 +539,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<int32_t> array;
 			array.resize(len);
 			int32_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int32_t));
+			read_payload((uint8_t *)w, f, len * sizeof(int32_t));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *ptr = (uint32_t *)w.ptr();
@@ -533,7 +558,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<int64_t> array;
 			array.resize(len);
 			int64_t *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(int64_t));
+			read_payload((uint8_t *)w, f, len * sizeof(int64_t));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint64_t *ptr = (uint64_t *)w.ptr();
@@ -552,7 +577,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<float> array;
 			array.resize(len);
 			float *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(float));
+			read_payload((uint8_t *)w, f, len * sizeof(float));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *ptr = (uint32_t *)w.ptr();
@@ -571,7 +596,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Vector<double> array;
 			array.resize(len);
 			double *w = array.ptrw();
-			f->get_buffer((uint8_t *)w, len * sizeof(double));
+			read_payload((uint8_t *)w, f, len * sizeof(double));
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint64_t *ptr = (uint64_t *)w.ptr();
@@ -630,7 +655,7 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 			Color *w = array.ptrw();
 			// Colors always use `float` even with double-precision support enabled
 			static_assert(sizeof(Color) == 4 * sizeof(float));
-			f->get_buffer((uint8_t *)w, len * sizeof(float) * 4);
+			read_payload((uint8_t *)w, f, len * sizeof(float) * 4);
 #ifdef BIG_ENDIAN_ENABLED
 			{
 				uint32_t *ptr = (uint32_t *)w.ptr();
@@ -655,199 +680,366 @@ Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
-Error ResourceLoaderBinary::load() {
-	if (error != OK) {
-		return error;
+SafeNumeric<uint64_t> ResourceLoaderBinary::parallel_decode_count;
+
+bool ResourceLoaderBinary::_can_decode_in_parallel() const {
+	// Worker threads need their own handle on the file, which can't be done for compressed files.
+	// The old format refers to external resources by path and would load them from the workers.
+	// A load already running on the pool decodes serially: waiting there for a group could leave every
+	// pool thread blocked on work that no thread is free to run. This includes every load_threaded_request(),
+	// those are parallel across files instead.
+	if (WorkerThreadPool::get_singleton()->get_thread_index() >= 0) {
+		return false;
 	}
+	return !file_path.is_empty() && !compressed && using_named_scene_ids && internal_resources.size() >= PARALLEL_DECODE_MIN_RESOURCES && WorkerThreadPool::get_singleton()->get_thread_count() > 0;
+}
 
-	for (int i = 0; i < external_resources.size(); i++) {
-		String path = external_resources[i].path;
+Error ResourceLoaderBinary::_create_internal_resource(int p_index, InternalResourceData &r_data) {
+	bool main = p_index == (internal_resources.size() - 1);
 
-		if (remaps.has(path)) {
-			path = remaps[path];
-		}
+	//maybe it is loaded already
+	String path;
+	String id;
 
-		if (!path.contains("://") && path.is_relative_path()) {
-			// path is relative to file being loaded, so convert to a resource path
-			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+	if (!main) {
+		path = internal_resources[p_index].path;
+
+		if (path.begins_with("local://")) {
+			path = path.replace_first("local://", "");
+			id = path;
+			path = res_path + "::" + path;
+
+			internal_resources.write[p_index].path = path; // Update path.
 		}
 
-		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
-		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, ResourceFormatLoader::CACHE_MODE_REUSE);
-		if (!external_resources[i].load_token.is_valid()) {
-			if (!ResourceLoader::get_abort_on_missing_resources()) {
-				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
-			} else {
-				error = ERR_FILE_MISSING_DEPENDENCIES;
-				ERR_FAIL_V_MSG(error, "Can't load dependency: " + path + ".");
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				error = OK;
+				internal_index_cache[path] = cached;
+				return OK;
 			}
 		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
 	}
 
-	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+	uint64_t offset = internal_resources[p_index].offset;
 
-		//maybe it is loaded already
-		String path;
-		String id;
+	f->seek(offset);
 
-		if (!main) {
-			path = internal_resources[i].path;
+	String t = get_unicode_string();
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+	Ref<Resource> res;
 
-				internal_resources.write[i].path = path; // Update path.
-			}
+	if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+		//use the existing one
+		Ref<Resource> cached = ResourceCache::get_ref(path);
+		if (cached->get_class() == t) {
+			cached->reset_state();
+			res = cached;
+		}
+	}
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
-				}
-			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
+	MissingResource *missing_resource = nullptr;
+
+	if (res.is_null()) {
+		//did not replace
+
+		Object *obj = ClassDB::instantiate(t);
+		if (!obj) {
+			if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+				//create a missing resource
+				missing_resource = memnew(MissingResource);
+				missing_resource->set_original_class(t);
+				missing_resource->set_recording_properties(true);
+				obj = missing_resource;
+			} else {
+				error = ERR_FILE_CORRUPT;
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
 			}
 		}
 
-		uint64_t offset = internal_resources[i].offset;
+		Resource *r = Object::cast_to<Resource>(obj);
+		if (!r) {
+			String obj_class = obj->get_class();
+			error = ERR_FILE_CORRUPT;
+			memdelete(obj); //bye
+			ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
+		}
 
-		f->seek(offset);
+		res = Ref<Resource>(r);
+		if (!path.is_empty() && cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+			r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); //if got here because the resource with same path has different type, replace it
+		} else if (!path.is_resource_file()) {
+			r->set_path_cache(path);
+		}
+		r->set_scene_unique_id(id);
+	}
 
-		String t = get_unicode_string();
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
 
-		Ref<Resource> res;
+	r_data.resource = res;
+	r_data.missing_resource = missing_resource;
+	r_data.properties_offset = f->get_position();
+	return OK;
+}
 
-		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-			//use the existing one
-			Ref<Resource> cached = ResourceCache::get_ref(path);
-			if (cached->get_class() == t) {
-				cached->reset_state();
-				res = cached;
-			}
+Error ResourceLoaderBinary::_parse_properties(Vector<Pair<StringName, Variant>> &r_properties) {
+	int pc = f->get_32();
+	r_properties.resize(pc);
+	Pair<StringName, Variant> *w = r_properties.ptrw();
+
+	for (int j = 0; j < pc; j++) {
+		w[j].first = _get_string();
+
+		if (w[j].first == StringName()) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
 		}
 
-		MissingResource *missing_resource = nullptr;
+		error = parse_variant(w[j].second);
+		if (error) {
+			return error;
+		}
+	}
 
-		if (res.is_null()) {
-			//did not replace
+	return OK;
+}
 
-			Object *obj = ClassDB::instantiate(t);
-			if (!obj) {
-				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-					//create a missing resource
-					missing_resource = memnew(MissingResource);
-					missing_resource->set_original_class(t);
-					missing_resource->set_recording_properties(true);
-					obj = missing_resource;
-				} else {
-					error = ERR_FILE_CORRUPT;
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource of unrecognized type in file: " + t + ".");
-				}
-			}
+void ResourceLoaderBinary::_apply_internal_resource(int p_index, InternalResourceData &r_data) {
+	bool main = p_index == (internal_resources.size() - 1);
+	Ref<Resource> &res = r_data.resource;
+	MissingResource *missing_resource = r_data.missing_resource;
 
-			Resource *r = Object::cast_to<Resource>(obj);
-			if (!r) {
-				String obj_class = obj->get_class();
-				error = ERR_FILE_CORRUPT;
-				memdelete(obj); //bye
-				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, local_path + ":Resource type in resource field not a resource, type is: " + obj_class + ".");
+	//set properties
+
+	Dictionary missing_resource_properties;
+
+	for (const Pair<StringName, Variant> &property : r_data.properties) {
+		const StringName &name = property.first;
+		Variant value = property.second;
+
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
+
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
 			}
+		}
 
-			res = Ref<Resource>(r);
-			if (!path.is_empty() && cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); //if got here because the resource with same path has different type, replace it
-			} else if (!path.is_resource_file()) {
-				r->set_path_cache(path);
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+				}
 			}
-			r->set_scene_unique_id(id);
 		}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+		if (set_valid) {
+			res->set(name, value);
+		}
+	}
+
+	// Values are owned by the resource now, no need to keep a second reference around.
+	r_data.properties.clear();
+
+	if (missing_resource) {
+		missing_resource->set_recording_properties(false);
+	}
+
+	if (!missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
+
+#ifdef TOOLS_ENABLED
+	res->set_edited(false);
+#endif
+
+	if (progress) {
+		*progress = (p_index + 1) / float(internal_resources.size());
+	}
+
+	resource_cache.push_back(res);
+
+	if (main) {
+		f.unref();
+		resource = res;
+		resource->set_as_translation_remapped(translation_remapped);
+		error = OK;
+	}
+}
+
+void ResourceLoaderBinary::_decode_properties_worker(uint32_t p_worker, ParallelDecode *p_decode) {
+	// Each worker decodes with its own file handle and string buffer, sharing the read-only tables.
+	ResourceLoaderBinary decoder;
+	Error err = OK;
+	decoder.f = FileAccess::open(file_path, FileAccess::READ, &err);
+	decoder.local_path = local_path;
+	decoder.res_path = res_path;
+	decoder.ver_format = ver_format;
+	decoder.using_named_scene_ids = using_named_scene_ids;
+	decoder.shared_tables = this;
+
+	if (decoder.f.is_valid()) {
+		decoder.f->set_big_endian(file_big_endian);
+		decoder.f->real_is_double = f->real_is_double;
+	}
+
+	while (true) {
+		uint32_t index = p_decode->next_resource.postincrement();
+		if (index >= p_decode->resource_count) {
+			break;
+		}
+
+		InternalResourceData &data = p_decode->resources[index];
+		if (data.resource.is_null()) {
+			continue;
 		}
+		if (err != OK) {
+			data.error = err;
+			continue;
+		}
+
+		decoder.f->seek(data.properties_offset);
+		data.error = decoder._parse_properties(data.properties);
+	}
+}
 
-		int pc = f->get_32();
+Error ResourceLoaderBinary::load() {
+	if (error != OK) {
+		return error;
+	}
 
-		//set properties
+	for (int i = 0; i < external_resources.size(); i++) {
+		String path = external_resources[i].path;
 
-		Dictionary missing_resource_properties;
+		if (remaps.has(path)) {
+			path = remaps[path];
+		}
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+		if (!path.contains("://") && path.is_relative_path()) {
+			// path is relative to file being loaded, so convert to a resource path
+			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+		}
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
+		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, ResourceFormatLoader::CACHE_MODE_REUSE);
+		if (!external_resources[i].load_token.is_valid()) {
+			if (!ResourceLoader::get_abort_on_missing_resources()) {
+				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
+			} else {
+				error = ERR_FILE_MISSING_DEPENDENCIES;
+				ERR_FAIL_V_MSG(error, "Can't load dependency: " + path + ".");
 			}
+		}
+	}
 
-			Variant value;
+	if (!_can_decode_in_parallel()) {
+		for (int i = 0; i < internal_resources.size(); i++) {
+			if (ResourceLoader::is_load_cancelled()) {
+				error = ERR_SKIP;
+				return error;
+			}
 
-			error = parse_variant(value);
+			InternalResourceData data;
+			error = _create_internal_resource(i, data);
 			if (error) {
 				return error;
 			}
-
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource != nullptr) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
-
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
+			if (data.resource.is_null()) {
+				continue;
 			}
 
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
+			error = _parse_properties(data.properties);
+			if (error) {
+				return error;
 			}
 
-			if (set_valid) {
-				res->set(name, value);
+			_apply_internal_resource(i, data);
+			if (i == internal_resources.size() - 1) {
+				return OK;
 			}
 		}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
+		return ERR_FILE_EOF;
+	}
+
+	// Parallel mode: resources are created up front so references between them can be resolved
+	// from any thread, their properties are decoded on the WorkerThreadPool, then applied in file order.
+
+	// Wait for dependencies here, so the workers never block on another load.
+	for (int i = 0; i < external_resources.size(); i++) {
+		ExtResource &er = external_resources.write[i];
+		if (er.load_token.is_valid()) {
+			Error err;
+			er.resource = ResourceLoader::_load_complete(*er.load_token.ptr(), &err);
+			if (er.resource.is_null() && !ResourceLoader::is_cleaning_tasks()) {
+				if (!ResourceLoader::get_abort_on_missing_resources()) {
+					ResourceLoader::notify_dependency_error(local_path, er.path, er.type);
+				} else {
+					error = ERR_FILE_MISSING_DEPENDENCIES;
+					ERR_FAIL_V_MSG(error, "Can't load dependency: " + er.path + ".");
+				}
+			}
 		}
+		er.resolved = true;
+	}
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	if (ResourceLoader::is_load_cancelled()) {
+		error = ERR_SKIP;
+		return error;
+	}
+
+	Vector<InternalResourceData> resources_data;
+	resources_data.resize(internal_resources.size());
+	InternalResourceData *resources_ptr = resources_data.ptrw();
+
+	for (int i = 0; i < internal_resources.size(); i++) {
+		error = _create_internal_resource(i, resources_ptr[i]);
+		if (error) {
+			return error;
 		}
+	}
 
-#ifdef TOOLS_ENABLED
-		res->set_edited(false);
-#endif
+	ParallelDecode decode;
+	decode.resources = resources_ptr;
+	decode.resource_count = internal_resources.size();
+
+	// The current thread decodes too, in addition to the pool threads. It is never a pool thread (see _can_decode_in_parallel()).
+	int worker_count = MIN(WorkerThreadPool::get_singleton()->get_thread_count() + 1, internal_resources.size() / (PARALLEL_DECODE_MIN_RESOURCES / 2));
+	parallel_decode_count.increment();
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ResourceLoaderBinary::_decode_properties_worker, &decode, worker_count - 1, -1, true, "ResourceLoaderBinaryDecode");
+	_decode_properties_worker(worker_count - 1, &decode);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
-		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+	for (int i = 0; i < internal_resources.size(); i++) {
+		InternalResourceData &data = resources_ptr[i];
+		if (data.resource.is_null()) {
+			continue;
 		}
 
-		resource_cache.push_back(res);
+		error = data.error;
+		if (error) {
+			return error;
+		}
 
-		if (main) {
-			f.unref();
-			resource = res;
-			resource->set_as_translation_remapped(translation_remapped);
-			error = OK;
+		_apply_internal_resource(i, data);
+		if (i == internal_resources.size() - 1) {
 			return OK;
 		}
 	}
@@ -952,6 +1144,7 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 			ERR_FAIL_MSG("Failed to open binary resource file: " + local_path + ".");
 		}
 		f = fac;
+		compressed = true;
 
 	} else if (header[0] != 'R' || header[1] != 'S' || header[2] != 'R' || header[3] != 'C') {
 		// Not normal.
@@ -960,20 +1153,20 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 		ERR_FAIL_MSG("Unrecognized binary resource file: " + local_path + ".");
 	}
 
-	bool big_endian = f->get_32();
+	file_big_endian = f->get_32();
 	bool use_real64 = f->get_32();
 
-	f->set_big_endian(big_endian != 0); //read big endian if saved as big endian
+	f->set_big_endian(file_big_endian); //read big endian if saved as big endian
 
 	uint32_t ver_major = f->get_32();
 	uint32_t ver_minor = f->get_32();
 	ver_format = f->get_32();
 
-	print_bl("big endian: " + itos(big_endian));
+	print_bl("big endian: " + itos(file_big_endian));
 #ifdef BIG_ENDIAN_ENABLED
-	print_bl("endian swap: " + itos(!big_endian));
+	print_bl("endian swap: " + itos(!file_big_endian));
 #else
-	print_bl("endian swap: " + itos(big_endian));
+	print_bl("endian swap: " + itos(file_big_endian));
 #endif
 	print_bl("real64: " + itos(use_real64));
 	print_bl("major: " + itos(ver_major));
@@ -1029,8 +1222,9 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 	print_bl("strings: " + itos(string_table_size));
 
 	uint32_t ext_resources_size = f->get_32();
+	external_resources.resize(ext_resources_size);
 	for (uint32_t i = 0; i < ext_resources_size; i++) {
-		ExtResource er;
+		ExtResource &er = external_resources.write[i];
 		er.type = get_unicode_string();
 		er.path = get_unicode_string();
 		if (using_uids) {
@@ -1051,18 +1245,16 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 				}
 			}
 		}
-
-		external_resources.push_back(er);
 	}
 
 	print_bl("ext resources: " + itos(ext_resources_size));
 	uint32_t int_resources_size = f->get_32();
 
+	internal_resources.resize(int_resources_size);
 	for (uint32_t i = 0; i < int_resources_size; i++) {
-		IntResource ir;
+		IntResource &ir = internal_resources.write[i];
 		ir.path = get_unicode_string();
 		ir.offset = f->get_64();
-		internal_resources.push_back(ir);
 	}
 
 	print_bl("int resources: " + itos(int_resources_size));
@@ -1180,6 +1372,7 @@ Ref<Resource> ResourceFormatLoaderBinary::load(const String &p_path, const Strin
 	loader.cache_mode = p_cache_mode;
 	loader.use_sub_threads = p_use_sub_threads;
 	loader.progress = r_progress;
+	loader.file_path = p_path;
 	String path = !p_original_path.is_empty() ? p_original_path : p_path;
 	loader.local_path = ProjectSettings::get_singleton()->localize_path(path);
 	loader.res_path = loader.local_path;
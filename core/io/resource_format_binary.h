@@ -34,6 +34,10 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/pair.h"
+#include "core/templates/safe_refcount.h"
+
+class MissingResource;
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -44,6 +48,9 @@ class ResourceLoaderBinary {
 	uint32_t ver_format = 0;
 
 	Ref<FileAccess> f;
+	String file_path; // Path the file was opened from, used to reopen it on worker threads.
+	bool compressed = false;
+	bool file_big_endian = false;
 
 	uint64_t importmd_ofs = 0;
 
@@ -61,6 +68,9 @@ class ResourceLoaderBinary {
 		String type;
 		ResourceUID::ID uid = ResourceUID::INVALID_ID;
 		Ref<ResourceLoader::LoadToken> load_token;
+		// Set when the dependency was waited for up front, so parse_variant() does not have to.
+		Ref<Resource> resource;
+		bool resolved = false;
 	};
 
 	bool using_named_scene_ids = false;
@@ -78,6 +88,35 @@ class ResourceLoaderBinary {
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
+	struct InternalResourceData {
+		Ref<Resource> resource; // Null if it was already cached and does not need loading.
+		MissingResource *missing_resource = nullptr;
+		uint64_t properties_offset = 0;
+		Vector<Pair<StringName, Variant>> properties;
+		Error error = OK;
+	};
+
+	struct ParallelDecode {
+		InternalResourceData *resources = nullptr;
+		uint32_t resource_count = 0;
+		SafeNumeric<uint32_t> next_resource;
+	};
+
+	// Below this amount of internal resources, parallel decoding is not worth the extra file handles.
+	static const int PARALLEL_DECODE_MIN_RESOURCES = 32;
+	static SafeNumeric<uint64_t> parallel_decode_count;
+
+	// Set on the decoders of worker threads, which read the tables of the loader that owns them instead of copying them.
+	// The tables are not modified while the workers run.
+	const ResourceLoaderBinary *shared_tables = nullptr;
+	const ResourceLoaderBinary &_get_tables() const { return shared_tables ? *shared_tables : *this; }
+
+	bool _can_decode_in_parallel() const;
+	void _decode_properties_worker(uint32_t p_worker, ParallelDecode *p_decode);
+	Error _create_internal_resource(int p_index, InternalResourceData &r_data);
+	Error _parse_properties(Vector<Pair<StringName, Variant>> &r_properties);
+	void _apply_internal_resource(int p_index, InternalResourceData &r_data);
+
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
 
@@ -119,6 +158,9 @@ public:
 	virtual ResourceUID::ID get_resource_uid(const String &p_path) const;
 	virtual void get_dependencies(const String &p_path, List<String> *p_dependencies, bool p_add_types = false);
 	virtual Error rename_dependencies(const String &p_path, const HashMap<String, String> &p_map);
+
+	// Number of loads whose sub-resources were decoded on the WorkerThreadPool, used by tests.
+	static uint64_t get_parallel_decode_count() { return ResourceLoaderBinary::parallel_decode_count.get(); }
 };
 
 class ResourceFormatSaverBinaryInstance {
@@ -147,6 +147,9 @@ public:
 	virtual Error import_group_file(const String &p_group_file, const HashMap<String, HashMap<StringName, Variant>> &p_source_file_options, const HashMap<String, String> &p_base_paths) { return ERR_UNAVAILABLE; }
 	virtual bool are_import_settings_valid(const String &p_path) const { return true; }
 	virtual String get_import_settings_string() const { return String(); }
+	// Whether the result of an import can be reused from the shared import cache. Only importers whose output depends on
+	// nothing but the source contents and options opt in, the cache key doesn't include the source path.
+	virtual bool can_cache_import(const Variant &p_metadata) const { return false; }
 };
 
 VARIANT_ENUM_CAST(ResourceImporter::ImportOrder);
@@ -125,6 +125,32 @@ void ResourceLoader::get_recognized_extensions_for_type(const String &p_type, Li
 	}
 }
 
+static bool _is_custom_loader(const Ref<ResourceFormatLoader> &p_loader) {
+	if (p_loader->get_script_instance()) {
+		return true;
+	}
+	// Engine loaders aren't always registered in ClassDB, GDExtension ones always are.
+	const StringName &class_name = p_loader->get_class_name();
+	if (!ClassDB::class_exists(class_name)) {
+		return false;
+	}
+	const ClassDB::APIType api = ClassDB::get_api_type(class_name);
+	return api == ClassDB::API_EXTENSION || api == ClassDB::API_EDITOR_EXTENSION;
+}
+
+bool ResourceLoader::get_custom_loader_extensions(List<String> *r_builtin_extensions, List<String> *r_custom_extensions) {
+	bool has_custom = false;
+	for (int i = 0; i < loader_count; i++) {
+		if (_is_custom_loader(loader[i])) {
+			loader[i]->get_recognized_extensions(r_custom_extensions);
+			has_custom = true;
+		} else {
+			loader[i]->get_recognized_extensions(r_builtin_extensions);
+		}
+	}
+	return has_custom;
+}
+
 bool ResourceFormatLoader::exists(const String &p_path) const {
 	bool success = false;
 	if (GDVIRTUAL_CALL(_exists, p_path, success)) {
@@ -208,6 +234,7 @@ void ResourceLoader::LoadToken::clear() {
 	thread_load_mutex.lock();
 
 	WorkerThreadPool::TaskID task_to_await = 0;
+	Vector<Ref<LoadToken>> prefetch_tokens; // Released after unlocking, since they may have to await their own tasks.
 
 	if (!local_path.is_empty()) { // Empty is used for the special case where the load task is not registered.
 		DEV_ASSERT(thread_load_tasks.has(local_path));
@@ -216,6 +243,19 @@ void ResourceLoader::LoadToken::clear() {
 			task_to_await = load_task.task_id;
 			load_task.awaited = true;
 		}
+		if (task_to_await && load_task.cancelled) {
+			// A cancelled load may not even have started, so its entry must outlive the task.
+			// Nobody wants the result, so let it bail out as soon as possible.
+			thread_load_mutex.unlock();
+			WorkerThreadPool::get_singleton()->promote_task(task_to_await);
+			WorkerThreadPool::get_singleton()->wait_for_task_completion(task_to_await);
+			thread_load_mutex.lock();
+			task_to_await = 0;
+		}
+	}
+
+	if (!local_path.is_empty()) { // May have been cleared by another thread while awaiting.
+		prefetch_tokens = thread_load_tasks[local_path].prefetch_tokens;
 		thread_load_tasks.erase(local_path);
 		local_path.clear();
 	}
@@ -271,6 +311,10 @@ Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_origin
 		return res;
 	}
 
+	if (found && is_load_cancelled()) {
+		return Ref<Resource>(); // Stopped on purpose, nothing to report.
+	}
+
 	ERR_FAIL_COND_V_MSG(found, Ref<Resource>(),
 			vformat("Failed loading resource: %s. Make sure resources have been imported by opening the project in the editor at least once.", p_path));
 
@@ -287,13 +331,19 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 
 	thread_load_mutex.lock();
 	caller_task_id = load_task.task_id;
-	if (cleaning_tasks) {
+	if (cleaning_tasks || load_task.cancelled) {
 		load_task.status = THREAD_LOAD_FAILED;
+		if (load_task.cancelled) {
+			load_task.error = ERR_SKIP;
+		}
+		load_queue_depth--;
 		thread_load_mutex.unlock();
 		return;
 	}
 	thread_load_mutex.unlock();
 
+	uint64_t load_start_usec = OS::get_singleton()->get_ticks_usec();
+
 	// Thread-safe either if it's the current thread or a brand new one.
 	CallQueue *mq_override = nullptr;
 	if (load_nesting == 0) {
@@ -316,13 +366,36 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 		set_current_thread_safe_for_nodes(true);
 	}
 
+	ThreadLoadTask *prev_load_task = current_load_task;
+	current_load_task = &load_task;
+
+	if (load_task.prefetch_dependencies) {
+		_prefetch_dependencies(load_task);
+	}
+
 	Ref<Resource> res = _load(load_task.remapped_path, load_task.remapped_path != load_task.local_path ? load_task.local_path : String(), load_task.type_hint, load_task.cache_mode, &load_task.error, load_task.use_sub_threads, &load_task.progress);
 	if (mq_override) {
 		mq_override->flush();
 	}
 
+	current_load_task = prev_load_task;
+
+	// Whatever was prefetched and not used by this load is no longer needed.
+	Vector<Ref<LoadToken>> prefetch_tokens;
+
 	thread_load_mutex.lock();
 
+	load_queue_depth--;
+	if (load_time_tracking && load_times.size() < MAX_TRACKED_LOAD_TIMES) {
+		LoadTimeInfo load_time;
+		load_time.path = load_task.local_path;
+		load_time.usec = OS::get_singleton()->get_ticks_usec() - load_start_usec;
+		load_times.push_back(load_time);
+	}
+
+	prefetch_tokens = load_task.prefetch_tokens;
+	load_task.prefetch_tokens.clear();
+
 	load_task.resource = res;
 
 	load_task.progress = 1.0; //it was fully loaded at this point, so force progress to 1.0
@@ -365,6 +438,8 @@ void ResourceLoader::_thread_load_function(void *p_userdata) {
 
 	thread_load_mutex.unlock();
 
+	prefetch_tokens.clear();
+
 	if (load_nesting == 0) {
 		if (mq_override) {
 			memdelete(mq_override);
@@ -384,22 +459,97 @@ static String _validate_local_path(const String &p_path) {
 	}
 }
 
-Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, ResourceFormatLoader::CacheMode p_cache_mode) {
+// Walks the whole dependency graph from the file headers and starts every load right away,
+// so leaves load concurrently instead of being discovered one level at a time.
+void ResourceLoader::_prefetch_dependencies(ThreadLoadTask &p_load_task) {
+	HashSet<String> visited;
+	visited.insert(p_load_task.local_path);
+	List<String> pending;
+	pending.push_back(p_load_task.local_path);
+	Vector<Ref<LoadToken>> tokens;
+
+	while (!pending.is_empty()) {
+		String path = pending.front()->get();
+		pending.pop_front();
+
+		List<String> dependencies;
+		get_dependencies(path, &dependencies, true);
+		for (const String &E : dependencies) {
+			// Either "path", "path::type" or "uid::type::fallback_path".
+			Vector<String> slices = E.split("::");
+			String dep_path = slices[0];
+			String dep_type = slices.size() > 1 ? slices[1] : String();
+			if (dep_path.begins_with("uid://") && !ResourceUID::get_singleton()->has_id(ResourceUID::get_singleton()->text_to_id(dep_path))) {
+				dep_path = slices.size() > 2 ? slices[2] : String();
+			}
+			if (dep_path.is_relative_path()) {
+				continue; // Relative paths are resolved by the loader itself.
+			}
+			dep_path = _validate_local_path(dep_path);
+			if (visited.has(dep_path)) {
+				continue;
+			}
+			visited.insert(dep_path);
+			if (ResourceCache::has(dep_path)) {
+				continue; // Its own dependencies are already loaded, too.
+			}
+			if (!exists(dep_path, dep_type)) {
+				continue; // Let the actual load report it.
+			}
+
+			Ref<LoadToken> token = _load_start(dep_path, dep_type, LOAD_THREAD_DISTRIBUTE, ResourceFormatLoader::CACHE_MODE_REUSE, p_load_task.priority);
+			if (token.is_valid()) {
+				tokens.push_back(token);
+			}
+			pending.push_back(dep_path);
+		}
+	}
+
+	MutexLock thread_load_lock(thread_load_mutex);
+	p_load_task.prefetch_tokens = tokens;
+}
+
+// Must be called with the thread load mutex locked.
+void ResourceLoader::_promote_load_task(ThreadLoadTask &p_load_task, LoadPriority p_priority) {
+	if (p_priority <= p_load_task.priority || p_load_task.status != THREAD_LOAD_IN_PROGRESS) {
+		return;
+	}
+
+	p_load_task.priority = p_priority;
+	if (p_load_task.task_id) {
+		WorkerThreadPool::get_singleton()->promote_task(p_load_task.task_id);
+	}
+	for (const Ref<LoadToken> &token : p_load_task.prefetch_tokens) {
+		HashMap<String, ThreadLoadTask>::Iterator E = thread_load_tasks.find(token->local_path);
+		if (E) {
+			_promote_load_task(E->value, p_priority);
+		}
+	}
+}
+
+Error ResourceLoader::load_threaded_request(const String &p_path, const String &p_type_hint, bool p_use_sub_threads, ResourceFormatLoader::CacheMode p_cache_mode, LoadPriority p_priority) {
 	thread_load_mutex.lock();
 	if (user_load_tokens.has(p_path)) {
 		print_verbose("load_threaded_request(): Another threaded load for resource path '" + p_path + "' has been initiated. Not an error.");
-		user_load_tokens[p_path]->reference(); // Additional request.
+		LoadToken *load_token = user_load_tokens[p_path];
+		load_token->reference(); // Additional request.
+		load_token->user_requests++;
+		HashMap<String, ThreadLoadTask>::Iterator E = thread_load_tasks.find(load_token->local_path);
+		if (E) {
+			_promote_load_task(E->value, p_priority);
+		}
 		thread_load_mutex.unlock();
 		return OK;
 	}
 	user_load_tokens[p_path] = nullptr;
 	thread_load_mutex.unlock();
 
-	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode);
+	Ref<ResourceLoader::LoadToken> token = _load_start(p_path, p_type_hint, p_use_sub_threads ? LOAD_THREAD_DISTRIBUTE : LOAD_THREAD_SPAWN_SINGLE, p_cache_mode, p_priority);
 	if (token.is_valid()) {
 		thread_load_mutex.lock();
 		token->user_path = p_path;
 		token->reference(); // First request.
+		token->user_requests++;
 		user_load_tokens[p_path] = token.ptr();
 		print_lt("REQUEST: user load tokens: " + itos(user_load_tokens.size()));
 		thread_load_mutex.unlock();
@@ -426,7 +576,7 @@ Ref<Resource> ResourceLoader::load(const String &p_path, const String &p_type_hi
 	return res;
 }
 
-Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode) {
+Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, LoadPriority p_priority) {
 	String local_path = _validate_local_path(p_path);
 
 	Ref<LoadToken> load_token;
@@ -437,6 +587,9 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 	{
 		MutexLock thread_load_lock(thread_load_mutex);
 
+		// Dependencies are needed as soon as whatever depends on them.
+		LoadPriority priority = current_load_task ? MAX(p_priority, current_load_task->priority) : p_priority;
+
 		if (thread_load_tasks.has(local_path)) {
 			load_token = Ref<LoadToken>(thread_load_tasks[local_path].load_token);
 			if (!load_token.is_valid()) {
@@ -445,6 +598,7 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 				thread_load_tasks[local_path].load_token->clear();
 			} else {
 				if (p_cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+					_promote_load_task(thread_load_tasks[local_path], priority);
 					return load_token;
 				}
 			}
@@ -463,6 +617,9 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			load_task.type_hint = p_type_hint;
 			load_task.cache_mode = p_cache_mode;
 			load_task.use_sub_threads = p_thread_mode == LOAD_THREAD_DISTRIBUTE;
+			// Only for loads requested from outside any other load; nested ones are part of the same graph.
+			load_task.prefetch_dependencies = load_task.use_sub_threads && !current_load_task;
+			load_task.priority = priority;
 			if (p_cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
 				Ref<Resource> existing = ResourceCache::get_ref(local_path);
 				if (existing.is_valid()) {
@@ -485,6 +642,7 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 			}
 
 			load_task_ptr = must_not_register ? &unregistered_load_task : &thread_load_tasks[local_path];
+			load_queue_depth++;
 		}
 
 		run_on_current_thread = must_not_register || p_thread_mode == LOAD_THREAD_FROM_CURRENT;
@@ -492,7 +650,7 @@ Ref<ResourceLoader::LoadToken> ResourceLoader::_load_start(const String &p_path,
 		if (run_on_current_thread) {
 			load_task_ptr->thread_id = Thread::get_caller_id();
 		} else {
-			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_thread_load_function, load_task_ptr);
+			load_task_ptr->task_id = WorkerThreadPool::get_singleton()->add_native_task(&ResourceLoader::_thread_load_function, load_task_ptr, priority == LOAD_PRIORITY_HIGH);
 		}
 	}
 
@@ -581,6 +739,7 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 			return Ref<Resource>();
 		}
 		res = _load_complete_inner(*load_token, r_error, thread_load_lock);
+		load_token->user_requests--;
 		if (load_token->unreference()) {
 			memdelete(load_token);
 		}
@@ -591,6 +750,80 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 	return res;
 }
 
+Error ResourceLoader::load_threaded_cancel(const String &p_path) {
+	LoadToken *load_token = nullptr;
+	bool must_delete = false;
+	{
+		MutexLock thread_load_lock(thread_load_mutex);
+
+		if (!user_load_tokens.has(p_path)) {
+			print_verbose("load_threaded_cancel(): No threaded load for resource path '" + p_path + "' has been initiated or its result has already been collected.");
+			return ERR_INVALID_PARAMETER;
+		}
+
+		load_token = user_load_tokens[p_path];
+		if (!load_token) {
+			// This happens if requested from one thread and rapidly cancelled from another.
+			return ERR_BUSY;
+		}
+
+		HashMap<String, ThreadLoadTask>::Iterator E = thread_load_tasks.find(load_token->local_path);
+		if (E) {
+			ERR_FAIL_COND_V_MSG(E->value.priority != LOAD_PRIORITY_LOW, ERR_UNAVAILABLE, "Only low priority loads can be cancelled: '" + p_path + "'.");
+			// If other loads depend on it, just drop the user requests and let it finish for them.
+			if (load_token->get_reference_count() == (int)load_token->user_requests && E->value.status == THREAD_LOAD_IN_PROGRESS) {
+				E->value.cancelled = true;
+			}
+		}
+
+		// The user requests are all gone, so the path is free for new requests even if a dependent keeps the token alive.
+		user_load_tokens.erase(p_path);
+		load_token->user_path.clear();
+
+		while (load_token->user_requests) {
+			load_token->user_requests--;
+			if (load_token->unreference()) {
+				must_delete = true;
+				break;
+			}
+		}
+	}
+
+	// Outside the lock, since the unused task is awaited on deletion.
+	if (must_delete) {
+		memdelete(load_token);
+	}
+
+	print_lt("CANCEL: user load tokens: " + itos(user_load_tokens.size()));
+
+	return OK;
+}
+
+bool ResourceLoader::is_load_cancelled() {
+	if (!current_load_task) {
+		return false;
+	}
+	MutexLock thread_load_lock(thread_load_mutex);
+	return current_load_task->cancelled;
+}
+
+uint32_t ResourceLoader::get_load_queue_depth() {
+	MutexLock thread_load_lock(thread_load_mutex);
+	return load_queue_depth;
+}
+
+void ResourceLoader::set_load_time_tracking(bool p_enable) {
+	MutexLock thread_load_lock(thread_load_mutex);
+	load_time_tracking = p_enable;
+	load_times.clear();
+}
+
+void ResourceLoader::take_load_times(Vector<LoadTimeInfo> &r_load_times) {
+	MutexLock thread_load_lock(thread_load_mutex);
+	r_load_times = load_times;
+	load_times.clear();
+}
+
 Ref<Resource> ResourceLoader::_load_complete(LoadToken &p_load_token, Error *r_error) {
 	MutexLock thread_load_lock(thread_load_mutex);
 	return _load_complete_inner(p_load_token, r_error, thread_load_lock);
@@ -1178,6 +1411,7 @@ bool ResourceLoader::timestamp_on_load = false;
 
 thread_local int ResourceLoader::load_nesting = 0;
 thread_local WorkerThreadPool::TaskID ResourceLoader::caller_task_id = 0;
+thread_local ResourceLoader::ThreadLoadTask *ResourceLoader::current_load_task = nullptr;
 thread_local Vector<String> *ResourceLoader::load_paths_stack;
 
 template <>
@@ -1186,6 +1420,10 @@ SafeBinaryMutex<ResourceLoader::BINARY_MUTEX_TAG> ResourceLoader::thread_load_mu
 HashMap<String, ResourceLoader::ThreadLoadTask> ResourceLoader::thread_load_tasks;
 bool ResourceLoader::cleaning_tasks = false;
 
+uint32_t ResourceLoader::load_queue_depth = 0;
+bool ResourceLoader::load_time_tracking = false;
+Vector<ResourceLoader::LoadTimeInfo> ResourceLoader::load_times;
+
 HashMap<String, ResourceLoader::LoadToken *> ResourceLoader::user_load_tokens;
 
 SelfList<Resource>::List ResourceLoader::remapped_list;
@@ -96,7 +96,8 @@ typedef void (*ResourceLoadedCallback)(Ref<Resource> p_resource, const String &p
 
 class ResourceLoader {
 	enum {
-		MAX_LOADERS = 64
+		MAX_LOADERS = 64,
+		MAX_TRACKED_LOAD_TIMES = 1024,
 	};
 
 public:
@@ -113,10 +114,21 @@ public:
 		LOAD_THREAD_DISTRIBUTE,
 	};
 
+	enum LoadPriority {
+		LOAD_PRIORITY_LOW, // Background streaming. Uses the low priority worker slots and can be cancelled.
+		LOAD_PRIORITY_HIGH, // Needed right away. Scheduled ahead of any pending low priority load.
+	};
+
+	struct LoadTimeInfo {
+		String path;
+		uint64_t usec = 0;
+	};
+
 	struct LoadToken : public RefCounted {
 		String local_path;
 		String user_path;
 		Ref<Resource> res_if_unregistered;
+		uint32_t user_requests = 0; // References held by load_threaded_request().
 
 		void clear();
 
@@ -125,7 +137,7 @@ public:
 
 	static const int BINARY_MUTEX_TAG = 1;
 
-	static Ref<LoadToken> _load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode);
+	static Ref<LoadToken> _load_start(const String &p_path, const String &p_type_hint, LoadThreadMode p_thread_mode, ResourceFormatLoader::CacheMode p_cache_mode, LoadPriority p_priority = LOAD_PRIORITY_LOW);
 	static Ref<Resource> _load_complete(LoadToken &p_load_token, Error *r_error);
 
 private:
@@ -175,13 +187,20 @@ private:
 		Ref<Resource> resource;
 		bool xl_remapped = false;
 		bool use_sub_threads = false;
+		bool prefetch_dependencies = false;
+		bool cancelled = false;
+		LoadPriority priority = LOAD_PRIORITY_LOW;
 		HashSet<String> sub_tasks;
+		Vector<Ref<LoadToken>> prefetch_tokens; // Keeps prefetched dependency loads alive until this one is done.
 	};
 
 	static void _thread_load_function(void *p_userdata);
+	static void _prefetch_dependencies(ThreadLoadTask &p_load_task);
+	static void _promote_load_task(ThreadLoadTask &p_load_task, LoadPriority p_priority);
 
 	static thread_local int load_nesting;
 	static thread_local WorkerThreadPool::TaskID caller_task_id;
+	static thread_local ThreadLoadTask *current_load_task;
 	static thread_local Vector<String> *load_paths_stack; // A pointer to avoid broken TLS implementations from double-running the destructor.
 	static SafeBinaryMutex<BINARY_MUTEX_TAG> thread_load_mutex;
 	static HashMap<String, ThreadLoadTask> thread_load_tasks;
@@ -189,12 +208,24 @@ private:
 
 	static HashMap<String, LoadToken *> user_load_tokens;
 
+	static uint32_t load_queue_depth;
+	static bool load_time_tracking;
+	static Vector<LoadTimeInfo> load_times;
+
 	static float _dependency_get_progress(const String &p_path);
 
 public:
-	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE);
+	static Error load_threaded_request(const String &p_path, const String &p_type_hint = "", bool p_use_sub_threads = false, ResourceFormatLoader::CacheMode p_cache_mode = ResourceFormatLoader::CACHE_MODE_REUSE, LoadPriority p_priority = LOAD_PRIORITY_LOW);
 	static ThreadLoadStatus load_threaded_get_status(const String &p_path, float *r_progress = nullptr);
 	static Ref<Resource> load_threaded_get(const String &p_path, Error *r_error = nullptr);
+	static Error load_threaded_cancel(const String &p_path);
+
+	// Loaders can poll this between expensive steps to bail out early with ERR_SKIP.
+	static bool is_load_cancelled();
+
+	static uint32_t get_load_queue_depth();
+	static void set_load_time_tracking(bool p_enable);
+	static void take_load_times(Vector<LoadTimeInfo> &r_load_times);
 
 	static bool is_within_load() { return load_nesting > 0; };
 
@@ -202,6 +233,9 @@ public:
 	static bool exists(const String &p_path, const String &p_type_hint = "");
 
 	static void get_recognized_extensions_for_type(const String &p_type, List<String> *p_extensions);
+	// Extensions recognized by the engine's loaders, and by custom loaders implemented in scripts or GDExtensions, which may not
+	// be thread-safe. Returns false if there are no custom loaders.
+	static bool get_custom_loader_extensions(List<String> *r_builtin_extensions, List<String> *r_custom_extensions);
 	static void add_resource_format_loader(Ref<ResourceFormatLoader> p_format_loader, bool p_at_front = false);
 	static void remove_resource_format_loader(Ref<ResourceFormatLoader> p_format_loader);
 	static void get_classes_used(const String &p_path, HashSet<StringName> *r_classes);
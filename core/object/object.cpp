@@ -877,6 +877,7 @@ void Object::set_script_and_instance(const Variant &p_script, ScriptInstance *p_
 
 	script = p_script;
 	script_instance = p_instance;
+	_script_instance_version++;
 }
 
 void Object::set_script(const Variant &p_script) {
@@ -906,6 +907,7 @@ void Object::set_script(const Variant &p_script) {
 			script_instance = s->placeholder_instance_create(this);
 		}
 	}
+	_script_instance_version++;
 
 	notify_property_list_changed(); //scripts may add variables, so refresh is desired
 	emit_signal(CoreStringNames::get_singleton()->script_changed);
@@ -921,6 +923,7 @@ void Object::set_script_instance(ScriptInstance *p_instance) {
 	}
 
 	script_instance = p_instance;
+	_script_instance_version++;
 
 	if (p_instance) {
 		script = p_instance->get_script();
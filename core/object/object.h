@@ -620,6 +620,7 @@ private:
 	void _postinitialize();
 	bool _can_translate = true;
 	bool _emitting = false;
+	uint32_t _script_instance_version = 0; // Changes with every new script instance, pointers may be reused.
 #ifdef TOOLS_ENABLED
 	bool _edited = false;
 	uint32_t _edited_version = 0;
@@ -897,6 +898,7 @@ public:
 
 	void set_script_instance(ScriptInstance *p_instance);
 	_FORCE_INLINE_ ScriptInstance *get_script_instance() const { return script_instance; }
+	_FORCE_INLINE_ uint32_t get_script_instance_version() const { return _script_instance_version; }
 
 	// Some script languages can't control instance creation, so this function eases the process.
 	void set_script_and_instance(const Variant &p_script, ScriptInstance *p_instance);
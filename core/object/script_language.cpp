@@ -44,6 +44,7 @@ Mutex ScriptServer::languages_mutex;
 
 bool ScriptServer::scripting_enabled = true;
 bool ScriptServer::reload_scripts_on_save = false;
+SafeNumeric<uint32_t> ScriptServer::script_version;
 ScriptEditRequestFunction ScriptServer::edit_request_func = nullptr;
 
 void Script::_notification(int p_what) {
@@ -265,6 +266,10 @@ bool ScriptServer::is_reload_scripts_on_save_enabled() {
 	return reload_scripts_on_save;
 }
 
+void ScriptServer::notify_script_changed() {
+	script_version.increment();
+}
+
 void ScriptServer::thread_enter() {
 	MutexLock lock(languages_mutex);
 	if (!languages_ready) {
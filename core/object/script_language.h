@@ -57,6 +57,7 @@ class ScriptServer {
 
 	static bool scripting_enabled;
 	static bool reload_scripts_on_save;
+	static SafeNumeric<uint32_t> script_version;
 
 	struct GlobalScriptClass {
 		StringName language;
@@ -81,6 +82,11 @@ public:
 	static void set_reload_scripts_on_save(bool p_enable);
 	static bool is_reload_scripts_on_save_enabled();
 
+	// Bumped whenever script code is reloaded, so cached method lookups can be refreshed.
+	// Replacing the script of an object gives it a new script instance, which callers must check themselves.
+	static void notify_script_changed();
+	_FORCE_INLINE_ static uint32_t get_script_version() { return script_version.get(); }
+
 	static void thread_enter();
 	static void thread_exit();
 
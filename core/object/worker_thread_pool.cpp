@@ -415,6 +415,50 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	return OK;
 }
 
+// Moves a low priority task that has not started yet to the front of the schedule queue,
+// so it runs ahead of any other pending work. Returns false if it's running or can't be moved.
+bool WorkerThreadPool::promote_task(TaskID p_task_id) {
+	task_mutex.lock();
+	Task **taskp = tasks.getptr(p_task_id);
+	if (!taskp) {
+		task_mutex.unlock();
+		ERR_FAIL_V_MSG(false, "Invalid Task ID"); // Invalid task
+	}
+	Task *task = *taskp;
+
+	if (task->completed || !task->low_priority || task->group || use_native_low_priority_threads || !task->task_elem.in_list()) {
+		// Done, already running or on a dedicated thread, nothing to gain.
+		task_mutex.unlock();
+		return false;
+	}
+
+	bool was_scheduled = true;
+	for (SelfList<Task> *E = low_priority_task_queue.first(); E; E = E->next()) {
+		if (E == &task->task_elem) {
+			was_scheduled = false;
+			break;
+		}
+	}
+
+	task->task_elem.remove_from_list();
+	task->low_priority = false;
+	bool post = !was_scheduled;
+	if (was_scheduled) {
+		// It already had a low priority slot and a semaphore post; give the slot back to a pending one.
+		low_priority_threads_used--;
+		if (_try_promote_low_priority_task()) {
+			post = true;
+		}
+	}
+	task_queue.add(&task->task_elem);
+	task_mutex.unlock();
+
+	if (post) {
+		task_available_semaphore.post();
+	}
+	return true;
+}
+
 WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_callable, void (*p_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks, bool p_high_priority, const String &p_description) {
 	ERR_FAIL_COND_V(p_elements < 0, INVALID_TASK_ID);
 	if (p_tasks < 0) {
@@ -535,6 +579,11 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 	task_mutex.unlock();
 }
 
+int WorkerThreadPool::get_thread_index() const {
+	const int *index = thread_ids.getptr(Thread::get_caller_id());
+	return index ? *index : -1;
+}
+
 void WorkerThreadPool::init(int p_thread_count, bool p_use_native_threads_low_priority, float p_low_priority_task_ratio) {
 	ERR_FAIL_COND(threads.size() > 0);
 	if (p_thread_count < 0) {
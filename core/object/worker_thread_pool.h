@@ -178,6 +178,7 @@ public:
 
 	bool is_task_completed(TaskID p_task_id) const;
 	Error wait_for_task_completion(TaskID p_task_id);
+	bool promote_task(TaskID p_task_id);
 
 	template <class C, class M, class U>
 	GroupID add_template_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, int p_tasks = -1, bool p_high_priority = false, const String &p_description = String()) {
@@ -195,6 +196,7 @@ public:
 	void wait_for_group_task_completion(GroupID p_group);
 
 	_FORCE_INLINE_ int get_thread_count() const { return threads.size(); }
+	int get_thread_index() const; // Index of the calling pool thread, -1 when called from any other thread.
 
 	static WorkerThreadPool *get_singleton() { return singleton; }
 	void init(int p_thread_count = -1, bool p_use_native_threads_low_priority = true, float p_low_priority_task_ratio = 0.3);
@@ -538,7 +538,7 @@ void RasterizerCanvasGLES3::_render_items(RID p_to_render_target, int p_item_cou
 	// Record Batches.
 	// First item always forms its own batch.
 	bool batch_broken = false;
-	_new_batch(batch_broken);
+	state.canvas_instance_batches.push_back(Batch());
 
 	// Override the start position and index as we want to start from where we finished off last time.
 	state.canvas_instance_batches[state.current_batch_index].start = state.last_item_index;
@@ -547,8 +547,12 @@ void RasterizerCanvasGLES3::_render_items(RID p_to_render_target, int p_item_cou
 	for (int i = 0; i < p_item_count; i++) {
 		Item *ci = items[i];
 
+		if (item_profiling) {
+			state.item_profile = get_item_profile(ci);
+		}
+
 		if (ci->final_clip_owner != state.canvas_instance_batches[state.current_batch_index].clip) {
-			_new_batch(batch_broken);
+			_new_batch(batch_broken, BATCH_BREAK_CLIP);
 			state.canvas_instance_batches[state.current_batch_index].clip = ci->final_clip_owner;
 			current_clip = ci->final_clip_owner;
 		}
@@ -569,7 +573,7 @@ void RasterizerCanvasGLES3::_render_items(RID p_to_render_target, int p_item_cou
 		}
 
 		if (material != state.canvas_instance_batches[state.current_batch_index].material) {
-			_new_batch(batch_broken);
+			_new_batch(batch_broken, BATCH_BREAK_MATERIAL);
 
 			GLES3::CanvasMaterialData *material_data = nullptr;
 			if (material.is_valid()) {
@@ -591,6 +595,8 @@ void RasterizerCanvasGLES3::_render_items(RID p_to_render_target, int p_item_cou
 		_record_item_commands(ci, p_to_render_target, p_canvas_transform_inverse, current_clip, blend_mode, p_lights, index, batch_broken, r_sdf_used);
 	}
 
+	state.item_profile = nullptr;
+
 	if (index == 0) {
 		// Nothing to render, just return.
 		state.current_batch_index = 0;
@@ -738,7 +744,7 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 	RenderingServer::CanvasItemTextureFilter texture_filter = p_item->texture_filter == RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT ? state.default_filter : p_item->texture_filter;
 
 	if (texture_filter != state.canvas_instance_batches[state.current_batch_index].filter) {
-		_new_batch(r_batch_broken);
+		_new_batch(r_batch_broken, BATCH_BREAK_TEXTURE);
 
 		state.canvas_instance_batches[state.current_batch_index].filter = texture_filter;
 	}
@@ -746,7 +752,7 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 	RenderingServer::CanvasItemTextureRepeat texture_repeat = p_item->texture_repeat == RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT ? state.default_repeat : p_item->texture_repeat;
 
 	if (texture_repeat != state.canvas_instance_batches[state.current_batch_index].repeat) {
-		_new_batch(r_batch_broken);
+		_new_batch(r_batch_broken, BATCH_BREAK_TEXTURE);
 
 		state.canvas_instance_batches[state.current_batch_index].repeat = texture_repeat;
 	}
@@ -790,7 +796,8 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 	bool lights_disabled = light_count == 0 && !state.using_directional_lights;
 
 	if (lights_disabled != state.canvas_instance_batches[state.current_batch_index].lights_disabled) {
-		_new_batch(r_batch_broken);
+		// Lights toggle a shader specialization, which costs the same as a material change.
+		_new_batch(r_batch_broken, BATCH_BREAK_MATERIAL);
 		state.canvas_instance_batches[state.current_batch_index].lights_disabled = lights_disabled;
 	}
 
@@ -835,7 +842,7 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 		}
 
 		if (blend_mode != state.canvas_instance_batches[state.current_batch_index].blend_mode || blend_color != state.canvas_instance_batches[state.current_batch_index].blend_color) {
-			_new_batch(r_batch_broken);
+			_new_batch(r_batch_broken, BATCH_BREAK_BLEND);
 			state.canvas_instance_batches[state.current_batch_index].blend_mode = blend_mode;
 			state.canvas_instance_batches[state.current_batch_index].blend_color = blend_color;
 		}
@@ -845,13 +852,23 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 				const Item::CommandRect *rect = static_cast<const Item::CommandRect *>(c);
 
 				if (rect->flags & CANVAS_RECT_TILE && state.canvas_instance_batches[state.current_batch_index].repeat != RenderingServer::CanvasItemTextureRepeat::CANVAS_ITEM_TEXTURE_REPEAT_ENABLED) {
-					_new_batch(r_batch_broken);
+					_new_batch(r_batch_broken, BATCH_BREAK_TEXTURE);
 					state.canvas_instance_batches[state.current_batch_index].repeat = RenderingServer::CanvasItemTextureRepeat::CANVAS_ITEM_TEXTURE_REPEAT_ENABLED;
 				}
 
-				if (rect->texture != state.canvas_instance_batches[state.current_batch_index].tex || state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_RECT) {
-					_new_batch(r_batch_broken);
+				// Rects whose textures live in the batch atlas can share a batch regardless of the texture.
+				Rect2 atlas_uv_rect;
+				bool use_atlas = _get_canvas_batch_atlas_rect(rect, state.canvas_instance_batches[state.current_batch_index], atlas_uv_rect);
+
+				if (state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_RECT) {
+					_new_batch(r_batch_broken, BATCH_BREAK_PRIMITIVE);
+				} else if (CanvasBatchAtlas::rect_breaks_batch({ state.canvas_instance_batches[state.current_batch_index].tex, state.canvas_instance_batches[state.current_batch_index].use_atlas }, { rect->texture, use_atlas })) {
+					_new_batch(r_batch_broken, BATCH_BREAK_TEXTURE);
+				}
+
+				if (r_batch_broken || state.canvas_instance_batches[state.current_batch_index].instance_count == 0) {
 					state.canvas_instance_batches[state.current_batch_index].tex = rect->texture;
+					state.canvas_instance_batches[state.current_batch_index].use_atlas = use_atlas;
 					state.canvas_instance_batches[state.current_batch_index].command_type = Item::Command::TYPE_RECT;
 					state.canvas_instance_batches[state.current_batch_index].command = c;
 					state.canvas_instance_batches[state.current_batch_index].shader_variant = CanvasShaderGLES3::MODE_QUAD;
@@ -918,6 +935,11 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 					state.instance_data_array[r_index].flags |= FLAGS_USE_LCD;
 				}
 
+				if (use_atlas) {
+					src_rect.position = atlas_uv_rect.position + src_rect.position * atlas_uv_rect.size;
+					src_rect.size *= atlas_uv_rect.size;
+				}
+
 				state.instance_data_array[r_index].modulation[0] = rect->modulate.r * base_color.r;
 				state.instance_data_array[r_index].modulation[1] = rect->modulate.g * base_color.g;
 				state.instance_data_array[r_index].modulation[2] = rect->modulate.b * base_color.b;
@@ -940,8 +962,9 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 				const Item::CommandNinePatch *np = static_cast<const Item::CommandNinePatch *>(c);
 
 				if (np->texture != state.canvas_instance_batches[state.current_batch_index].tex || state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_NINEPATCH) {
-					_new_batch(r_batch_broken);
+					_new_batch(r_batch_broken, state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_NINEPATCH ? BATCH_BREAK_PRIMITIVE : BATCH_BREAK_TEXTURE);
 					state.canvas_instance_batches[state.current_batch_index].tex = np->texture;
+					state.canvas_instance_batches[state.current_batch_index].use_atlas = false;
 					state.canvas_instance_batches[state.current_batch_index].command_type = Item::Command::TYPE_NINEPATCH;
 					state.canvas_instance_batches[state.current_batch_index].command = c;
 					state.canvas_instance_batches[state.current_batch_index].shader_variant = CanvasShaderGLES3::MODE_NINEPATCH;
@@ -1005,9 +1028,10 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 				const Item::CommandPolygon *polygon = static_cast<const Item::CommandPolygon *>(c);
 
 				// Polygon's can't be batched, so always create a new batch
-				_new_batch(r_batch_broken);
+				_new_batch(r_batch_broken, BATCH_BREAK_PRIMITIVE);
 
 				state.canvas_instance_batches[state.current_batch_index].tex = polygon->texture;
+				state.canvas_instance_batches[state.current_batch_index].use_atlas = false;
 				state.canvas_instance_batches[state.current_batch_index].command_type = Item::Command::TYPE_POLYGON;
 				state.canvas_instance_batches[state.current_batch_index].command = c;
 				state.canvas_instance_batches[state.current_batch_index].shader_variant = CanvasShaderGLES3::MODE_ATTRIBUTES;
@@ -1032,8 +1056,9 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 				const Item::CommandPrimitive *primitive = static_cast<const Item::CommandPrimitive *>(c);
 
 				if (primitive->point_count != state.canvas_instance_batches[state.current_batch_index].primitive_points || state.canvas_instance_batches[state.current_batch_index].command_type != Item::Command::TYPE_PRIMITIVE) {
-					_new_batch(r_batch_broken);
+					_new_batch(r_batch_broken, BATCH_BREAK_PRIMITIVE);
 					state.canvas_instance_batches[state.current_batch_index].tex = primitive->texture;
+					state.canvas_instance_batches[state.current_batch_index].use_atlas = false;
 					state.canvas_instance_batches[state.current_batch_index].primitive_points = primitive->point_count;
 					state.canvas_instance_batches[state.current_batch_index].command_type = Item::Command::TYPE_PRIMITIVE;
 					state.canvas_instance_batches[state.current_batch_index].command = c;
@@ -1084,7 +1109,7 @@ void RasterizerCanvasGLES3::_record_item_commands(const Item *p_item, RID p_rend
 				const Item::CommandClipIgnore *ci = static_cast<const Item::CommandClipIgnore *>(c);
 				if (current_clip) {
 					if (ci->ignore != reclip) {
-						_new_batch(r_batch_broken);
+						_new_batch(r_batch_broken, BATCH_BREAK_CLIP);
 						if (ci->ignore) {
 							state.canvas_instance_batches[state.current_batch_index].clip = nullptr;
 							reclip = true;
@@ -1122,7 +1147,13 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
 	// Used by Polygon.
 	static const GLenum prim[5] = { GL_POINTS, GL_LINES, GL_LINE_STRIP, GL_TRIANGLES, GL_TRIANGLE_STRIP };
 
-	_bind_canvas_texture(state.canvas_instance_batches[p_index].tex, state.canvas_instance_batches[p_index].filter, state.canvas_instance_batches[p_index].repeat);
+	if (state.canvas_instance_batches[p_index].use_atlas) {
+		_bind_canvas_batch_atlas(state.canvas_instance_batches[p_index].filter);
+	} else {
+		_bind_canvas_texture(state.canvas_instance_batches[p_index].tex, state.canvas_instance_batches[p_index].filter, state.canvas_instance_batches[p_index].repeat);
+	}
+
+	batching_info.batches++;
 
 	switch (state.canvas_instance_batches[p_index].command_type) {
 		case Item::Command::TYPE_RECT:
@@ -1134,6 +1165,7 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
 
 			glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, state.canvas_instance_batches[p_index].instance_count);
 			glBindVertexArray(0);
+			batching_info.draw_calls++;
 
 		} break;
 
@@ -1159,6 +1191,7 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
 				glDrawArraysInstanced(prim[polygon->primitive], 0, pb->count, 1);
 			}
 			glBindVertexArray(0);
+			batching_info.draw_calls++;
 
 			if (pb->color_disabled && pb->color != Color(1.0, 1.0, 1.0, 1.0)) {
 				// Reset so this doesn't pollute other draw calls.
@@ -1177,6 +1210,7 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
 			ERR_FAIL_COND(instance_count <= 0);
 			if (instance_count >= 1) {
 				glDrawArraysInstanced(primitive[state.canvas_instance_batches[p_index].primitive_points], 0, state.canvas_instance_batches[p_index].primitive_points, instance_count);
+				batching_info.draw_calls++;
 			}
 
 		} break;
@@ -1191,6 +1225,9 @@ void RasterizerCanvasGLES3::_render_batch(Light *p_lights, uint32_t p_index) {
 
 void RasterizerCanvasGLES3::_add_to_batch(uint32_t &r_index, bool &r_batch_broken) {
 	state.canvas_instance_batches[state.current_batch_index].instance_count++;
+	if (state.item_profile) {
+		state.item_profile->instances++;
+	}
 	r_index++;
 	if (r_index + state.last_item_index >= data.max_instances_per_buffer) {
 		// Copy over all data needed for rendering right away
@@ -1204,12 +1241,12 @@ void RasterizerCanvasGLES3::_add_to_batch(uint32_t &r_index, bool &r_batch_broke
 		r_index = 0;
 		state.last_item_index = 0;
 		r_batch_broken = false; // Force a new batch to be created
-		_new_batch(r_batch_broken);
+		_new_batch(r_batch_broken, BATCH_BREAK_BUFFER_FULL);
 		state.canvas_instance_batches[state.current_batch_index].start = 0;
 	}
 }
 
-void RasterizerCanvasGLES3::_new_batch(bool &r_batch_broken) {
+void RasterizerCanvasGLES3::_new_batch(bool &r_batch_broken, BatchBreakReason p_reason) {
 	if (state.canvas_instance_batches.size() == 0) {
 		state.canvas_instance_batches.push_back(Batch());
 		return;
@@ -1220,6 +1257,10 @@ void RasterizerCanvasGLES3::_new_batch(bool &r_batch_broken) {
 	}
 
 	r_batch_broken = true;
+	batching_info.batch_breaks[p_reason]++;
+	if (state.item_profile) {
+		state.item_profile->batch_breaks[p_reason]++;
+	}
 
 	// Copy the properties of the current batch, we will manually update the things that changed.
 	Batch new_batch = state.canvas_instance_batches[state.current_batch_index];
@@ -1956,6 +1997,41 @@ void RasterizerCanvasGLES3::_bind_canvas_texture(RID p_texture, RS::CanvasItemTe
 	}
 }
 
+void RasterizerCanvasGLES3::_bind_canvas_batch_atlas(RS::CanvasItemTextureFilter p_filter) {
+	GLES3::TextureStorage *texture_storage = GLES3::TextureStorage::get_singleton();
+	GLES3::Config *config = GLES3::Config::get_singleton();
+
+	// Force the next regular texture to be bound again.
+	state.current_tex = RID();
+
+	GLenum filter = p_filter == RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST ? GL_NEAREST : GL_LINEAR;
+
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, texture_storage->canvas_batch_atlas_get_texture());
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+
+	// Atlas textures never have normal or specular maps, see TextureStorage::_canvas_batch_atlas_is_texture_eligible().
+	glActiveTexture(GL_TEXTURE0 + config->max_texture_image_units - 6);
+	glBindTexture(GL_TEXTURE_2D, texture_storage->get_texture(texture_storage->texture_gl_get_default(GLES3::DEFAULT_GL_TEXTURE_NORMAL))->tex_id);
+	glActiveTexture(GL_TEXTURE0 + config->max_texture_image_units - 7);
+	glBindTexture(GL_TEXTURE_2D, texture_storage->get_texture(texture_storage->texture_gl_get_default(GLES3::DEFAULT_GL_TEXTURE_WHITE))->tex_id);
+}
+
+bool RasterizerCanvasGLES3::_get_canvas_batch_atlas_rect(const Item::CommandRect *p_rect, const Batch &p_batch, Rect2 &r_uv_rect) {
+	GLES3::TextureStorage *texture_storage = GLES3::TextureStorage::get_singleton();
+
+	if (!texture_storage->canvas_batch_atlas_is_enabled()) {
+		return false;
+	}
+
+	if (!CanvasBatchAtlas::can_draw_rect(p_rect->texture, p_batch.material.is_valid(), p_rect->flags, p_batch.filter, p_batch.repeat)) {
+		return false;
+	}
+
+	return texture_storage->canvas_batch_atlas_get_uv_rect(p_rect->texture, r_uv_rect);
+}
+
 void RasterizerCanvasGLES3::_prepare_canvas_texture(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, uint32_t &r_index, Size2 &r_texpixel_size) {
 	GLES3::TextureStorage *texture_storage = GLES3::TextureStorage::get_singleton();
 
@@ -252,6 +252,7 @@ public:
 		uint32_t instance_buffer_index = 0;
 
 		RID tex;
+		bool use_atlas = false; // Samples from the canvas batch atlas instead of `tex`.
 		RS::CanvasItemTextureFilter filter = RS::CANVAS_ITEM_TEXTURE_FILTER_MAX;
 		RS::CanvasItemTextureRepeat repeat = RS::CANVAS_ITEM_TEXTURE_REPEAT_MAX;
 
@@ -290,6 +291,9 @@ public:
 		uint32_t current_batch_index = 0;
 		uint32_t last_item_index = 0;
 
+		// Profile of the item currently being recorded, only set while item profiling is enabled.
+		ItemProfile *item_profile = nullptr;
+
 		InstanceData *instance_data_array = nullptr;
 
 		LightUniform *light_uniforms = nullptr;
@@ -346,6 +350,8 @@ public:
 	void update() override;
 
 	void _bind_canvas_texture(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat);
+	void _bind_canvas_batch_atlas(RS::CanvasItemTextureFilter p_filter);
+	bool _get_canvas_batch_atlas_rect(const Item::CommandRect *p_rect, const Batch &p_batch, Rect2 &r_uv_rect);
 	void _prepare_canvas_texture(RID p_texture, RS::CanvasItemTextureFilter p_base_filter, RS::CanvasItemTextureRepeat p_base_repeat, uint32_t &r_index, Size2 &r_texpixel_size);
 
 	void canvas_render_items(RID p_to_render_target, Item *p_item_list, const Color &p_modulate, Light *p_light_list, Light *p_directional_list, const Transform2D &p_canvas_transform, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, bool &r_sdf_used) override;
@@ -353,7 +359,7 @@ public:
 	void _record_item_commands(const Item *p_item, RID p_render_target, const Transform2D &p_canvas_transform_inverse, Item *&current_clip, GLES3::CanvasShaderData::BlendMode p_blend_mode, Light *p_lights, uint32_t &r_index, bool &r_break_batch, bool &r_sdf_used);
 	void _render_batch(Light *p_lights, uint32_t p_index);
 	bool _bind_material(GLES3::CanvasMaterialData *p_material_data, CanvasShaderGLES3::ShaderVariant p_variant, uint64_t p_specialization);
-	void _new_batch(bool &r_batch_broken);
+	void _new_batch(bool &r_batch_broken, BatchBreakReason p_reason);
 	void _add_to_batch(uint32_t &r_index, bool &r_batch_broken);
 	void _allocate_instance_data_buffer();
 	void _allocate_instance_buffer();
@@ -181,6 +181,13 @@ TextureStorage::TextureStorage() {
 
 	glBindTexture(GL_TEXTURE_2D, 0);
 
+	{ // Canvas batch atlas, the texture itself is created on first update.
+		canvas_batch_atlas.enabled = GLOBAL_GET("rendering/2d/batching/use_texture_atlas");
+		int atlas_size = MIN(int(GLOBAL_GET("rendering/2d/batching/atlas_size")), int(Config::get_singleton()->max_texture_size));
+		canvas_batch_atlas.layout.set_max_size(Size2i(atlas_size, atlas_size));
+		canvas_batch_atlas.layout.set_max_texture_size(GLOBAL_GET("rendering/2d/batching/atlas_max_texture_size"));
+	}
+
 	{
 		sdf_shader.shader.initialize();
 		sdf_shader.shader_version = sdf_shader.shader.version_create();
@@ -204,6 +211,7 @@ TextureStorage::~TextureStorage() {
 	texture_atlas.texture = 0;
 	glDeleteFramebuffers(1, &texture_atlas.framebuffer);
 	texture_atlas.framebuffer = 0;
+	_canvas_batch_atlas_free_data();
 	sdf_shader.shader.version_free(sdf_shader.shader_version);
 }
 
@@ -665,6 +673,7 @@ void TextureStorage::texture_free(RID p_texture) {
 	}
 
 	texture_atlas_remove_texture(p_texture);
+	canvas_batch_atlas.layout.erase(p_texture);
 
 	for (int i = 0; i < t->proxies.size(); i++) {
 		Texture *p = texture_owner.get_or_null(t->proxies[i]);
@@ -738,6 +747,7 @@ void TextureStorage::texture_2d_update(RID p_texture, const Ref<Image> &p_image,
 	Texture *tex = texture_owner.get_or_null(p_texture);
 	ERR_FAIL_NULL(tex);
 	GLES3::Utilities::get_singleton()->texture_resize_data(tex->tex_id, tex->total_data_size);
+	canvas_batch_atlas.layout.mark_dirty(p_texture);
 
 #ifdef TOOLS_ENABLED
 	tex->image_cache_2d.unref();
@@ -944,6 +954,7 @@ void TextureStorage::texture_replace(RID p_texture, RID p_by_texture) {
 	texture_owner.free(p_by_texture);
 
 	texture_atlas_mark_dirty_on_texture(p_texture);
+	canvas_batch_atlas.layout.erase(p_texture); // Size or format may have changed, request it again.
 }
 
 void TextureStorage::texture_set_size_override(RID p_texture, int p_width, int p_height) {
@@ -1428,6 +1439,174 @@ void TextureStorage::update_texture_atlas() {
 	glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
+/* CANVAS BATCH ATLAS API */
+
+bool TextureStorage::_canvas_batch_atlas_is_texture_eligible(const Texture *p_texture) const {
+	if (!p_texture->active || p_texture->tex_id == 0 || p_texture->is_proxy || p_texture->is_external || p_texture->is_render_target || p_texture->render_target) {
+		return false;
+	}
+	if (p_texture->type != Texture::TYPE_2D || p_texture->target != GL_TEXTURE_2D || p_texture->layers != 1) {
+		return false;
+	}
+	if (p_texture->compressed || p_texture->mipmaps > 1 || p_texture->resize_to_po2) {
+		return false;
+	}
+	// Swizzled formats can't be copied as-is with a framebuffer blit.
+	if (p_texture->real_format != Image::FORMAT_RGBA8 && p_texture->real_format != Image::FORMAT_RGB8) {
+		return false;
+	}
+
+	const CanvasTexture *ct = p_texture->canvas_texture;
+	if (ct && (ct->normal_map.is_valid() || ct->specular.is_valid() || ct->texture_filter != RS::CANVAS_ITEM_TEXTURE_FILTER_DEFAULT || ct->texture_repeat != RS::CANVAS_ITEM_TEXTURE_REPEAT_DEFAULT)) {
+		return false;
+	}
+
+	return true;
+}
+
+void TextureStorage::_canvas_batch_atlas_free_data() {
+	if (canvas_batch_atlas.texture != 0) {
+		GLES3::Utilities::get_singleton()->texture_free_data(canvas_batch_atlas.texture);
+		canvas_batch_atlas.texture = 0;
+	}
+	if (canvas_batch_atlas.framebuffer != 0) {
+		glDeleteFramebuffers(1, &canvas_batch_atlas.framebuffer);
+		canvas_batch_atlas.framebuffer = 0;
+	}
+	if (canvas_batch_atlas.read_framebuffer != 0) {
+		glDeleteFramebuffers(1, &canvas_batch_atlas.read_framebuffer);
+		canvas_batch_atlas.read_framebuffer = 0;
+	}
+	canvas_batch_atlas.size = Size2i();
+}
+
+void TextureStorage::_canvas_batch_atlas_blit(RID p_texture, const CanvasBatchAtlas::Entry &p_entry) {
+	const Texture *src_tex = get_texture(p_texture);
+	ERR_FAIL_NULL(src_tex);
+
+	glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, src_tex->tex_id, 0);
+
+	const int w = p_entry.size.width;
+	const int h = p_entry.size.height;
+	const int x = p_entry.rect.position.x;
+	const int y = p_entry.rect.position.y;
+
+	glBlitFramebuffer(0, 0, w, h, x, y, x + w, y + h, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+
+	// Extrude the edges into the padding so linear filtering doesn't bleed neighbors in.
+	glBlitFramebuffer(0, 0, w, 1, x, y - 1, x + w, y, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+	glBlitFramebuffer(0, h - 1, w, h, x, y + h, x + w, y + h + 1, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+	glBlitFramebuffer(0, 0, 1, h, x - 1, y, x, y + h, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+	glBlitFramebuffer(w - 1, 0, w, h, x + w, y, x + w + 1, y + h, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+}
+
+GLuint TextureStorage::canvas_batch_atlas_get_texture() const {
+	return canvas_batch_atlas.texture;
+}
+
+bool TextureStorage::canvas_batch_atlas_get_uv_rect(RID p_texture, Rect2 &r_uv_rect) {
+	if (!canvas_batch_atlas.enabled) {
+		return false;
+	}
+
+	if (canvas_batch_atlas.layout.get_uv_rect(p_texture, r_uv_rect)) {
+		return canvas_batch_atlas.texture != 0;
+	}
+
+	const Texture *t = get_texture(p_texture);
+	if (!t || !_canvas_batch_atlas_is_texture_eligible(t)) {
+		return false;
+	}
+
+	// Newly requested textures are packed on the next update and batched from then on.
+	canvas_batch_atlas.layout.request(p_texture, Size2i(t->width, t->height));
+	return false;
+}
+
+void TextureStorage::update_canvas_batch_atlas() {
+	if (!canvas_batch_atlas.enabled) {
+		return;
+	}
+
+	canvas_batch_atlas.layout.advance_frame();
+
+	if (!canvas_batch_atlas.layout.is_dirty()) {
+		if (canvas_batch_atlas.layout.has_dirty_contents() && canvas_batch_atlas.texture != 0) {
+			// Only copy the textures whose contents changed, their regions didn't move.
+			glDisable(GL_SCISSOR_TEST);
+			glBindFramebuffer(GL_DRAW_FRAMEBUFFER, canvas_batch_atlas.framebuffer);
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, canvas_batch_atlas.read_framebuffer);
+			for (const KeyValue<RID, CanvasBatchAtlas::Entry> &E : canvas_batch_atlas.layout.get_entries()) {
+				if (E.value.packed && E.value.contents_dirty) {
+					_canvas_batch_atlas_blit(E.key, E.value);
+				}
+			}
+			glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+			glBindFramebuffer(GL_FRAMEBUFFER, system_fbo);
+		}
+		canvas_batch_atlas.layout.clear_dirty_contents();
+		return;
+	}
+
+	canvas_batch_atlas.layout.pack();
+
+	Size2i atlas_size = canvas_batch_atlas.layout.get_size();
+	if (atlas_size == Size2i()) {
+		_canvas_batch_atlas_free_data();
+		return;
+	}
+
+	if (canvas_batch_atlas.size != atlas_size) {
+		_canvas_batch_atlas_free_data();
+
+		glGenTextures(1, &canvas_batch_atlas.texture);
+		glActiveTexture(GL_TEXTURE0);
+		glBindTexture(GL_TEXTURE_2D, canvas_batch_atlas.texture);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, atlas_size.width, atlas_size.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		GLES3::Utilities::get_singleton()->texture_allocated_data(canvas_batch_atlas.texture, atlas_size.width * atlas_size.height * 4, "Canvas batch atlas");
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+		glBindTexture(GL_TEXTURE_2D, 0);
+
+		glGenFramebuffers(1, &canvas_batch_atlas.framebuffer);
+		glBindFramebuffer(GL_FRAMEBUFFER, canvas_batch_atlas.framebuffer);
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, canvas_batch_atlas.texture, 0);
+
+		GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+		if (status != GL_FRAMEBUFFER_COMPLETE) {
+			glBindFramebuffer(GL_FRAMEBUFFER, system_fbo);
+			_canvas_batch_atlas_free_data();
+			canvas_batch_atlas.enabled = false;
+			WARN_PRINT("Could not create canvas batch atlas, status: " + get_framebuffer_error(status) + ". Texture atlas batching will be disabled.");
+			return;
+		}
+
+		glGenFramebuffers(1, &canvas_batch_atlas.read_framebuffer);
+		canvas_batch_atlas.size = atlas_size;
+	}
+
+	glDisable(GL_SCISSOR_TEST);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, canvas_batch_atlas.framebuffer);
+	glClearColor(0.0, 0.0, 0.0, 0.0);
+	glClear(GL_COLOR_BUFFER_BIT);
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, canvas_batch_atlas.read_framebuffer);
+
+	for (const KeyValue<RID, CanvasBatchAtlas::Entry> &E : canvas_batch_atlas.layout.get_entries()) {
+		if (E.value.packed) {
+			_canvas_batch_atlas_blit(E.key, E.value);
+		}
+	}
+
+	glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+	glBindFramebuffer(GL_FRAMEBUFFER, system_fbo);
+}
+
 /* RENDER TARGET API */
 
 GLuint TextureStorage::system_fbo = 0;
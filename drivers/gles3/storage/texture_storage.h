@@ -38,6 +38,7 @@
 #include "config.h"
 #include "core/os/os.h"
 #include "core/templates/rid_owner.h"
+#include "servers/rendering/canvas_batch_atlas.h"
 #include "servers/rendering/renderer_compositor.h"
 #include "servers/rendering/storage/texture_storage.h"
 
@@ -429,6 +430,22 @@ private:
 		Size2i size;
 	} texture_atlas;
 
+	/* CANVAS BATCH ATLAS API */
+
+	struct CanvasBatchAtlasData {
+		bool enabled = false;
+		CanvasBatchAtlas layout;
+
+		GLuint texture = 0;
+		GLuint framebuffer = 0;
+		GLuint read_framebuffer = 0;
+		Size2i size;
+	} canvas_batch_atlas;
+
+	bool _canvas_batch_atlas_is_texture_eligible(const Texture *p_texture) const;
+	void _canvas_batch_atlas_free_data();
+	void _canvas_batch_atlas_blit(RID p_texture, const CanvasBatchAtlas::Entry &p_entry);
+
 	/* Render Target API */
 
 	mutable RID_Owner<RenderTarget> render_target_owner;
@@ -547,6 +564,15 @@ public:
 	void texture_atlas_mark_dirty_on_texture(RID p_texture);
 	void texture_atlas_remove_texture(RID p_texture);
 
+	/* CANVAS BATCH ATLAS API */
+
+	void update_canvas_batch_atlas();
+
+	_FORCE_INLINE_ bool canvas_batch_atlas_is_enabled() const { return canvas_batch_atlas.enabled; }
+	GLuint canvas_batch_atlas_get_texture() const;
+	bool canvas_batch_atlas_get_uv_rect(RID p_texture, Rect2 &r_uv_rect);
+	const CanvasBatchAtlas &canvas_batch_atlas_get_layout() const { return canvas_batch_atlas.layout; }
+
 	/* RENDER TARGET API */
 
 	static GLuint system_fbo;
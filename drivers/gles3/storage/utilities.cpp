@@ -235,6 +235,7 @@ void Utilities::update_dirty_resources() {
 	MaterialStorage::get_singleton()->_update_global_shader_uniforms();
 	MaterialStorage::get_singleton()->_update_queued_materials();
 	TextureStorage::get_singleton()->update_texture_atlas();
+	TextureStorage::get_singleton()->update_canvas_batch_atlas();
 }
 
 void Utilities::set_debug_generate_wireframes(bool p_generate) {
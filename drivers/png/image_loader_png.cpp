@@ -38,6 +38,11 @@
 
 Error ImageLoaderPNG::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitField<ImageFormatLoader::LoaderFlags> p_flags, float p_scale) {
 	const uint64_t buffer_size = f->get_length();
+	const uint8_t *mapped = f->get_mapped_buffer(buffer_size);
+	if (mapped) {
+		// Decode straight from the file mapping, no need for an intermediate copy.
+		return PNGDriverCommon::png_to_image(mapped, buffer_size, p_flags & FLAG_FORCE_LINEAR, p_image);
+	}
 	Vector<uint8_t> file_buffer;
 	Error err = file_buffer.resize(buffer_size);
 	if (err) {
@@ -51,6 +56,21 @@ Error ImageLoaderPNG::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitField
 	return PNGDriverCommon::png_to_image(reader, buffer_size, p_flags & FLAG_FORCE_LINEAR, p_image);
 }
 
+Error ImageLoaderPNG::load_image_region(Ref<Image> p_image, Ref<FileAccess> f, BitField<ImageFormatLoader::LoaderFlags> p_flags, const Rect2i &p_region, int p_shrink) {
+	const uint64_t buffer_size = f->get_length();
+	const uint8_t *mapped = f->get_mapped_buffer(buffer_size);
+	if (mapped) {
+		return PNGDriverCommon::png_to_image_region(mapped, buffer_size, p_flags & FLAG_FORCE_LINEAR, p_region, p_shrink, p_image);
+	}
+	Vector<uint8_t> file_buffer;
+	Error err = file_buffer.resize(buffer_size);
+	if (err) {
+		return err;
+	}
+	f->get_buffer(file_buffer.ptrw(), buffer_size);
+	return PNGDriverCommon::png_to_image_region(file_buffer.ptr(), buffer_size, p_flags & FLAG_FORCE_LINEAR, p_region, p_shrink, p_image);
+}
+
 void ImageLoaderPNG::get_recognized_extensions(List<String> *p_extensions) const {
 	p_extensions->push_back("png");
 }
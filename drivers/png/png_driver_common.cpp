@@ -30,6 +30,7 @@
 
 #include "png_driver_common.h"
 
+#include "core/io/image_loader.h"
 #include "core/os/os.h"
 
 #include <png.h>
@@ -40,20 +41,24 @@ namespace PNGDriverCommon {
 // Print any warnings.
 // On error, set explain and return true.
 // Call should be wrapped in ERR_FAIL_COND
+static void print_warning(const char *p_message) {
+#ifdef TOOLS_ENABLED
+	// suppress this warning, to avoid log spam when opening assetlib
+	const static char *const noisy = "iCCP: known incorrect sRGB profile";
+	const Engine *const eng = Engine::get_singleton();
+	if (eng && eng->is_editor_hint() && !strcmp(p_message, noisy)) {
+		return;
+	}
+#endif
+	WARN_PRINT(p_message);
+}
+
 static bool check_error(const png_image &image) {
 	const png_uint_32 failed = PNG_IMAGE_FAILED(image);
 	if (failed & PNG_IMAGE_ERROR) {
 		return true;
 	} else if (failed) {
-#ifdef TOOLS_ENABLED
-		// suppress this warning, to avoid log spam when opening assetlib
-		const static char *const noisy = "iCCP: known incorrect sRGB profile";
-		const Engine *const eng = Engine::get_singleton();
-		if (eng && eng->is_editor_hint() && !strcmp(image.message, noisy)) {
-			return false;
-		}
-#endif
-		WARN_PRINT(image.message);
+		print_warning(image.message);
 	}
 	return false;
 }
@@ -124,6 +129,117 @@ Error png_to_image(const uint8_t *p_source, size_t p_size, bool p_force_linear,
 	return OK;
 }
 
+struct MemoryReader {
+	const uint8_t *data = nullptr;
+	size_t size = 0;
+	size_t offset = 0;
+};
+
+static void read_from_memory(png_structp p_png, png_bytep r_data, size_t p_length) {
+	MemoryReader *reader = (MemoryReader *)png_get_io_ptr(p_png);
+	if (p_length > reader->size - reader->offset) {
+		png_error(p_png, "Read past end of data.");
+	}
+	memcpy(r_data, reader->data + reader->offset, p_length);
+	reader->offset += p_length;
+}
+
+static void on_error(png_structp p_png, png_const_charp p_message) {
+	ERR_PRINT(p_message);
+	png_longjmp(p_png, 1);
+}
+
+static void on_warning(png_structp p_png, png_const_charp p_message) {
+	print_warning(p_message);
+}
+
+Error png_to_image_region(const uint8_t *p_source, size_t p_size, bool p_force_linear, const Rect2i &p_region, int p_shrink, Ref<Image> p_image) {
+	// Uses the progressive row API instead of png_image, so rows outside the region are
+	// never stored and decoding stops after its last row.
+	MemoryReader reader;
+	reader.data = p_source;
+	reader.size = p_size;
+
+	png_structp png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, on_error, on_warning);
+	ERR_FAIL_NULL_V(png, ERR_OUT_OF_MEMORY);
+	png_infop info = png_create_info_struct(png);
+	if (!info) {
+		png_destroy_read_struct(&png, nullptr, nullptr);
+		ERR_FAIL_V(ERR_OUT_OF_MEMORY);
+	}
+
+	// Declared before setjmp, nothing with a destructor may be created between it and png_error().
+	ImageRegionWriter writer;
+	LocalVector<uint8_t> row;
+	Error err = OK;
+
+	if (setjmp(png_jmpbuf(png))) {
+		png_destroy_read_struct(&png, &info, nullptr);
+		return ERR_FILE_CORRUPT;
+	}
+
+	png_set_read_fn(png, &reader, read_from_memory);
+	png_read_info(png, info);
+
+	const png_uint_32 width = png_get_image_width(png, info);
+	const png_uint_32 height = png_get_image_height(png, info);
+	const int bit_depth = png_get_bit_depth(png, info);
+
+	if (png_get_interlace_type(png, info) != PNG_INTERLACE_NONE) {
+		// Interlaced rows are only complete after the last pass, decode the whole image instead.
+		png_destroy_read_struct(&png, &info, nullptr);
+		err = png_to_image(p_source, p_size, p_force_linear, p_image);
+		if (err != OK) {
+			return err;
+		}
+		return ImageRegionWriter::apply(p_image, p_region, p_shrink);
+	}
+
+	// Match the formats and gamma handling of png_to_image(): palettes, low bit depths
+	// and tRNS are expanded, 16 bit is reduced to 8 bit sRGB.
+	png_set_expand(png);
+	if (bit_depth == 16) {
+		png_set_scale_16(png);
+	}
+	png_set_gamma(png, PNG_DEFAULT_sRGB, (bit_depth == 16 && p_force_linear) ? PNG_GAMMA_LINEAR : PNG_DEFAULT_sRGB);
+	png_read_update_info(png, info);
+
+	Image::Format dest_format;
+	switch (png_get_channels(png, info)) {
+		case 1:
+			dest_format = Image::FORMAT_L8;
+			break;
+		case 2:
+			dest_format = Image::FORMAT_LA8;
+			break;
+		case 3:
+			dest_format = Image::FORMAT_RGB8;
+			break;
+		case 4:
+			dest_format = Image::FORMAT_RGBA8;
+			break;
+		default:
+			png_destroy_read_struct(&png, &info, nullptr);
+			ERR_PRINT("Unsupported png format.");
+			return ERR_UNAVAILABLE;
+	}
+
+	err = writer.begin(width, height, dest_format, p_region, p_shrink);
+	if (err != OK) {
+		png_destroy_read_struct(&png, &info, nullptr);
+		return err;
+	}
+
+	row.resize(png_get_rowbytes(png, info));
+	for (int y = 0; y < writer.get_end_row(); y++) {
+		png_read_row(png, row.ptr(), nullptr);
+		writer.write_row(y, row.ptr());
+	}
+	png_destroy_read_struct(&png, &info, nullptr);
+
+	return writer.finish(p_image);
+}
+
 Error image_to_png(const Ref<Image> &p_image, Vector<uint8_t> &p_buffer) {
 	Ref<Image> source_image = p_image->duplicate();
 
@@ -38,6 +38,9 @@ namespace PNGDriverCommon {
 // Attempt to load png from buffer (p_source, p_size) into p_image
 Error png_to_image(const uint8_t *p_source, size_t p_size, bool p_force_linear, Ref<Image> p_image);
 
+// Decode only p_region of the png, shrunk by p_shrink, row by row into p_image.
+Error png_to_image_region(const uint8_t *p_source, size_t p_size, bool p_force_linear, const Rect2i &p_region, int p_shrink, Ref<Image> p_image);
+
 // Append p_image, as a png, to p_buffer.
 // Contents of p_buffer is unspecified if error returned.
 Error image_to_png(const Ref<Image> &p_image, Vector<uint8_t> &p_buffer);
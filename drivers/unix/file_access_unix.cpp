@@ -37,6 +37,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -142,6 +143,9 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	_release_mapping();
+	map_failed = false;
+
 	fclose(f);
 	f = nullptr;
 
@@ -237,6 +241,98 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+uint32_t FileAccessUnix::MappingKey::hash(const MappingKey &p_key) {
+	uint32_t h = hash_murmur3_one_64(p_key.device);
+	h = hash_murmur3_one_64(p_key.inode, h);
+	h = hash_murmur3_one_64(p_key.length, h);
+	h = hash_murmur3_one_64(p_key.modified_time, h);
+	return hash_fmix32(h);
+}
+
+FileAccessUnix::Mapping *FileAccessUnix::_acquire_mapping() const {
+	struct stat st = {};
+	if (fstat(fileno(f), &st) != 0 || (st.st_mode & S_IFMT) != S_IFREG || st.st_size <= 0) {
+		return nullptr;
+	}
+
+	MappingKey key;
+	key.device = st.st_dev;
+	key.inode = st.st_ino;
+	key.length = st.st_size;
+	key.modified_time = st.st_mtime;
+
+	MutexLock lock(mappings_mutex);
+
+	Mapping **existing = mappings.getptr(key);
+	if (existing) {
+		(*existing)->refcount++;
+		return *existing;
+	}
+
+	void *data = mmap(nullptr, key.length, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+	if (data == MAP_FAILED) {
+		return nullptr;
+	}
+
+	Mapping *new_mapping = memnew(Mapping);
+	new_mapping->key = key;
+	new_mapping->data = (uint8_t *)data;
+	new_mapping->length = key.length;
+	new_mapping->refcount = 1;
+	mappings.insert(key, new_mapping);
+	return new_mapping;
+}
+
+void FileAccessUnix::_release_mapping() {
+	if (!mapping) {
+		return;
+	}
+
+	MutexLock lock(mappings_mutex);
+
+	mapping->refcount--;
+	if (mapping->refcount == 0) {
+		mappings.erase(mapping->key);
+		munmap(mapping->data, mapping->length);
+		memdelete(mapping);
+	}
+	mapping = nullptr;
+}
+
+const uint8_t *FileAccessUnix::get_mapped_buffer(uint64_t p_length) const {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+	// Files open for writing could change under the mapping.
+	if (flags != READ || map_failed) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	// Project files are edited and reimported while the editor reads them.
+	const bool exported_data = false;
+#else
+	const bool exported_data = path_src.begins_with("res://");
+#endif
+	if (!read_only_data && !exported_data) {
+		return nullptr;
+	}
+
+	if (!mapping) {
+		mapping = _acquire_mapping();
+		if (!mapping) {
+			// Not a regular file, or out of address space, don't try again.
+			map_failed = true;
+			return nullptr;
+		}
+	}
+
+	uint64_t pos = get_position();
+	if (pos > mapping->length || p_length > mapping->length - pos) {
+		return nullptr;
+	}
+	ERR_FAIL_COND_V(fseeko(f, pos + p_length, SEEK_SET), nullptr);
+	return mapping->data + pos;
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -392,6 +488,8 @@ void FileAccessUnix::close() {
 }
 
 CloseNotificationFunc FileAccessUnix::close_notification_func = nullptr;
+Mutex FileAccessUnix::mappings_mutex;
+HashMap<FileAccessUnix::MappingKey, FileAccessUnix::Mapping *, FileAccessUnix::MappingKey> FileAccessUnix::mappings;
 
 FileAccessUnix::~FileAccessUnix() {
 	_close();
@@ -33,6 +33,8 @@
 
 #include "core/io/file_access.h"
 #include "core/os/memory.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
 
 #include <stdio.h>
 
@@ -43,6 +45,35 @@ typedef void (*CloseNotificationFunc)(const String &p_file, int p_flags);
 class FileAccessUnix : public FileAccess {
 	FILE *f = nullptr;
 	int flags = 0;
+
+	// Whole file mappings are shared by every handle reading the same file, so a pack or a file reopened
+	// by several threads is only mapped once. Entries are keyed by the file identity and dropped with the last handle.
+	struct MappingKey {
+		uint64_t device = 0;
+		uint64_t inode = 0;
+		uint64_t length = 0;
+		int64_t modified_time = 0;
+
+		static uint32_t hash(const MappingKey &p_key);
+		bool operator==(const MappingKey &p_key) const { return device == p_key.device && inode == p_key.inode && length == p_key.length && modified_time == p_key.modified_time; }
+	};
+
+	struct Mapping {
+		MappingKey key;
+		uint8_t *data = nullptr;
+		uint64_t length = 0;
+		uint32_t refcount = 0;
+	};
+
+	static Mutex mappings_mutex;
+	static HashMap<MappingKey, Mapping *, MappingKey> mappings;
+
+	// Created on the first get_mapped_buffer() call of a read-only file.
+	mutable Mapping *mapping = nullptr;
+	mutable bool map_failed = false;
+	Mapping *_acquire_mapping() const;
+	void _release_mapping();
+
 	void check_errors() const;
 	mutable Error last_error = OK;
 	String save_path;
@@ -69,6 +100,7 @@ public:
 
 	virtual uint8_t get_8() const override; ///< get a byte
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual const uint8_t *get_mapped_buffer(uint64_t p_length) const override;
 
 	virtual Error get_error() const override; ///< get last error
 
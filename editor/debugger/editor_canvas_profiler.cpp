@@ -0,0 +1,284 @@
+/**************************************************************************/
+/*  editor_canvas_profiler.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "editor_canvas_profiler.h"
+
+#include "editor/editor_scale.h"
+#include "editor/editor_string_names.h"
+#include "scene/main/timer.h"
+
+// Rows shown in the tree, the game side already sends only the worst offenders of each frame.
+static const int MAX_DISPLAYED_ITEMS = 512;
+
+void EditorCanvasProfiler::add_frame(uint64_t p_frame_number, const Vector<ItemMetric> &p_items) {
+	if (p_frame_number != last_frame_number) {
+		last_frame_number = p_frame_number;
+		frame_count++;
+	}
+
+	for (const ItemMetric &metric : p_items) {
+		HashMap<ObjectID, ItemTotal>::Iterator E = totals.find(metric.instance_id);
+		if (!E) {
+			E = totals.insert(metric.instance_id, ItemTotal());
+			E->value.instance_id = metric.instance_id;
+		}
+		ItemTotal &total = E->value;
+		total.name = metric.name;
+		total.instances += metric.instances;
+		total.batch_breaks += metric.batch_breaks;
+		total.batch_break_mask |= metric.batch_break_mask;
+		total.cull_msec += metric.cull_msec;
+	}
+
+	dirty = true;
+	if (update_timer->is_stopped()) {
+		update_timer->start();
+	}
+}
+
+void EditorCanvasProfiler::clear() {
+	totals.clear();
+	frame_count = 0;
+	last_frame_number = 0;
+	dirty = true;
+	_update_items();
+}
+
+String EditorCanvasProfiler::_get_break_reasons_text(uint32_t p_mask) {
+	// Same order as the RENDERING_INFO_CANVAS_BATCH_BREAKS_* constants.
+	static const char *reason_names[] = {
+		TTRC("Texture"),
+		TTRC("Material"),
+		TTRC("Clip"),
+		TTRC("Blend"),
+		TTRC("Primitive"),
+	};
+
+	String text;
+	for (uint32_t i = 0; i < sizeof(reason_names) / sizeof(reason_names[0]); i++) {
+		if (p_mask & (1 << i)) {
+			if (!text.is_empty()) {
+				text += ", ";
+			}
+			text += TTRGET(reason_names[i]);
+		}
+	}
+	return text;
+}
+
+void EditorCanvasProfiler::_update_items() {
+	if (!dirty) {
+		return;
+	}
+	dirty = false;
+
+	items->clear();
+	frames_label->set_text(vformat(TTR("Frames: %d"), frame_count));
+	if (totals.is_empty() || frame_count == 0) {
+		return;
+	}
+
+	Vector<const ItemTotal *> sorted;
+	sorted.resize(totals.size());
+	{
+		const ItemTotal **w = sorted.ptrw();
+		int idx = 0;
+		for (const KeyValue<ObjectID, ItemTotal> &E : totals) {
+			w[idx++] = &E.value;
+		}
+	}
+
+	switch (sort_mode->get_selected()) {
+		case SORT_BATCH_BREAKS: {
+			struct SortBreaks {
+				bool operator()(const ItemTotal *p_a, const ItemTotal *p_b) const { return p_a->batch_breaks == p_b->batch_breaks ? p_a->instances > p_b->instances : p_a->batch_breaks > p_b->batch_breaks; }
+			};
+			sorted.sort_custom<SortBreaks>();
+		} break;
+		case SORT_INSTANCES: {
+			struct SortInstances {
+				bool operator()(const ItemTotal *p_a, const ItemTotal *p_b) const { return p_a->instances == p_b->instances ? p_a->batch_breaks > p_b->batch_breaks : p_a->instances > p_b->instances; }
+			};
+			sorted.sort_custom<SortInstances>();
+		} break;
+		case SORT_CULL_TIME: {
+			struct SortCullTime {
+				bool operator()(const ItemTotal *p_a, const ItemTotal *p_b) const { return p_a->cull_msec > p_b->cull_msec; }
+			};
+			sorted.sort_custom<SortCullTime>();
+		} break;
+	}
+
+	// Values are shown as averages per profiled frame.
+	double frames = double(frame_count);
+	TreeItem *root = items->create_item();
+	for (int i = 0; i < MIN(sorted.size(), MAX_DISPLAYED_ITEMS); i++) {
+		const ItemTotal *total = sorted[i];
+		TreeItem *item = items->create_item(root);
+		item->set_text(0, total->name);
+		item->set_tooltip_text(0, total->name);
+		item->set_metadata(0, uint64_t(total->instance_id));
+		item->set_text(1, String::num(total->instances / frames, 1));
+		item->set_text(2, String::num(total->batch_breaks / frames, 2));
+		item->set_text(3, _get_break_reasons_text(total->batch_break_mask));
+		item->set_text(4, String::num(total->cull_msec / frames, 3));
+	}
+}
+
+void EditorCanvasProfiler::_item_activated() {
+	TreeItem *item = items->get_selected();
+	if (!item) {
+		return;
+	}
+	ObjectID id = ObjectID(uint64_t(item->get_metadata(0)));
+	if (id.is_valid()) {
+		emit_signal(SNAME("object_selected"), id);
+	}
+}
+
+void EditorCanvasProfiler::_sort_changed(int p_mode) {
+	dirty = true;
+	_update_items();
+}
+
+void EditorCanvasProfiler::_activate_pressed() {
+	if (activate->is_pressed()) {
+		_clear_pressed(); //always clear on start
+		clear_button->set_disabled(false);
+	}
+	_update_button_text();
+	emit_signal(SNAME("enable_profiling"), activate->is_pressed());
+}
+
+void EditorCanvasProfiler::_clear_pressed() {
+	clear_button->set_disabled(true);
+	clear();
+}
+
+void EditorCanvasProfiler::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_ENTER_TREE:
+		case NOTIFICATION_LAYOUT_DIRECTION_CHANGED:
+		case NOTIFICATION_THEME_CHANGED:
+		case NOTIFICATION_TRANSLATION_CHANGED: {
+			_update_button_text();
+			clear_button->set_icon(get_editor_theme_icon(SNAME("Clear")));
+		} break;
+	}
+}
+
+void EditorCanvasProfiler::_bind_methods() {
+	ADD_SIGNAL(MethodInfo("enable_profiling", PropertyInfo(Variant::BOOL, "enable")));
+	ADD_SIGNAL(MethodInfo("object_selected", PropertyInfo(Variant::INT, "id")));
+}
+
+void EditorCanvasProfiler::_update_button_text() {
+	if (activate->is_pressed()) {
+		activate->set_icon(get_editor_theme_icon(SNAME("Stop")));
+		activate->set_text(TTR("Stop"));
+	} else {
+		activate->set_icon(get_editor_theme_icon(is_layout_rtl() ? SNAME("PlayBackwards") : SNAME("Play")));
+		activate->set_text(TTR("Start"));
+	}
+}
+
+void EditorCanvasProfiler::set_enabled(bool p_enable) {
+	activate->set_disabled(!p_enable);
+}
+
+void EditorCanvasProfiler::set_pressed(bool p_pressed) {
+	activate->set_pressed(p_pressed);
+	_update_button_text();
+}
+
+bool EditorCanvasProfiler::is_profiling() {
+	return activate->is_pressed();
+}
+
+EditorCanvasProfiler::EditorCanvasProfiler() {
+	HBoxContainer *hb = memnew(HBoxContainer);
+	add_child(hb);
+	activate = memnew(Button);
+	activate->set_toggle_mode(true);
+	activate->set_disabled(true);
+	activate->set_text(TTR("Start"));
+	activate->connect("pressed", callable_mp(this, &EditorCanvasProfiler::_activate_pressed));
+	hb->add_child(activate);
+
+	clear_button = memnew(Button);
+	clear_button->set_text(TTR("Clear"));
+	clear_button->set_disabled(true);
+	clear_button->connect("pressed", callable_mp(this, &EditorCanvasProfiler::_clear_pressed));
+	hb->add_child(clear_button);
+
+	hb->add_child(memnew(Label(TTR("Sort By:"))));
+
+	sort_mode = memnew(OptionButton);
+	sort_mode->add_item(TTR("Batch Breaks"));
+	sort_mode->add_item(TTR("Instances"));
+	sort_mode->add_item(TTR("Cull Time"));
+	sort_mode->connect("item_selected", callable_mp(this, &EditorCanvasProfiler::_sort_changed));
+	hb->add_child(sort_mode);
+
+	hb->add_spacer();
+
+	frames_label = memnew(Label(vformat(TTR("Frames: %d"), 0)));
+	hb->add_child(frames_label);
+
+	hb->add_theme_constant_override("separation", 8 * EDSCALE);
+
+	items = memnew(Tree);
+	items->set_v_size_flags(SIZE_EXPAND_FILL);
+	items->set_hide_folding(true);
+	items->set_hide_root(true);
+	items->set_columns(5);
+	items->set_column_titles_visible(true);
+	items->set_column_title(0, TTR("Canvas Item"));
+	items->set_column_expand(0, true);
+	items->set_column_clip_content(0, true);
+	items->set_column_custom_minimum_width(0, 200 * EDSCALE);
+	items->set_column_title(1, TTR("Instances"));
+	items->set_column_title(2, TTR("Batch Breaks"));
+	items->set_column_title(3, TTR("Break Reasons"));
+	items->set_column_title(4, TTR("Cull (ms)"));
+	for (int i = 1; i < 5; i++) {
+		items->set_column_expand(i, false);
+		items->set_column_clip_content(i, true);
+		items->set_column_custom_minimum_width(i, (i == 3 ? 160 : 90) * EDSCALE);
+	}
+	items->connect("item_activated", callable_mp(this, &EditorCanvasProfiler::_item_activated));
+	add_child(items);
+
+	update_timer = memnew(Timer);
+	update_timer->set_wait_time(0.5);
+	update_timer->set_one_shot(true);
+	add_child(update_timer);
+	update_timer->connect("timeout", callable_mp(this, &EditorCanvasProfiler::_update_items));
+}
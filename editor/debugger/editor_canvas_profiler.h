@@ -0,0 +1,107 @@
+/**************************************************************************/
+/*  editor_canvas_profiler.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef EDITOR_CANVAS_PROFILER_H
+#define EDITOR_CANVAS_PROFILER_H
+
+#include "scene/gui/box_container.h"
+#include "scene/gui/button.h"
+#include "scene/gui/label.h"
+#include "scene/gui/option_button.h"
+#include "scene/gui/tree.h"
+
+class EditorCanvasProfiler : public VBoxContainer {
+	GDCLASS(EditorCanvasProfiler, VBoxContainer);
+
+public:
+	struct ItemMetric {
+		String name;
+		ObjectID instance_id;
+		uint32_t instances = 0;
+		uint32_t batch_breaks = 0;
+		uint32_t batch_break_mask = 0;
+		double cull_msec = 0;
+	};
+
+	enum SortMode {
+		SORT_BATCH_BREAKS,
+		SORT_INSTANCES,
+		SORT_CULL_TIME,
+	};
+
+private:
+	struct ItemTotal {
+		String name;
+		ObjectID instance_id;
+		uint64_t instances = 0;
+		uint64_t batch_breaks = 0;
+		uint32_t batch_break_mask = 0;
+		double cull_msec = 0;
+	};
+
+	Button *activate = nullptr;
+	Button *clear_button = nullptr;
+	OptionButton *sort_mode = nullptr;
+	Label *frames_label = nullptr;
+	Tree *items = nullptr;
+
+	// Totals since profiling started, keyed by remote object ID.
+	HashMap<ObjectID, ItemTotal> totals;
+	uint64_t frame_count = 0;
+	uint64_t last_frame_number = 0;
+
+	bool dirty = false;
+	Timer *update_timer = nullptr;
+
+	void _update_button_text();
+	void _activate_pressed();
+	void _clear_pressed();
+	void _sort_changed(int p_mode);
+	void _item_activated();
+	void _update_items();
+
+	static String _get_break_reasons_text(uint32_t p_mask);
+
+protected:
+	void _notification(int p_what);
+	static void _bind_methods();
+
+public:
+	void add_frame(uint64_t p_frame_number, const Vector<ItemMetric> &p_items);
+	void set_enabled(bool p_enable);
+	void set_pressed(bool p_pressed);
+	bool is_profiling();
+
+	void clear();
+
+	EditorCanvasProfiler();
+};
+
+#endif // EDITOR_CANVAS_PROFILER_H
@@ -37,6 +37,7 @@
 #include "core/string/ustring.h"
 #include "core/version.h"
 #include "editor/debugger/debug_adapter/debug_adapter_protocol.h"
+#include "editor/debugger/editor_canvas_profiler.h"
 #include "editor/debugger/editor_performance_profiler.h"
 #include "editor/debugger/editor_profiler.h"
 #include "editor/debugger/editor_visual_profiler.h"
@@ -343,6 +344,7 @@ void ScriptEditorDebugger::_parse_message(const String &p_msg, uint64_t p_thread
 			}
 			profiler->set_enabled(false, false);
 			visual_profiler->set_enabled(false);
+			canvas_profiler->set_enabled(false);
 		}
 		_update_buttons_state();
 
@@ -372,6 +374,7 @@ void ScriptEditorDebugger::_parse_message(const String &p_msg, uint64_t p_thread
 				profiler->disable_seeking();
 
 				visual_profiler->set_enabled(true);
+				canvas_profiler->set_enabled(true);
 
 				_set_reason_text(TTR("Execution resumed."), MESSAGE_SUCCESS);
 				emit_signal(SNAME("breaked"), false, false, "", false);
@@ -520,6 +523,24 @@ void ScriptEditorDebugger::_parse_message(const String &p_msg, uint64_t p_thread
 			}
 		}
 		visual_profiler->add_frame_metric(metric);
+	} else if (p_msg == "canvas:profile_frame") {
+		ServersDebugger::CanvasProfilerFrame frame;
+		ERR_FAIL_COND_MSG(!frame.deserialize(p_data), "Failed to deserialize canvas profiler frame.");
+
+		Vector<EditorCanvasProfiler::ItemMetric> metrics;
+		metrics.resize(frame.items.size());
+		{
+			EditorCanvasProfiler::ItemMetric *metrics_ptr = metrics.ptrw();
+			for (int i = 0; i < frame.items.size(); i++) {
+				metrics_ptr[i].name = frame.items[i].name;
+				metrics_ptr[i].instance_id = frame.items[i].instance_id;
+				metrics_ptr[i].instances = frame.items[i].instances;
+				metrics_ptr[i].batch_breaks = frame.items[i].batch_breaks;
+				metrics_ptr[i].batch_break_mask = frame.items[i].batch_break_mask;
+				metrics_ptr[i].cull_msec = frame.items[i].cull_msec;
+			}
+		}
+		canvas_profiler->add_frame(frame.frame_number, metrics);
 	} else if (p_msg == "error") {
 		DebuggerMarshalls::OutputError oe;
 		ERR_FAIL_COND_MSG(oe.deserialize(p_data) == false, "Failed to deserialize error message");
@@ -977,6 +998,7 @@ void ScriptEditorDebugger::start(Ref<RemoteDebuggerPeer> p_peer) {
 
 	profiler->set_enabled(true, true);
 	visual_profiler->set_enabled(true);
+	canvas_profiler->set_enabled(true);
 
 	peer = p_peer;
 	ERR_FAIL_COND(p_peer.is_null());
@@ -1059,6 +1081,9 @@ void ScriptEditorDebugger::stop() {
 	visual_profiler->set_enabled(false);
 	visual_profiler->set_pressed(false);
 
+	canvas_profiler->set_enabled(false);
+	canvas_profiler->set_pressed(false);
+
 	inspector->edit(nullptr);
 	_update_buttons_state();
 }
@@ -1070,6 +1095,9 @@ void ScriptEditorDebugger::_profiler_activate(bool p_enable, int p_type) {
 		case PROFILER_VISUAL:
 			_put_msg("profiler:visual", msg_data);
 			break;
+		case PROFILER_CANVAS:
+			_put_msg("profiler:canvas", msg_data);
+			break;
 		case PROFILER_SCRIPTS_SERVERS:
 			if (p_enable) {
 				// Clear old script signatures. (should we move all this into the profiler?)
@@ -1989,6 +2017,14 @@ ScriptEditorDebugger::ScriptEditorDebugger() {
 		visual_profiler->connect("enable_profiling", callable_mp(this, &ScriptEditorDebugger::_profiler_activate).bind(PROFILER_VISUAL));
 	}
 
+	{ //canvas item profiler
+		canvas_profiler = memnew(EditorCanvasProfiler);
+		canvas_profiler->set_name(TTR("Canvas Profiler"));
+		tabs->add_child(canvas_profiler);
+		canvas_profiler->connect("enable_profiling", callable_mp(this, &ScriptEditorDebugger::_profiler_activate).bind(PROFILER_CANVAS));
+		canvas_profiler->connect("object_selected", callable_mp(this, &ScriptEditorDebugger::_remote_object_selected));
+	}
+
 	{ //monitors
 		performance_profiler = memnew(EditorPerformanceProfiler);
 		tabs->add_child(performance_profiler);
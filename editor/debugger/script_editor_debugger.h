@@ -51,6 +51,7 @@ class ItemList;
 class EditorProfiler;
 class EditorFileDialog;
 class EditorVisualProfiler;
+class EditorCanvasProfiler;
 class EditorPerformanceProfiler;
 class SceneDebuggerTree;
 class EditorDebuggerPlugin;
@@ -73,6 +74,7 @@ private:
 
 	enum ProfilerType {
 		PROFILER_VISUAL,
+		PROFILER_CANVAS,
 		PROFILER_SCRIPTS_SERVERS
 	};
 
@@ -151,6 +153,7 @@ private:
 
 	EditorProfiler *profiler = nullptr;
 	EditorVisualProfiler *visual_profiler = nullptr;
+	EditorCanvasProfiler *canvas_profiler = nullptr;
 	EditorPerformanceProfiler *performance_profiler = nullptr;
 
 	OS::ProcessID remote_pid = 0;
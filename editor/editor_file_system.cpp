@@ -46,6 +46,7 @@
 #include "editor/editor_settings.h"
 
 EditorFileSystem *EditorFileSystem::singleton = nullptr;
+int EditorFileSystem::import_thread_limit = 0;
 //the name is the version, to keep compatibility with different versions of Godot
 #define CACHE_FILE_NAME "filesystem_cache8"
 
@@ -226,14 +227,35 @@ void EditorFileSystem::_scan_filesystem() {
 	String project = ProjectSettings::get_singleton()->get_resource_path();
 
 	String fscache = EditorPaths::get_singleton()->get_project_settings_dir().path_join(CACHE_FILE_NAME);
+	uint64_t cache_begin_time = OS::get_singleton()->get_ticks_usec();
 	{
+		// Map (or read) the whole cache at once and split the lines in memory, much faster than reading line by line on
+		// big projects. The mapping stays valid while the file is open.
 		Ref<FileAccess> f = FileAccess::open(fscache, FileAccess::READ);
+		const int64_t data_size = f.is_valid() ? f->get_length() : 0;
+		const char *data = nullptr;
+		Vector<uint8_t> cache_data;
+		if (data_size > 0) {
+			data = (const char *)f->get_mapped_buffer(data_size);
+			if (!data) {
+				cache_data = f->get_buffer(data_size);
+				data = cache_data.size() == data_size ? (const char *)cache_data.ptr() : nullptr;
+			}
+		}
 
 		bool first = true;
-		if (f.is_valid()) {
+		if (data) {
+			int64_t line_from = 0;
+
 			//read the disk cache
-			while (!f->eof_reached()) {
-				String l = f->get_line().strip_edges();
+			while (line_from < data_size) {
+				int64_t line_to = line_from;
+				while (line_to < data_size && data[line_to] != '\n') {
+					line_to++;
+				}
+				String l = String::utf8(data + line_from, line_to - line_from).strip_edges();
+				line_from = line_to + 1;
+
 				if (first) {
 					if (first_scan) {
 						// only use this on first scan, afterwards it gets ignored
@@ -299,6 +321,7 @@ void EditorFileSystem::_scan_filesystem() {
 			}
 		}
 	}
+	print_verbose(vformat("EditorFileSystem: Read %d entries from the filesystem cache in %d ms.", file_cache.size(), (OS::get_singleton()->get_ticks_usec() - cache_begin_time) / 1000));
 
 	String update_cache = EditorPaths::get_singleton()->get_project_settings_dir().path_join("filesystem_update4");
 
@@ -326,9 +349,7 @@ void EditorFileSystem::_scan_filesystem() {
 	new_filesystem = memnew(EditorFileSystemDirectory);
 	new_filesystem->parent = nullptr;
 
-	Ref<DirAccess> d = DirAccess::create(DirAccess::ACCESS_RESOURCES);
-	d->change_dir("res://");
-	_scan_new_dir(new_filesystem, d, sp);
+	_scan_new_dir(new_filesystem, "res://", sp);
 
 	file_cache.clear(); //clear caches, no longer needed
 
@@ -523,6 +544,10 @@ bool EditorFileSystem::_test_for_reimport(const String &p_path, bool p_only_impo
 	return false; //nothing changed
 }
 
+void EditorFileSystem::_test_for_reimport_thread(uint32_t p_index, TestReimportThreadData *p_data) {
+	p_data->results[p_index] = _test_for_reimport(p_data->paths[p_index], false);
+}
+
 bool EditorFileSystem::_scan_import_support(Vector<String> reimports) {
 	if (import_support_queries.size() == 0) {
 		return false;
@@ -570,6 +595,28 @@ bool EditorFileSystem::_update_scan_actions() {
 	Vector<String> reimports;
 	Vector<String> reloads;
 
+	// Checking the md5 of the sources is the slow part of testing for reimport, do it in parallel beforehand.
+	Vector<String> test_paths;
+	for (const ItemAction &ia : scan_actions) {
+		if (ia.action == ItemAction::ACTION_FILE_TEST_REIMPORT) {
+			test_paths.push_back(ia.dir->get_path().path_join(ia.file));
+		}
+	}
+
+	Vector<bool> test_results;
+	test_results.resize(test_paths.size());
+	if (test_paths.size()) {
+		uint64_t test_begin_time = OS::get_singleton()->get_ticks_usec();
+		TestReimportThreadData tdata;
+		tdata.paths = test_paths.ptr();
+		tdata.results = test_results.ptrw();
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_test_for_reimport_thread, &tdata, test_paths.size(), -1, false, SNAME("TestForReimport"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		print_verbose(vformat("EditorFileSystem: Tested %d files for reimport in %d ms.", test_paths.size(), (OS::get_singleton()->get_ticks_usec() - test_begin_time) / 1000));
+	}
+	int test_index = 0;
+
 	for (const ItemAction &ia : scan_actions) {
 		switch (ia.action) {
 			case ItemAction::ACTION_NONE: {
@@ -633,10 +680,11 @@ bool EditorFileSystem::_update_scan_actions() {
 
 			} break;
 			case ItemAction::ACTION_FILE_TEST_REIMPORT: {
+				bool must_reimport = test_results[test_index++];
 				int idx = ia.dir->find_file_index(ia.file);
 				ERR_CONTINUE(idx == -1);
 				String full_path = ia.dir->get_file_path(idx);
-				if (_test_for_reimport(full_path, false)) {
+				if (must_reimport) {
 					//must reimport
 					reimports.push_back(full_path);
 					Vector<String> dependencies = _get_dependencies(full_path);
@@ -762,13 +810,15 @@ EditorFileSystem::ScanProgress EditorFileSystem::ScanProgress::get_sub(int p_cur
 	return sp;
 }
 
-void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, Ref<DirAccess> &da, const ScanProgress &p_progress) {
-	List<String> dirs;
-	List<String> files;
-
-	String cd = da->get_current_dir();
+void EditorFileSystem::_scan_dir_thread(uint32_t p_index, ScanDir *p_dirs) {
+	ScanDir &sd = p_dirs[p_index];
 
-	p_dir->modified_time = FileAccess::get_modified_time(cd);
+	Ref<DirAccess> da = DirAccess::open(sd.path);
+	if (da.is_null()) {
+		return;
+	}
+	sd.valid = true;
+	sd.modified_time = FileAccess::get_modified_time(sd.path);
 
 	da->list_dir_begin();
 	while (true) {
@@ -786,176 +836,272 @@ void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, Ref<DirAc
 				continue;
 			}
 
-			if (_should_skip_directory(cd.path_join(f))) {
+			if (_should_skip_directory(sd.path.path_join(f))) {
 				continue;
 			}
 
-			dirs.push_back(f);
+			sd.dirs.push_back(f);
 
-		} else {
-			files.push_back(f);
+		} else if (valid_extensions.has(f.get_extension().to_lower())) {
+			sd.files.push_back(f);
 		}
 	}
 
 	da->list_dir_end();
 
-	dirs.sort_custom<NaturalNoCaseComparator>();
-	files.sort_custom<NaturalNoCaseComparator>();
+	// Skip links back into the current directory or out of it, to avoid recursion.
+	const String cd = da->get_current_dir();
+	for (int i = sd.dirs.size() - 1; i >= 0; i--) {
+		if (da->change_dir(sd.dirs[i]) != OK) {
+			continue; // Reported when listing the next level.
+		}
+		const String d = da->get_current_dir();
+		if (d == cd || !d.begins_with(cd)) {
+			sd.dirs.remove_at(i);
+		}
+		da->change_dir(cd);
+	}
 
-	int total = dirs.size() + files.size();
-	int idx = 0;
+	sd.dirs.sort_custom<NaturalNoCaseComparator>();
+	sd.files.sort_custom<NaturalNoCaseComparator>();
+}
 
-	for (List<String>::Element *E = dirs.front(); E; E = E->next(), idx++) {
-		if (da->change_dir(E->get()) == OK) {
-			String d = da->get_current_dir();
+void EditorFileSystem::_scan_file(ScanFile &r_file) {
+	EditorFileSystemDirectory::FileInfo *fi = r_file.fi;
+	const String &path = r_file.path;
+	String ext = fi->file.get_extension().to_lower();
 
-			if (d == cd || !d.begins_with(cd)) {
-				da->change_dir(cd); //avoid recursion
-			} else {
-				EditorFileSystemDirectory *efd = memnew(EditorFileSystemDirectory);
+	// Only reads happen here, anything touching shared editor state is left to _scan_new_dir(). Called on worker threads,
+	// except for files that custom loaders may handle, which are checked serially on the scanning thread.
+	const FileCache *fc = file_cache.getptr(path);
+	uint64_t mt = FileAccess::get_modified_time(path);
 
-				efd->parent = p_dir;
-				efd->name = E->get();
+	if (import_extensions.has(ext)) {
+		//is imported
+		uint64_t import_mt = 0;
+		if (FileAccess::exists(path + ".import")) {
+			import_mt = FileAccess::get_modified_time(path + ".import");
+		}
 
-				_scan_new_dir(efd, da, p_progress.get_sub(idx, total));
+		if (fc && fc->modification_time == mt && fc->import_modification_time == import_mt && !_test_for_reimport(path, true)) {
+			fi->type = fc->type;
+			fi->resource_script_class = fc->resource_script_class;
+			fi->uid = fc->uid;
+			fi->deps = fc->deps;
+			fi->modified_time = fc->modification_time;
+			fi->import_modified_time = fc->import_modification_time;
 
-				int idx2 = 0;
-				for (int i = 0; i < p_dir->subdirs.size(); i++) {
-					if (efd->name.naturalnocasecmp_to(p_dir->subdirs[i]->name) < 0) {
-						break;
-					}
-					idx2++;
-				}
-				if (idx2 == p_dir->subdirs.size()) {
-					p_dir->subdirs.push_back(efd);
-				} else {
-					p_dir->subdirs.insert(idx2, efd);
-				}
+			fi->import_valid = fc->import_valid;
+			fi->script_class_name = fc->script_class_name;
+			fi->import_group_file = fc->import_group_file;
+			fi->script_class_extends = fc->script_class_extends;
+			fi->script_class_icon_path = fc->script_class_icon_path;
 
-				da->change_dir("..");
+			if (revalidate_import_files && !ResourceFormatImporter::get_singleton()->are_import_settings_valid(path)) {
+				r_file.test_reimport = true;
 			}
+
+			if (fc->type.is_empty()) {
+				fi->type = ResourceLoader::get_resource_type(path);
+				fi->resource_script_class = ResourceLoader::get_resource_script_class(path);
+				fi->import_group_file = ResourceLoader::get_import_group_file(path);
+				//there is also the chance that file type changed due to reimport, must probably check this somehow here (or kind of note it for next time in another file?)
+				//note: I think this should not happen any longer..
+			}
+
+			if (fc->uid == ResourceUID::INVALID_ID) {
+				// imported files should always have a UID, so attempt to fetch it.
+				fi->uid = ResourceLoader::get_resource_uid(path);
+			}
+
 		} else {
-			ERR_PRINT("Cannot go into subdir '" + E->get() + "'.");
+			fi->type = ResourceFormatImporter::get_singleton()->get_resource_type(path);
+			fi->uid = ResourceFormatImporter::get_singleton()->get_resource_uid(path);
+			fi->import_group_file = ResourceFormatImporter::get_singleton()->get_import_group_file(path);
+			fi->modified_time = 0;
+			fi->import_modified_time = 0;
+			fi->import_valid = fi->type == "TextFile" ? true : ResourceLoader::is_import_valid(path);
+
+			r_file.update_script_class = true;
+			r_file.test_reimport = true;
 		}
+	} else {
+		if (fc && fc->modification_time == mt) {
+			//not imported, so just update type if changed
+			fi->type = fc->type;
+			fi->resource_script_class = fc->resource_script_class;
+			fi->uid = fc->uid;
+			fi->modified_time = fc->modification_time;
+			fi->deps = fc->deps;
+			fi->import_modified_time = 0;
+			fi->import_valid = true;
+			fi->script_class_name = fc->script_class_name;
+			fi->script_class_extends = fc->script_class_extends;
+			fi->script_class_icon_path = fc->script_class_icon_path;
+		} else {
+			//new or modified time
+			fi->type = ResourceLoader::get_resource_type(path);
+			fi->resource_script_class = ResourceLoader::get_resource_script_class(path);
+			if (fi->type == "" && textfile_extensions.has(ext)) {
+				fi->type = "TextFile";
+			}
+			fi->uid = ResourceLoader::get_resource_uid(path);
+			fi->modified_time = mt;
+			fi->import_modified_time = 0;
+			fi->import_valid = true;
 
-		p_progress.update(idx, total);
+			r_file.update_script_class = true;
+			r_file.update_dependencies = true;
+		}
 	}
+}
 
-	for (List<String>::Element *E = files.front(); E; E = E->next(), idx++) {
-		String ext = E->get().get_extension().to_lower();
-		if (!valid_extensions.has(ext)) {
-			continue; //invalid
-		}
+void EditorFileSystem::_scan_file_thread(uint32_t p_index, ScanFileThreadData *p_data) {
+	_scan_file(p_data->files[p_data->parallel_files[p_index]]);
+	p_data->done.increment();
+}
 
-		EditorFileSystemDirectory::FileInfo *fi = memnew(EditorFileSystemDirectory::FileInfo);
-		fi->file = E->get();
+void EditorFileSystem::_scan_new_dir(EditorFileSystemDirectory *p_dir, const String &p_path, const ScanProgress &p_progress) {
+	uint64_t begin_time = OS::get_singleton()->get_ticks_usec();
 
-		String path = cd.path_join(fi->file);
+	// List the tree one level at a time, the directories of each level are listed in parallel.
+	LocalVector<ScanFile> scan_files;
+	Vector<ScanDir> level;
+	int dir_count = 0;
+	{
+		ScanDir sd;
+		sd.dir = p_dir;
+		sd.path = p_path;
+		level.push_back(sd);
+	}
+
+	while (level.size()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_scan_dir_thread, level.ptrw(), level.size(), -1, false, SNAME("ScanDirectories"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+		Vector<ScanDir> next_level;
+		for (const ScanDir &sd : level) {
+			if (!sd.valid) {
+				ERR_PRINT("Cannot go into subdir '" + sd.path + "'.");
+				if (sd.dir->parent) {
+					sd.dir->parent->subdirs.erase(sd.dir);
+					memdelete(sd.dir);
+				}
+				continue;
+			}
 
-		FileCache *fc = file_cache.getptr(path);
-		uint64_t mt = FileAccess::get_modified_time(path);
+			dir_count++;
+			sd.dir->modified_time = sd.modified_time;
 
-		if (import_extensions.has(ext)) {
-			//is imported
-			uint64_t import_mt = 0;
-			if (FileAccess::exists(path + ".import")) {
-				import_mt = FileAccess::get_modified_time(path + ".import");
+			// Names are sorted already, so appending keeps the tree sorted.
+			for (const String &E : sd.dirs) {
+				EditorFileSystemDirectory *efd = memnew(EditorFileSystemDirectory);
+				efd->parent = sd.dir;
+				efd->name = E;
+				sd.dir->subdirs.push_back(efd);
+
+				ScanDir sub;
+				sub.dir = efd;
+				sub.path = sd.path.path_join(E);
+				next_level.push_back(sub);
 			}
 
-			if (fc && fc->modification_time == mt && fc->import_modification_time == import_mt && !_test_for_reimport(path, true)) {
-				fi->type = fc->type;
-				fi->resource_script_class = fc->resource_script_class;
-				fi->uid = fc->uid;
-				fi->deps = fc->deps;
-				fi->modified_time = fc->modification_time;
-				fi->import_modified_time = fc->import_modification_time;
+			for (const String &E : sd.files) {
+				ScanFile sf;
+				sf.dir = sd.dir;
+				sf.fi = memnew(EditorFileSystemDirectory::FileInfo);
+				sf.fi->file = E;
+				sf.path = sd.path.path_join(E);
+				scan_files.push_back(sf);
+			}
+		}
+		level = next_level;
+	}
 
-				fi->import_valid = fc->import_valid;
-				fi->script_class_name = fc->script_class_name;
-				fi->import_group_file = fc->import_group_file;
-				fi->script_class_extends = fc->script_class_extends;
-				fi->script_class_icon_path = fc->script_class_icon_path;
+	uint64_t list_time = OS::get_singleton()->get_ticks_usec();
 
-				if (revalidate_import_files && !ResourceFormatImporter::get_singleton()->are_import_settings_valid(path)) {
-					ItemAction ia;
-					ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
-					ia.dir = p_dir;
-					ia.file = E->get();
-					scan_actions.push_back(ia);
-				}
+	// Custom loaders implemented in scripts or GDExtensions may not be thread-safe. Files they may handle, because they
+	// recognize the extension or no engine loader does, are checked serially on this thread after the parallel pass.
+	LocalVector<uint32_t> parallel_files;
+	LocalVector<uint32_t> serial_files;
+	{
+		List<String> builtin_list;
+		List<String> custom_list;
+		bool has_custom = ResourceLoader::get_custom_loader_extensions(&builtin_list, &custom_list);
+		HashSet<String> builtin_extensions;
+		HashSet<String> custom_extensions;
+		for (const String &E : builtin_list) {
+			builtin_extensions.insert(E.to_lower());
+		}
+		for (const String &E : custom_list) {
+			custom_extensions.insert(E.to_lower());
+		}
+
+		for (uint32_t i = 0; i < scan_files.size(); i++) {
+			const String ext = scan_files[i].fi->file.get_extension().to_lower();
+			if (has_custom && (custom_extensions.has(ext) || !builtin_extensions.has(ext))) {
+				serial_files.push_back(i);
+			} else {
+				parallel_files.push_back(i);
+			}
+		}
+	}
 
-				if (fc->type.is_empty()) {
-					fi->type = ResourceLoader::get_resource_type(path);
-					fi->resource_script_class = ResourceLoader::get_resource_script_class(path);
-					fi->import_group_file = ResourceLoader::get_import_group_file(path);
-					//there is also the chance that file type changed due to reimport, must probably check this somehow here (or kind of note it for next time in another file?)
-					//note: I think this should not happen any longer..
-				}
+	// Check modified times, .import and md5 files of all other files in parallel.
+	ScanFileThreadData tdata;
+	tdata.files = scan_files.ptr();
+	tdata.parallel_files = parallel_files.ptr();
+	if (parallel_files.size()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_scan_file_thread, &tdata, parallel_files.size(), -1, false, SNAME("ScanFiles"));
+		while (!WorkerThreadPool::get_singleton()->is_group_task_completed(group_task)) {
+			p_progress.update(tdata.done.get(), scan_files.size());
+			OS::get_singleton()->delay_usec(1000);
+		}
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+	for (uint32_t i : serial_files) {
+		_scan_file(scan_files[i]);
+		tdata.done.increment();
+		p_progress.update(tdata.done.get(), scan_files.size());
+	}
 
-				if (fc->uid == ResourceUID::INVALID_ID) {
-					// imported files should always have a UID, so attempt to fetch it.
-					fi->uid = ResourceLoader::get_resource_uid(path);
-				}
+	uint64_t check_time = OS::get_singleton()->get_ticks_usec();
 
-			} else {
-				fi->type = ResourceFormatImporter::get_singleton()->get_resource_type(path);
-				fi->uid = ResourceFormatImporter::get_singleton()->get_resource_uid(path);
-				fi->import_group_file = ResourceFormatImporter::get_singleton()->get_import_group_file(path);
-				fi->script_class_name = _get_global_script_class(fi->type, path, &fi->script_class_extends, &fi->script_class_icon_path);
-				fi->modified_time = 0;
-				fi->import_modified_time = 0;
-				fi->import_valid = fi->type == "TextFile" ? true : ResourceLoader::is_import_valid(path);
+	for (const ScanFile &sf : scan_files) {
+		EditorFileSystemDirectory::FileInfo *fi = sf.fi;
 
-				ItemAction ia;
-				ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
-				ia.dir = p_dir;
-				ia.file = E->get();
-				scan_actions.push_back(ia);
-			}
-		} else {
-			if (fc && fc->modification_time == mt) {
-				//not imported, so just update type if changed
-				fi->type = fc->type;
-				fi->resource_script_class = fc->resource_script_class;
-				fi->uid = fc->uid;
-				fi->modified_time = fc->modification_time;
-				fi->deps = fc->deps;
-				fi->import_modified_time = 0;
-				fi->import_valid = true;
-				fi->script_class_name = fc->script_class_name;
-				fi->script_class_extends = fc->script_class_extends;
-				fi->script_class_icon_path = fc->script_class_icon_path;
-			} else {
-				//new or modified time
-				fi->type = ResourceLoader::get_resource_type(path);
-				fi->resource_script_class = ResourceLoader::get_resource_script_class(path);
-				if (fi->type == "" && textfile_extensions.has(ext)) {
-					fi->type = "TextFile";
-				}
-				fi->uid = ResourceLoader::get_resource_uid(path);
-				fi->script_class_name = _get_global_script_class(fi->type, path, &fi->script_class_extends, &fi->script_class_icon_path);
-				fi->deps = _get_dependencies(path);
-				fi->modified_time = mt;
-				fi->import_modified_time = 0;
-				fi->import_valid = true;
-
-				if (ClassDB::is_parent_class(fi->type, SNAME("Script"))) {
-					_queue_update_script_class(path);
-				}
+		if (sf.update_script_class) {
+			fi->script_class_name = _get_global_script_class(fi->type, sf.path, &fi->script_class_extends, &fi->script_class_icon_path);
+		}
+
+		if (sf.update_dependencies) {
+			fi->deps = _get_dependencies(sf.path);
+			if (ClassDB::is_parent_class(fi->type, SNAME("Script"))) {
+				_queue_update_script_class(sf.path);
 			}
 		}
 
+		if (sf.test_reimport) {
+			ItemAction ia;
+			ia.action = ItemAction::ACTION_FILE_TEST_REIMPORT;
+			ia.dir = sf.dir;
+			ia.file = fi->file;
+			scan_actions.push_back(ia);
+		}
+
 		if (fi->uid != ResourceUID::INVALID_ID) {
 			if (ResourceUID::get_singleton()->has_id(fi->uid)) {
-				ResourceUID::get_singleton()->set_id(fi->uid, path);
+				ResourceUID::get_singleton()->set_id(fi->uid, sf.path);
 			} else {
-				ResourceUID::get_singleton()->add_id(fi->uid, path);
+				ResourceUID::get_singleton()->add_id(fi->uid, sf.path);
 			}
 		}
 
-		p_dir->files.push_back(fi);
-		p_progress.update(idx, total);
+		sf.dir->files.push_back(fi);
 	}
+
+	uint64_t end_time = OS::get_singleton()->get_ticks_usec();
+	print_verbose(vformat("EditorFileSystem: Scanned %d directories and %d files in \"%s\" in %d ms (listing: %d ms, checking files: %d ms, updating: %d ms).", dir_count, scan_files.size(), p_path, (end_time - begin_time) / 1000, (list_time - begin_time) / 1000, (check_time - list_time) / 1000, (end_time - check_time) / 1000));
 }
 
 void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, const ScanProgress &p_progress) {
@@ -1012,9 +1158,7 @@ void EditorFileSystem::_scan_fs_changes(EditorFileSystemDirectory *p_dir, const
 
 					efd->parent = p_dir;
 					efd->name = f;
-					Ref<DirAccess> d = DirAccess::create(DirAccess::ACCESS_RESOURCES);
-					d->change_dir(cd.path_join(f));
-					_scan_new_dir(efd, d, p_progress.get_sub(1, 1));
+					_scan_new_dir(efd, cd.path_join(f), p_progress.get_sub(1, 1));
 
 					ItemAction ia;
 					ia.action = ItemAction::ACTION_DIR_ADD;
@@ -2056,7 +2200,23 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 	List<String> import_variants;
 	List<String> gen_files;
 	Variant meta;
-	Error err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &meta);
+
+	// Reuse the result of an identical import from the shared cache, if enabled. Metadata isn't known before importing,
+	// this only skips hashing the inputs of importers that never cache.
+	String cache_key;
+	bool restored = false;
+	if (import_cache.is_enabled() && importer->can_cache_import(Variant())) {
+		cache_key = EditorImportCache::get_key(p_file, importer, opts, params, generator_parameters);
+		restored = import_cache.restore(cache_key, base_path, &import_variants, &meta);
+		if (restored) {
+			print_verbose(vformat("EditorFileSystem: \"%s\" restored from the import cache.", p_file));
+		}
+	}
+
+	Error err = OK;
+	if (!restored) {
+		err = importer->import(p_file, base_path, params, &import_variants, &gen_files, &meta);
+	}
 
 	ERR_FAIL_COND_V_MSG(err != OK, ERR_FILE_UNRECOGNIZED, "Error importing '" + p_file + "'.");
 
@@ -2165,6 +2325,11 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 		}
 	}
 
+	// Imports which generate extra files aren't cached, those files belong to the project.
+	if (!restored && !cache_key.is_empty() && gen_files.is_empty() && importer->can_cache_import(meta)) {
+		import_cache.store(cache_key, base_path, importer->get_save_extension(), import_variants, meta);
+	}
+
 	// Update cpos, newly created files could've changed the index of the reimported p_file.
 	_find_file(p_file, &fs, cpos);
 
@@ -2216,6 +2381,7 @@ void EditorFileSystem::_find_group_files(EditorFileSystemDirectory *efd, HashMap
 }
 
 void EditorFileSystem::reimport_file_with_custom_parameters(const String &p_file, const String &p_importer, const HashMap<StringName, Variant> &p_custom_params) {
+	import_cache.configure();
 	_reimport_file(p_file, p_custom_params, p_importer);
 
 	// Emit the resource_reimported signal for the single file we just reimported.
@@ -2229,9 +2395,16 @@ void EditorFileSystem::_reimport_thread(uint32_t p_index, ImportThreadData *p_im
 	_reimport_file(p_import_data->reimport_files[p_import_data->reimport_from + p_index].path);
 }
 
+void EditorFileSystem::_import_file_info_thread(uint32_t p_index, ImportFile *p_files) {
+	ImportFile &ifile = p_files[p_index];
+	ifile.group_file = ResourceFormatImporter::get_singleton()->get_import_group_file(ifile.path);
+	ResourceFormatImporter::get_singleton()->get_import_order_threads_and_importer(ifile.path, ifile.order, ifile.threaded, ifile.importer);
+}
+
 void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	ERR_FAIL_COND_MSG(importing, "Attempted to call reimport_files() recursively, this is not allowed.");
 	importing = true;
+	import_cache.configure();
 
 	Vector<String> reloads;
 
@@ -2241,6 +2414,9 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 
 	HashSet<String> groups_to_reimport;
 
+	// Parse the .import files of all sources in parallel, to get their importers and groups.
+	Vector<ImportFile> import_infos;
+	import_infos.resize(p_files.size());
 	for (int i = 0; i < p_files.size(); i++) {
 		String file = p_files[i];
 
@@ -2248,8 +2424,16 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 		if (uid != ResourceUID::INVALID_ID && ResourceUID::get_singleton()->has_id(uid)) {
 			file = ResourceUID::get_singleton()->get_id_path(uid);
 		}
+		import_infos.write[i].path = file;
+	}
+	if (import_infos.size()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_import_file_info_thread, import_infos.ptrw(), import_infos.size(), -1, false, SNAME("ImportFileInfo"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
 
-		String group_file = ResourceFormatImporter::get_singleton()->get_import_group_file(file);
+	for (int i = 0; i < import_infos.size(); i++) {
+		const String &file = import_infos[i].path;
+		String group_file = import_infos[i].group_file;
 
 		if (group_file_cache.has(file)) {
 			// Maybe the file itself is a group!
@@ -2264,11 +2448,8 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 			groups_to_reimport.insert(group_file);
 		} else {
 			// It's a regular file.
-			ImportFile ifile;
-			ifile.path = file;
-			ResourceFormatImporter::get_singleton()->get_import_order_threads_and_importer(file, ifile.order, ifile.threaded, ifile.importer);
 			reloads.push_back(file);
-			reimport_files.push_back(ifile);
+			reimport_files.push_back(import_infos[i]);
 		}
 
 		// Group may have changed, so also update group reference.
@@ -2306,7 +2487,7 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 					tdata.reimport_from = from;
 					tdata.reimport_files = reimport_files.ptr();
 
-					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &tdata, i - from + 1, -1, false, vformat(TTR("Import resources of type: %s"), reimport_files[from].importer));
+					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &tdata, i - from + 1, import_thread_limit > 0 ? MIN(import_thread_limit, i - from + 1) : -1, false, vformat(TTR("Import resources of type: %s"), reimport_files[from].importer));
 					int current_index = from - 1;
 					do {
 						if (current_index < tdata.max_index) {
@@ -36,6 +36,7 @@
 #include "core/os/thread_safe.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/safe_refcount.h"
+#include "editor/editor_import_cache.h"
 #include "scene/main/node.h"
 
 class FileAccess;
@@ -188,6 +189,9 @@ class EditorFileSystem : public Node {
 	EditorFileSystemDirectory *filesystem = nullptr;
 
 	static EditorFileSystem *singleton;
+	static int import_thread_limit;
+
+	EditorImportCache import_cache;
 
 	/* Used for reading the filesystem cache file */
 	struct FileCache {
@@ -227,7 +231,34 @@ class EditorFileSystem : public Node {
 	HashSet<String> valid_extensions;
 	HashSet<String> import_extensions;
 
-	void _scan_new_dir(EditorFileSystemDirectory *p_dir, Ref<DirAccess> &da, const ScanProgress &p_progress);
+	struct ScanDir {
+		EditorFileSystemDirectory *dir = nullptr;
+		String path;
+		uint64_t modified_time = 0;
+		Vector<String> dirs;
+		Vector<String> files;
+		bool valid = false;
+	};
+
+	struct ScanFile {
+		EditorFileSystemDirectory *dir = nullptr;
+		EditorFileSystemDirectory::FileInfo *fi = nullptr;
+		String path;
+		bool test_reimport = false;
+		bool update_script_class = false;
+		bool update_dependencies = false;
+	};
+
+	struct ScanFileThreadData {
+		ScanFile *files = nullptr;
+		const uint32_t *parallel_files = nullptr;
+		SafeNumeric<uint32_t> done;
+	};
+
+	void _scan_dir_thread(uint32_t p_index, ScanDir *p_dirs);
+	void _scan_file(ScanFile &r_file);
+	void _scan_file_thread(uint32_t p_index, ScanFileThreadData *p_data);
+	void _scan_new_dir(EditorFileSystemDirectory *p_dir, const String &p_path, const ScanProgress &p_progress);
 
 	Thread thread_sources;
 	bool scanning_changes = false;
@@ -247,6 +278,13 @@ class EditorFileSystem : public Node {
 
 	bool _test_for_reimport(const String &p_path, bool p_only_imported_files);
 
+	struct TestReimportThreadData {
+		const String *paths = nullptr;
+		bool *results = nullptr;
+	};
+
+	void _test_for_reimport_thread(uint32_t p_index, TestReimportThreadData *p_data);
+
 	bool reimport_on_missing_imported_files;
 
 	Vector<String> _get_dependencies(const String &p_path);
@@ -254,6 +292,7 @@ class EditorFileSystem : public Node {
 	struct ImportFile {
 		String path;
 		String importer;
+		String group_file;
 		bool threaded = false;
 		int order = 0;
 		bool operator<(const ImportFile &p_if) const {
@@ -286,6 +325,7 @@ class EditorFileSystem : public Node {
 	};
 
 	void _reimport_thread(uint32_t p_index, ImportThreadData *p_import_data);
+	void _import_file_info_thread(uint32_t p_index, ImportFile *p_files);
 
 	static ResourceUID::ID _resource_saver_get_resource_id_for_path(const String &p_path, bool p_generate);
 
@@ -316,6 +356,8 @@ public:
 	EditorFileSystemDirectory *find_file(const String &p_file, int *r_index) const;
 
 	void reimport_files(const Vector<String> &p_files);
+	// Maximum number of files imported at once by threaded importers, 0 uses all worker threads.
+	static void set_import_thread_limit(int p_threads) { import_thread_limit = MAX(p_threads, 0); }
 	Error reimport_append(const String &p_file, const HashMap<StringName, Variant> &p_custom_options, const String &p_custom_importer, Variant p_generator_parameters);
 
 	void reimport_file_with_custom_parameters(const String &p_file, const String &p_importer, const HashMap<StringName, Variant> &p_custom_params);
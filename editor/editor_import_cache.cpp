@@ -0,0 +1,375 @@
+/**************************************************************************/
+/*  editor_import_cache.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "editor_import_cache.h"
+
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/io/config_file.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/variant/variant_parser.h"
+#include "editor/editor_settings.h"
+
+#define ENTRY_FILE "entry.cfg"
+#define ARTIFACT_PREFIX "artifact"
+#define MAX_DEPENDENCY_DEPTH 8
+
+String EditorImportCache::_get_entry_path(const String &p_key) const {
+	// Two levels, so a big cache doesn't end up with a huge single directory.
+	return cache_path.path_join(p_key.substr(0, 2)).path_join(p_key);
+}
+
+String EditorImportCache::_get_temp_suffix() {
+	// Unique per editor and thread, for files and directories that are renamed into place once complete.
+	return "." + itos(OS::get_singleton()->get_process_id()) + "_" + itos(Thread::get_caller_id());
+}
+
+uint64_t EditorImportCache::_get_time_usec() {
+	// Microseconds, entries used within the same second still get evicted in order.
+	return uint64_t(OS::get_singleton()->get_unix_time() * 1000000.0);
+}
+
+Vector<String> EditorImportCache::_get_artifact_suffixes(const String &p_save_extension, const List<String> &p_variants) {
+	// Same naming as the dest files of EditorFileSystem::_reimport_file().
+	Vector<String> suffixes;
+	if (p_variants.size()) {
+		for (const String &E : p_variants) {
+			suffixes.push_back("." + E + "." + p_save_extension);
+		}
+	} else {
+		suffixes.push_back("." + p_save_extension);
+	}
+	return suffixes;
+}
+
+void EditorImportCache::_remove_directory(const String &p_path) {
+	Ref<DirAccess> da = DirAccess::open(p_path);
+	if (da.is_valid()) {
+		da->erase_contents_recursive();
+	}
+	DirAccess::remove_absolute(p_path);
+}
+
+void EditorImportCache::_scan() {
+	scanned = true;
+	entries.clear();
+	total_size = 0;
+
+	Ref<DirAccess> da = DirAccess::open(cache_path);
+	if (da.is_null()) {
+		return;
+	}
+
+	for (const String &bucket : da->get_directories()) {
+		const String bucket_path = cache_path.path_join(bucket);
+		for (const String &key : DirAccess::get_directories_at(bucket_path)) {
+			Ref<ConfigFile> cf;
+			cf.instantiate();
+			if (key.contains(".") || cf->load(bucket_path.path_join(key).path_join(ENTRY_FILE)) != OK) {
+				continue; // Temporary directory of a store in progress, or a broken entry.
+			}
+			Entry entry;
+			entry.size = cf->get_value("entry", "size", 0);
+			entry.last_used = cf->get_value("entry", "last_used_usec", 0);
+			entries[key] = entry;
+			total_size += entry.size;
+		}
+	}
+}
+
+void EditorImportCache::_evict(const String &p_keep) {
+	if (total_size <= max_size) {
+		return;
+	}
+
+	struct EntrySort {
+		String key;
+		uint64_t last_used = 0;
+		bool operator<(const EntrySort &p_other) const { return last_used < p_other.last_used; }
+	};
+	Vector<EntrySort> sorted;
+	for (const KeyValue<String, Entry> &E : entries) {
+		if (E.key != p_keep) {
+			sorted.push_back({ E.key, E.value.last_used });
+		}
+	}
+	sorted.sort();
+
+	// Leave some headroom so the next stores don't evict again right away.
+	const uint64_t target_size = max_size / 10 * 9;
+	for (int i = 0; i < sorted.size() && total_size > target_size; i++) {
+		_remove_directory(_get_entry_path(sorted[i].key));
+		total_size -= entries[sorted[i].key].size;
+		entries.erase(sorted[i].key);
+	}
+}
+
+void EditorImportCache::configure() {
+	if (!EditorSettings::get_singleton()) {
+		return;
+	}
+	const String path = EDITOR_GET("filesystem/import/cache_path");
+	const int max_size_mb = EDITOR_GET("filesystem/import/cache_max_size_mb");
+	configure(path, (uint64_t)MAX(max_size_mb, 1) * 1024 * 1024);
+}
+
+void EditorImportCache::configure(const String &p_path, uint64_t p_max_size) {
+	String path = p_path.strip_edges();
+
+	MutexLock lock(mutex);
+	if (!path.is_empty() && DirAccess::make_dir_recursive_absolute(path) != OK) {
+		ERR_PRINT("Can't create import cache directory '" + path + "', the import cache is disabled.");
+		path = String();
+	}
+	if (path != cache_path) {
+		cache_path = path;
+		scanned = false;
+		entries.clear();
+		total_size = 0;
+	}
+	max_size = p_max_size;
+}
+
+void EditorImportCache::_add_file_dependency(const String &p_name, const String &p_path, String &r_text) {
+	if (!FileAccess::exists(p_path)) {
+		return;
+	}
+	r_text += p_name + ":md5:" + p_path + "=" + FileAccess::get_md5(p_path) + "\n";
+	// Imported dependencies (e.g. fallback fonts) also depend on their own import settings.
+	if (FileAccess::exists(p_path + ".import")) {
+		r_text += p_name + ":md5:" + p_path + ".import=" + FileAccess::get_md5(p_path + ".import") + "\n";
+	}
+}
+
+void EditorImportCache::_add_dependencies(const String &p_name, const Variant &p_value, String &r_text, int p_depth) {
+	if (p_depth > MAX_DEPENDENCY_DEPTH) {
+		return;
+	}
+
+	switch (p_value.get_type()) {
+		case Variant::STRING: {
+			const String path = p_value;
+			if (path.begins_with("res://")) {
+				_add_file_dependency(p_name, path, r_text);
+			}
+		} break;
+		case Variant::ARRAY: {
+			const Array array = p_value;
+			for (int i = 0; i < array.size(); i++) {
+				_add_dependencies(p_name, array[i], r_text, p_depth + 1);
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			const Dictionary dict = p_value;
+			List<Variant> keys;
+			dict.get_key_list(&keys);
+			for (const Variant &key : keys) {
+				_add_dependencies(p_name, key, r_text, p_depth + 1);
+				_add_dependencies(p_name, dict[key], r_text, p_depth + 1);
+			}
+		} break;
+		case Variant::OBJECT: {
+			Object *obj = p_value.get_validated_object();
+			if (!obj) {
+				break;
+			}
+			// The options text only has the path of a resource saved to a file, not its contents.
+			Resource *res = Object::cast_to<Resource>(obj);
+			if (res && !res->get_path().is_empty()) {
+				_add_file_dependency(p_name, res->get_path().get_slice("::", 0), r_text);
+				if (!res->get_path().contains("::")) {
+					break;
+				}
+			}
+			// Built-in resources are written with their properties, which can reference files in turn.
+			List<PropertyInfo> props;
+			obj->get_property_list(&props);
+			for (const PropertyInfo &E : props) {
+				if (E.usage & PROPERTY_USAGE_STORAGE) {
+					_add_dependencies(p_name, obj->get(E.name), r_text, p_depth + 1);
+				}
+			}
+		} break;
+		default:
+			break;
+	}
+}
+
+String EditorImportCache::get_key(const String &p_source_file, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params, const Variant &p_generator_parameters) {
+	const Dictionary version = Engine::get_singleton()->get_version_info();
+	String text = "engine=" + String(version["string"]) + ":" + String(version["hash"]) + "\n";
+	text += "importer=" + p_importer->get_importer_name() + ":" + itos(p_importer->get_format_version()) + "\n";
+	text += "settings=" + p_importer->get_import_settings_string() + "\n";
+	text += "extension=" + p_source_file.get_extension().to_lower() + "\n";
+	text += "source=" + FileAccess::get_md5(p_source_file) + "\n";
+
+	for (const ResourceImporter::ImportOption &E : p_options) {
+		const Variant *value = p_params.getptr(E.option.name);
+		if (!value) {
+			continue;
+		}
+		String value_text;
+		VariantWriter::write_to_string(*value, value_text);
+		text += E.option.name + "=" + value_text + "\n";
+
+		// Files referenced by options (e.g. a normal map path, or the fallback fonts of a font) are inputs too.
+		_add_dependencies(E.option.name, *value, text);
+	}
+
+	if (p_generator_parameters != Variant()) {
+		text += "generator=" + p_generator_parameters.get_construct_string() + "\n";
+	}
+
+	return text.md5_text();
+}
+
+bool EditorImportCache::restore(const String &p_key, const String &p_base_path, List<String> *r_variants, Variant *r_metadata) {
+	const String entry_path = _get_entry_path(p_key);
+	Ref<ConfigFile> cf;
+	cf.instantiate();
+	if (cf->load(entry_path.path_join(ENTRY_FILE)) != OK) {
+		return false;
+	}
+
+	const String save_extension = cf->get_value("entry", "save_extension", String());
+	const Vector<String> variants = cf->get_value("entry", "variants", Vector<String>());
+	const Vector<int64_t> sizes = cf->get_value("entry", "sizes", Vector<int64_t>());
+	List<String> variant_list;
+	for (const String &E : variants) {
+		variant_list.push_back(E);
+	}
+	const Vector<String> suffixes = _get_artifact_suffixes(save_extension, variant_list);
+	if (save_extension.is_empty() || sizes.size() != suffixes.size()) {
+		return false;
+	}
+
+	// Entries may come from another machine or be half evicted, check them before use.
+	for (int i = 0; i < suffixes.size(); i++) {
+		Ref<FileAccess> f = FileAccess::open(entry_path.path_join(ARTIFACT_PREFIX + suffixes[i]), FileAccess::READ);
+		if (f.is_null() || (int64_t)f->get_length() != sizes[i]) {
+			return false;
+		}
+	}
+
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	for (int i = 0; i < suffixes.size(); i++) {
+		const String dest = ProjectSettings::get_singleton()->globalize_path(p_base_path + suffixes[i]);
+		if (da->copy(entry_path.path_join(ARTIFACT_PREFIX + suffixes[i]), dest) != OK) {
+			return false;
+		}
+	}
+
+	*r_variants = variant_list;
+	*r_metadata = cf->get_value("entry", "metadata", Variant());
+
+	// Other editors sharing the cache may be reading the entry, replace the file instead of rewriting it.
+	const uint64_t now = _get_time_usec();
+	const String temp_file = entry_path.path_join(ENTRY_FILE + _get_temp_suffix());
+	cf->set_value("entry", "last_used_usec", now);
+	if (cf->save(temp_file) != OK || da->rename(temp_file, entry_path.path_join(ENTRY_FILE)) != OK) {
+		DirAccess::remove_absolute(temp_file);
+	}
+
+	MutexLock lock(mutex);
+	if (entries.has(p_key)) {
+		entries[p_key].last_used = now;
+	}
+	return true;
+}
+
+void EditorImportCache::store(const String &p_key, const String &p_base_path, const String &p_save_extension, const List<String> &p_variants, const Variant &p_metadata) {
+	if (p_save_extension.is_empty()) {
+		return; // Nothing written, nothing to reuse.
+	}
+
+	const String entry_path = _get_entry_path(p_key);
+	if (DirAccess::dir_exists_absolute(entry_path)) {
+		return;
+	}
+
+	// Files are gathered in a temporary directory and renamed into place, so other
+	// editors sharing the cache never see a partial entry.
+	const String temp_path = entry_path + _get_temp_suffix();
+	if (DirAccess::make_dir_recursive_absolute(temp_path) != OK) {
+		return;
+	}
+
+	Ref<DirAccess> da = DirAccess::create(DirAccess::ACCESS_FILESYSTEM);
+	const Vector<String> suffixes = _get_artifact_suffixes(p_save_extension, p_variants);
+	Vector<int64_t> sizes;
+	uint64_t size = 0;
+	for (const String &suffix : suffixes) {
+		const String artifact_path = temp_path.path_join(ARTIFACT_PREFIX + suffix);
+		if (da->copy(ProjectSettings::get_singleton()->globalize_path(p_base_path + suffix), artifact_path) != OK) {
+			_remove_directory(temp_path);
+			return;
+		}
+		Ref<FileAccess> f = FileAccess::open(artifact_path, FileAccess::READ);
+		sizes.push_back(f.is_valid() ? f->get_length() : 0);
+		size += sizes[sizes.size() - 1];
+	}
+
+	Vector<String> variants;
+	for (const String &E : p_variants) {
+		variants.push_back(E);
+	}
+
+	const uint64_t now = _get_time_usec();
+	Ref<ConfigFile> cf;
+	cf.instantiate();
+	cf->set_value("entry", "save_extension", p_save_extension);
+	cf->set_value("entry", "variants", variants);
+	cf->set_value("entry", "sizes", sizes);
+	cf->set_value("entry", "size", size);
+	cf->set_value("entry", "last_used_usec", now);
+	if (p_metadata != Variant()) {
+		cf->set_value("entry", "metadata", p_metadata);
+	}
+	if (cf->save(temp_path.path_join(ENTRY_FILE)) != OK || da->rename(temp_path, entry_path) != OK) {
+		// Most likely stored by another editor in the meantime.
+		_remove_directory(temp_path);
+		return;
+	}
+
+	MutexLock lock(mutex);
+	if (!scanned) {
+		_scan();
+	} else if (!entries.has(p_key)) {
+		Entry entry;
+		entry.size = size;
+		entry.last_used = now;
+		entries[p_key] = entry;
+		total_size += size;
+	}
+	_evict(p_key);
+}
@@ -0,0 +1,78 @@
+/**************************************************************************/
+/*  editor_import_cache.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef EDITOR_IMPORT_CACHE_H
+#define EDITOR_IMPORT_CACHE_H
+
+#include "core/io/resource_importer.h"
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+
+// Content-addressed store of import results in a local directory, which can be shared
+// by several projects, branches or checkouts. Entries are keyed by the source file
+// contents, the importer and its options, so identical inputs reuse the result without
+// importing again. The least recently used entries are evicted past the size limit.
+class EditorImportCache {
+	struct Entry {
+		uint64_t size = 0;
+		uint64_t last_used = 0;
+	};
+
+	Mutex mutex;
+	String cache_path;
+	uint64_t max_size = 0;
+	bool scanned = false;
+	HashMap<String, Entry> entries;
+	uint64_t total_size = 0;
+
+	String _get_entry_path(const String &p_key) const;
+	static String _get_temp_suffix();
+	static uint64_t _get_time_usec();
+	static Vector<String> _get_artifact_suffixes(const String &p_save_extension, const List<String> &p_variants);
+	static void _remove_directory(const String &p_path);
+	static void _add_file_dependency(const String &p_name, const String &p_path, String &r_text);
+	static void _add_dependencies(const String &p_name, const Variant &p_value, String &r_text, int p_depth = 0);
+
+	void _scan();
+	void _evict(const String &p_keep);
+
+public:
+	void configure();
+	void configure(const String &p_path, uint64_t p_max_size);
+	bool is_enabled() const { return !cache_path.is_empty(); }
+
+	static String get_key(const String &p_source_file, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params, const Variant &p_generator_parameters);
+
+	// Copies the cached files to p_base_path, returns false if there is no valid entry.
+	bool restore(const String &p_key, const String &p_base_path, List<String> *r_variants, Variant *r_metadata);
+	void store(const String &p_key, const String &p_base_path, const String &p_save_extension, const List<String> &p_variants, const Variant &p_metadata);
+};
+
+#endif // EDITOR_IMPORT_CACHE_H
@@ -503,6 +503,10 @@ void EditorSettings::_load_defaults(Ref<ConfigFile> p_extra_config) {
 	const String fs_dir_default_project_path = OS::get_singleton()->has_environment("HOME") ? OS::get_singleton()->get_environment("HOME") : OS::get_singleton()->get_system_dir(OS::SYSTEM_DIR_DOCUMENTS);
 	EDITOR_SETTING(Variant::STRING, PROPERTY_HINT_GLOBAL_DIR, "filesystem/directories/default_project_path", fs_dir_default_project_path, "")
 
+	// Import
+	EDITOR_SETTING(Variant::STRING, PROPERTY_HINT_GLOBAL_DIR, "filesystem/import/cache_path", "", "")
+	EDITOR_SETTING(Variant::INT, PROPERTY_HINT_RANGE, "filesystem/import/cache_max_size_mb", 4096, "64,65536,64,or_greater")
+
 	// On save
 	_initial_set("filesystem/on_save/compress_binary_resources", true);
 	_initial_set("filesystem/on_save/safe_save_on_backup_then_rename", true);
@@ -59,6 +59,7 @@ public:
 	void show_advanced_options(const String &p_path) override;
 
 	virtual Error import(const String &p_source_file, const String &p_save_path, const HashMap<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files = nullptr, Variant *r_metadata = nullptr) override;
+	virtual bool can_cache_import(const Variant &p_metadata) const override { return true; }
 
 	ResourceImporterDynamicFont();
 };
@@ -636,6 +636,12 @@ String ResourceImporterTexture::get_import_settings_string() const {
 	return s;
 }
 
+bool ResourceImporterTexture::can_cache_import(const Variant &p_metadata) const {
+	// Editor variants depend on the editor scale and theme, not only on the import inputs.
+	const Dictionary meta = p_metadata;
+	return !meta.has("has_editor_variant");
+}
+
 bool ResourceImporterTexture::are_import_settings_valid(const String &p_path) const {
 	Dictionary meta = ResourceFormatImporter::get_singleton()->get_resource_metadata(p_path);
 
@@ -105,6 +105,7 @@ public:
 
 	virtual bool are_import_settings_valid(const String &p_path) const override;
 	virtual String get_import_settings_string() const override;
+	virtual bool can_cache_import(const Variant &p_metadata) const override;
 
 	ResourceImporterTexture(bool p_singleton = false);
 	~ResourceImporterTexture();
@@ -395,6 +395,7 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  --check-only                      Only parse for errors and quit (use with --script).\n");
 #ifdef TOOLS_ENABLED
 	OS::get_singleton()->print("  --import                          Starts the editor, waits for any resources to be imported, and then quits.\n");
+	OS::get_singleton()->print("  --import-threads <count>          Limit the number of threads used to import resources and compress textures (0 uses all worker threads).\n");
 	OS::get_singleton()->print("  --export-release <preset> <path>  Export the project in release mode using the given preset and output path. The preset name should match one defined in export_presets.cfg.\n");
 	OS::get_singleton()->print("                                    <path> should be absolute or relative to the project directory, and include the filename for the binary (e.g. 'builds/game.exe').\n");
 	OS::get_singleton()->print("                                    The target directory must exist.\n");
@@ -1153,6 +1154,16 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			cmdline_tool = true;
 			wait_for_import = true;
 			quit_after = 1;
+		} else if (I->get() == "--import-threads") {
+			if (I->next()) {
+				int import_threads = I->next()->get().to_int();
+				EditorFileSystem::set_import_thread_limit(import_threads);
+				Image::set_compression_thread_limit(import_threads);
+				N = I->next()->next();
+			} else {
+				OS::get_singleton()->print("Missing <count> argument for --import-threads, aborting.\n");
+				goto error;
+			}
 		} else if (I->get() == "--export-release" || I->get() == "--export-debug" ||
 				I->get() == "--export-pack") { // Export project
 			// Actually handling is done in start().
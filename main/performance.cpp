@@ -30,6 +30,7 @@
 
 #include "performance.h"
 
+#include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
@@ -37,6 +38,7 @@
 #include "scene/main/scene_tree.h"
 #include "servers/audio_server.h"
 #include "servers/rendering_server.h"
+#include "servers/text_server.h"
 
 Performance *Performance::singleton = nullptr;
 
@@ -66,6 +68,11 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(RENDER_TEXTURE_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDER_BUFFER_MEM_USED);
 	BIND_ENUM_CONSTANT(AUDIO_OUTPUT_LATENCY);
+	BIND_ENUM_CONSTANT(RESOURCE_LOAD_QUEUE_DEPTH);
+	BIND_ENUM_CONSTANT(GUI_LAYOUT_MEASURED_CONTROLS);
+	BIND_ENUM_CONSTANT(GUI_LAYOUT_ARRANGED_CONTAINERS);
+	BIND_ENUM_CONSTANT(TEXT_SHAPED_CACHE_HIT_RATE);
+	BIND_ENUM_CONSTANT(TEXT_SHAPED_CACHE_MEMORY);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -98,6 +105,11 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		"video/texture_mem",
 		"video/buffer_mem",
 		"audio/driver/output_latency",
+		"resource/load_queue_depth",
+		"gui/layout_measured_controls",
+		"gui/layout_arranged_containers",
+		"text/shaped_cache_hit_rate",
+		"text/shaped_cache_memory",
 	};
 
 	return names[p_monitor];
@@ -139,6 +151,23 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_BUFFER_MEM_USED);
 		case AUDIO_OUTPUT_LATENCY:
 			return AudioServer::get_singleton()->get_output_latency();
+		case RESOURCE_LOAD_QUEUE_DEPTH:
+			return ResourceLoader::get_load_queue_depth();
+		case GUI_LAYOUT_MEASURED_CONTROLS: {
+			SceneTree *sml = Object::cast_to<SceneTree>(OS::get_singleton()->get_main_loop());
+			return sml ? sml->get_layout_measured_count() : 0;
+		}
+		case GUI_LAYOUT_ARRANGED_CONTAINERS: {
+			SceneTree *sml = Object::cast_to<SceneTree>(OS::get_singleton()->get_main_loop());
+			return sml ? sml->get_layout_arranged_count() : 0;
+		}
+		case TEXT_SHAPED_CACHE_HIT_RATE: {
+			int64_t hits = TS->get_shaped_text_cache_info(TextServer::SHAPED_TEXT_CACHE_HITS);
+			int64_t total = hits + TS->get_shaped_text_cache_info(TextServer::SHAPED_TEXT_CACHE_MISSES);
+			return total > 0 ? 100.0 * hits / total : 0;
+		}
+		case TEXT_SHAPED_CACHE_MEMORY:
+			return TS->get_shaped_text_cache_info(TextServer::SHAPED_TEXT_CACHE_MEMORY_USED);
 		default: {
 		}
 	}
@@ -167,6 +196,11 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_MEMORY,
 		MONITOR_TYPE_MEMORY,
 		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
 	};
 
 	return types[p_monitor];
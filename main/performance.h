@@ -83,6 +83,11 @@ public:
 		RENDER_TEXTURE_MEM_USED,
 		RENDER_BUFFER_MEM_USED,
 		AUDIO_OUTPUT_LATENCY,
+		RESOURCE_LOAD_QUEUE_DEPTH,
+		GUI_LAYOUT_MEASURED_CONTROLS,
+		GUI_LAYOUT_ARRANGED_CONTAINERS,
+		TEXT_SHAPED_CACHE_HIT_RATE,
+		TEXT_SHAPED_CACHE_MEMORY,
 		MONITOR_MAX
 	};
 
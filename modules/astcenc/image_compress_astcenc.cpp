@@ -30,11 +30,27 @@
 
 #include "image_compress_astcenc.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
 #include <astcenc.h>
 
+struct ASTCCompressionJob {
+	astcenc_context *context = nullptr;
+	astcenc_image *image = nullptr;
+	const astcenc_swizzle *swizzle = nullptr;
+	uint8_t *dst = nullptr;
+	size_t dst_len = 0;
+	LocalVector<astcenc_error> thread_status;
+};
+
+static void _compress_astc_thread(void *p_job, uint32_t p_thread_index) {
+	// Every thread of the context has to join, astcenc hands out the blocks between them.
+	ASTCCompressionJob *job = static_cast<ASTCCompressionJob *>(p_job);
+	job->thread_status[p_thread_index] = astcenc_compress_image(job->context, job->image, job->swizzle, job->dst, job->dst_len, p_thread_index);
+}
+
 void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -115,7 +131,8 @@ void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 	// Context allocation.
 
 	astcenc_context *context;
-	const unsigned int thread_count = 1; // Godot compresses multiple images each on a thread, which is more efficient for large amount of images imported.
+	// The encoded blocks don't depend on the number of threads.
+	const unsigned int thread_count = Image::get_compression_thread_count();
 	status = astcenc_context_alloc(&config, thread_count, &context);
 	ERR_FAIL_COND_MSG(status != ASTCENC_SUCCESS,
 			vformat("astcenc: Context allocation failed: %s.", astcenc_get_error_string(status)));
@@ -156,7 +173,26 @@ void _compress_astc(Image *r_img, Image::ASTCFormat p_format) {
 			ASTCENC_SWZ_R, ASTCENC_SWZ_G, ASTCENC_SWZ_B, ASTCENC_SWZ_A
 		};
 
-		status = astcenc_compress_image(context, &image, &swizzle, dest_mip_write, comp_len, 0);
+		if (thread_count > 1) {
+			ASTCCompressionJob job;
+			job.context = context;
+			job.image = &image;
+			job.swizzle = &swizzle;
+			job.dst = dest_mip_write;
+			job.dst_len = comp_len;
+			job.thread_status.resize(thread_count);
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_compress_astc_thread, &job, thread_count, thread_count, true, SNAME("ASTC Compress"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			status = ASTCENC_SUCCESS;
+			for (const astcenc_error &thread_status : job.thread_status) {
+				if (thread_status != ASTCENC_SUCCESS) {
+					status = thread_status;
+					break;
+				}
+			}
+		} else {
+			status = astcenc_compress_image(context, &image, &swizzle, dest_mip_write, comp_len, 0);
+		}
 
 		ERR_BREAK_MSG(status != ASTCENC_SUCCESS,
 				vformat("astcenc: ASTC image compression failed: %s.", astcenc_get_error_string(status)));
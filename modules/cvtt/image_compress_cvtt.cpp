@@ -57,6 +57,7 @@ struct CVTTCompressionJobQueue {
 	CVTTCompressionJobParams job_params;
 	const CVTTCompressionRowTask *job_tasks = nullptr;
 	uint32_t num_tasks = 0;
+	uint32_t num_threads = 1;
 	SafeNumeric<uint32_t> current_task;
 };
 
@@ -132,7 +133,7 @@ static void _digest_row_task(const CVTTCompressionJobParams &p_job_params, const
 static void _digest_job_queue(void *p_job_queue, uint32_t p_index) {
 	CVTTCompressionJobQueue *job_queue = static_cast<CVTTCompressionJobQueue *>(p_job_queue);
 	uint32_t num_tasks = job_queue->num_tasks;
-	uint32_t total_threads = WorkerThreadPool::get_singleton()->get_thread_count();
+	uint32_t total_threads = job_queue->num_threads;
 	uint32_t start = p_index * num_tasks / total_threads;
 	uint32_t end = (p_index + 1 == total_threads) ? num_tasks : ((p_index + 1) * num_tasks / total_threads);
 
@@ -246,8 +247,13 @@ void image_compress_cvtt(Image *p_image, Image::UsedChannels p_channels) {
 
 	job_queue.job_tasks = &tasks_rb[0];
 	job_queue.num_tasks = static_cast<uint32_t>(tasks.size());
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_digest_job_queue, &job_queue, WorkerThreadPool::get_singleton()->get_thread_count(), -1, true, SNAME("CVTT Compress"));
-	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	job_queue.num_threads = Image::get_compression_thread_count();
+	if (job_queue.num_threads > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_digest_job_queue, &job_queue, job_queue.num_threads, -1, true, SNAME("CVTT Compress"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_digest_job_queue(&job_queue, 0);
+	}
 
 	p_image->set_data(p_image->get_width(), p_image->get_height(), p_image->has_mipmaps(), target_format, data);
 }
@@ -30,12 +30,50 @@
 
 #include "image_compress_etcpak.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 
 #include <ProcessDxtc.hpp>
 #include <ProcessRGB.hpp>
 
+struct EtcpakCompressionJob {
+	const uint32_t *src = nullptr;
+	uint64_t *dst = nullptr;
+	uint32_t blocks = 0;
+	uint32_t width = 0;
+};
+
+struct EtcpakCompressionJobQueue {
+	EtcpakType type = EtcpakType::ETCPAK_TYPE_ETC1;
+	const EtcpakCompressionJob *jobs = nullptr;
+};
+
+static void _digest_job(EtcpakType p_type, const EtcpakCompressionJob &p_job) {
+	switch (p_type) {
+		case EtcpakType::ETCPAK_TYPE_ETC1:
+			CompressEtc1RgbDither(p_job.src, p_job.dst, p_job.blocks, p_job.width);
+			break;
+		case EtcpakType::ETCPAK_TYPE_ETC2:
+			CompressEtc2Rgb(p_job.src, p_job.dst, p_job.blocks, p_job.width, true);
+			break;
+		case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
+			CompressEtc2Rgba(p_job.src, p_job.dst, p_job.blocks, p_job.width, true);
+			break;
+		case EtcpakType::ETCPAK_TYPE_DXT1:
+			CompressDxt1Dither(p_job.src, p_job.dst, p_job.blocks, p_job.width);
+			break;
+		case EtcpakType::ETCPAK_TYPE_DXT5:
+			CompressDxt5(p_job.src, p_job.dst, p_job.blocks, p_job.width);
+			break;
+	}
+}
+
+static void _digest_job_queue(void *p_job_queue, uint32_t p_index) {
+	const EtcpakCompressionJobQueue *job_queue = static_cast<const EtcpakCompressionJobQueue *>(p_job_queue);
+	_digest_job(job_queue->type, job_queue->jobs[p_index]);
+}
+
 EtcpakType _determine_etc_type(Image::UsedChannels p_channels) {
 	switch (p_channels) {
 		case Image::USED_CHANNELS_L:
@@ -166,7 +204,17 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 	uint8_t *dest_write = dest_data.ptrw();
 
 	int mip_count = mipmaps ? Image::get_image_required_mipmaps(width, height, target_format) : 0;
-	Vector<uint32_t> padded_src;
+	// Smeared copies of the mipmaps that aren't a multiple of the block size, kept alive until all jobs are done.
+	LocalVector<Vector<uint32_t>> padded_src;
+	padded_src.resize(mip_count + 1);
+
+	// 8 bytes per block for the RGB formats, 16 when alpha is stored separately.
+	const int block_size = (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA || p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5) ? 2 : 1;
+	// Blocks are independent, every job encodes a few block rows into a fixed place of the
+	// output, so the result doesn't depend on the number of threads. Mipmaps are queued
+	// together so the small ones don't serialize.
+	const uint32_t min_job_blocks = 1024;
+	LocalVector<EtcpakCompressionJob> jobs;
 
 	for (int i = 0; i < mip_count + 1; i++) {
 		// Get write mip metrics for target image.
@@ -179,7 +227,6 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 		// Block size. Align stride to multiple of 4 (RGBA8).
 		int mip_w = (orig_mip_w + 3) & ~3;
 		int mip_h = (orig_mip_h + 3) & ~3;
-		const uint32_t blocks = mip_w * mip_h / 16;
 
 		// Get mip data from source image for reading.
 		int src_mip_ofs = r_img->get_mipmap_offset(i);
@@ -187,8 +234,8 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 
 		// Pad textures to nearest block by smearing.
 		if (mip_w != orig_mip_w || mip_h != orig_mip_h) {
-			padded_src.resize(mip_w * mip_h);
-			uint32_t *ptrw = padded_src.ptrw();
+			padded_src[i].resize(mip_w * mip_h);
+			uint32_t *ptrw = padded_src[i].ptrw();
 			int x = 0, y = 0;
 			for (y = 0; y < orig_mip_h; y++) {
 				for (x = 0; x < orig_mip_w; x++) {
@@ -206,20 +253,32 @@ void _compress_etcpak(EtcpakType p_compresstype, Image *r_img) {
 				}
 			}
 			// Override the src_mip_read pointer to our temporary Vector.
-			src_mip_read = padded_src.ptr();
+			src_mip_read = padded_src[i].ptr();
+		}
+
+		const uint32_t row_blocks = mip_w / 4;
+		const uint32_t block_rows = mip_h / 4;
+		const uint32_t rows_per_job = MAX(1u, min_job_blocks / row_blocks);
+		for (uint32_t row = 0; row < block_rows; row += rows_per_job) {
+			EtcpakCompressionJob job;
+			job.src = src_mip_read + row * 4 * mip_w;
+			job.dst = dest_mip_write + row * row_blocks * block_size;
+			job.blocks = MIN(rows_per_job, block_rows - row) * row_blocks;
+			job.width = mip_w;
+			jobs.push_back(job);
 		}
-		if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC1) {
-			CompressEtc1RgbDither(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2) {
-			CompressEtc2Rgb(src_mip_read, dest_mip_write, blocks, mip_w, true);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_ETC2_ALPHA) {
-			CompressEtc2Rgba(src_mip_read, dest_mip_write, blocks, mip_w, true);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT1) {
-			CompressDxt1Dither(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else if (p_compresstype == EtcpakType::ETCPAK_TYPE_DXT5) {
-			CompressDxt5(src_mip_read, dest_mip_write, blocks, mip_w);
-		} else {
-			ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
+	}
+
+	const int thread_count = Image::get_compression_thread_count();
+	if (thread_count > 1 && jobs.size() > 1) {
+		EtcpakCompressionJobQueue job_queue;
+		job_queue.type = p_compresstype;
+		job_queue.jobs = jobs.ptr();
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_digest_job_queue, &job_queue, jobs.size(), MIN(thread_count, (int)jobs.size()), true, SNAME("Etcpak Compress"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (const EtcpakCompressionJob &job : jobs) {
+			_digest_job(p_compresstype, job);
 		}
 	}
 
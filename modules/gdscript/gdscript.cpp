@@ -812,6 +812,10 @@ Error GDScript::reload(bool p_keep_state) {
 	}
 #endif
 
+	if (has_instances) {
+		ScriptServer::notify_script_changed();
+	}
+
 	reloading = false;
 	return OK;
 }
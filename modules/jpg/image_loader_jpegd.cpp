@@ -38,7 +38,7 @@
 
 #include <string.h>
 
-Error jpeg_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p_buffer_len) {
+Error jpeg_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p_buffer_len, const Rect2i &p_region = Rect2i(), int p_shrink = 1) {
 	jpgd::jpeg_decoder_mem_stream mem_stream(p_buffer, p_buffer_len);
 
 	jpgd::jpeg_decoder decoder(&mem_stream);
@@ -54,61 +54,46 @@ Error jpeg_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p
 		return ERR_FILE_CORRUPT;
 	}
 
+	// Scanlines go straight into the (possibly cropped and shrunk) destination image,
+	// decoding stops after the last row of the region.
+	ImageRegionWriter writer;
+	Error err = writer.begin(image_width, image_height, comps == 1 ? Image::FORMAT_L8 : Image::FORMAT_RGB8, p_region, p_shrink);
+	if (err != OK) {
+		return err;
+	}
+
 	if (decoder.begin_decoding() != jpgd::JPGD_SUCCESS) {
 		return ERR_FILE_CORRUPT;
 	}
 
-	const int dst_bpl = image_width * comps;
-
-	Vector<uint8_t> data;
-
-	data.resize(dst_bpl * image_height);
-
-	uint8_t *dw = data.ptrw();
-
-	jpgd::uint8 *pImage_data = (jpgd::uint8 *)dw;
-
-	for (int y = 0; y < image_height; y++) {
+	for (int y = 0; y < writer.get_end_row(); y++) {
 		const jpgd::uint8 *pScan_line;
 		jpgd::uint scan_line_len;
 		if (decoder.decode((const void **)&pScan_line, &scan_line_len) != jpgd::JPGD_SUCCESS) {
 			return ERR_FILE_CORRUPT;
 		}
 
-		jpgd::uint8 *pDst = pImage_data + y * dst_bpl;
-
-		if (comps == 1) {
-			memcpy(pDst, pScan_line, dst_bpl);
-		} else {
-			// For images with more than 1 channel pScan_line will always point to a buffer
-			// containing 32-bit RGBA pixels. Alpha is always 255 and we ignore it.
-			for (int x = 0; x < image_width; x++) {
-				pDst[0] = pScan_line[x * 4 + 0];
-				pDst[1] = pScan_line[x * 4 + 1];
-				pDst[2] = pScan_line[x * 4 + 2];
-				pDst += 3;
-			}
-		}
+		// For images with more than 1 channel pScan_line will always point to a buffer
+		// containing 32-bit RGBA pixels. Alpha is always 255 and we ignore it.
+		writer.write_row(y, pScan_line, comps == 1 ? 1 : 4);
 	}
 
 	//all good
 
-	Image::Format fmt;
-	if (comps == 1) {
-		fmt = Image::FORMAT_L8;
-	} else {
-		fmt = Image::FORMAT_RGB8;
-	}
-
-	p_image->set_data(image_width, image_height, false, fmt, data);
-
-	return OK;
+	return writer.finish(p_image);
 }
 
 Error ImageLoaderJPG::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitField<ImageFormatLoader::LoaderFlags> p_flags, float p_scale) {
 	Vector<uint8_t> src_image;
 	uint64_t src_image_len = f->get_length();
 	ERR_FAIL_COND_V(src_image_len == 0, ERR_FILE_CORRUPT);
+
+	const uint8_t *mapped = f->get_mapped_buffer(src_image_len);
+	if (mapped) {
+		// Decode straight from the file mapping, no need for an intermediate copy.
+		return jpeg_load_image_from_buffer(p_image.ptr(), mapped, src_image_len);
+	}
+
 	src_image.resize(src_image_len);
 
 	uint8_t *w = src_image.ptrw();
@@ -120,6 +105,22 @@ Error ImageLoaderJPG::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitField
 	return err;
 }
 
+Error ImageLoaderJPG::load_image_region(Ref<Image> p_image, Ref<FileAccess> f, BitField<ImageFormatLoader::LoaderFlags> p_flags, const Rect2i &p_region, int p_shrink) {
+	uint64_t src_image_len = f->get_length();
+	ERR_FAIL_COND_V(src_image_len == 0, ERR_FILE_CORRUPT);
+
+	const uint8_t *mapped = f->get_mapped_buffer(src_image_len);
+	if (mapped) {
+		return jpeg_load_image_from_buffer(p_image.ptr(), mapped, src_image_len, p_region, p_shrink);
+	}
+
+	Vector<uint8_t> src_image;
+	src_image.resize(src_image_len);
+	f->get_buffer(src_image.ptrw(), src_image_len);
+
+	return jpeg_load_image_from_buffer(p_image.ptr(), src_image.ptr(), src_image_len, p_region, p_shrink);
+}
+
 void ImageLoaderJPG::get_recognized_extensions(List<String> *p_extensions) const {
 	p_extensions->push_back("jpg");
 	p_extensions->push_back("jpeg");
@@ -33,22 +33,28 @@
 #ifdef GDEXTENSION
 // Headers for building as GDExtension plug-in.
 
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/dir_access.hpp>
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/os.hpp>
 #include <godot_cpp/classes/project_settings.hpp>
 #include <godot_cpp/classes/rendering_server.hpp>
 #include <godot_cpp/classes/translation_server.hpp>
 #include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
 
 using namespace godot;
 
 #define GLOBAL_GET(m_var) ProjectSettings::get_singleton()->get_setting_with_override(m_var)
+#define print_verbose(m_text) UtilityFunctions::print_verbose(m_text)
 
 #else
 // Headers for building as built-in module.
 
+#include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/error/error_macros.h"
+#include "core/io/dir_access.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/string/print_string.h"
 #include "core/string/translation.h"
@@ -339,6 +345,7 @@ _FORCE_INLINE_ bool is_connected_to_prev(char32_t p_chr, char32_t p_pchr) {
 
 bool TextServerAdvanced::icu_data_loaded = false;
 PackedByteArray TextServerAdvanced::icu_data;
+thread_local uint32_t TextServerAdvanced::RIDUseLock::depth = 0;
 
 bool TextServerAdvanced::_has_feature(Feature p_feature) const {
 	switch (p_feature) {
@@ -388,15 +395,22 @@ int64_t TextServerAdvanced::_get_features() const {
 }
 
 void TextServerAdvanced::_free_rid(const RID &p_rid) {
-	_THREAD_SAFE_METHOD_
-	if (font_owner.owns(p_rid)) {
-		MutexLock ftlock(ft_mutex);
+	// Nested calls only free objects the calling method created and never shared, and
+	// can't wait for the lock they hold for reading.
+	const bool exclusive = !RIDUseLock::is_locked();
+	if (exclusive) {
+		rid_use_lock.write_lock();
+	}
 
+	if (font_owner.owns(p_rid)) {
 		FontAdvanced *fd = font_owner.get_or_null(p_rid);
 		{
 			MutexLock lock(fd->mutex);
+			_persistent_cache_save_all(fd);
 			font_owner.free(p_rid);
 		}
+		// Taken after the font mutex is released, size cache functions lock font data first.
+		MutexLock ftlock(ft_mutex);
 		memdelete(fd);
 	} else if (font_var_owner.owns(p_rid)) {
 		MutexLock ftlock(ft_mutex);
@@ -414,10 +428,13 @@ void TextServerAdvanced::_free_rid(const RID &p_rid) {
 		}
 		memdelete(sd);
 	}
+
+	if (exclusive) {
+		rid_use_lock.write_unlock();
+	}
 }
 
 bool TextServerAdvanced::_has(const RID &p_rid) {
-	_THREAD_SAFE_METHOD_
 	return font_owner.owns(p_rid) || font_var_owner.owns(p_rid) || shaped_owner.owns(p_rid);
 }
 
@@ -805,7 +822,7 @@ _FORCE_INLINE_ TextServerAdvanced::FontTexturePosition TextServerAdvanced::find_
 	int mw = p_width;
 	int mh = p_height;
 
-	ShelfPackTexture *ct = p_data->textures.ptrw();
+	SkylinePackTexture *ct = p_data->textures.ptrw();
 	for (int32_t i = 0; i < p_data->textures.size(); i++) {
 		if (p_image_format != ct[i].format) {
 			continue;
@@ -837,7 +854,7 @@ _FORCE_INLINE_ TextServerAdvanced::FontTexturePosition TextServerAdvanced::find_
 			texsize = next_power_of_2(mh);
 		}
 
-		ShelfPackTexture tex = ShelfPackTexture(texsize, texsize);
+		SkylinePackTexture tex = SkylinePackTexture(texsize, texsize);
 		tex.format = p_image_format;
 		tex.imgdata.resize(texsize * texsize * p_color_size);
 		{
@@ -999,7 +1016,7 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_msdf(
 
 		FontTexturePosition tex_pos = find_texture_pos_for_glyph(p_data, 4, Image::FORMAT_RGBA8, mw, mh, true);
 		ERR_FAIL_COND_V(tex_pos.index < 0, FontGlyph());
-		ShelfPackTexture &tex = p_data->textures.write[tex_pos.index];
+		SkylinePackTexture &tex = p_data->textures.write[tex_pos.index];
 
 		edgeColoringSimple(shape, 3.0); // Max. angle.
 		msdfgen::Bitmap<float, 4> image(w, h); // Texture size.
@@ -1083,7 +1100,7 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_bitma
 	ERR_FAIL_COND_V(tex_pos.index < 0, FontGlyph());
 
 	// Fit character in char texture.
-	ShelfPackTexture &tex = p_data->textures.write[tex_pos.index];
+	SkylinePackTexture &tex = p_data->textures.write[tex_pos.index];
 
 	{
 		uint8_t *wr = tex.imgdata.ptrw();
@@ -1164,6 +1181,101 @@ _FORCE_INLINE_ TextServerAdvanced::FontGlyph TextServerAdvanced::rasterize_bitma
 /* Font Cache                                                            */
 /*************************************************************************/
 
+#ifdef MODULE_FREETYPE_ENABLED
+_FORCE_INLINE_ int TextServerAdvanced::_load_glyph(const FontAdvanced *p_font_data, FT_Face p_face, const Vector2i &p_size, int32_t p_glyph, Vector2 &r_advance, FT_Render_Mode &r_aa_mode, bool &r_bgra) const {
+	int32_t glyph_index = p_glyph & 0xffffff; // Remove subpixel shifts.
+	FT_Int32 flags = FT_LOAD_DEFAULT;
+
+	bool outline = p_size.y > 0;
+	switch (p_font_data->hinting) {
+		case TextServer::HINTING_NONE:
+			flags |= FT_LOAD_NO_HINTING;
+			break;
+		case TextServer::HINTING_LIGHT:
+			flags |= FT_LOAD_TARGET_LIGHT;
+			break;
+		default:
+			flags |= FT_LOAD_TARGET_NORMAL;
+			break;
+	}
+	if (p_font_data->force_autohinter) {
+		flags |= FT_LOAD_FORCE_AUTOHINT;
+	}
+	if (outline) {
+		flags |= FT_LOAD_NO_BITMAP;
+	} else if (FT_HAS_COLOR(p_face)) {
+		flags |= FT_LOAD_COLOR;
+	}
+
+	FT_Fixed v, h;
+	FT_Get_Advance(p_face, glyph_index, flags, &h);
+	FT_Get_Advance(p_face, glyph_index, flags | FT_LOAD_VERTICAL_LAYOUT, &v);
+
+	int error = FT_Load_Glyph(p_face, glyph_index, flags);
+	if (error) {
+		return error;
+	}
+
+	if (!p_font_data->msdf) {
+		if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
+			FT_Pos xshift = (int)((p_glyph >> 27) & 3) << 4;
+			FT_Outline_Translate(&p_face->glyph->outline, xshift, 0);
+		} else if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
+			FT_Pos xshift = (int)((p_glyph >> 27) & 3) << 5;
+			FT_Outline_Translate(&p_face->glyph->outline, xshift, 0);
+		}
+	}
+
+	if (p_font_data->embolden != 0.f) {
+		FT_Pos strength = p_font_data->embolden * p_size.x * 4; // 26.6 fractional units (1 / 64).
+		FT_Outline_Embolden(&p_face->glyph->outline, strength);
+	}
+
+	if (p_font_data->transform != Transform2D()) {
+		FT_Matrix mat = { FT_Fixed(p_font_data->transform[0][0] * 65536), FT_Fixed(p_font_data->transform[0][1] * 65536), FT_Fixed(p_font_data->transform[1][0] * 65536), FT_Fixed(p_font_data->transform[1][1] * 65536) }; // 16.16 fractional units (1 / 65536).
+		FT_Outline_Transform(&p_face->glyph->outline, &mat);
+	}
+
+	r_advance = Vector2((h + (1 << 9)) >> 10, (v + (1 << 9)) >> 10) / 64.0;
+	r_aa_mode = FT_RENDER_MODE_NORMAL;
+	r_bgra = false;
+	switch (p_font_data->antialiasing) {
+		case FONT_ANTIALIASING_NONE: {
+			r_aa_mode = FT_RENDER_MODE_MONO;
+		} break;
+		case FONT_ANTIALIASING_GRAY: {
+			r_aa_mode = FT_RENDER_MODE_NORMAL;
+		} break;
+		case FONT_ANTIALIASING_LCD: {
+			int aa_layout = (int)((p_glyph >> 24) & 7);
+			switch (aa_layout) {
+				case FONT_LCD_SUBPIXEL_LAYOUT_HRGB: {
+					r_aa_mode = FT_RENDER_MODE_LCD;
+					r_bgra = false;
+				} break;
+				case FONT_LCD_SUBPIXEL_LAYOUT_HBGR: {
+					r_aa_mode = FT_RENDER_MODE_LCD;
+					r_bgra = true;
+				} break;
+				case FONT_LCD_SUBPIXEL_LAYOUT_VRGB: {
+					r_aa_mode = FT_RENDER_MODE_LCD_V;
+					r_bgra = false;
+				} break;
+				case FONT_LCD_SUBPIXEL_LAYOUT_VBGR: {
+					r_aa_mode = FT_RENDER_MODE_LCD_V;
+					r_bgra = true;
+				} break;
+				default: {
+					r_aa_mode = FT_RENDER_MODE_NORMAL;
+				} break;
+			}
+		} break;
+	}
+
+	return 0;
+}
+#endif
+
 _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_glyph) const {
 	ERR_FAIL_COND_V(!_ensure_cache_for_size(p_font_data, p_size), false);
 
@@ -1182,94 +1294,16 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data,
 #ifdef MODULE_FREETYPE_ENABLED
 	FontGlyph gl;
 	if (fd->face) {
-		FT_Int32 flags = FT_LOAD_DEFAULT;
-
 		bool outline = p_size.y > 0;
-		switch (p_font_data->hinting) {
-			case TextServer::HINTING_NONE:
-				flags |= FT_LOAD_NO_HINTING;
-				break;
-			case TextServer::HINTING_LIGHT:
-				flags |= FT_LOAD_TARGET_LIGHT;
-				break;
-			default:
-				flags |= FT_LOAD_TARGET_NORMAL;
-				break;
-		}
-		if (p_font_data->force_autohinter) {
-			flags |= FT_LOAD_FORCE_AUTOHINT;
-		}
-		if (outline) {
-			flags |= FT_LOAD_NO_BITMAP;
-		} else if (FT_HAS_COLOR(fd->face)) {
-			flags |= FT_LOAD_COLOR;
-		}
-
-		FT_Fixed v, h;
-		FT_Get_Advance(fd->face, glyph_index, flags, &h);
-		FT_Get_Advance(fd->face, glyph_index, flags | FT_LOAD_VERTICAL_LAYOUT, &v);
-
-		int error = FT_Load_Glyph(fd->face, glyph_index, flags);
+		Vector2 advance;
+		FT_Render_Mode aa_mode = FT_RENDER_MODE_NORMAL;
+		bool bgra = false;
+		int error = _load_glyph(p_font_data, fd->face, p_size, p_glyph, advance, aa_mode, bgra);
 		if (error) {
 			fd->glyph_map[p_glyph] = FontGlyph();
 			return false;
 		}
 
-		if (!p_font_data->msdf) {
-			if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-				FT_Pos xshift = (int)((p_glyph >> 27) & 3) << 4;
-				FT_Outline_Translate(&fd->face->glyph->outline, xshift, 0);
-			} else if ((p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (p_font_data->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && p_size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-				FT_Pos xshift = (int)((p_glyph >> 27) & 3) << 5;
-				FT_Outline_Translate(&fd->face->glyph->outline, xshift, 0);
-			}
-		}
-
-		if (p_font_data->embolden != 0.f) {
-			FT_Pos strength = p_font_data->embolden * p_size.x * 4; // 26.6 fractional units (1 / 64).
-			FT_Outline_Embolden(&fd->face->glyph->outline, strength);
-		}
-
-		if (p_font_data->transform != Transform2D()) {
-			FT_Matrix mat = { FT_Fixed(p_font_data->transform[0][0] * 65536), FT_Fixed(p_font_data->transform[0][1] * 65536), FT_Fixed(p_font_data->transform[1][0] * 65536), FT_Fixed(p_font_data->transform[1][1] * 65536) }; // 16.16 fractional units (1 / 65536).
-			FT_Outline_Transform(&fd->face->glyph->outline, &mat);
-		}
-
-		FT_Render_Mode aa_mode = FT_RENDER_MODE_NORMAL;
-		bool bgra = false;
-		switch (p_font_data->antialiasing) {
-			case FONT_ANTIALIASING_NONE: {
-				aa_mode = FT_RENDER_MODE_MONO;
-			} break;
-			case FONT_ANTIALIASING_GRAY: {
-				aa_mode = FT_RENDER_MODE_NORMAL;
-			} break;
-			case FONT_ANTIALIASING_LCD: {
-				int aa_layout = (int)((p_glyph >> 24) & 7);
-				switch (aa_layout) {
-					case FONT_LCD_SUBPIXEL_LAYOUT_HRGB: {
-						aa_mode = FT_RENDER_MODE_LCD;
-						bgra = false;
-					} break;
-					case FONT_LCD_SUBPIXEL_LAYOUT_HBGR: {
-						aa_mode = FT_RENDER_MODE_LCD;
-						bgra = true;
-					} break;
-					case FONT_LCD_SUBPIXEL_LAYOUT_VRGB: {
-						aa_mode = FT_RENDER_MODE_LCD_V;
-						bgra = false;
-					} break;
-					case FONT_LCD_SUBPIXEL_LAYOUT_VBGR: {
-						aa_mode = FT_RENDER_MODE_LCD_V;
-						bgra = true;
-					} break;
-					default: {
-						aa_mode = FT_RENDER_MODE_NORMAL;
-					} break;
-				}
-			} break;
-		}
-
 		if (!outline) {
 			if (!p_font_data->msdf) {
 				error = FT_Render_Glyph(fd->face->glyph, aa_mode);
@@ -1278,13 +1312,13 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data,
 			if (!error) {
 				if (p_font_data->msdf) {
 #ifdef MODULE_MSDFGEN_ENABLED
-					gl = rasterize_msdf(p_font_data, fd, p_font_data->msdf_range, rect_range, &slot->outline, Vector2((h + (1 << 9)) >> 10, (v + (1 << 9)) >> 10) / 64.0);
+					gl = rasterize_msdf(p_font_data, fd, p_font_data->msdf_range, rect_range, &slot->outline, advance);
 #else
 					fd->glyph_map[p_glyph] = FontGlyph();
 					ERR_FAIL_V_MSG(false, "Compiled without MSDFGEN support!");
 #endif
 				} else {
-					gl = rasterize_bitmap(fd, rect_range, slot->bitmap, slot->bitmap_top, slot->bitmap_left, Vector2((h + (1 << 9)) >> 10, (v + (1 << 9)) >> 10) / 64.0, bgra);
+					gl = rasterize_bitmap(fd, rect_range, slot->bitmap, slot->bitmap_top, slot->bitmap_left, advance, bgra);
 				}
 			}
 		} else {
@@ -1327,6 +1361,111 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_glyph(FontAdvanced *p_font_data,
 	return false;
 }
 
+#ifdef MODULE_FREETYPE_ENABLED
+void TextServerAdvanced::_render_glyphs_threaded(void *p_td, uint32_t p_chunk) {
+	GlyphBatchData *td = static_cast<GlyphBatchData *>(p_td);
+	const FontAdvanced *font_data = td->font_data;
+
+	// FreeType faces can't be used by multiple threads, each chunk renders with its own face.
+	FT_Face face = nullptr;
+	{
+		MutexLock ftlock(td->ts->ft_mutex);
+		if (FT_New_Memory_Face(td->ts->ft_library, font_data->data_ptr, font_data->data_size, td->face_index, &face) != 0) {
+			return; // Glyphs left unrendered are rendered by the calling thread.
+		}
+	}
+	FT_Set_Pixel_Sizes(face, 0, td->pixel_size);
+	if (!td->coords.is_empty()) {
+		FT_Set_Var_Design_Coordinates(face, td->coords.size(), const_cast<FT_Fixed *>(td->coords.ptr()));
+	}
+
+	uint32_t from = p_chunk * td->chunk_size;
+	uint32_t to = MIN(from + td->chunk_size, td->glyphs.size());
+	for (uint32_t i = from; i < to; i++) {
+		RenderedGlyph &rg = td->glyphs[i];
+		FT_Render_Mode aa_mode = FT_RENDER_MODE_NORMAL;
+		if (td->ts->_load_glyph(font_data, face, td->size, rg.glyph, rg.advance, aa_mode, rg.bgra) != 0) {
+			continue;
+		}
+		if (FT_Render_Glyph(face->glyph, aa_mode) != 0) {
+			continue;
+		}
+		rg.bitmap = face->glyph->bitmap;
+		rg.buffer.resize(rg.bitmap.rows * ABS(rg.bitmap.pitch));
+		if (!rg.buffer.is_empty()) {
+			memcpy(rg.buffer.ptrw(), rg.bitmap.buffer, rg.buffer.size());
+		}
+		rg.top = face->glyph->bitmap_top;
+		rg.left = face->glyph->bitmap_left;
+		rg.rendered = true;
+	}
+
+	MutexLock ftlock(td->ts->ft_mutex);
+	FT_Done_Face(face);
+}
+#endif
+
+void TextServerAdvanced::_ensure_glyphs(FontAdvanced *p_font_data, const Vector2i &p_size, const int32_t *p_glyphs, uint32_t p_count) const {
+	ERR_FAIL_COND(!_ensure_cache_for_size(p_font_data, p_size));
+	FontForSizeAdvanced *fd = p_font_data->cache[p_size];
+
+#ifdef MODULE_FREETYPE_ENABLED
+	GlyphBatchData td;
+	HashSet<int32_t> queued;
+	for (uint32_t i = 0; i < p_count; i++) {
+		int32_t glyph = p_glyphs[i];
+		if ((glyph & 0xffffff) == 0 || fd->glyph_map.has(glyph) || queued.has(glyph)) {
+			continue;
+		}
+		queued.insert(glyph);
+		RenderedGlyph rg;
+		rg.glyph = glyph;
+		td.glyphs.push_back(rg);
+	}
+
+	// Outlines and MSDF glyphs are rendered with the shared face (MSDF generation is threaded per glyph),
+	// color bitmap strikes are selected by the shared face and can't be reproduced by pixel size alone.
+	// Pool threads render inline: waiting for a group while holding the font mutex could starve the
+	// pool, or deadlock with a pool task waiting for the same font.
+	uint32_t threads = WorkerThreadPool::get_singleton()->get_thread_count();
+	bool batch = threads > 1 && WorkerThreadPool::get_singleton()->get_thread_index() < 0;
+	if (batch && fd->face && !p_font_data->msdf && p_size.y == 0 && FT_IS_SCALABLE(fd->face) && !(FT_HAS_COLOR(fd->face) && fd->face->num_fixed_sizes > 0) && td.glyphs.size() >= GLYPH_BATCH_MIN) {
+		td.ts = this;
+		td.font_data = p_font_data;
+		td.size = p_size;
+		td.face_index = fd->face->face_index;
+		td.pixel_size = double(fd->size.x * fd->oversampling);
+		if (fd->face->face_flags & FT_FACE_FLAG_MULTIPLE_MASTERS) {
+			FT_MM_Var *amaster;
+			FT_Get_MM_Var(fd->face, &amaster);
+			td.coords.resize(amaster->num_axis);
+			FT_Get_Var_Design_Coordinates(fd->face, td.coords.size(), td.coords.ptrw());
+			FT_Done_MM_Var(ft_library, amaster);
+		}
+
+		uint32_t chunks = MIN(threads, td.glyphs.size() / (GLYPH_BATCH_MIN / 2));
+		td.chunk_size = (td.glyphs.size() + chunks - 1) / chunks;
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&TextServerAdvanced::_render_glyphs_threaded, &td, chunks, -1, true, String("FontServerRasterizeGlyphs"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	// Pack in request order, so the texture layout doesn't depend on thread scheduling.
+	for (RenderedGlyph &rg : td.glyphs) {
+		if (rg.rendered) {
+			FT_Bitmap bitmap = rg.bitmap;
+			bitmap.buffer = rg.buffer.ptrw();
+			fd->glyph_map[rg.glyph] = rasterize_bitmap(fd, rect_range, bitmap, rg.top, rg.left, rg.advance, rg.bgra);
+		} else {
+			_ensure_glyph(p_font_data, p_size, rg.glyph);
+		}
+	}
+#else
+	for (uint32_t i = 0; i < p_count; i++) {
+		_ensure_glyph(p_font_data, p_size, p_glyphs[i]);
+	}
+#endif
+}
+
 _FORCE_INLINE_ bool TextServerAdvanced::_ensure_cache_for_size(FontAdvanced *p_font_data, const Vector2i &p_size) const {
 	ERR_FAIL_COND_V(p_size.x <= 0, false);
 	if (p_font_data->cache.has(p_size)) {
@@ -1796,6 +1935,10 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_cache_for_size(FontAdvanced *p_f
 			hb_font_set_variations(fd->hb_handle, hb_vars.is_empty() ? nullptr : &hb_vars[0], hb_vars.size());
 			FT_Done_MM_Var(ft_library, amaster);
 		}
+
+		if (_persistent_cache_enabled()) {
+			_persistent_cache_load(p_font_data, fd, p_size);
+		}
 #else
 		memdelete(fd);
 		ERR_FAIL_V_MSG(false, "FreeType: Can't load dynamic font, engine is compiled without FreeType support!");
@@ -1809,6 +1952,8 @@ _FORCE_INLINE_ bool TextServerAdvanced::_ensure_cache_for_size(FontAdvanced *p_f
 }
 
 _FORCE_INLINE_ void TextServerAdvanced::_font_clear_cache(FontAdvanced *p_font_data) {
+	_persistent_cache_save_all(p_font_data);
+
 	MutexLock ftlock(ft_mutex);
 
 	for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : p_font_data->cache) {
@@ -1821,7 +1966,246 @@ _FORCE_INLINE_ void TextServerAdvanced::_font_clear_cache(FontAdvanced *p_font_d
 	p_font_data->supported_scripts.clear();
 }
 
+bool TextServerAdvanced::_persistent_cache_enabled() const {
+	return ProjectSettings::get_singleton() != nullptr && GLOBAL_GET("gui/fonts/dynamic_fonts/persistent_glyph_cache").operator bool();
+}
+
+String TextServerAdvanced::_persistent_cache_file(FontAdvanced *p_font_data, const FontForSizeAdvanced *p_data, const Vector2i &p_size) const {
+	if (p_font_data->data_hash == 0) {
+		p_font_data->data_hash = hash_murmur3_buffer(p_font_data->data_ptr, p_font_data->data_size);
+	}
+
+	// Everything that affects rasterized glyphs, changing any of it selects a different cache file.
+	uint32_t hash = hash_murmur3_one_64(p_font_data->data_size);
+	hash = hash_murmur3_one_32(p_font_data->face_index, hash);
+	hash = hash_murmur3_one_32(p_size.x, hash);
+	hash = hash_murmur3_one_32(p_size.y, hash);
+	hash = hash_murmur3_one_double(p_data->oversampling, hash);
+	hash = hash_murmur3_one_32(p_font_data->msdf_range, hash);
+	hash = hash_murmur3_one_32(p_font_data->fixed_size, hash);
+	hash = hash_murmur3_one_double(p_font_data->embolden, hash);
+	hash = hash_murmur3_one_real(p_font_data->transform[0].x, hash);
+	hash = hash_murmur3_one_real(p_font_data->transform[0].y, hash);
+	hash = hash_murmur3_one_real(p_font_data->transform[1].x, hash);
+	hash = hash_murmur3_one_real(p_font_data->transform[1].y, hash);
+	hash = hash_murmur3_one_32(p_font_data->variation_coordinates.hash(), hash);
+	if (p_size.y > 0) {
+		hash = hash_murmur3_one_32(GLOBAL_GET("gui/fonts/dynamic_fonts/line_cap").operator int(), hash);
+		hash = hash_murmur3_one_32(GLOBAL_GET("gui/fonts/dynamic_fonts/line_join").operator int(), hash);
+		hash = hash_murmur3_one_float(GLOBAL_GET("gui/fonts/dynamic_fonts/miter_limit").operator float(), hash);
+	}
+	hash = hash_fmix32(hash_murmur3_one_32(((int)p_font_data->msdf) | ((int)p_font_data->force_autohinter << 1) | ((int)p_font_data->hinting << 2) | ((int)p_font_data->subpixel_positioning << 6) | ((int)p_font_data->antialiasing << 10), hash));
+
+	const String path = GLOBAL_GET("gui/fonts/dynamic_fonts/persistent_glyph_cache_path");
+	return path.path_join(vformat("%08x_%08x.glyphcache", p_font_data->data_hash, hash));
+}
+
+void TextServerAdvanced::_persistent_cache_load(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data, const Vector2i &p_size) const {
+	p_data->persistent_glyphs = 0;
+
+	uint64_t start = OS::get_singleton()->get_ticks_usec();
+	const String path = _persistent_cache_file(p_font_data, p_data, p_size);
+	if (WorkerThreadPool::get_singleton()->get_thread_index() < 0) {
+		_persistent_cache_wait(path); // A write of the same file may still be queued.
+	}
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+	if (f.is_null()) {
+		return;
+	}
+	if (f->get_32() != PERSISTENT_CACHE_MAGIC || f->get_32() != PERSISTENT_CACHE_VERSION) {
+		return;
+	}
+
+	// Nothing is applied until the whole file is read, a truncated or corrupted file leaves the size cache empty.
+	uint32_t texture_count = f->get_32();
+	if (texture_count > 1024) {
+		return;
+	}
+	Vector<SkylinePackTexture> textures;
+	textures.resize(texture_count);
+	for (SkylinePackTexture &tex : textures) {
+		uint32_t format = f->get_32();
+		tex.texture_w = f->get_32();
+		tex.texture_h = f->get_32();
+		uint32_t size = f->get_32();
+		if (format >= Image::FORMAT_MAX || tex.texture_w <= 0 || tex.texture_h <= 0 || size > f->get_length() - f->get_position()) {
+			return;
+		}
+		tex.format = (Image::Format)format;
+		tex.imgdata = f->get_buffer(size);
+
+		uint32_t node_count = f->get_32();
+		if (node_count > (uint32_t)tex.texture_w) {
+			return;
+		}
+		for (uint32_t i = 0; i < node_count; i++) {
+			int32_t x = f->get_32();
+			int32_t y = f->get_32();
+			int32_t w = f->get_32();
+			tex.skyline.push_back(SkylineNode(x, y, w));
+		}
+	}
+
+	uint32_t glyph_count = f->get_32();
+	if ((uint64_t)glyph_count * 49 > f->get_length() - f->get_position()) {
+		return;
+	}
+	HashMap<int32_t, FontGlyph> glyph_map;
+	glyph_map.reserve(glyph_count);
+	for (uint32_t i = 0; i < glyph_count; i++) {
+		int32_t key = f->get_32();
+		FontGlyph gl;
+		gl.found = f->get_8();
+		gl.texture_idx = (int32_t)f->get_32();
+		gl.rect.position.x = f->get_float();
+		gl.rect.position.y = f->get_float();
+		gl.rect.size.x = f->get_float();
+		gl.rect.size.y = f->get_float();
+		gl.uv_rect.position.x = f->get_float();
+		gl.uv_rect.position.y = f->get_float();
+		gl.uv_rect.size.x = f->get_float();
+		gl.uv_rect.size.y = f->get_float();
+		gl.advance.x = f->get_float();
+		gl.advance.y = f->get_float();
+		if (gl.texture_idx < -1 || gl.texture_idx >= (int32_t)texture_count) {
+			return;
+		}
+		glyph_map[key] = gl;
+	}
+	if (f->get_32() != PERSISTENT_CACHE_MAGIC || f->get_error() != OK) {
+		return;
+	}
+
+	p_data->textures = textures;
+	p_data->glyph_map = glyph_map;
+	p_data->persistent_glyphs = glyph_map.size();
+
+	print_verbose(vformat("TextServer: Loaded %d glyphs of \"%s\" (size %d) from the persistent glyph cache in %.2f ms.", glyph_count, p_font_data->font_name, p_size.x, (OS::get_singleton()->get_ticks_usec() - start) / 1000.0));
+}
+
+void TextServerAdvanced::_persistent_cache_write(PersistentCacheWrite *p_write) {
+	DirAccess::make_dir_recursive_absolute(p_write->path.get_base_dir());
+
+	// Written to a temporary file first, so readers never see a partially written cache.
+	Ref<FileAccess> f = FileAccess::open(p_write->tmp_path, FileAccess::WRITE);
+	if (f.is_null()) {
+		return; // Read-only location, e.g. a cache shipped in the exported pack.
+	}
+
+	f->store_32(PERSISTENT_CACHE_MAGIC);
+	f->store_32(PERSISTENT_CACHE_VERSION);
+
+	f->store_32(p_write->textures.size());
+	for (const SkylinePackTexture &tex : p_write->textures) {
+		f->store_32(tex.format);
+		f->store_32(tex.texture_w);
+		f->store_32(tex.texture_h);
+		f->store_32(tex.imgdata.size());
+		f->store_buffer(tex.imgdata);
+
+		f->store_32(tex.skyline.size());
+		for (const SkylineNode &E : tex.skyline) {
+			f->store_32(E.x);
+			f->store_32(E.y);
+			f->store_32(E.w);
+		}
+	}
+
+	f->store_32(p_write->glyph_map.size());
+	for (const KeyValue<int32_t, FontGlyph> &E : p_write->glyph_map) {
+		f->store_32(E.key);
+		f->store_8(E.value.found);
+		f->store_32(E.value.texture_idx);
+		f->store_float(E.value.rect.position.x);
+		f->store_float(E.value.rect.position.y);
+		f->store_float(E.value.rect.size.x);
+		f->store_float(E.value.rect.size.y);
+		f->store_float(E.value.uv_rect.position.x);
+		f->store_float(E.value.uv_rect.position.y);
+		f->store_float(E.value.uv_rect.size.x);
+		f->store_float(E.value.uv_rect.size.y);
+		f->store_float(E.value.advance.x);
+		f->store_float(E.value.advance.y);
+	}
+	f->store_32(PERSISTENT_CACHE_MAGIC);
+
+	bool failed = f->get_error() != OK;
+	f.unref();
+
+	if (failed || DirAccess::rename_absolute(p_write->tmp_path, p_write->path) != OK) {
+		DirAccess::remove_absolute(p_write->tmp_path);
+	}
+}
+
+void TextServerAdvanced::_persistent_cache_write_task(void *p_write) {
+	PersistentCacheWrite *write = (PersistentCacheWrite *)p_write;
+	_persistent_cache_write(write);
+	memdelete(write);
+}
+
+void TextServerAdvanced::_persistent_cache_wait(const String &p_path) const {
+	LocalVector<WorkerThreadPool::TaskID> tasks;
+	{
+		MutexLock lock(persistent_cache_mutex);
+		for (const KeyValue<WorkerThreadPool::TaskID, String> &E : persistent_cache_writes) {
+			if (p_path.is_empty() || E.value == p_path) {
+				tasks.push_back(E.key);
+			}
+		}
+		for (const WorkerThreadPool::TaskID &E : tasks) {
+			persistent_cache_writes.erase(E);
+		}
+	}
+	for (const WorkerThreadPool::TaskID &E : tasks) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(E);
+	}
+}
+
+void TextServerAdvanced::_persistent_cache_save(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data, const Vector2i &p_size) const {
+	if (p_data->persistent_glyphs < 0 || p_data->persistent_glyphs == (int)p_data->glyph_map.size()) {
+		return; // Not persisted, or no glyphs were rasterized since the cache was loaded or saved.
+	}
+
+	// Only a copy is taken here (texture data is shared until the font changes it), the file is written by a worker thread
+	// so the font lock is not held during disk I/O.
+	PersistentCacheWrite *write = memnew(PersistentCacheWrite);
+	write->path = _persistent_cache_file(p_font_data, p_data, p_size);
+	write->textures = p_data->textures;
+	write->glyph_map = p_data->glyph_map;
+	p_data->persistent_glyphs = p_data->glyph_map.size();
+
+	MutexLock lock(persistent_cache_mutex);
+	write->tmp_path = vformat("%s.%d_%d.tmp", write->path, OS::get_singleton()->get_process_id(), ++persistent_cache_seq);
+	if (persistent_cache_sync) {
+		_persistent_cache_write_task(write); // Worker threads are no longer available after cleanup.
+		return;
+	}
+
+	// Release finished writes.
+	LocalVector<WorkerThreadPool::TaskID> finished;
+	for (const KeyValue<WorkerThreadPool::TaskID, String> &E : persistent_cache_writes) {
+		if (WorkerThreadPool::get_singleton()->is_task_completed(E.key)) {
+			finished.push_back(E.key);
+		}
+	}
+	for (const WorkerThreadPool::TaskID &E : finished) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(E);
+		persistent_cache_writes.erase(E);
+	}
+
+	const String path = write->path;
+	WorkerThreadPool::TaskID task = WorkerThreadPool::get_singleton()->add_native_task(&TextServerAdvanced::_persistent_cache_write_task, write, false, String("FontServerPersistentGlyphCache"));
+	persistent_cache_writes.insert(task, path);
+}
+
+void TextServerAdvanced::_persistent_cache_save_all(FontAdvanced *p_font_data) const {
+	for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : p_font_data->cache) {
+		_persistent_cache_save(p_font_data, E.value, E.key);
+	}
+}
+
 hb_font_t *TextServerAdvanced::_font_get_hb_handle(const RID &p_font_rid, int64_t p_size) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, nullptr);
 
@@ -1834,16 +2218,12 @@ hb_font_t *TextServerAdvanced::_font_get_hb_handle(const RID &p_font_rid, int64_
 }
 
 RID TextServerAdvanced::_create_font() {
-	_THREAD_SAFE_METHOD_
-
 	FontAdvanced *fd = memnew(FontAdvanced);
 
 	return font_owner.make_rid(fd);
 }
 
 RID TextServerAdvanced::_create_font_linked_variation(const RID &p_font_rid) {
-	_THREAD_SAFE_METHOD_
-
 	RID rid = p_font_rid;
 	FontAdvancedLinkedVariation *fdv = font_var_owner.get_or_null(rid);
 	if (unlikely(fdv)) {
@@ -1858,6 +2238,8 @@ RID TextServerAdvanced::_create_font_linked_variation(const RID &p_font_rid) {
 }
 
 void TextServerAdvanced::_font_set_data(const RID &p_font_rid, const PackedByteArray &p_data) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -1866,9 +2248,12 @@ void TextServerAdvanced::_font_set_data(const RID &p_font_rid, const PackedByteA
 	fd->data = p_data;
 	fd->data_ptr = fd->data.ptr();
 	fd->data_size = fd->data.size();
+	fd->data_hash = 0;
 }
 
 void TextServerAdvanced::_font_set_data_ptr(const RID &p_font_rid, const uint8_t *p_data_ptr, int64_t p_data_size) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -1877,9 +2262,12 @@ void TextServerAdvanced::_font_set_data_ptr(const RID &p_font_rid, const uint8_t
 	fd->data.resize(0);
 	fd->data_ptr = p_data_ptr;
 	fd->data_size = p_data_size;
+	fd->data_hash = 0;
 }
 
 void TextServerAdvanced::_font_set_face_index(const RID &p_font_rid, int64_t p_face_index) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	ERR_FAIL_COND(p_face_index < 0);
 	ERR_FAIL_COND(p_face_index >= 0x7FFF);
 
@@ -1894,6 +2282,7 @@ void TextServerAdvanced::_font_set_face_index(const RID &p_font_rid, int64_t p_f
 }
 
 int64_t TextServerAdvanced::_font_get_face_index(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0);
 
@@ -1902,6 +2291,7 @@ int64_t TextServerAdvanced::_font_get_face_index(const RID &p_font_rid) const {
 }
 
 int64_t TextServerAdvanced::_font_get_face_count(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0);
 
@@ -1948,6 +2338,8 @@ int64_t TextServerAdvanced::_font_get_face_count(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_style(const RID &p_font_rid, BitField<FontStyle> p_style) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -1958,6 +2350,7 @@ void TextServerAdvanced::_font_set_style(const RID &p_font_rid, BitField<FontSty
 }
 
 BitField<TextServer::FontStyle> TextServerAdvanced::_font_get_style(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0);
 
@@ -1968,6 +2361,8 @@ BitField<TextServer::FontStyle> TextServerAdvanced::_font_get_style(const RID &p
 }
 
 void TextServerAdvanced::_font_set_style_name(const RID &p_font_rid, const String &p_name) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -1978,6 +2373,7 @@ void TextServerAdvanced::_font_set_style_name(const RID &p_font_rid, const Strin
 }
 
 String TextServerAdvanced::_font_get_style_name(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, String());
 
@@ -1988,6 +2384,8 @@ String TextServerAdvanced::_font_get_style_name(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_weight(const RID &p_font_rid, int64_t p_weight) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -1998,6 +2396,7 @@ void TextServerAdvanced::_font_set_weight(const RID &p_font_rid, int64_t p_weigh
 }
 
 int64_t TextServerAdvanced::_font_get_weight(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 400);
 
@@ -2008,6 +2407,8 @@ int64_t TextServerAdvanced::_font_get_weight(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_stretch(const RID &p_font_rid, int64_t p_stretch) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2018,6 +2419,7 @@ void TextServerAdvanced::_font_set_stretch(const RID &p_font_rid, int64_t p_stre
 }
 
 int64_t TextServerAdvanced::_font_get_stretch(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 100);
 
@@ -2028,6 +2430,8 @@ int64_t TextServerAdvanced::_font_get_stretch(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_name(const RID &p_font_rid, const String &p_name) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2038,6 +2442,7 @@ void TextServerAdvanced::_font_set_name(const RID &p_font_rid, const String &p_n
 }
 
 String TextServerAdvanced::_font_get_name(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, String());
 
@@ -2048,6 +2453,7 @@ String TextServerAdvanced::_font_get_name(const RID &p_font_rid) const {
 }
 
 Dictionary TextServerAdvanced::_font_get_ot_name_strings(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Dictionary());
 
@@ -2161,6 +2567,8 @@ Dictionary TextServerAdvanced::_font_get_ot_name_strings(const RID &p_font_rid)
 }
 
 void TextServerAdvanced::_font_set_antialiasing(const RID &p_font_rid, TextServer::FontAntialiasing p_antialiasing) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2172,6 +2580,7 @@ void TextServerAdvanced::_font_set_antialiasing(const RID &p_font_rid, TextServe
 }
 
 TextServer::FontAntialiasing TextServerAdvanced::_font_get_antialiasing(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, TextServer::FONT_ANTIALIASING_NONE);
 
@@ -2180,6 +2589,7 @@ TextServer::FontAntialiasing TextServerAdvanced::_font_get_antialiasing(const RI
 }
 
 void TextServerAdvanced::_font_set_generate_mipmaps(const RID &p_font_rid, bool p_generate_mipmaps) {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2196,6 +2606,7 @@ void TextServerAdvanced::_font_set_generate_mipmaps(const RID &p_font_rid, bool
 }
 
 bool TextServerAdvanced::_font_get_generate_mipmaps(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, false);
 
@@ -2204,6 +2615,8 @@ bool TextServerAdvanced::_font_get_generate_mipmaps(const RID &p_font_rid) const
 }
 
 void TextServerAdvanced::_font_set_multichannel_signed_distance_field(const RID &p_font_rid, bool p_msdf) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2215,6 +2628,7 @@ void TextServerAdvanced::_font_set_multichannel_signed_distance_field(const RID
 }
 
 bool TextServerAdvanced::_font_is_multichannel_signed_distance_field(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, false);
 
@@ -2223,6 +2637,8 @@ bool TextServerAdvanced::_font_is_multichannel_signed_distance_field(const RID &
 }
 
 void TextServerAdvanced::_font_set_msdf_pixel_range(const RID &p_font_rid, int64_t p_msdf_pixel_range) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2234,6 +2650,7 @@ void TextServerAdvanced::_font_set_msdf_pixel_range(const RID &p_font_rid, int64
 }
 
 int64_t TextServerAdvanced::_font_get_msdf_pixel_range(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, false);
 
@@ -2242,6 +2659,8 @@ int64_t TextServerAdvanced::_font_get_msdf_pixel_range(const RID &p_font_rid) co
 }
 
 void TextServerAdvanced::_font_set_msdf_size(const RID &p_font_rid, int64_t p_msdf_size) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2253,6 +2672,7 @@ void TextServerAdvanced::_font_set_msdf_size(const RID &p_font_rid, int64_t p_ms
 }
 
 int64_t TextServerAdvanced::_font_get_msdf_size(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0);
 
@@ -2261,6 +2681,8 @@ int64_t TextServerAdvanced::_font_get_msdf_size(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_fixed_size(const RID &p_font_rid, int64_t p_fixed_size) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2269,6 +2691,7 @@ void TextServerAdvanced::_font_set_fixed_size(const RID &p_font_rid, int64_t p_f
 }
 
 int64_t TextServerAdvanced::_font_get_fixed_size(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0);
 
@@ -2277,6 +2700,8 @@ int64_t TextServerAdvanced::_font_get_fixed_size(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_fixed_size_scale_mode(const RID &p_font_rid, TextServer::FixedSizeScaleMode p_fixed_size_scale_mode) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2285,6 +2710,7 @@ void TextServerAdvanced::_font_set_fixed_size_scale_mode(const RID &p_font_rid,
 }
 
 TextServer::FixedSizeScaleMode TextServerAdvanced::_font_get_fixed_size_scale_mode(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, FIXED_SIZE_SCALE_DISABLE);
 
@@ -2293,6 +2719,8 @@ TextServer::FixedSizeScaleMode TextServerAdvanced::_font_get_fixed_size_scale_mo
 }
 
 void TextServerAdvanced::_font_set_allow_system_fallback(const RID &p_font_rid, bool p_allow_system_fallback) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2301,6 +2729,7 @@ void TextServerAdvanced::_font_set_allow_system_fallback(const RID &p_font_rid,
 }
 
 bool TextServerAdvanced::_font_is_allow_system_fallback(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, false);
 
@@ -2309,6 +2738,8 @@ bool TextServerAdvanced::_font_is_allow_system_fallback(const RID &p_font_rid) c
 }
 
 void TextServerAdvanced::_font_set_force_autohinter(const RID &p_font_rid, bool p_force_autohinter) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2320,6 +2751,7 @@ void TextServerAdvanced::_font_set_force_autohinter(const RID &p_font_rid, bool
 }
 
 bool TextServerAdvanced::_font_is_force_autohinter(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, false);
 
@@ -2328,6 +2760,8 @@ bool TextServerAdvanced::_font_is_force_autohinter(const RID &p_font_rid) const
 }
 
 void TextServerAdvanced::_font_set_hinting(const RID &p_font_rid, TextServer::Hinting p_hinting) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2339,6 +2773,7 @@ void TextServerAdvanced::_font_set_hinting(const RID &p_font_rid, TextServer::Hi
 }
 
 TextServer::Hinting TextServerAdvanced::_font_get_hinting(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, HINTING_NONE);
 
@@ -2347,6 +2782,8 @@ TextServer::Hinting TextServerAdvanced::_font_get_hinting(const RID &p_font_rid)
 }
 
 void TextServerAdvanced::_font_set_subpixel_positioning(const RID &p_font_rid, TextServer::SubpixelPositioning p_subpixel) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2355,6 +2792,7 @@ void TextServerAdvanced::_font_set_subpixel_positioning(const RID &p_font_rid, T
 }
 
 TextServer::SubpixelPositioning TextServerAdvanced::_font_get_subpixel_positioning(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, SUBPIXEL_POSITIONING_DISABLED);
 
@@ -2363,6 +2801,8 @@ TextServer::SubpixelPositioning TextServerAdvanced::_font_get_subpixel_positioni
 }
 
 void TextServerAdvanced::_font_set_embolden(const RID &p_font_rid, double p_strength) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2374,6 +2814,7 @@ void TextServerAdvanced::_font_set_embolden(const RID &p_font_rid, double p_stre
 }
 
 double TextServerAdvanced::_font_get_embolden(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0.0);
 
@@ -2382,6 +2823,8 @@ double TextServerAdvanced::_font_get_embolden(const RID &p_font_rid) const {
 }
 
 void TextServerAdvanced::_font_set_spacing(const RID &p_font_rid, SpacingType p_spacing, int64_t p_value) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	ERR_FAIL_INDEX((int)p_spacing, 4);
 	FontAdvancedLinkedVariation *fdv = font_var_owner.get_or_null(p_font_rid);
 	if (fdv) {
@@ -2400,6 +2843,7 @@ void TextServerAdvanced::_font_set_spacing(const RID &p_font_rid, SpacingType p_
 }
 
 int64_t TextServerAdvanced::_font_get_spacing(const RID &p_font_rid, SpacingType p_spacing) const {
+	_RID_USE_METHOD_
 	ERR_FAIL_INDEX_V((int)p_spacing, 4, 0);
 	FontAdvancedLinkedVariation *fdv = font_var_owner.get_or_null(p_font_rid);
 	if (fdv) {
@@ -2414,6 +2858,8 @@ int64_t TextServerAdvanced::_font_get_spacing(const RID &p_font_rid, SpacingType
 }
 
 void TextServerAdvanced::_font_set_transform(const RID &p_font_rid, const Transform2D &p_transform) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2425,6 +2871,7 @@ void TextServerAdvanced::_font_set_transform(const RID &p_font_rid, const Transf
 }
 
 Transform2D TextServerAdvanced::_font_get_transform(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Transform2D());
 
@@ -2433,6 +2880,8 @@ Transform2D TextServerAdvanced::_font_get_transform(const RID &p_font_rid) const
 }
 
 void TextServerAdvanced::_font_set_variation_coordinates(const RID &p_font_rid, const Dictionary &p_variation_coordinates) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2444,6 +2893,7 @@ void TextServerAdvanced::_font_set_variation_coordinates(const RID &p_font_rid,
 }
 
 Dictionary TextServerAdvanced::_font_get_variation_coordinates(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Dictionary());
 
@@ -2452,6 +2902,8 @@ Dictionary TextServerAdvanced::_font_get_variation_coordinates(const RID &p_font
 }
 
 void TextServerAdvanced::_font_set_oversampling(const RID &p_font_rid, double p_oversampling) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2463,6 +2915,7 @@ void TextServerAdvanced::_font_set_oversampling(const RID &p_font_rid, double p_
 }
 
 double TextServerAdvanced::_font_get_oversampling(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0.0);
 
@@ -2471,6 +2924,7 @@ double TextServerAdvanced::_font_get_oversampling(const RID &p_font_rid) const {
 }
 
 TypedArray<Vector2i> TextServerAdvanced::_font_get_size_cache_list(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, TypedArray<Vector2i>());
 
@@ -2483,10 +2937,13 @@ TypedArray<Vector2i> TextServerAdvanced::_font_get_size_cache_list(const RID &p_
 }
 
 void TextServerAdvanced::_font_clear_size_cache(const RID &p_font_rid) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
 	MutexLock lock(fd->mutex);
+	_persistent_cache_save_all(fd);
 	MutexLock ftlock(ft_mutex);
 	for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : fd->cache) {
 		memdelete(E.value);
@@ -2495,10 +2952,15 @@ void TextServerAdvanced::_font_clear_size_cache(const RID &p_font_rid) {
 }
 
 void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Vector2i &p_size) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
 	MutexLock lock(fd->mutex);
+	if (fd->cache.has(p_size)) {
+		_persistent_cache_save(fd, fd->cache[p_size], p_size);
+	}
 	MutexLock ftlock(ft_mutex);
 	if (fd->cache.has(p_size)) {
 		memdelete(fd->cache[p_size]);
@@ -2506,7 +2968,128 @@ void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Ve
 	}
 }
 
+TypedArray<Dictionary> TextServerAdvanced::_font_get_size_cache_info(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
+	FontAdvanced *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL_V(fd, TypedArray<Dictionary>());
+
+	MutexLock lock(fd->mutex);
+	TypedArray<Dictionary> ret;
+	for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : fd->cache) {
+		int64_t texture_area = 0;
+		int64_t textures_size = 0;
+		for (const SkylinePackTexture &tex : E.value->textures) {
+			texture_area += (int64_t)tex.texture_w * tex.texture_h;
+			textures_size += tex.imgdata.size();
+		}
+		int64_t glyph_area = 0;
+		for (const KeyValue<int32_t, FontGlyph> &G : E.value->glyph_map) {
+			if (G.value.texture_idx >= 0) {
+				glyph_area += (int64_t)(G.value.uv_rect.size.x + rect_range * 2) * (int64_t)(G.value.uv_rect.size.y + rect_range * 2);
+			}
+		}
+
+		Dictionary info;
+		info["size"] = E.key;
+		info["glyphs"] = E.value->glyph_map.size();
+		info["textures"] = E.value->textures.size();
+		info["textures_size"] = textures_size;
+		info["occupancy"] = (texture_area > 0) ? (double)glyph_area / (double)texture_area : 0.0;
+		ret.push_back(info);
+	}
+	return ret;
+}
+
+void TextServerAdvanced::_font_compact_size_cache(const RID &p_font_rid, const Vector2i &p_size, int64_t p_max_unused_frames) {
+	_RID_USE_METHOD_
+	FontAdvanced *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL(fd);
+
+	MutexLock lock(fd->mutex);
+	Vector2i size = _get_size_outline(fd, p_size);
+	if (!fd->cache.has(size)) {
+		return;
+	}
+	FontForSizeAdvanced *ffsd = fd->cache[size];
+	for (const SkylinePackTexture &tex : ffsd->textures) {
+		if (tex.format != Image::FORMAT_LA8 && tex.format != Image::FORMAT_RGBA8) {
+			return; // Custom texture set by font_set_texture_image(), glyph layout is unknown.
+		}
+	}
+
+	if (p_max_unused_frames >= 0) {
+		uint64_t frame = Engine::get_singleton()->get_frames_drawn();
+		LocalVector<int32_t> unused;
+		for (const KeyValue<int32_t, FontGlyph> &E : ffsd->glyph_map) {
+			if (E.value.texture_idx >= 0 && frame - E.value.last_used > (uint64_t)p_max_unused_frames) {
+				unused.push_back(E.key);
+			}
+		}
+		for (int32_t E : unused) {
+			ffsd->glyph_map.erase(E);
+		}
+	}
+
+	// Repack the remaining glyphs into new textures, tallest first.
+	struct GlyphRepack {
+		int32_t glyph = 0;
+		real_t height = 0.0;
+
+		bool operator<(const GlyphRepack &p_b) const { return height > p_b.height; }
+	};
+	LocalVector<GlyphRepack> glyphs;
+	for (const KeyValue<int32_t, FontGlyph> &E : ffsd->glyph_map) {
+		if (E.value.texture_idx >= 0) {
+			GlyphRepack gr;
+			gr.glyph = E.key;
+			gr.height = E.value.uv_rect.size.y;
+			glyphs.push_back(gr);
+		}
+	}
+	glyphs.sort();
+
+	Vector<SkylinePackTexture> old_textures = ffsd->textures;
+	ffsd->textures.clear();
+	for (const GlyphRepack &E : glyphs) {
+		FontGlyph &gl = ffsd->glyph_map[E.glyph];
+		if (gl.texture_idx >= old_textures.size()) {
+			ffsd->glyph_map.erase(E.glyph);
+			continue;
+		}
+		const SkylinePackTexture &src = old_textures[gl.texture_idx];
+		int color_size = (src.format == Image::FORMAT_LA8) ? 2 : 4;
+		Rect2i rect = Rect2i(gl.uv_rect).grow(rect_range).intersection(Rect2i(0, 0, src.texture_w, src.texture_h));
+
+		FontTexturePosition tex_pos = find_texture_pos_for_glyph(ffsd, color_size, src.format, rect.size.x, rect.size.y, fd->msdf);
+		if (tex_pos.index < 0) {
+			ffsd->glyph_map.erase(E.glyph); // Rendered again on next use.
+			continue;
+		}
+		SkylinePackTexture &dst = ffsd->textures.write[tex_pos.index];
+
+		const uint8_t *r = src.imgdata.ptr();
+		uint8_t *w = dst.imgdata.ptrw();
+		for (int32_t y = 0; y < rect.size.y; y++) {
+			memcpy(w + ((tex_pos.y + y) * dst.texture_w + tex_pos.x) * color_size, r + ((rect.position.y + y) * src.texture_w + rect.position.x) * color_size, rect.size.x * color_size);
+		}
+
+		gl.uv_rect.position += Vector2(tex_pos.x - rect.position.x, tex_pos.y - rect.position.y);
+		gl.texture_idx = tex_pos.index;
+	}
+
+	// Every page gets a new texture, the old ones are freed with old_textures. Canvas items that drew glyphs
+	// of this size before must be redrawn, FontFile::compact_size_cache() emits "changed" for that.
+	for (int i = 0; i < ffsd->textures.size(); i++) {
+		ffsd->textures.write[i].dirty = true;
+	}
+	if (ffsd->persistent_glyphs >= 0) {
+		ffsd->persistent_glyphs = 0; // Texture layout changed, written again with the next save.
+	}
+}
+
 void TextServerAdvanced::_font_set_ascent(const RID &p_font_rid, int64_t p_size, double p_ascent) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2518,6 +3101,7 @@ void TextServerAdvanced::_font_set_ascent(const RID &p_font_rid, int64_t p_size,
 }
 
 double TextServerAdvanced::_font_get_ascent(const RID &p_font_rid, int64_t p_size) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0.0);
 
@@ -2540,6 +3124,8 @@ double TextServerAdvanced::_font_get_ascent(const RID &p_font_rid, int64_t p_siz
 }
 
 void TextServerAdvanced::_font_set_descent(const RID &p_font_rid, int64_t p_size, double p_descent) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2550,6 +3136,7 @@ void TextServerAdvanced::_font_set_descent(const RID &p_font_rid, int64_t p_size
 }
 
 double TextServerAdvanced::_font_get_descent(const RID &p_font_rid, int64_t p_size) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0.0);
 
@@ -2572,6 +3159,8 @@ double TextServerAdvanced::_font_get_descent(const RID &p_font_rid, int64_t p_si
 }
 
 void TextServerAdvanced::_font_set_underline_position(const RID &p_font_rid, int64_t p_size, double p_underline_position) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2583,6 +3172,7 @@ void TextServerAdvanced::_font_set_underline_position(const RID &p_font_rid, int
 }
 
 double TextServerAdvanced::_font_get_underline_position(const RID &p_font_rid, int64_t p_size) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0.0);
 
@@ -2605,6 +3195,8 @@ double TextServerAdvanced::_font_get_underline_position(const RID &p_font_rid, i
 }
 
 void TextServerAdvanced::_font_set_underline_thickness(const RID &p_font_rid, int64_t p_size, double p_underline_thickness) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2616,6 +3208,7 @@ void TextServerAdvanced::_font_set_underline_thickness(const RID &p_font_rid, in
 }
 
 double TextServerAdvanced::_font_get_underline_thickness(const RID &p_font_rid, int64_t p_size) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0.0);
 
@@ -2638,6 +3231,8 @@ double TextServerAdvanced::_font_get_underline_thickness(const RID &p_font_rid,
 }
 
 void TextServerAdvanced::_font_set_scale(const RID &p_font_rid, int64_t p_size, double p_scale) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2654,6 +3249,7 @@ void TextServerAdvanced::_font_set_scale(const RID &p_font_rid, int64_t p_size,
 }
 
 double TextServerAdvanced::_font_get_scale(const RID &p_font_rid, int64_t p_size) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0.0);
 
@@ -2676,6 +3272,7 @@ double TextServerAdvanced::_font_get_scale(const RID &p_font_rid, int64_t p_size
 }
 
 int64_t TextServerAdvanced::_font_get_texture_count(const RID &p_font_rid, const Vector2i &p_size) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0);
 
@@ -2688,6 +3285,7 @@ int64_t TextServerAdvanced::_font_get_texture_count(const RID &p_font_rid, const
 }
 
 void TextServerAdvanced::_font_clear_textures(const RID &p_font_rid, const Vector2i &p_size) {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 	MutexLock lock(fd->mutex);
@@ -2698,6 +3296,7 @@ void TextServerAdvanced::_font_clear_textures(const RID &p_font_rid, const Vecto
 }
 
 void TextServerAdvanced::_font_remove_texture(const RID &p_font_rid, const Vector2i &p_size, int64_t p_texture_index) {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2710,6 +3309,7 @@ void TextServerAdvanced::_font_remove_texture(const RID &p_font_rid, const Vecto
 }
 
 void TextServerAdvanced::_font_set_texture_image(const RID &p_font_rid, const Vector2i &p_size, int64_t p_texture_index, const Ref<Image> &p_image) {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 	ERR_FAIL_COND(p_image.is_null());
@@ -2722,7 +3322,7 @@ void TextServerAdvanced::_font_set_texture_image(const RID &p_font_rid, const Ve
 		fd->cache[size]->textures.resize(p_texture_index + 1);
 	}
 
-	ShelfPackTexture &tex = fd->cache[size]->textures.write[p_texture_index];
+	SkylinePackTexture &tex = fd->cache[size]->textures.write[p_texture_index];
 
 	tex.imgdata = p_image->get_data();
 	tex.texture_w = p_image->get_width();
@@ -2739,6 +3339,7 @@ void TextServerAdvanced::_font_set_texture_image(const RID &p_font_rid, const Ve
 }
 
 Ref<Image> TextServerAdvanced::_font_get_texture_image(const RID &p_font_rid, const Vector2i &p_size, int64_t p_texture_index) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Ref<Image>());
 
@@ -2747,11 +3348,12 @@ Ref<Image> TextServerAdvanced::_font_get_texture_image(const RID &p_font_rid, co
 	ERR_FAIL_COND_V(!_ensure_cache_for_size(fd, size), Ref<Image>());
 	ERR_FAIL_INDEX_V(p_texture_index, fd->cache[size]->textures.size(), Ref<Image>());
 
-	const ShelfPackTexture &tex = fd->cache[size]->textures[p_texture_index];
+	const SkylinePackTexture &tex = fd->cache[size]->textures[p_texture_index];
 	return Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
 }
 
 void TextServerAdvanced::_font_set_texture_offsets(const RID &p_font_rid, const Vector2i &p_size, int64_t p_texture_index, const PackedInt32Array &p_offsets) {
+	_RID_USE_METHOD_
 	ERR_FAIL_COND(p_offsets.size() % 4 != 0);
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
@@ -2764,14 +3366,30 @@ void TextServerAdvanced::_font_set_texture_offsets(const RID &p_font_rid, const
 		fd->cache[size]->textures.resize(p_texture_index + 1);
 	}
 
-	ShelfPackTexture &tex = fd->cache[size]->textures.write[p_texture_index];
-	tex.shelves.clear();
-	for (int32_t i = 0; i < p_offsets.size(); i += 4) {
-		tex.shelves.push_back(Shelf(p_offsets[i], p_offsets[i + 1], p_offsets[i + 2], p_offsets[i + 3]));
+	SkylinePackTexture &tex = fd->cache[size]->textures.write[p_texture_index];
+	tex.skyline.clear();
+	bool legacy = false;
+	for (int32_t i = 3; i < p_offsets.size(); i += 4) {
+		legacy = legacy || (p_offsets[i] != 0);
+	}
+	if (legacy) {
+		// Shelf packer data (next free X, Y, free width, height). The area above the bottom of the last shelf and left of its free space is used.
+		int32_t i = p_offsets.size() - 4;
+		if (p_offsets[i] > 0) {
+			tex.skyline.push_back(SkylineNode(0, p_offsets[i + 1] + p_offsets[i + 3], p_offsets[i]));
+		}
+		if (p_offsets[i + 2] > 0) {
+			tex.skyline.push_back(SkylineNode(p_offsets[i], p_offsets[i + 1], p_offsets[i + 2]));
+		}
+	} else {
+		for (int32_t i = 0; i < p_offsets.size(); i += 4) {
+			tex.skyline.push_back(SkylineNode(p_offsets[i], p_offsets[i + 1], p_offsets[i + 2]));
+		}
 	}
 }
 
 PackedInt32Array TextServerAdvanced::_font_get_texture_offsets(const RID &p_font_rid, const Vector2i &p_size, int64_t p_texture_index) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, PackedInt32Array());
 
@@ -2780,23 +3398,22 @@ PackedInt32Array TextServerAdvanced::_font_get_texture_offsets(const RID &p_font
 	ERR_FAIL_COND_V(!_ensure_cache_for_size(fd, size), PackedInt32Array());
 	ERR_FAIL_INDEX_V(p_texture_index, fd->cache[size]->textures.size(), PackedInt32Array());
 
-	const ShelfPackTexture &tex = fd->cache[size]->textures[p_texture_index];
+	const SkylinePackTexture &tex = fd->cache[size]->textures[p_texture_index];
 	PackedInt32Array ret;
-	ret.resize(tex.shelves.size() * 4);
+	ret.resize(tex.skyline.size() * 4);
 
 	int32_t *wr = ret.ptrw();
-	int32_t i = 0;
-	for (const Shelf &E : tex.shelves) {
-		wr[i * 4] = E.x;
-		wr[i * 4 + 1] = E.y;
-		wr[i * 4 + 2] = E.w;
-		wr[i * 4 + 3] = E.h;
-		i++;
+	for (uint32_t i = 0; i < tex.skyline.size(); i++) {
+		wr[i * 4] = tex.skyline[i].x;
+		wr[i * 4 + 1] = tex.skyline[i].y;
+		wr[i * 4 + 2] = tex.skyline[i].w;
+		wr[i * 4 + 3] = 0;
 	}
 	return ret;
 }
 
 PackedInt32Array TextServerAdvanced::_font_get_glyph_list(const RID &p_font_rid, const Vector2i &p_size) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, PackedInt32Array());
 
@@ -2813,6 +3430,8 @@ PackedInt32Array TextServerAdvanced::_font_get_glyph_list(const RID &p_font_rid,
 }
 
 void TextServerAdvanced::_font_clear_glyphs(const RID &p_font_rid, const Vector2i &p_size) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2824,6 +3443,8 @@ void TextServerAdvanced::_font_clear_glyphs(const RID &p_font_rid, const Vector2
 }
 
 void TextServerAdvanced::_font_remove_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2835,6 +3456,7 @@ void TextServerAdvanced::_font_remove_glyph(const RID &p_font_rid, const Vector2
 }
 
 double TextServerAdvanced::_get_extra_advance(RID p_font_rid, int p_font_size) const {
+	_RID_USE_METHOD_
 	const FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0.0);
 
@@ -2849,6 +3471,7 @@ double TextServerAdvanced::_get_extra_advance(RID p_font_rid, int p_font_size) c
 }
 
 Vector2 TextServerAdvanced::_font_get_glyph_advance(const RID &p_font_rid, int64_t p_size, int64_t p_glyph) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Vector2());
 
@@ -2893,6 +3516,8 @@ Vector2 TextServerAdvanced::_font_get_glyph_advance(const RID &p_font_rid, int64
 }
 
 void TextServerAdvanced::_font_set_glyph_advance(const RID &p_font_rid, int64_t p_size, int64_t p_glyph, const Vector2 &p_advance) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2908,6 +3533,7 @@ void TextServerAdvanced::_font_set_glyph_advance(const RID &p_font_rid, int64_t
 }
 
 Vector2 TextServerAdvanced::_font_get_glyph_offset(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Vector2());
 
@@ -2944,6 +3570,8 @@ Vector2 TextServerAdvanced::_font_get_glyph_offset(const RID &p_font_rid, const
 }
 
 void TextServerAdvanced::_font_set_glyph_offset(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph, const Vector2 &p_offset) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -2959,6 +3587,7 @@ void TextServerAdvanced::_font_set_glyph_offset(const RID &p_font_rid, const Vec
 }
 
 Vector2 TextServerAdvanced::_font_get_glyph_size(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Vector2());
 
@@ -2995,6 +3624,8 @@ Vector2 TextServerAdvanced::_font_get_glyph_size(const RID &p_font_rid, const Ve
 }
 
 void TextServerAdvanced::_font_set_glyph_size(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph, const Vector2 &p_gl_size) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3010,6 +3641,7 @@ void TextServerAdvanced::_font_set_glyph_size(const RID &p_font_rid, const Vecto
 }
 
 Rect2 TextServerAdvanced::_font_get_glyph_uv_rect(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Rect2());
 
@@ -3035,6 +3667,7 @@ Rect2 TextServerAdvanced::_font_get_glyph_uv_rect(const RID &p_font_rid, const V
 }
 
 void TextServerAdvanced::_font_set_glyph_uv_rect(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph, const Rect2 &p_uv_rect) {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3050,6 +3683,7 @@ void TextServerAdvanced::_font_set_glyph_uv_rect(const RID &p_font_rid, const Ve
 }
 
 int64_t TextServerAdvanced::_font_get_glyph_texture_idx(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, -1);
 
@@ -3075,6 +3709,7 @@ int64_t TextServerAdvanced::_font_get_glyph_texture_idx(const RID &p_font_rid, c
 }
 
 void TextServerAdvanced::_font_set_glyph_texture_idx(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph, int64_t p_texture_idx) {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3090,6 +3725,7 @@ void TextServerAdvanced::_font_set_glyph_texture_idx(const RID &p_font_rid, cons
 }
 
 RID TextServerAdvanced::_font_get_glyph_texture_rid(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, RID());
 
@@ -3116,7 +3752,7 @@ RID TextServerAdvanced::_font_get_glyph_texture_rid(const RID &p_font_rid, const
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (gl[p_glyph | mod].texture_idx != -1) {
 			if (fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].dirty) {
-				ShelfPackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
+				SkylinePackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
 				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
 				if (fd->mipmaps) {
 					img->generate_mipmaps();
@@ -3136,6 +3772,7 @@ RID TextServerAdvanced::_font_get_glyph_texture_rid(const RID &p_font_rid, const
 }
 
 Size2 TextServerAdvanced::_font_get_glyph_texture_size(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Size2());
 
@@ -3162,7 +3799,7 @@ Size2 TextServerAdvanced::_font_get_glyph_texture_size(const RID &p_font_rid, co
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (gl[p_glyph | mod].texture_idx != -1) {
 			if (fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].dirty) {
-				ShelfPackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
+				SkylinePackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
 				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
 				if (fd->mipmaps) {
 					img->generate_mipmaps();
@@ -3182,6 +3819,7 @@ Size2 TextServerAdvanced::_font_get_glyph_texture_size(const RID &p_font_rid, co
 }
 
 Dictionary TextServerAdvanced::_font_get_glyph_contours(const RID &p_font_rid, int64_t p_size, int64_t p_index) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Dictionary());
 
@@ -3238,6 +3876,7 @@ Dictionary TextServerAdvanced::_font_get_glyph_contours(const RID &p_font_rid, i
 }
 
 TypedArray<Vector2i> TextServerAdvanced::_font_get_kerning_list(const RID &p_font_rid, int64_t p_size) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, TypedArray<Vector2i>());
 
@@ -3254,6 +3893,8 @@ TypedArray<Vector2i> TextServerAdvanced::_font_get_kerning_list(const RID &p_fon
 }
 
 void TextServerAdvanced::_font_clear_kerning_map(const RID &p_font_rid, int64_t p_size) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3265,6 +3906,8 @@ void TextServerAdvanced::_font_clear_kerning_map(const RID &p_font_rid, int64_t
 }
 
 void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3276,6 +3919,8 @@ void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_s
 }
 
 void TextServerAdvanced::_font_set_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair, const Vector2 &p_kerning) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3287,6 +3932,7 @@ void TextServerAdvanced::_font_set_kerning(const RID &p_font_rid, int64_t p_size
 }
 
 Vector2 TextServerAdvanced::_font_get_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Vector2());
 
@@ -3332,6 +3978,7 @@ Vector2 TextServerAdvanced::_font_get_kerning(const RID &p_font_rid, int64_t p_s
 }
 
 int64_t TextServerAdvanced::_font_get_glyph_index(const RID &p_font_rid, int64_t p_size, int64_t p_char, int64_t p_variation_selector) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0);
 	ERR_FAIL_COND_V_MSG((p_char >= 0xd800 && p_char <= 0xdfff) || (p_char > 0x10ffff), 0, "Unicode parsing error: Invalid unicode codepoint " + String::num_int64(p_char, 16) + ".");
@@ -3357,6 +4004,7 @@ int64_t TextServerAdvanced::_font_get_glyph_index(const RID &p_font_rid, int64_t
 }
 
 int64_t TextServerAdvanced::_font_get_char_from_glyph_index(const RID &p_font_rid, int64_t p_size, int64_t p_glyph_index) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, 0);
 
@@ -3388,6 +4036,7 @@ int64_t TextServerAdvanced::_font_get_char_from_glyph_index(const RID &p_font_ri
 }
 
 bool TextServerAdvanced::_font_has_char(const RID &p_font_rid, int64_t p_char) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_COND_V_MSG((p_char >= 0xd800 && p_char <= 0xdfff) || (p_char > 0x10ffff), false, "Unicode parsing error: Invalid unicode codepoint " + String::num_int64(p_char, 16) + ".");
 	if (!fd) {
@@ -3409,6 +4058,7 @@ bool TextServerAdvanced::_font_has_char(const RID &p_font_rid, int64_t p_char) c
 }
 
 String TextServerAdvanced::_font_get_supported_chars(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, String());
 
@@ -3442,6 +4092,7 @@ String TextServerAdvanced::_font_get_supported_chars(const RID &p_font_rid) cons
 }
 
 void TextServerAdvanced::_font_render_range(const RID &p_font_rid, const Vector2i &p_size, int64_t p_start, int64_t p_end) {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 	ERR_FAIL_COND_MSG((p_start >= 0xd800 && p_start <= 0xdfff) || (p_start > 0x10ffff), "Unicode parsing error: Invalid unicode codepoint " + String::num_int64(p_start, 16) + ".");
@@ -3450,33 +4101,37 @@ void TextServerAdvanced::_font_render_range(const RID &p_font_rid, const Vector2
 	MutexLock lock(fd->mutex);
 	Vector2i size = _get_size_outline(fd, p_size);
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
-	for (int64_t i = p_start; i <= p_end; i++) {
 #ifdef MODULE_FREETYPE_ENABLED
+	if (!fd->cache[size]->face) {
+		return;
+	}
+	LocalVector<int32_t> glyphs;
+	for (int64_t i = p_start; i <= p_end; i++) {
 		int32_t idx = FT_Get_Char_Index(fd->cache[size]->face, i);
-		if (fd->cache[size]->face) {
-			if (fd->msdf) {
-				_ensure_glyph(fd, size, (int32_t)idx);
-			} else {
-				for (int aa = 0; aa < ((fd->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
-					if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (2 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (3 << 27) | (aa << 24));
-					} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
-						_ensure_glyph(fd, size, (int32_t)idx | (1 << 27) | (aa << 24));
-						_ensure_glyph(fd, size, (int32_t)idx | (0 << 27) | (aa << 24));
-					} else {
-						_ensure_glyph(fd, size, (int32_t)idx | (aa << 24));
-					}
+		if (fd->msdf) {
+			glyphs.push_back(idx);
+		} else {
+			for (int aa = 0; aa < ((fd->antialiasing == FONT_ANTIALIASING_LCD) ? FONT_LCD_SUBPIXEL_LAYOUT_MAX : 1); aa++) {
+				if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_QUARTER) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_QUARTER_MAX_SIZE)) {
+					glyphs.push_back(idx | (0 << 27) | (aa << 24));
+					glyphs.push_back(idx | (1 << 27) | (aa << 24));
+					glyphs.push_back(idx | (2 << 27) | (aa << 24));
+					glyphs.push_back(idx | (3 << 27) | (aa << 24));
+				} else if ((fd->subpixel_positioning == SUBPIXEL_POSITIONING_ONE_HALF) || (fd->subpixel_positioning == SUBPIXEL_POSITIONING_AUTO && size.x <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE)) {
+					glyphs.push_back(idx | (1 << 27) | (aa << 24));
+					glyphs.push_back(idx | (0 << 27) | (aa << 24));
+				} else {
+					glyphs.push_back(idx | (aa << 24));
 				}
 			}
 		}
-#endif
 	}
+	_ensure_glyphs(fd, size, glyphs.ptr(), glyphs.size());
+#endif
 }
 
 void TextServerAdvanced::_font_render_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_index) {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3508,6 +4163,7 @@ void TextServerAdvanced::_font_render_glyph(const RID &p_font_rid, const Vector2
 }
 
 void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3543,7 +4199,8 @@ void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 		return; // Invalid or non-graphical glyph, do not display errors, nothing to draw.
 	}
 
-	const FontGlyph &gl = fd->cache[size]->glyph_map[index];
+	FontGlyph &gl = fd->cache[size]->glyph_map[index];
+	gl.last_used = Engine::get_singleton()->get_frames_drawn();
 	if (gl.found) {
 		ERR_FAIL_COND(gl.texture_idx < -1 || gl.texture_idx >= fd->cache[size]->textures.size());
 
@@ -3556,7 +4213,7 @@ void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 #endif
 			if (RenderingServer::get_singleton() != nullptr) {
 				if (fd->cache[size]->textures[gl.texture_idx].dirty) {
-					ShelfPackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
+					SkylinePackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
 					Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
 					if (fd->mipmaps) {
 						img->generate_mipmaps();
@@ -3612,6 +4269,7 @@ void TextServerAdvanced::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 }
 
 void TextServerAdvanced::_font_draw_glyph_outline(const RID &p_font_rid, const RID &p_canvas, int64_t p_size, int64_t p_outline_size, const Vector2 &p_pos, int64_t p_index, const Color &p_color) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3647,7 +4305,8 @@ void TextServerAdvanced::_font_draw_glyph_outline(const RID &p_font_rid, const R
 		return; // Invalid or non-graphical glyph, do not display errors, nothing to draw.
 	}
 
-	const FontGlyph &gl = fd->cache[size]->glyph_map[index];
+	FontGlyph &gl = fd->cache[size]->glyph_map[index];
+	gl.last_used = Engine::get_singleton()->get_frames_drawn();
 	if (gl.found) {
 		ERR_FAIL_COND(gl.texture_idx < -1 || gl.texture_idx >= fd->cache[size]->textures.size());
 
@@ -3660,7 +4319,7 @@ void TextServerAdvanced::_font_draw_glyph_outline(const RID &p_font_rid, const R
 #endif
 			if (RenderingServer::get_singleton() != nullptr) {
 				if (fd->cache[size]->textures[gl.texture_idx].dirty) {
-					ShelfPackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
+					SkylinePackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
 					Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
 					if (fd->mipmaps) {
 						img->generate_mipmaps();
@@ -3716,6 +4375,7 @@ void TextServerAdvanced::_font_draw_glyph_outline(const RID &p_font_rid, const R
 }
 
 bool TextServerAdvanced::_font_is_language_supported(const RID &p_font_rid, const String &p_language) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, false);
 
@@ -3728,6 +4388,8 @@ bool TextServerAdvanced::_font_is_language_supported(const RID &p_font_rid, cons
 }
 
 void TextServerAdvanced::_font_set_language_support_override(const RID &p_font_rid, const String &p_language, bool p_supported) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3736,6 +4398,7 @@ void TextServerAdvanced::_font_set_language_support_override(const RID &p_font_r
 }
 
 bool TextServerAdvanced::_font_get_language_support_override(const RID &p_font_rid, const String &p_language) {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, false);
 
@@ -3744,6 +4407,8 @@ bool TextServerAdvanced::_font_get_language_support_override(const RID &p_font_r
 }
 
 void TextServerAdvanced::_font_remove_language_support_override(const RID &p_font_rid, const String &p_language) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3752,6 +4417,7 @@ void TextServerAdvanced::_font_remove_language_support_override(const RID &p_fon
 }
 
 PackedStringArray TextServerAdvanced::_font_get_language_support_overrides(const RID &p_font_rid) {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, PackedStringArray());
 
@@ -3764,6 +4430,7 @@ PackedStringArray TextServerAdvanced::_font_get_language_support_overrides(const
 }
 
 bool TextServerAdvanced::_font_is_script_supported(const RID &p_font_rid, const String &p_script) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, false);
 
@@ -3778,6 +4445,8 @@ bool TextServerAdvanced::_font_is_script_supported(const RID &p_font_rid, const
 }
 
 void TextServerAdvanced::_font_set_script_support_override(const RID &p_font_rid, const String &p_script, bool p_supported) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3786,6 +4455,7 @@ void TextServerAdvanced::_font_set_script_support_override(const RID &p_font_rid
 }
 
 bool TextServerAdvanced::_font_get_script_support_override(const RID &p_font_rid, const String &p_script) {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, false);
 
@@ -3794,6 +4464,8 @@ bool TextServerAdvanced::_font_get_script_support_override(const RID &p_font_rid
 }
 
 void TextServerAdvanced::_font_remove_script_support_override(const RID &p_font_rid, const String &p_script) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3802,6 +4474,7 @@ void TextServerAdvanced::_font_remove_script_support_override(const RID &p_font_
 }
 
 PackedStringArray TextServerAdvanced::_font_get_script_support_overrides(const RID &p_font_rid) {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, PackedStringArray());
 
@@ -3814,6 +4487,8 @@ PackedStringArray TextServerAdvanced::_font_get_script_support_overrides(const R
 }
 
 void TextServerAdvanced::_font_set_opentype_feature_overrides(const RID &p_font_rid, const Dictionary &p_overrides) {
+	_RID_USE_METHOD_
+	font_revision.increment();
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
 
@@ -3824,6 +4499,7 @@ void TextServerAdvanced::_font_set_opentype_feature_overrides(const RID &p_font_
 }
 
 Dictionary TextServerAdvanced::_font_get_opentype_feature_overrides(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Dictionary());
 
@@ -3832,6 +4508,7 @@ Dictionary TextServerAdvanced::_font_get_opentype_feature_overrides(const RID &p
 }
 
 Dictionary TextServerAdvanced::_font_supported_feature_list(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Dictionary());
 
@@ -3842,6 +4519,7 @@ Dictionary TextServerAdvanced::_font_supported_feature_list(const RID &p_font_ri
 }
 
 Dictionary TextServerAdvanced::_font_supported_variation_list(const RID &p_font_rid) const {
+	_RID_USE_METHOD_
 	FontAdvanced *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL_V(fd, Dictionary());
 
@@ -3852,13 +4530,15 @@ Dictionary TextServerAdvanced::_font_supported_variation_list(const RID &p_font_
 }
 
 double TextServerAdvanced::_font_get_global_oversampling() const {
-	return oversampling;
+	return oversampling.get();
 }
 
 void TextServerAdvanced::_font_set_global_oversampling(double p_oversampling) {
 	_THREAD_SAFE_METHOD_
-	if (oversampling != p_oversampling) {
-		oversampling = p_oversampling;
+	_RID_USE_METHOD_
+	if (oversampling.get() != p_oversampling) {
+		font_revision.increment();
+		oversampling.set(p_oversampling);
 		List<RID> fonts;
 		font_owner.get_owned_list(&fonts);
 		bool font_cleared = false;
@@ -3873,7 +4553,13 @@ void TextServerAdvanced::_font_set_global_oversampling(double p_oversampling) {
 			List<RID> text_bufs;
 			shaped_owner.get_owned_list(&text_bufs);
 			for (const RID &E : text_bufs) {
-				invalidate(shaped_owner.get_or_null(E), false);
+				// Freed since the list was taken, frees wait for the RID use lock after that.
+				ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(E);
+				if (!sd) {
+					continue;
+				}
+				MutexLock lock(sd->mutex);
+				invalidate(sd, false);
 			}
 		}
 	}
@@ -3975,7 +4661,6 @@ void TextServerAdvanced::full_copy(ShapedTextDataAdvanced *p_shaped) {
 }
 
 RID TextServerAdvanced::_create_shaped_text(TextServer::Direction p_direction, TextServer::Orientation p_orientation) {
-	_THREAD_SAFE_METHOD_
 	ERR_FAIL_COND_V_MSG(p_direction == DIRECTION_INHERITED, RID(), "Invalid text direction.");
 
 	ShapedTextDataAdvanced *sd = memnew(ShapedTextDataAdvanced);
@@ -3986,6 +4671,7 @@ RID TextServerAdvanced::_create_shaped_text(TextServer::Direction p_direction, T
 }
 
 void TextServerAdvanced::_shaped_text_clear(const RID &p_shaped) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL(sd);
 
@@ -4001,6 +4687,7 @@ void TextServerAdvanced::_shaped_text_clear(const RID &p_shaped) {
 }
 
 void TextServerAdvanced::_shaped_text_set_direction(const RID &p_shaped, TextServer::Direction p_direction) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_COND_MSG(p_direction == DIRECTION_INHERITED, "Invalid text direction.");
 	ERR_FAIL_NULL(sd);
@@ -4016,6 +4703,7 @@ void TextServerAdvanced::_shaped_text_set_direction(const RID &p_shaped, TextSer
 }
 
 TextServer::Direction TextServerAdvanced::_shaped_text_get_direction(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, TextServer::DIRECTION_LTR);
 
@@ -4024,6 +4712,7 @@ TextServer::Direction TextServerAdvanced::_shaped_text_get_direction(const RID &
 }
 
 TextServer::Direction TextServerAdvanced::_shaped_text_get_inferred_direction(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, TextServer::DIRECTION_LTR);
 
@@ -4032,10 +4721,11 @@ TextServer::Direction TextServerAdvanced::_shaped_text_get_inferred_direction(co
 }
 
 void TextServerAdvanced::_shaped_text_set_custom_punctuation(const RID &p_shaped, const String &p_punct) {
-	_THREAD_SAFE_METHOD_
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL(sd);
 
+	MutexLock lock(sd->mutex);
 	if (sd->custom_punct != p_punct) {
 		if (sd->parent != RID()) {
 			full_copy(sd);
@@ -4046,13 +4736,16 @@ void TextServerAdvanced::_shaped_text_set_custom_punctuation(const RID &p_shaped
 }
 
 String TextServerAdvanced::_shaped_text_get_custom_punctuation(const RID &p_shaped) const {
-	_THREAD_SAFE_METHOD_
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, String());
+
+	MutexLock lock(sd->mutex);
 	return sd->custom_punct;
 }
 
 void TextServerAdvanced::_shaped_text_set_bidi_override(const RID &p_shaped, const Array &p_override) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL(sd);
 
@@ -4074,6 +4767,7 @@ void TextServerAdvanced::_shaped_text_set_bidi_override(const RID &p_shaped, con
 }
 
 void TextServerAdvanced::_shaped_text_set_orientation(const RID &p_shaped, TextServer::Orientation p_orientation) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL(sd);
 
@@ -4088,6 +4782,7 @@ void TextServerAdvanced::_shaped_text_set_orientation(const RID &p_shaped, TextS
 }
 
 void TextServerAdvanced::_shaped_text_set_preserve_invalid(const RID &p_shaped, bool p_enabled) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL(sd);
 
@@ -4100,6 +4795,7 @@ void TextServerAdvanced::_shaped_text_set_preserve_invalid(const RID &p_shaped,
 }
 
 bool TextServerAdvanced::_shaped_text_get_preserve_invalid(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, false);
 
@@ -4108,6 +4804,7 @@ bool TextServerAdvanced::_shaped_text_get_preserve_invalid(const RID &p_shaped)
 }
 
 void TextServerAdvanced::_shaped_text_set_preserve_control(const RID &p_shaped, bool p_enabled) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL(sd);
 
@@ -4122,6 +4819,7 @@ void TextServerAdvanced::_shaped_text_set_preserve_control(const RID &p_shaped,
 }
 
 bool TextServerAdvanced::_shaped_text_get_preserve_control(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, false);
 
@@ -4130,6 +4828,7 @@ bool TextServerAdvanced::_shaped_text_get_preserve_control(const RID &p_shaped)
 }
 
 void TextServerAdvanced::_shaped_text_set_spacing(const RID &p_shaped, SpacingType p_spacing, int64_t p_value) {
+	_RID_USE_METHOD_
 	ERR_FAIL_INDEX((int)p_spacing, 4);
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL(sd);
@@ -4145,6 +4844,7 @@ void TextServerAdvanced::_shaped_text_set_spacing(const RID &p_shaped, SpacingTy
 }
 
 int64_t TextServerAdvanced::_shaped_text_get_spacing(const RID &p_shaped, SpacingType p_spacing) const {
+	_RID_USE_METHOD_
 	ERR_FAIL_INDEX_V((int)p_spacing, 4, 0);
 
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
@@ -4155,6 +4855,7 @@ int64_t TextServerAdvanced::_shaped_text_get_spacing(const RID &p_shaped, Spacin
 }
 
 TextServer::Orientation TextServerAdvanced::_shaped_text_get_orientation(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, TextServer::ORIENTATION_HORIZONTAL);
 
@@ -4163,12 +4864,14 @@ TextServer::Orientation TextServerAdvanced::_shaped_text_get_orientation(const R
 }
 
 int64_t TextServerAdvanced::_shaped_get_span_count(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, 0);
 	return sd->spans.size();
 }
 
 Variant TextServerAdvanced::_shaped_get_span_meta(const RID &p_shaped, int64_t p_index) const {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, Variant());
 	ERR_FAIL_INDEX_V(p_index, sd->spans.size(), Variant());
@@ -4176,6 +4879,7 @@ Variant TextServerAdvanced::_shaped_get_span_meta(const RID &p_shaped, int64_t p
 }
 
 void TextServerAdvanced::_shaped_set_span_update_font(const RID &p_shaped, int64_t p_index, const TypedArray<RID> &p_fonts, int64_t p_size, const Dictionary &p_opentype_features) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL(sd);
 	ERR_FAIL_INDEX(p_index, sd->spans.size());
@@ -4189,6 +4893,7 @@ void TextServerAdvanced::_shaped_set_span_update_font(const RID &p_shaped, int64
 }
 
 bool TextServerAdvanced::_shaped_text_add_string(const RID &p_shaped, const String &p_text, const TypedArray<RID> &p_fonts, int64_t p_size, const Dictionary &p_opentype_features, const String &p_language, const Variant &p_meta) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, false);
 	ERR_FAIL_COND_V(p_size <= 0, false);
@@ -4224,9 +4929,11 @@ bool TextServerAdvanced::_shaped_text_add_string(const RID &p_shaped, const Stri
 }
 
 bool TextServerAdvanced::_shaped_text_add_object(const RID &p_shaped, const Variant &p_key, const Size2 &p_size, InlineAlignment p_inline_align, int64_t p_length, double p_baseline) {
-	_THREAD_SAFE_METHOD_
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, false);
+
+	MutexLock lock(sd->mutex);
 	ERR_FAIL_COND_V(p_key == Variant(), false);
 	ERR_FAIL_COND_V(sd->objects.has(p_key), false);
 
@@ -4255,6 +4962,7 @@ bool TextServerAdvanced::_shaped_text_add_object(const RID &p_shaped, const Vari
 }
 
 bool TextServerAdvanced::_shaped_text_resize_object(const RID &p_shaped, const Variant &p_key, const Size2 &p_size, InlineAlignment p_inline_align, double p_baseline) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, false);
 
@@ -4399,7 +5107,7 @@ void TextServerAdvanced::_realign(ShapedTextDataAdvanced *p_sd) const {
 }
 
 RID TextServerAdvanced::_shaped_text_substr(const RID &p_shaped, int64_t p_start, int64_t p_length) const {
-	_THREAD_SAFE_METHOD_
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, RID());
 
@@ -4584,6 +5292,7 @@ bool TextServerAdvanced::_shape_substr(ShapedTextDataAdvanced *p_new_sd, const S
 }
 
 RID TextServerAdvanced::_shaped_text_get_parent(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, RID());
 
@@ -4592,6 +5301,7 @@ RID TextServerAdvanced::_shaped_text_get_parent(const RID &p_shaped) const {
 }
 
 double TextServerAdvanced::_shaped_text_fit_to_width(const RID &p_shaped, double p_width, BitField<TextServer::JustificationFlag> p_jst_flags) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, 0.0);
 
@@ -4749,6 +5459,7 @@ double TextServerAdvanced::_shaped_text_fit_to_width(const RID &p_shaped, double
 }
 
 double TextServerAdvanced::_shaped_text_tab_align(const RID &p_shaped, const PackedFloat32Array &p_tab_stops) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, 0.0);
 
@@ -4805,6 +5516,7 @@ double TextServerAdvanced::_shaped_text_tab_align(const RID &p_shaped, const Pac
 }
 
 void TextServerAdvanced::_shaped_text_overrun_trim_to_width(const RID &p_shaped_line, double p_width, BitField<TextServer::TextOverrunFlag> p_trim_flags) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped_line);
 	ERR_FAIL_NULL_MSG(sd, "ShapedTextDataAdvanced invalid.");
 
@@ -4972,6 +5684,7 @@ void TextServerAdvanced::_shaped_text_overrun_trim_to_width(const RID &p_shaped_
 }
 
 int64_t TextServerAdvanced::_shaped_text_get_trim_pos(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V_MSG(sd, -1, "ShapedTextDataAdvanced invalid.");
 
@@ -4980,6 +5693,7 @@ int64_t TextServerAdvanced::_shaped_text_get_trim_pos(const RID &p_shaped) const
 }
 
 int64_t TextServerAdvanced::_shaped_text_get_ellipsis_pos(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V_MSG(sd, -1, "ShapedTextDataAdvanced invalid.");
 
@@ -4988,6 +5702,7 @@ int64_t TextServerAdvanced::_shaped_text_get_ellipsis_pos(const RID &p_shaped) c
 }
 
 const Glyph *TextServerAdvanced::_shaped_text_get_ellipsis_glyphs(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V_MSG(sd, nullptr, "ShapedTextDataAdvanced invalid.");
 
@@ -4996,6 +5711,7 @@ const Glyph *TextServerAdvanced::_shaped_text_get_ellipsis_glyphs(const RID &p_s
 }
 
 int64_t TextServerAdvanced::_shaped_text_get_ellipsis_glyph_count(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V_MSG(sd, 0, "ShapedTextDataAdvanced invalid.");
 
@@ -5004,6 +5720,7 @@ int64_t TextServerAdvanced::_shaped_text_get_ellipsis_glyph_count(const RID &p_s
 }
 
 void TextServerAdvanced::_update_chars(ShapedTextDataAdvanced *p_sd) const {
+	_RID_USE_METHOD_
 	if (!p_sd->chars_valid) {
 		p_sd->chars.clear();
 
@@ -5059,6 +5776,7 @@ void TextServerAdvanced::_update_chars(ShapedTextDataAdvanced *p_sd) const {
 }
 
 PackedInt32Array TextServerAdvanced::_shaped_text_get_character_breaks(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, PackedInt32Array());
 
@@ -5073,6 +5791,7 @@ PackedInt32Array TextServerAdvanced::_shaped_text_get_character_breaks(const RID
 }
 
 bool TextServerAdvanced::_shaped_text_update_breaks(const RID &p_shaped) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, false);
 
@@ -5338,6 +6057,7 @@ _FORCE_INLINE_ int64_t _generate_kashida_justification_opportunies(const String
 }
 
 bool TextServerAdvanced::_shaped_text_update_justification_ops(const RID &p_shaped) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, false);
 
@@ -5565,6 +6285,7 @@ _FORCE_INLINE_ void TextServerAdvanced::_add_featuers(const Dictionary &p_source
 }
 
 void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_start, int64_t p_end, hb_script_t p_script, hb_direction_t p_direction, TypedArray<RID> p_fonts, int64_t p_span, int64_t p_fb_index, int64_t p_prev_start, int64_t p_prev_end) {
+	_RID_USE_METHOD_
 	RID f;
 	int fs = p_sd->spans[p_span].font_size;
 
@@ -5610,6 +6331,9 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 			String locale = (p_sd->spans[p_span].language.is_empty()) ? TranslationServer::get_singleton()->get_tool_locale() : p_sd->spans[p_span].language;
 
 			PackedStringArray fallback_font_name = OS::get_singleton()->get_system_font_path_for_text(font_name, text, locale, script_code, font_weight, font_stretch, font_style & TextServer::FONT_ITALIC);
+
+			// System font cache is shared by all shaped texts.
+			MutexLock sysf_lock(system_font_mutex);
 #ifdef GDEXTENSION
 			for (int fb = 0; fb < fallback_font_name.size(); fb++) {
 				const String &E = fallback_font_name[fb];
@@ -5837,6 +6561,14 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 
 	// Process glyphs.
 	if (glyph_count > 0) {
+		// Render new glyphs in one batch, long runs of new glyphs (e.g. CJK text) are rasterized in parallel.
+		LocalVector<int32_t> glyph_indices;
+		glyph_indices.resize(glyph_count);
+		for (unsigned int i = 0; i < glyph_count; i++) {
+			glyph_indices[i] = glyph_info[i].codepoint | mod;
+		}
+		_ensure_glyphs(fd, fss, glyph_indices.ptr(), glyph_count);
+
 		Glyph *w = (Glyph *)memalloc(glyph_count * sizeof(Glyph));
 
 		int end = (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) ? p_end : 0;
@@ -5888,7 +6620,6 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 
 			gl.index = glyph_info[i].codepoint;
 			if (gl.index != 0) {
-				_ensure_glyph(fd, fss, gl.index | mod);
 				if (p_sd->orientation == ORIENTATION_HORIZONTAL) {
 					if (subpos) {
 						gl.advance = (double)glyph_pos[i].x_advance / (64.0 / scale) + ea;
@@ -5979,8 +6710,125 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 	}
 }
 
+bool TextServerAdvanced::ShapedCacheKey::operator==(const ShapedCacheKey &p_b) const {
+	if (hash != p_b.hash || font_revision != p_b.font_revision || start != p_b.start || direction != p_b.direction || orientation != p_b.orientation || preserve_invalid != p_b.preserve_invalid || preserve_control != p_b.preserve_control) {
+		return false;
+	}
+	for (int i = 0; i < 4; i++) {
+		if (extra_spacing[i] != p_b.extra_spacing[i]) {
+			return false;
+		}
+	}
+	if (text != p_b.text || locale != p_b.locale || bidi_override != p_b.bidi_override || spans.size() != p_b.spans.size()) {
+		return false;
+	}
+	for (int i = 0; i < spans.size(); i++) {
+		const ShapedTextDataAdvanced::Span &a = spans[i];
+		const ShapedTextDataAdvanced::Span &b = p_b.spans[i];
+		if (a.start != b.start || a.end != b.end || a.font_size != b.font_size || a.language != b.language || a.fonts != b.fonts || a.features != b.features) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool TextServerAdvanced::_shaped_cache_make_key(const ShapedTextDataAdvanced *p_sd, ShapedCacheKey &r_key) const {
+	// Embedded objects are sized by the caller, texts using them are always shaped.
+	if (!p_sd->objects.is_empty()) {
+		return false;
+	}
+
+	uint32_t h = hash_murmur3_one_32(p_sd->text.hash());
+	bool default_locale = false;
+	for (const ShapedTextDataAdvanced::Span &span : p_sd->spans) {
+		h = hash_murmur3_one_32(span.start, h);
+		h = hash_murmur3_one_32(span.end, h);
+		h = hash_murmur3_one_32(span.font_size, h);
+		h = hash_murmur3_one_32(span.fonts.hash(), h);
+		h = hash_murmur3_one_32(span.language.hash(), h);
+		h = hash_murmur3_one_32(span.features.hash(), h);
+		default_locale = default_locale || span.language.is_empty();
+	}
+	for (const Vector3i &E : p_sd->bidi_override) {
+		h = hash_murmur3_one_32(E.x, h);
+		h = hash_murmur3_one_32(E.y, h);
+		h = hash_murmur3_one_32(E.z, h);
+	}
+	if (default_locale) {
+		r_key.locale = TranslationServer::get_singleton()->get_tool_locale();
+		h = hash_murmur3_one_32(r_key.locale.hash(), h);
+	}
+	for (int i = 0; i < 4; i++) {
+		r_key.extra_spacing[i] = p_sd->extra_spacing[i];
+		h = hash_murmur3_one_32(p_sd->extra_spacing[i], h);
+	}
+	r_key.text = p_sd->text;
+	r_key.spans = p_sd->spans;
+	r_key.bidi_override = p_sd->bidi_override;
+	r_key.direction = p_sd->direction;
+	r_key.orientation = p_sd->orientation;
+	r_key.start = p_sd->start;
+	r_key.preserve_invalid = p_sd->preserve_invalid;
+	r_key.preserve_control = p_sd->preserve_control;
+	r_key.font_revision = font_revision.get();
+
+	h = hash_murmur3_one_32(p_sd->start, h);
+	h = hash_murmur3_one_32(p_sd->direction | (p_sd->orientation << 4) | (p_sd->preserve_invalid << 8) | (p_sd->preserve_control << 9), h);
+	h = hash_murmur3_one_64(r_key.font_revision, h);
+	r_key.hash = hash_fmix32(h);
+
+	return true;
+}
+
+bool TextServerAdvanced::_shaped_cache_fetch(const ShapedCacheKey &p_key, ShapedTextDataAdvanced *p_sd) {
+	MutexLock lock(shaped_cache_mutex);
+	List<ShapedCacheEntry>::Element **E = shaped_cache.getptr(p_key);
+	if (!E) {
+		shaped_cache_misses++;
+		return false;
+	}
+	shaped_cache_hits++;
+	shaped_cache_lru.move_to_front(*E);
+
+	const ShapedCacheEntry &entry = (*E)->get();
+	p_sd->glyphs = entry.glyphs;
+	p_sd->ascent = entry.ascent;
+	p_sd->descent = entry.descent;
+	p_sd->width = entry.width;
+	p_sd->upos = entry.upos;
+	p_sd->uthk = entry.uthk;
+	return true;
+}
+
+void TextServerAdvanced::_shaped_cache_store(const ShapedCacheKey &p_key, const ShapedTextDataAdvanced *p_sd) {
+	MutexLock lock(shaped_cache_mutex);
+	if (shaped_cache.has(p_key)) {
+		return; // Stored by another thread while this one was shaping.
+	}
+
+	ShapedCacheEntry entry;
+	entry.key = p_key;
+	entry.glyphs = p_sd->glyphs;
+	entry.ascent = p_sd->ascent;
+	entry.descent = p_sd->descent;
+	entry.width = p_sd->width;
+	entry.upos = p_sd->upos;
+	entry.uthk = p_sd->uthk;
+	entry.memory = sizeof(ShapedCacheEntry) + p_sd->glyphs.size() * sizeof(Glyph) + p_sd->text.length() * sizeof(char32_t) + p_sd->spans.size() * sizeof(ShapedTextDataAdvanced::Span);
+
+	shaped_cache_memory += entry.memory;
+	shaped_cache[p_key] = shaped_cache_lru.push_front(entry);
+
+	while (shaped_cache_memory > SHAPED_CACHE_MAX_MEMORY && shaped_cache_lru.size() > 1) {
+		List<ShapedCacheEntry>::Element *L = shaped_cache_lru.back();
+		shaped_cache_memory -= L->get().memory;
+		shaped_cache.erase(L->get().key);
+		shaped_cache_lru.pop_back();
+	}
+}
+
 bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
-	_THREAD_SAFE_METHOD_
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, false);
 
@@ -6003,6 +6851,10 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		return true;
 	}
 
+	ShapedCacheKey cache_key;
+	bool cacheable = _shaped_cache_make_key(sd, cache_key);
+	bool cached = cacheable && _shaped_cache_fetch(cache_key, sd);
+
 	sd->utf16 = sd->text.utf16();
 	const UChar *data = sd->utf16.get_data();
 
@@ -6083,6 +6935,11 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		}
 		sd->bidi_iter.push_back(bidi_iter);
 
+		if (cached) {
+			// Glyphs are restored from the cache, BiDi iterators are still needed by substrings.
+			continue;
+		}
+
 		err = U_ZERO_ERROR;
 		int bidi_run_count = 1;
 		if (bidi_iter) {
@@ -6191,12 +7048,17 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		}
 	}
 
+	if (cacheable && !cached) {
+		_shaped_cache_store(cache_key, sd);
+	}
+
 	_realign(sd);
 	sd->valid = true;
 	return sd->valid;
 }
 
 bool TextServerAdvanced::_shaped_text_is_ready(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, false);
 
@@ -6204,7 +7066,21 @@ bool TextServerAdvanced::_shaped_text_is_ready(const RID &p_shaped) const {
 	return sd->valid;
 }
 
+int64_t TextServerAdvanced::_get_shaped_text_cache_info(ShapedTextCacheInfo p_info) const {
+	MutexLock lock(shaped_cache_mutex);
+	switch (p_info) {
+		case SHAPED_TEXT_CACHE_HITS:
+			return shaped_cache_hits;
+		case SHAPED_TEXT_CACHE_MISSES:
+			return shaped_cache_misses;
+		case SHAPED_TEXT_CACHE_MEMORY_USED:
+			return shaped_cache_memory;
+	}
+	return 0;
+}
+
 const Glyph *TextServerAdvanced::_shaped_text_get_glyphs(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, nullptr);
 
@@ -6216,6 +7092,7 @@ const Glyph *TextServerAdvanced::_shaped_text_get_glyphs(const RID &p_shaped) co
 }
 
 int64_t TextServerAdvanced::_shaped_text_get_glyph_count(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, 0);
 
@@ -6227,6 +7104,7 @@ int64_t TextServerAdvanced::_shaped_text_get_glyph_count(const RID &p_shaped) co
 }
 
 const Glyph *TextServerAdvanced::_shaped_text_sort_logical(const RID &p_shaped) {
+	_RID_USE_METHOD_
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, nullptr);
 
@@ -6245,6 +7123,7 @@ const Glyph *TextServerAdvanced::_shaped_text_sort_logical(const RID &p_shaped)
 }
 
 Vector2i TextServerAdvanced::_shaped_text_get_range(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, Vector2i());
 
@@ -6253,6 +7132,7 @@ Vector2i TextServerAdvanced::_shaped_text_get_range(const RID &p_shaped) const {
 }
 
 Array TextServerAdvanced::_shaped_text_get_objects(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	Array ret;
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, ret);
@@ -6266,6 +7146,7 @@ Array TextServerAdvanced::_shaped_text_get_objects(const RID &p_shaped) const {
 }
 
 Rect2 TextServerAdvanced::_shaped_text_get_object_rect(const RID &p_shaped, const Variant &p_key) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, Rect2());
 
@@ -6278,6 +7159,7 @@ Rect2 TextServerAdvanced::_shaped_text_get_object_rect(const RID &p_shaped, cons
 }
 
 Size2 TextServerAdvanced::_shaped_text_get_size(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, Size2());
 
@@ -6293,6 +7175,7 @@ Size2 TextServerAdvanced::_shaped_text_get_size(const RID &p_shaped) const {
 }
 
 double TextServerAdvanced::_shaped_text_get_ascent(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, 0.0);
 
@@ -6304,6 +7187,7 @@ double TextServerAdvanced::_shaped_text_get_ascent(const RID &p_shaped) const {
 }
 
 double TextServerAdvanced::_shaped_text_get_descent(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, 0.0);
 
@@ -6315,6 +7199,7 @@ double TextServerAdvanced::_shaped_text_get_descent(const RID &p_shaped) const {
 }
 
 double TextServerAdvanced::_shaped_text_get_width(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, 0.0);
 
@@ -6326,6 +7211,7 @@ double TextServerAdvanced::_shaped_text_get_width(const RID &p_shaped) const {
 }
 
 double TextServerAdvanced::_shaped_text_get_underline_position(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, 0.0);
 
@@ -6338,6 +7224,7 @@ double TextServerAdvanced::_shaped_text_get_underline_position(const RID &p_shap
 }
 
 double TextServerAdvanced::_shaped_text_get_underline_thickness(const RID &p_shaped) const {
+	_RID_USE_METHOD_
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, 0.0);
 
@@ -7080,6 +7967,26 @@ TextServerAdvanced::TextServerAdvanced() {
 
 void TextServerAdvanced::_cleanup() {
 	_THREAD_SAFE_METHOD_
+	{
+		_RID_USE_METHOD_
+		List<RID> fonts;
+		font_owner.get_owned_list(&fonts);
+		for (const RID &E : fonts) {
+			FontAdvanced *fd = font_owner.get_or_null(E);
+			if (!fd) {
+				continue;
+			}
+			MutexLock lock(fd->mutex);
+			_persistent_cache_save_all(fd);
+		}
+	}
+	_persistent_cache_wait();
+	{
+		MutexLock lock(persistent_cache_mutex);
+		persistent_cache_sync = true;
+	}
+
+	MutexLock sysf_lock(system_font_mutex);
 	for (const KeyValue<SystemFontKey, SystemFontCache> &E : system_fonts) {
 		const Vector<SystemFontCacheRec> &sysf_cache = E.value.var;
 		for (const SystemFontCacheRec &F : sysf_cache) {
@@ -7088,6 +7995,11 @@ void TextServerAdvanced::_cleanup() {
 	}
 	system_fonts.clear();
 	system_font_data.clear();
+
+	MutexLock cache_lock(shaped_cache_mutex);
+	shaped_cache.clear();
+	shaped_cache_lru.clear();
+	shaped_cache_memory = 0;
 }
 
 TextServerAdvanced::~TextServerAdvanced() {
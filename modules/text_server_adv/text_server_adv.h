@@ -73,17 +73,33 @@
 
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 #include <godot_cpp/templates/rid_owner.hpp>
 #include <godot_cpp/templates/vector.hpp>
 
 using namespace godot;
 
+#include <shared_mutex>
+
+// godot-cpp has no RWLock, same interface as the engine one.
+class RWLock {
+	mutable std::shared_timed_mutex mutex;
+
+public:
+	void read_lock() const { mutex.lock_shared(); }
+	void read_unlock() const { mutex.unlock_shared(); }
+	void write_lock() { mutex.lock(); }
+	void write_unlock() { mutex.unlock(); }
+};
+
 #else
 // Headers for building as built-in module.
 
 #include "core/extension/ext_wrappers.gen.inc"
 #include "core/object/worker_thread_pool.h"
+#include "core/os/rw_lock.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rid_owner.h"
 #include "scene/resources/image_texture.h"
 #include "servers/text/text_server_extension.h"
@@ -181,28 +197,17 @@ class TextServerAdvanced : public TextServerExtension {
 				index(p_id), x(p_x), y(p_y) {}
 	};
 
-	struct Shelf {
+	struct SkylineNode {
 		int32_t x = 0;
 		int32_t y = 0;
 		int32_t w = 0;
-		int32_t h = 0;
 
-		FontTexturePosition alloc_shelf(int32_t p_id, int32_t p_w, int32_t p_h) {
-			if (p_w > w || p_h > h) {
-				return FontTexturePosition(-1, 0, 0);
-			}
-			int32_t xx = x;
-			x += p_w;
-			w -= p_w;
-			return FontTexturePosition(p_id, xx, y);
-		}
-
-		Shelf() {}
-		Shelf(int32_t p_x, int32_t p_y, int32_t p_w, int32_t p_h) :
-				x(p_x), y(p_y), w(p_w), h(p_h) {}
+		SkylineNode() {}
+		SkylineNode(int32_t p_x, int32_t p_y, int32_t p_w) :
+				x(p_x), y(p_y), w(p_w) {}
 	};
 
-	struct ShelfPackTexture {
+	struct SkylinePackTexture {
 		int32_t texture_w = 1024;
 		int32_t texture_h = 1024;
 
@@ -211,45 +216,84 @@ class TextServerAdvanced : public TextServerExtension {
 		Ref<ImageTexture> texture;
 		bool dirty = true;
 
-		List<Shelf> shelves;
+		// Top edge of the packed area, left to right. Nodes cover the whole texture width once packing has started.
+		LocalVector<SkylineNode> skyline;
 
-		FontTexturePosition pack_rect(int32_t p_id, int32_t p_h, int32_t p_w) {
+		// Returns the Y position of a rect placed at the left edge of node p_idx, or -1 if it does not fit.
+		int32_t fit_rect(uint32_t p_idx, int32_t p_w, int32_t p_h) const {
+			if (skyline[p_idx].x + p_w > texture_w) {
+				return -1;
+			}
 			int32_t y = 0;
-			int32_t waste = 0;
-			Shelf *best_shelf = nullptr;
-			int32_t best_waste = std::numeric_limits<std::int32_t>::max();
+			int32_t width_left = p_w;
+			for (uint32_t i = p_idx; width_left > 0 && i < skyline.size(); i++) {
+				y = MAX(y, skyline[i].y);
+				if (y + p_h > texture_h) {
+					return -1;
+				}
+				width_left -= skyline[i].w;
+			}
+			return width_left > 0 ? -1 : y;
+		}
+
+		FontTexturePosition pack_rect(int32_t p_id, int32_t p_h, int32_t p_w) {
+			if (skyline.is_empty()) {
+				skyline.push_back(SkylineNode(0, 0, texture_w));
+			}
 
-			for (Shelf &E : shelves) {
-				y += E.h;
-				if (p_w > E.w) {
+			// Bottom-left rule, lowest resulting top edge first, then the narrowest node.
+			int32_t best_idx = -1;
+			int32_t best_y = 0;
+			int32_t best_bottom = std::numeric_limits<std::int32_t>::max();
+			int32_t best_w = std::numeric_limits<std::int32_t>::max();
+			for (uint32_t i = 0; i < skyline.size(); i++) {
+				int32_t y = fit_rect(i, p_w, p_h);
+				if (y < 0) {
 					continue;
 				}
-				if (p_h == E.h) {
-					return E.alloc_shelf(p_id, p_w, p_h);
+				if (y + p_h < best_bottom || (y + p_h == best_bottom && skyline[i].w < best_w)) {
+					best_idx = i;
+					best_y = y;
+					best_bottom = y + p_h;
+					best_w = skyline[i].w;
 				}
-				if (p_h > E.h) {
-					continue;
+			}
+			if (best_idx == -1) {
+				return FontTexturePosition(-1, 0, 0);
+			}
+
+			int32_t x = skyline[best_idx].x;
+			skyline.insert(best_idx, SkylineNode(x, best_bottom, p_w));
+
+			// Shrink or remove the nodes covered by the new one.
+			for (uint32_t i = best_idx + 1; i < skyline.size();) {
+				int32_t covered = x + p_w - skyline[i].x;
+				if (covered <= 0) {
+					break;
 				}
-				if (p_h < E.h) {
-					waste = (E.h - p_h) * p_w;
-					if (waste < best_waste) {
-						best_waste = waste;
-						best_shelf = &E;
-					}
+				if (skyline[i].w > covered) {
+					skyline[i].x += covered;
+					skyline[i].w -= covered;
+					break;
 				}
+				skyline.remove_at(i);
 			}
-			if (best_shelf) {
-				return best_shelf->alloc_shelf(p_id, p_w, p_h);
-			}
-			if (p_h <= (texture_h - y) && p_w <= texture_w) {
-				List<Shelf>::Element *E = shelves.push_back(Shelf(0, y, texture_w, p_h));
-				return E->get().alloc_shelf(p_id, p_w, p_h);
+
+			// Merge neighbors at the same height.
+			for (uint32_t i = 0; i + 1 < skyline.size();) {
+				if (skyline[i].y == skyline[i + 1].y) {
+					skyline[i].w += skyline[i + 1].w;
+					skyline.remove_at(i + 1);
+				} else {
+					i++;
+				}
 			}
-			return FontTexturePosition(-1, 0, 0);
+
+			return FontTexturePosition(p_id, x, best_y);
 		}
 
-		ShelfPackTexture() {}
-		ShelfPackTexture(int32_t p_w, int32_t p_h) :
+		SkylinePackTexture() {}
+		SkylinePackTexture(int32_t p_w, int32_t p_h) :
 				texture_w(p_w), texture_h(p_h) {}
 	};
 
@@ -259,6 +303,7 @@ class TextServerAdvanced : public TextServerExtension {
 		Rect2 rect;
 		Rect2 uv_rect;
 		Vector2 advance;
+		uint64_t last_used = 0; // Frame the glyph was last drawn, used for eviction.
 	};
 
 	struct FontForSizeAdvanced {
@@ -271,12 +316,15 @@ class TextServerAdvanced : public TextServerExtension {
 
 		Vector2i size;
 
-		Vector<ShelfPackTexture> textures;
+		Vector<SkylinePackTexture> textures;
 		HashMap<int64_t, int64_t> inv_glyph_map;
 		HashMap<int32_t, FontGlyph> glyph_map;
 		HashMap<Vector2i, Vector2> kerning_map;
 		hb_font_t *hb_handle = nullptr;
 
+		// Glyph count last loaded from or written to the persistent glyph cache, -1 if this size is not persisted.
+		int persistent_glyphs = -1;
+
 #ifdef MODULE_FREETYPE_ENABLED
 		FT_Face face = nullptr;
 		FT_StreamRec stream;
@@ -341,6 +389,7 @@ class TextServerAdvanced : public TextServerExtension {
 		const uint8_t *data_ptr;
 		size_t data_size;
 		int face_index = 0;
+		uint32_t data_hash = 0; // Font data hash used by the persistent glyph cache, 0 until computed.
 
 		~FontAdvanced() {
 			for (const KeyValue<Vector2i, FontForSizeAdvanced *> &E : cache) {
@@ -356,8 +405,37 @@ class TextServerAdvanced : public TextServerExtension {
 #endif
 #ifdef MODULE_FREETYPE_ENABLED
 	_FORCE_INLINE_ FontGlyph rasterize_bitmap(FontForSizeAdvanced *p_data, int p_rect_margin, FT_Bitmap bitmap, int yofs, int xofs, const Vector2 &advance, bool p_bgra) const;
+	_FORCE_INLINE_ int _load_glyph(const FontAdvanced *p_font_data, FT_Face p_face, const Vector2i &p_size, int32_t p_glyph, Vector2 &r_advance, FT_Render_Mode &r_aa_mode, bool &r_bgra) const;
+
+	// Glyph bitmap rendered by a worker thread, packed into the font textures by the calling thread.
+	struct RenderedGlyph {
+		int32_t glyph = 0;
+		bool rendered = false;
+		FT_Bitmap bitmap;
+		Vector<uint8_t> buffer;
+		int top = 0;
+		int left = 0;
+		Vector2 advance;
+		bool bgra = false;
+	};
+
+	struct GlyphBatchData {
+		const TextServerAdvanced *ts = nullptr;
+		const FontAdvanced *font_data = nullptr;
+		Vector2i size;
+		FT_Long face_index = 0;
+		FT_UInt pixel_size = 0;
+		Vector<FT_Fixed> coords;
+		LocalVector<RenderedGlyph> glyphs;
+		uint32_t chunk_size = 0;
+	};
+
+	static void _render_glyphs_threaded(void *p_td, uint32_t p_chunk);
 #endif
+	const uint32_t GLYPH_BATCH_MIN = 32; // Smaller batches are rendered on the calling thread.
+
 	_FORCE_INLINE_ bool _ensure_glyph(FontAdvanced *p_font_data, const Vector2i &p_size, int32_t p_glyph) const;
+	void _ensure_glyphs(FontAdvanced *p_font_data, const Vector2i &p_size, const int32_t *p_glyphs, uint32_t p_count) const;
 	_FORCE_INLINE_ bool _ensure_cache_for_size(FontAdvanced *p_font_data, const Vector2i &p_size) const;
 	_FORCE_INLINE_ void _font_clear_cache(FontAdvanced *p_font_data);
 	static void _generateMTSDF_threaded(void *p_td, uint32_t p_y);
@@ -540,10 +618,38 @@ class TextServerAdvanced : public TextServerExtension {
 
 	// Common data.
 
-	double oversampling = 1.0;
-	mutable RID_PtrOwner<FontAdvancedLinkedVariation> font_var_owner;
-	mutable RID_PtrOwner<FontAdvanced> font_owner;
-	mutable RID_PtrOwner<ShapedTextDataAdvanced> shaped_owner;
+	SafeNumeric<double> oversampling{ 1.0 };
+	// Owners are locked internally, per-object state is guarded by the object mutex,
+	// so texts using different shaped buffers can be shaped from several threads.
+	mutable RID_PtrOwner<FontAdvancedLinkedVariation, true> font_var_owner;
+	mutable RID_PtrOwner<FontAdvanced, true> font_owner;
+	mutable RID_PtrOwner<ShapedTextDataAdvanced, true> shaped_owner;
+
+	// Methods that look up fonts or shaped texts hold this for reading until they return, and
+	// _free_rid() takes it for writing, so nothing is deleted while another thread uses it.
+	// Server methods call each other, only the outermost call on a thread locks.
+	RWLock rid_use_lock;
+
+	class RIDUseLock {
+		static thread_local uint32_t depth;
+		const RWLock &lock;
+
+	public:
+		_FORCE_INLINE_ static bool is_locked() { return depth > 0; }
+
+		_FORCE_INLINE_ RIDUseLock(const RWLock &p_lock) :
+				lock(p_lock) {
+			if (depth++ == 0) {
+				lock.read_lock();
+			}
+		}
+		_FORCE_INLINE_ ~RIDUseLock() {
+			if (--depth == 0) {
+				lock.read_unlock();
+			}
+		}
+	};
+#define _RID_USE_METHOD_ RIDUseLock _rid_use_lock_(rid_use_lock);
 
 	_FORCE_INLINE_ FontAdvanced *_get_font_data(const RID &p_font_rid) const {
 		RID rid = p_font_rid;
@@ -638,6 +744,79 @@ class TextServerAdvanced : public TextServerExtension {
 	};
 	mutable HashMap<SystemFontKey, SystemFontCache, SystemFontKeyHasher> system_fonts;
 	mutable HashMap<String, PackedByteArray> system_font_data;
+	Mutex system_font_mutex;
+
+	// Shaped text cache, texts with the same source data and fonts reuse glyphs instead of reshaping.
+	struct ShapedCacheKey {
+		String text;
+		String locale;
+		Vector<ShapedTextDataAdvanced::Span> spans;
+		Vector<Vector3i> bidi_override;
+		TextServer::Direction direction = DIRECTION_LTR;
+		TextServer::Orientation orientation = ORIENTATION_HORIZONTAL;
+		int start = 0;
+		int extra_spacing[4] = { 0, 0, 0, 0 };
+		bool preserve_invalid = true;
+		bool preserve_control = false;
+		uint64_t font_revision = 0;
+		uint32_t hash = 0;
+
+		bool operator==(const ShapedCacheKey &p_b) const;
+	};
+
+	struct ShapedCacheKeyHasher {
+		_FORCE_INLINE_ static uint32_t hash(const ShapedCacheKey &p_a) { return p_a.hash; }
+	};
+
+	struct ShapedCacheEntry {
+		ShapedCacheKey key;
+		Vector<Glyph> glyphs;
+		double ascent = 0.0;
+		double descent = 0.0;
+		double width = 0.0;
+		double upos = 0.0;
+		double uthk = 0.0;
+		int64_t memory = 0;
+	};
+
+	const int64_t SHAPED_CACHE_MAX_MEMORY = 4 * 1024 * 1024;
+
+	mutable Mutex shaped_cache_mutex;
+	List<ShapedCacheEntry> shaped_cache_lru;
+	HashMap<ShapedCacheKey, List<ShapedCacheEntry>::Element *, ShapedCacheKeyHasher> shaped_cache;
+	int64_t shaped_cache_memory = 0;
+	int64_t shaped_cache_hits = 0;
+	int64_t shaped_cache_misses = 0;
+	SafeNumeric<uint64_t> font_revision; // Incremented by every font change that can affect shaping.
+
+	bool _shaped_cache_make_key(const ShapedTextDataAdvanced *p_sd, ShapedCacheKey &r_key) const;
+	bool _shaped_cache_fetch(const ShapedCacheKey &p_key, ShapedTextDataAdvanced *p_sd);
+	void _shaped_cache_store(const ShapedCacheKey &p_key, const ShapedTextDataAdvanced *p_sd);
+
+	// Persistent glyph cache, rasterized glyphs and texture pages of dynamic fonts are kept on disk between runs.
+	static const uint32_t PERSISTENT_CACHE_MAGIC = 0x43474C47; // "GLGC"
+	static const uint32_t PERSISTENT_CACHE_VERSION = 2;
+
+	bool _persistent_cache_enabled() const;
+	String _persistent_cache_file(FontAdvanced *p_font_data, const FontForSizeAdvanced *p_data, const Vector2i &p_size) const;
+	void _persistent_cache_load(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data, const Vector2i &p_size) const;
+	void _persistent_cache_save(FontAdvanced *p_font_data, FontForSizeAdvanced *p_data, const Vector2i &p_size) const;
+	void _persistent_cache_save_all(FontAdvanced *p_font_data) const;
+
+	struct PersistentCacheWrite {
+		String path;
+		String tmp_path;
+		Vector<SkylinePackTexture> textures;
+		HashMap<int32_t, FontGlyph> glyph_map;
+	};
+	mutable Mutex persistent_cache_mutex;
+	mutable HashMap<WorkerThreadPool::TaskID, String> persistent_cache_writes; // Queued writes and their cache files.
+	mutable uint64_t persistent_cache_seq = 0;
+	mutable bool persistent_cache_sync = false; // Set by cleanup, later saves are written on the calling thread.
+
+	static void _persistent_cache_write(PersistentCacheWrite *p_write);
+	static void _persistent_cache_write_task(void *p_write);
+	void _persistent_cache_wait(const String &p_path = String()) const;
 
 	void _update_chars(ShapedTextDataAdvanced *p_sd) const;
 	void _realign(ShapedTextDataAdvanced *p_sd) const;
@@ -794,6 +973,8 @@ public:
 	MODBIND1RC(TypedArray<Vector2i>, font_get_size_cache_list, const RID &);
 	MODBIND1(font_clear_size_cache, const RID &);
 	MODBIND2(font_remove_size_cache, const RID &, const Vector2i &);
+	MODBIND1RC(TypedArray<Dictionary>, font_get_size_cache_info, const RID &);
+	MODBIND3(font_compact_size_cache, const RID &, const Vector2i &, int64_t);
 
 	MODBIND3(font_set_ascent, const RID &, int64_t, double);
 	MODBIND2RC(double, font_get_ascent, const RID &, int64_t);
@@ -937,6 +1118,7 @@ public:
 	MODBIND3(shaped_text_overrun_trim_to_width, const RID &, double, BitField<TextServer::TextOverrunFlag>);
 
 	MODBIND1RC(bool, shaped_text_is_ready, const RID &);
+	MODBIND1RC(int64_t, get_shaped_text_cache_info, ShapedTextCacheInfo);
 
 	MODBIND1RC(const Glyph *, shaped_text_get_glyphs, const RID &);
 	MODBIND1R(const Glyph *, shaped_text_sort_logical, const RID &);
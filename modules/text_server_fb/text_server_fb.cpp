@@ -33,6 +33,7 @@
 #ifdef GDEXTENSION
 // Headers for building as GDExtension plug-in.
 
+#include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/os.hpp>
 #include <godot_cpp/classes/project_settings.hpp>
@@ -47,6 +48,7 @@ using namespace godot;
 #else
 // Headers for building as built-in module.
 
+#include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/error/error_macros.h"
 #include "core/string/print_string.h"
@@ -240,7 +242,7 @@ _FORCE_INLINE_ TextServerFallback::FontTexturePosition TextServerFallback::find_
 	int mw = p_width;
 	int mh = p_height;
 
-	ShelfPackTexture *ct = p_data->textures.ptrw();
+	SkylinePackTexture *ct = p_data->textures.ptrw();
 	for (int32_t i = 0; i < p_data->textures.size(); i++) {
 		if (p_image_format != ct[i].format) {
 			continue;
@@ -273,7 +275,7 @@ _FORCE_INLINE_ TextServerFallback::FontTexturePosition TextServerFallback::find_
 			texsize = next_power_of_2(mh);
 		}
 
-		ShelfPackTexture tex = ShelfPackTexture(texsize, texsize);
+		SkylinePackTexture tex = SkylinePackTexture(texsize, texsize);
 		tex.format = p_image_format;
 		tex.imgdata.resize(texsize * texsize * p_color_size);
 		{
@@ -435,7 +437,7 @@ _FORCE_INLINE_ TextServerFallback::FontGlyph TextServerFallback::rasterize_msdf(
 
 		FontTexturePosition tex_pos = find_texture_pos_for_glyph(p_data, 4, Image::FORMAT_RGBA8, mw, mh, true);
 		ERR_FAIL_COND_V(tex_pos.index < 0, FontGlyph());
-		ShelfPackTexture &tex = p_data->textures.write[tex_pos.index];
+		SkylinePackTexture &tex = p_data->textures.write[tex_pos.index];
 
 		edgeColoringSimple(shape, 3.0); // Max. angle.
 		msdfgen::Bitmap<float, 4> image(w, h); // Texture size.
@@ -518,7 +520,7 @@ _FORCE_INLINE_ TextServerFallback::FontGlyph TextServerFallback::rasterize_bitma
 	ERR_FAIL_COND_V(tex_pos.index < 0, FontGlyph());
 
 	// Fit character in char texture.
-	ShelfPackTexture &tex = p_data->textures.write[tex_pos.index];
+	SkylinePackTexture &tex = p_data->textures.write[tex_pos.index];
 
 	{
 		uint8_t *wr = tex.imgdata.ptrw();
@@ -1500,6 +1502,120 @@ void TextServerFallback::_font_remove_size_cache(const RID &p_font_rid, const Ve
 	}
 }
 
+TypedArray<Dictionary> TextServerFallback::_font_get_size_cache_info(const RID &p_font_rid) const {
+	FontFallback *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL_V(fd, TypedArray<Dictionary>());
+
+	MutexLock lock(fd->mutex);
+	TypedArray<Dictionary> ret;
+	for (const KeyValue<Vector2i, FontForSizeFallback *> &E : fd->cache) {
+		int64_t texture_area = 0;
+		int64_t textures_size = 0;
+		for (const SkylinePackTexture &tex : E.value->textures) {
+			texture_area += (int64_t)tex.texture_w * tex.texture_h;
+			textures_size += tex.imgdata.size();
+		}
+		int64_t glyph_area = 0;
+		for (const KeyValue<int32_t, FontGlyph> &G : E.value->glyph_map) {
+			if (G.value.texture_idx >= 0) {
+				glyph_area += (int64_t)(G.value.uv_rect.size.x + rect_range * 2) * (int64_t)(G.value.uv_rect.size.y + rect_range * 2);
+			}
+		}
+
+		Dictionary info;
+		info["size"] = E.key;
+		info["glyphs"] = E.value->glyph_map.size();
+		info["textures"] = E.value->textures.size();
+		info["textures_size"] = textures_size;
+		info["occupancy"] = (texture_area > 0) ? (double)glyph_area / (double)texture_area : 0.0;
+		ret.push_back(info);
+	}
+	return ret;
+}
+
+void TextServerFallback::_font_compact_size_cache(const RID &p_font_rid, const Vector2i &p_size, int64_t p_max_unused_frames) {
+	FontFallback *fd = _get_font_data(p_font_rid);
+	ERR_FAIL_NULL(fd);
+
+	MutexLock lock(fd->mutex);
+	Vector2i size = _get_size_outline(fd, p_size);
+	if (!fd->cache.has(size)) {
+		return;
+	}
+	FontForSizeFallback *ffsd = fd->cache[size];
+	for (const SkylinePackTexture &tex : ffsd->textures) {
+		if (tex.format != Image::FORMAT_LA8 && tex.format != Image::FORMAT_RGBA8) {
+			return; // Custom texture set by font_set_texture_image(), glyph layout is unknown.
+		}
+	}
+
+	if (p_max_unused_frames >= 0) {
+		uint64_t frame = Engine::get_singleton()->get_frames_drawn();
+		LocalVector<int32_t> unused;
+		for (const KeyValue<int32_t, FontGlyph> &E : ffsd->glyph_map) {
+			if (E.value.texture_idx >= 0 && frame - E.value.last_used > (uint64_t)p_max_unused_frames) {
+				unused.push_back(E.key);
+			}
+		}
+		for (int32_t E : unused) {
+			ffsd->glyph_map.erase(E);
+		}
+	}
+
+	// Repack the remaining glyphs into new textures, tallest first.
+	struct GlyphRepack {
+		int32_t glyph = 0;
+		real_t height = 0.0;
+
+		bool operator<(const GlyphRepack &p_b) const { return height > p_b.height; }
+	};
+	LocalVector<GlyphRepack> glyphs;
+	for (const KeyValue<int32_t, FontGlyph> &E : ffsd->glyph_map) {
+		if (E.value.texture_idx >= 0) {
+			GlyphRepack gr;
+			gr.glyph = E.key;
+			gr.height = E.value.uv_rect.size.y;
+			glyphs.push_back(gr);
+		}
+	}
+	glyphs.sort();
+
+	Vector<SkylinePackTexture> old_textures = ffsd->textures;
+	ffsd->textures.clear();
+	for (const GlyphRepack &E : glyphs) {
+		FontGlyph &gl = ffsd->glyph_map[E.glyph];
+		if (gl.texture_idx >= old_textures.size()) {
+			ffsd->glyph_map.erase(E.glyph);
+			continue;
+		}
+		const SkylinePackTexture &src = old_textures[gl.texture_idx];
+		int color_size = (src.format == Image::FORMAT_LA8) ? 2 : 4;
+		Rect2i rect = Rect2i(gl.uv_rect).grow(rect_range).intersection(Rect2i(0, 0, src.texture_w, src.texture_h));
+
+		FontTexturePosition tex_pos = find_texture_pos_for_glyph(ffsd, color_size, src.format, rect.size.x, rect.size.y, fd->msdf);
+		if (tex_pos.index < 0) {
+			ffsd->glyph_map.erase(E.glyph); // Rendered again on next use.
+			continue;
+		}
+		SkylinePackTexture &dst = ffsd->textures.write[tex_pos.index];
+
+		const uint8_t *r = src.imgdata.ptr();
+		uint8_t *w = dst.imgdata.ptrw();
+		for (int32_t y = 0; y < rect.size.y; y++) {
+			memcpy(w + ((tex_pos.y + y) * dst.texture_w + tex_pos.x) * color_size, r + ((rect.position.y + y) * src.texture_w + rect.position.x) * color_size, rect.size.x * color_size);
+		}
+
+		gl.uv_rect.position += Vector2(tex_pos.x - rect.position.x, tex_pos.y - rect.position.y);
+		gl.texture_idx = tex_pos.index;
+	}
+
+	// Every page gets a new texture, the old ones are freed with old_textures. Canvas items that drew glyphs
+	// of this size before must be redrawn, FontFile::compact_size_cache() emits "changed" for that.
+	for (int i = 0; i < ffsd->textures.size(); i++) {
+		ffsd->textures.write[i].dirty = true;
+	}
+}
+
 void TextServerFallback::_font_set_ascent(const RID &p_font_rid, int64_t p_size, double p_ascent) {
 	FontFallback *fd = _get_font_data(p_font_rid);
 	ERR_FAIL_NULL(fd);
@@ -1716,7 +1832,7 @@ void TextServerFallback::_font_set_texture_image(const RID &p_font_rid, const Ve
 		fd->cache[size]->textures.resize(p_texture_index + 1);
 	}
 
-	ShelfPackTexture &tex = fd->cache[size]->textures.write[p_texture_index];
+	SkylinePackTexture &tex = fd->cache[size]->textures.write[p_texture_index];
 
 	tex.imgdata = p_image->get_data();
 	tex.texture_w = p_image->get_width();
@@ -1741,7 +1857,7 @@ Ref<Image> TextServerFallback::_font_get_texture_image(const RID &p_font_rid, co
 	ERR_FAIL_COND_V(!_ensure_cache_for_size(fd, size), Ref<Image>());
 	ERR_FAIL_INDEX_V(p_texture_index, fd->cache[size]->textures.size(), Ref<Image>());
 
-	const ShelfPackTexture &tex = fd->cache[size]->textures[p_texture_index];
+	const SkylinePackTexture &tex = fd->cache[size]->textures[p_texture_index];
 	return Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
 }
 
@@ -1758,10 +1874,25 @@ void TextServerFallback::_font_set_texture_offsets(const RID &p_font_rid, const
 		fd->cache[size]->textures.resize(p_texture_index + 1);
 	}
 
-	ShelfPackTexture &tex = fd->cache[size]->textures.write[p_texture_index];
-	tex.shelves.clear();
-	for (int32_t i = 0; i < p_offsets.size(); i += 4) {
-		tex.shelves.push_back(Shelf(p_offsets[i], p_offsets[i + 1], p_offsets[i + 2], p_offsets[i + 3]));
+	SkylinePackTexture &tex = fd->cache[size]->textures.write[p_texture_index];
+	tex.skyline.clear();
+	bool legacy = false;
+	for (int32_t i = 3; i < p_offsets.size(); i += 4) {
+		legacy = legacy || (p_offsets[i] != 0);
+	}
+	if (legacy) {
+		// Shelf packer data (next free X, Y, free width, height). The area above the bottom of the last shelf and left of its free space is used.
+		int32_t i = p_offsets.size() - 4;
+		if (p_offsets[i] > 0) {
+			tex.skyline.push_back(SkylineNode(0, p_offsets[i + 1] + p_offsets[i + 3], p_offsets[i]));
+		}
+		if (p_offsets[i + 2] > 0) {
+			tex.skyline.push_back(SkylineNode(p_offsets[i], p_offsets[i + 1], p_offsets[i + 2]));
+		}
+	} else {
+		for (int32_t i = 0; i < p_offsets.size(); i += 4) {
+			tex.skyline.push_back(SkylineNode(p_offsets[i], p_offsets[i + 1], p_offsets[i + 2]));
+		}
 	}
 }
 
@@ -1774,18 +1905,16 @@ PackedInt32Array TextServerFallback::_font_get_texture_offsets(const RID &p_font
 	ERR_FAIL_COND_V(!_ensure_cache_for_size(fd, size), PackedInt32Array());
 	ERR_FAIL_INDEX_V(p_texture_index, fd->cache[size]->textures.size(), PackedInt32Array());
 
-	const ShelfPackTexture &tex = fd->cache[size]->textures[p_texture_index];
+	const SkylinePackTexture &tex = fd->cache[size]->textures[p_texture_index];
 	PackedInt32Array ret;
-	ret.resize(tex.shelves.size() * 4);
+	ret.resize(tex.skyline.size() * 4);
 
 	int32_t *wr = ret.ptrw();
-	int32_t i = 0;
-	for (const Shelf &E : tex.shelves) {
-		wr[i * 4] = E.x;
-		wr[i * 4 + 1] = E.y;
-		wr[i * 4 + 2] = E.w;
-		wr[i * 4 + 3] = E.h;
-		i++;
+	for (uint32_t i = 0; i < tex.skyline.size(); i++) {
+		wr[i * 4] = tex.skyline[i].x;
+		wr[i * 4 + 1] = tex.skyline[i].y;
+		wr[i * 4 + 2] = tex.skyline[i].w;
+		wr[i * 4 + 3] = 0;
 	}
 	return ret;
 }
@@ -2096,7 +2225,7 @@ RID TextServerFallback::_font_get_glyph_texture_rid(const RID &p_font_rid, const
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (gl[p_glyph | mod].texture_idx != -1) {
 			if (fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].dirty) {
-				ShelfPackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
+				SkylinePackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
 				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
 				if (fd->mipmaps) {
 					img->generate_mipmaps();
@@ -2142,7 +2271,7 @@ Size2 TextServerFallback::_font_get_glyph_texture_size(const RID &p_font_rid, co
 	if (RenderingServer::get_singleton() != nullptr) {
 		if (gl[p_glyph | mod].texture_idx != -1) {
 			if (fd->cache[size]->textures[gl[p_glyph | mod].texture_idx].dirty) {
-				ShelfPackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
+				SkylinePackTexture &tex = fd->cache[size]->textures.write[gl[p_glyph | mod].texture_idx];
 				Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
 				if (fd->mipmaps) {
 					img->generate_mipmaps();
@@ -2478,7 +2607,8 @@ void TextServerFallback::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 		return; // Invalid or non-graphical glyph, do not display errors, nothing to draw.
 	}
 
-	const FontGlyph &gl = fd->cache[size]->glyph_map[index];
+	FontGlyph &gl = fd->cache[size]->glyph_map[index];
+	gl.last_used = Engine::get_singleton()->get_frames_drawn();
 	if (gl.found) {
 		ERR_FAIL_COND(gl.texture_idx < -1 || gl.texture_idx >= fd->cache[size]->textures.size());
 
@@ -2491,7 +2621,7 @@ void TextServerFallback::_font_draw_glyph(const RID &p_font_rid, const RID &p_ca
 #endif
 			if (RenderingServer::get_singleton() != nullptr) {
 				if (fd->cache[size]->textures[gl.texture_idx].dirty) {
-					ShelfPackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
+					SkylinePackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
 					Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
 					if (fd->mipmaps) {
 						img->generate_mipmaps();
@@ -2582,7 +2712,8 @@ void TextServerFallback::_font_draw_glyph_outline(const RID &p_font_rid, const R
 		return; // Invalid or non-graphical glyph, do not display errors, nothing to draw.
 	}
 
-	const FontGlyph &gl = fd->cache[size]->glyph_map[index];
+	FontGlyph &gl = fd->cache[size]->glyph_map[index];
+	gl.last_used = Engine::get_singleton()->get_frames_drawn();
 	if (gl.found) {
 		ERR_FAIL_COND(gl.texture_idx < -1 || gl.texture_idx >= fd->cache[size]->textures.size());
 
@@ -2595,7 +2726,7 @@ void TextServerFallback::_font_draw_glyph_outline(const RID &p_font_rid, const R
 #endif
 			if (RenderingServer::get_singleton() != nullptr) {
 				if (fd->cache[size]->textures[gl.texture_idx].dirty) {
-					ShelfPackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
+					SkylinePackTexture &tex = fd->cache[size]->textures.write[gl.texture_idx];
 					Ref<Image> img = Image::create_from_data(tex.texture_w, tex.texture_h, false, tex.format, tex.imgdata);
 					if (fd->mipmaps) {
 						img->generate_mipmaps();
@@ -4111,6 +4242,11 @@ bool TextServerFallback::_shaped_text_is_ready(const RID &p_shaped) const {
 	return sd->valid;
 }
 
+int64_t TextServerFallback::_get_shaped_text_cache_info(ShapedTextCacheInfo p_info) const {
+	// Shaping is a lookup per character, results are not cached.
+	return 0;
+}
+
 const Glyph *TextServerFallback::_shaped_text_get_glyphs(const RID &p_shaped) const {
 	const ShapedTextDataFallback *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, nullptr);
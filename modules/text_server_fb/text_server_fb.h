@@ -71,6 +71,7 @@
 
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
 #include <godot_cpp/templates/rid_owner.hpp>
 #include <godot_cpp/templates/vector.hpp>
 
@@ -82,6 +83,7 @@ using namespace godot;
 #include "core/extension/ext_wrappers.gen.inc"
 #include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rid_owner.h"
 #include "scene/resources/image_texture.h"
 #include "servers/text/text_server_extension.h"
@@ -137,28 +139,17 @@ class TextServerFallback : public TextServerExtension {
 				index(p_id), x(p_x), y(p_y) {}
 	};
 
-	struct Shelf {
+	struct SkylineNode {
 		int32_t x = 0;
 		int32_t y = 0;
 		int32_t w = 0;
-		int32_t h = 0;
 
-		FontTexturePosition alloc_shelf(int32_t p_id, int32_t p_w, int32_t p_h) {
-			if (p_w > w || p_h > h) {
-				return FontTexturePosition(-1, 0, 0);
-			}
-			int32_t xx = x;
-			x += p_w;
-			w -= p_w;
-			return FontTexturePosition(p_id, xx, y);
-		}
-
-		Shelf() {}
-		Shelf(int32_t p_x, int32_t p_y, int32_t p_w, int32_t p_h) :
-				x(p_x), y(p_y), w(p_w), h(p_h) {}
+		SkylineNode() {}
+		SkylineNode(int32_t p_x, int32_t p_y, int32_t p_w) :
+				x(p_x), y(p_y), w(p_w) {}
 	};
 
-	struct ShelfPackTexture {
+	struct SkylinePackTexture {
 		int32_t texture_w = 1024;
 		int32_t texture_h = 1024;
 
@@ -167,45 +158,84 @@ class TextServerFallback : public TextServerExtension {
 		Ref<ImageTexture> texture;
 		bool dirty = true;
 
-		List<Shelf> shelves;
+		// Top edge of the packed area, left to right. Nodes cover the whole texture width once packing has started.
+		LocalVector<SkylineNode> skyline;
 
-		FontTexturePosition pack_rect(int32_t p_id, int32_t p_h, int32_t p_w) {
+		// Returns the Y position of a rect placed at the left edge of node p_idx, or -1 if it does not fit.
+		int32_t fit_rect(uint32_t p_idx, int32_t p_w, int32_t p_h) const {
+			if (skyline[p_idx].x + p_w > texture_w) {
+				return -1;
+			}
 			int32_t y = 0;
-			int32_t waste = 0;
-			Shelf *best_shelf = nullptr;
-			int32_t best_waste = std::numeric_limits<std::int32_t>::max();
+			int32_t width_left = p_w;
+			for (uint32_t i = p_idx; width_left > 0 && i < skyline.size(); i++) {
+				y = MAX(y, skyline[i].y);
+				if (y + p_h > texture_h) {
+					return -1;
+				}
+				width_left -= skyline[i].w;
+			}
+			return width_left > 0 ? -1 : y;
+		}
+
+		FontTexturePosition pack_rect(int32_t p_id, int32_t p_h, int32_t p_w) {
+			if (skyline.is_empty()) {
+				skyline.push_back(SkylineNode(0, 0, texture_w));
+			}
 
-			for (Shelf &E : shelves) {
-				y += E.h;
-				if (p_w > E.w) {
+			// Bottom-left rule, lowest resulting top edge first, then the narrowest node.
+			int32_t best_idx = -1;
+			int32_t best_y = 0;
+			int32_t best_bottom = std::numeric_limits<std::int32_t>::max();
+			int32_t best_w = std::numeric_limits<std::int32_t>::max();
+			for (uint32_t i = 0; i < skyline.size(); i++) {
+				int32_t y = fit_rect(i, p_w, p_h);
+				if (y < 0) {
 					continue;
 				}
-				if (p_h == E.h) {
-					return E.alloc_shelf(p_id, p_w, p_h);
+				if (y + p_h < best_bottom || (y + p_h == best_bottom && skyline[i].w < best_w)) {
+					best_idx = i;
+					best_y = y;
+					best_bottom = y + p_h;
+					best_w = skyline[i].w;
 				}
-				if (p_h > E.h) {
-					continue;
+			}
+			if (best_idx == -1) {
+				return FontTexturePosition(-1, 0, 0);
+			}
+
+			int32_t x = skyline[best_idx].x;
+			skyline.insert(best_idx, SkylineNode(x, best_bottom, p_w));
+
+			// Shrink or remove the nodes covered by the new one.
+			for (uint32_t i = best_idx + 1; i < skyline.size();) {
+				int32_t covered = x + p_w - skyline[i].x;
+				if (covered <= 0) {
+					break;
 				}
-				if (p_h < E.h) {
-					waste = (E.h - p_h) * p_w;
-					if (waste < best_waste) {
-						best_waste = waste;
-						best_shelf = &E;
-					}
+				if (skyline[i].w > covered) {
+					skyline[i].x += covered;
+					skyline[i].w -= covered;
+					break;
 				}
+				skyline.remove_at(i);
 			}
-			if (best_shelf) {
-				return best_shelf->alloc_shelf(p_id, p_w, p_h);
-			}
-			if (p_h <= (texture_h - y) && p_w <= texture_w) {
-				List<Shelf>::Element *E = shelves.push_back(Shelf(0, y, texture_w, p_h));
-				return E->get().alloc_shelf(p_id, p_w, p_h);
+
+			// Merge neighbors at the same height.
+			for (uint32_t i = 0; i + 1 < skyline.size();) {
+				if (skyline[i].y == skyline[i + 1].y) {
+					skyline[i].w += skyline[i + 1].w;
+					skyline.remove_at(i + 1);
+				} else {
+					i++;
+				}
 			}
-			return FontTexturePosition(-1, 0, 0);
+
+			return FontTexturePosition(p_id, x, best_y);
 		}
 
-		ShelfPackTexture() {}
-		ShelfPackTexture(int32_t p_w, int32_t p_h) :
+		SkylinePackTexture() {}
+		SkylinePackTexture(int32_t p_w, int32_t p_h) :
 				texture_w(p_w), texture_h(p_h) {}
 	};
 
@@ -215,6 +245,7 @@ class TextServerFallback : public TextServerExtension {
 		Rect2 rect;
 		Rect2 uv_rect;
 		Vector2 advance;
+		uint64_t last_used = 0; // Frame the glyph was last drawn, used for eviction.
 	};
 
 	struct FontForSizeFallback {
@@ -227,7 +258,7 @@ class TextServerFallback : public TextServerExtension {
 
 		Vector2i size;
 
-		Vector<ShelfPackTexture> textures;
+		Vector<SkylinePackTexture> textures;
 		HashMap<int32_t, FontGlyph> glyph_map;
 		HashMap<Vector2i, Vector2> kerning_map;
 
@@ -661,6 +692,8 @@ public:
 	MODBIND1RC(TypedArray<Vector2i>, font_get_size_cache_list, const RID &);
 	MODBIND1(font_clear_size_cache, const RID &);
 	MODBIND2(font_remove_size_cache, const RID &, const Vector2i &);
+	MODBIND1RC(TypedArray<Dictionary>, font_get_size_cache_info, const RID &);
+	MODBIND3(font_compact_size_cache, const RID &, const Vector2i &, int64_t);
 
 	MODBIND3(font_set_ascent, const RID &, int64_t, double);
 	MODBIND2RC(double, font_get_ascent, const RID &, int64_t);
@@ -804,6 +837,7 @@ public:
 	MODBIND3(shaped_text_overrun_trim_to_width, const RID &, double, BitField<TextServer::TextOverrunFlag>);
 
 	MODBIND1RC(bool, shaped_text_is_ready, const RID &);
+	MODBIND1RC(int64_t, get_shaped_text_cache_info, ShapedTextCacheInfo);
 
 	MODBIND1RC(const Glyph *, shaped_text_get_glyphs, const RID &);
 	MODBIND1R(const Glyph *, shaped_text_sort_logical, const RID &);
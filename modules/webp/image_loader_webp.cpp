@@ -54,6 +54,13 @@ Error ImageLoaderWebP::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitFiel
 	Vector<uint8_t> src_image;
 	uint64_t src_image_len = f->get_length();
 	ERR_FAIL_COND_V(src_image_len == 0, ERR_FILE_CORRUPT);
+
+	const uint8_t *mapped = f->get_mapped_buffer(src_image_len);
+	if (mapped) {
+		// Decode straight from the file mapping, no need for an intermediate copy.
+		return WebPCommon::webp_load_image_from_buffer(p_image.ptr(), mapped, src_image_len);
+	}
+
 	src_image.resize(src_image_len);
 
 	uint8_t *w = src_image.ptrw();
@@ -65,6 +72,22 @@ Error ImageLoaderWebP::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitFiel
 	return err;
 }
 
+Error ImageLoaderWebP::load_image_region(Ref<Image> p_image, Ref<FileAccess> f, BitField<ImageFormatLoader::LoaderFlags> p_flags, const Rect2i &p_region, int p_shrink) {
+	uint64_t src_image_len = f->get_length();
+	ERR_FAIL_COND_V(src_image_len == 0, ERR_FILE_CORRUPT);
+
+	const uint8_t *mapped = f->get_mapped_buffer(src_image_len);
+	if (mapped) {
+		return WebPCommon::webp_load_image_region_from_buffer(p_image.ptr(), mapped, src_image_len, p_region, p_shrink);
+	}
+
+	Vector<uint8_t> src_image;
+	src_image.resize(src_image_len);
+	f->get_buffer(src_image.ptrw(), src_image_len);
+
+	return WebPCommon::webp_load_image_region_from_buffer(p_image.ptr(), src_image.ptr(), src_image_len, p_region, p_shrink);
+}
+
 void ImageLoaderWebP::get_recognized_extensions(List<String> *p_extensions) const {
 	p_extensions->push_back("webp");
 }
@@ -36,6 +36,7 @@
 class ImageLoaderWebP : public ImageFormatLoader {
 public:
 	virtual Error load_image(Ref<Image> p_image, Ref<FileAccess> f, BitField<ImageFormatLoader::LoaderFlags> p_flags, float p_scale);
+	virtual Error load_image_region(Ref<Image> p_image, Ref<FileAccess> f, BitField<ImageFormatLoader::LoaderFlags> p_flags, const Rect2i &p_region, int p_shrink);
 	virtual void get_recognized_extensions(List<String> *p_extensions) const;
 	ImageLoaderWebP();
 };
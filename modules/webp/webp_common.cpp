@@ -31,6 +31,7 @@
 #include "webp_common.h"
 
 #include "core/config/project_settings.h"
+#include "core/io/image_loader.h"
 #include "core/os/os.h"
 
 #include <webp/decode.h>
@@ -179,4 +180,48 @@ Error webp_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p
 
 	return OK;
 }
+
+Error webp_load_image_region_from_buffer(Image *p_image, const uint8_t *p_buffer, int p_buffer_len, const Rect2i &p_region, int p_shrink) {
+	ERR_FAIL_NULL_V(p_image, ERR_INVALID_PARAMETER);
+
+	WebPDecoderConfig config;
+	if (!WebPInitDecoderConfig(&config)) {
+		ERR_FAIL_V(ERR_UNAVAILABLE);
+	}
+	if (WebPGetFeatures(p_buffer, p_buffer_len, &config.input) != VP8_STATUS_OK) {
+		ERR_FAIL_V(ERR_FILE_CORRUPT);
+	}
+
+	const bool has_alpha = config.input.has_alpha;
+	ImageRegionWriter writer;
+	Error err = writer.begin(config.input.width, config.input.height, has_alpha ? Image::FORMAT_RGBA8 : Image::FORMAT_RGB8, p_region, p_shrink);
+	if (err != OK) {
+		return err;
+	}
+
+	// libwebp crops and rescales while decoding, RGB output modes crop at exact offsets.
+	const Rect2i &region = writer.get_region();
+	const Size2i size = writer.get_size();
+	config.options.use_cropping = region.size != Size2i(config.input.width, config.input.height);
+	config.options.crop_left = region.position.x;
+	config.options.crop_top = region.position.y;
+	config.options.crop_width = region.size.width;
+	config.options.crop_height = region.size.height;
+	config.options.use_scaling = size != region.size;
+	config.options.scaled_width = size.width;
+	config.options.scaled_height = size.height;
+
+	const int pixel_size = has_alpha ? 4 : 3;
+	config.output.colorspace = has_alpha ? MODE_RGBA : MODE_RGB;
+	config.output.is_external_memory = 1;
+	config.output.u.RGBA.rgba = writer.ptrw();
+	config.output.u.RGBA.stride = size.width * pixel_size;
+	config.output.u.RGBA.size = (size_t)size.width * size.height * pixel_size;
+
+	const VP8StatusCode status = WebPDecode(p_buffer, p_buffer_len, &config);
+	WebPFreeDecBuffer(&config.output);
+	ERR_FAIL_COND_V_MSG(status != VP8_STATUS_OK, ERR_FILE_CORRUPT, "Failed decoding WebP image.");
+
+	return writer.finish(p_image);
+}
 } // namespace WebPCommon
@@ -42,6 +42,8 @@ Vector<uint8_t> _webp_packer(const Ref<Image> &p_image, float p_quality, bool p_
 // Given a WebP file, unpack it into an image.
 Ref<Image> _webp_unpack(const Vector<uint8_t> &p_buffer);
 Error webp_load_image_from_buffer(Image *p_image, const uint8_t *p_buffer, int p_buffer_len);
+// Decode only p_region, scaled down by p_shrink, straight into the image buffer.
+Error webp_load_image_region_from_buffer(Image *p_image, const uint8_t *p_buffer, int p_buffer_len, const Rect2i &p_region, int p_shrink);
 } //namespace WebPCommon
 
 #endif // WEBP_COMMON_H
@@ -30,7 +30,7 @@
 
 #include "container.h"
 
-#include "core/object/message_queue.h"
+#include "scene/main/scene_tree.h"
 #include "scene/scene_string_names.h"
 
 void Container::_child_minsize_changed() {
@@ -138,7 +138,7 @@ void Container::queue_sort() {
 		return;
 	}
 
-	MessageQueue::get_singleton()->push_callable(callable_mp(this, &Container::_sort_children));
+	get_tree()->_queue_layout_arrange(this);
 	pending_sort = true;
 }
 
@@ -270,6 +270,7 @@ private:
 	// Global relations.
 
 	friend class Viewport;
+	friend class SceneTree;
 
 	// Positioning and sizing.
 
@@ -36,22 +36,24 @@
 #include "scene/theme/theme_db.h"
 
 void ItemList::_shape_text(int p_idx) {
-	Item &item = items.write[p_idx];
+	_shape_item_text(items.write[p_idx]);
+}
 
-	item.text_buf->clear();
-	if (item.text_direction == Control::TEXT_DIRECTION_INHERITED) {
-		item.text_buf->set_direction(is_layout_rtl() ? TextServer::DIRECTION_RTL : TextServer::DIRECTION_LTR);
+void ItemList::_shape_item_text(Item &p_item) const {
+	p_item.text_buf->clear();
+	if (p_item.text_direction == Control::TEXT_DIRECTION_INHERITED) {
+		p_item.text_buf->set_direction(is_layout_rtl() ? TextServer::DIRECTION_RTL : TextServer::DIRECTION_LTR);
 	} else {
-		item.text_buf->set_direction((TextServer::Direction)item.text_direction);
+		p_item.text_buf->set_direction((TextServer::Direction)p_item.text_direction);
 	}
-	item.text_buf->add_string(item.text, theme_cache.font, theme_cache.font_size, item.language);
+	p_item.text_buf->add_string(p_item.text, theme_cache.font, theme_cache.font_size, p_item.language);
 	if (icon_mode == ICON_MODE_TOP && max_text_lines > 0) {
-		item.text_buf->set_break_flags(TextServer::BREAK_MANDATORY | TextServer::BREAK_WORD_BOUND | TextServer::BREAK_GRAPHEME_BOUND | TextServer::BREAK_TRIM_EDGE_SPACES);
+		p_item.text_buf->set_break_flags(TextServer::BREAK_MANDATORY | TextServer::BREAK_WORD_BOUND | TextServer::BREAK_GRAPHEME_BOUND | TextServer::BREAK_TRIM_EDGE_SPACES);
 	} else {
-		item.text_buf->set_break_flags(TextServer::BREAK_NONE);
+		p_item.text_buf->set_break_flags(TextServer::BREAK_NONE);
 	}
-	item.text_buf->set_text_overrun_behavior(text_overrun_behavior);
-	item.text_buf->set_max_lines_visible(max_text_lines);
+	p_item.text_buf->set_text_overrun_behavior(text_overrun_behavior);
+	p_item.text_buf->set_max_lines_visible(max_text_lines);
 }
 
 int ItemList::add_item(const String &p_item, const Ref<Texture2D> &p_texture, bool p_selectable) {
@@ -84,6 +86,7 @@ int ItemList::add_icon_item(const Ref<Texture2D> &p_item, bool p_selectable) {
 }
 
 void ItemList::set_item_text(int p_idx, const String &p_text) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -100,11 +103,12 @@ void ItemList::set_item_text(int p_idx, const String &p_text) {
 }
 
 String ItemList::get_item_text(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), String());
-	return items[p_idx].text;
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), String());
+	return _is_virtual() ? _get_virtual_row(p_idx).text : items[p_idx].text;
 }
 
 void ItemList::set_item_text_direction(int p_idx, Control::TextDirection p_text_direction) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -118,11 +122,15 @@ void ItemList::set_item_text_direction(int p_idx, Control::TextDirection p_text_
 }
 
 Control::TextDirection ItemList::get_item_text_direction(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), TEXT_DIRECTION_INHERITED);
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), TEXT_DIRECTION_INHERITED);
+	if (_is_virtual()) {
+		return TEXT_DIRECTION_AUTO; // Not provided by item_source.
+	}
 	return items[p_idx].text_direction;
 }
 
 void ItemList::set_item_language(int p_idx, const String &p_language) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -135,11 +143,15 @@ void ItemList::set_item_language(int p_idx, const String &p_language) {
 }
 
 String ItemList::get_item_language(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), "");
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), "");
+	if (_is_virtual()) {
+		return ""; // Not provided by item_source.
+	}
 	return items[p_idx].language;
 }
 
 void ItemList::set_item_tooltip_enabled(int p_idx, const bool p_enabled) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -148,11 +160,15 @@ void ItemList::set_item_tooltip_enabled(int p_idx, const bool p_enabled) {
 }
 
 bool ItemList::is_item_tooltip_enabled(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), false);
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), false);
+	if (_is_virtual()) {
+		return true; // Not provided by item_source.
+	}
 	return items[p_idx].tooltip_enabled;
 }
 
 void ItemList::set_item_tooltip(int p_idx, const String &p_tooltip) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -168,11 +184,12 @@ void ItemList::set_item_tooltip(int p_idx, const String &p_tooltip) {
 }
 
 String ItemList::get_item_tooltip(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), String());
-	return items[p_idx].tooltip;
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), String());
+	return _is_virtual() ? _get_virtual_row(p_idx).tooltip : items[p_idx].tooltip;
 }
 
 void ItemList::set_item_icon(int p_idx, const Ref<Texture2D> &p_icon) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -188,12 +205,13 @@ void ItemList::set_item_icon(int p_idx, const Ref<Texture2D> &p_icon) {
 }
 
 Ref<Texture2D> ItemList::get_item_icon(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), Ref<Texture2D>());
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), Ref<Texture2D>());
 
-	return items[p_idx].icon;
+	return _is_virtual() ? _get_virtual_row(p_idx).icon : items[p_idx].icon;
 }
 
 void ItemList::set_item_icon_transposed(int p_idx, const bool p_transposed) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -209,12 +227,16 @@ void ItemList::set_item_icon_transposed(int p_idx, const bool p_transposed) {
 }
 
 bool ItemList::is_item_icon_transposed(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), false);
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), false);
+	if (_is_virtual()) {
+		return false; // Not provided by item_source.
+	}
 
 	return items[p_idx].icon_transposed;
 }
 
 void ItemList::set_item_icon_region(int p_idx, const Rect2 &p_region) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -230,12 +252,16 @@ void ItemList::set_item_icon_region(int p_idx, const Rect2 &p_region) {
 }
 
 Rect2 ItemList::get_item_icon_region(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), Rect2());
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), Rect2());
+	if (_is_virtual()) {
+		return Rect2(); // Not provided by item_source.
+	}
 
 	return items[p_idx].icon_region;
 }
 
 void ItemList::set_item_icon_modulate(int p_idx, const Color &p_modulate) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -250,12 +276,16 @@ void ItemList::set_item_icon_modulate(int p_idx, const Color &p_modulate) {
 }
 
 Color ItemList::get_item_icon_modulate(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), Color());
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), Color());
+	if (_is_virtual()) {
+		return Color(1, 1, 1, 1); // Not provided by item_source.
+	}
 
 	return items[p_idx].icon_modulate;
 }
 
 void ItemList::set_item_custom_bg_color(int p_idx, const Color &p_custom_bg_color) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -270,12 +300,13 @@ void ItemList::set_item_custom_bg_color(int p_idx, const Color &p_custom_bg_colo
 }
 
 Color ItemList::get_item_custom_bg_color(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), Color());
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), Color());
 
-	return items[p_idx].custom_bg;
+	return _is_virtual() ? _get_virtual_row(p_idx).custom_bg : items[p_idx].custom_bg;
 }
 
 void ItemList::set_item_custom_fg_color(int p_idx, const Color &p_custom_fg_color) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -290,15 +321,15 @@ void ItemList::set_item_custom_fg_color(int p_idx, const Color &p_custom_fg_colo
 }
 
 Color ItemList::get_item_custom_fg_color(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), Color());
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), Color());
 
-	return items[p_idx].custom_fg;
+	return _is_virtual() ? _get_virtual_row(p_idx).custom_fg : items[p_idx].custom_fg;
 }
 
 Rect2 ItemList::get_item_rect(int p_idx, bool p_expand) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), Rect2());
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), Rect2());
 
-	Rect2 ret = items[p_idx].rect_cache;
+	Rect2 ret = _is_virtual() ? _get_virtual_item_rect(p_idx) : items[p_idx].rect_cache;
 	ret.position += theme_cache.panel_style->get_offset();
 
 	if (p_expand && p_idx % current_columns == current_columns - 1) {
@@ -308,6 +339,7 @@ Rect2 ItemList::get_item_rect(int p_idx, bool p_expand) const {
 }
 
 void ItemList::set_item_tag_icon(int p_idx, const Ref<Texture2D> &p_tag_icon) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -323,6 +355,7 @@ void ItemList::set_item_tag_icon(int p_idx, const Ref<Texture2D> &p_tag_icon) {
 }
 
 void ItemList::set_item_selectable(int p_idx, bool p_selectable) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -332,11 +365,12 @@ void ItemList::set_item_selectable(int p_idx, bool p_selectable) {
 }
 
 bool ItemList::is_item_selectable(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), false);
-	return items[p_idx].selectable;
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), false);
+	return _is_virtual() ? _get_virtual_row(p_idx).selectable : items[p_idx].selectable;
 }
 
 void ItemList::set_item_disabled(int p_idx, bool p_disabled) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -351,11 +385,12 @@ void ItemList::set_item_disabled(int p_idx, bool p_disabled) {
 }
 
 bool ItemList::is_item_disabled(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), false);
-	return items[p_idx].disabled;
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), false);
+	return _is_virtual() ? _get_virtual_row(p_idx).disabled : items[p_idx].disabled;
 }
 
 void ItemList::set_item_metadata(int p_idx, const Variant &p_metadata) {
+	ERR_FAIL_COND_MSG(_is_virtual(), "Items of a virtual ItemList come from item_source and can't be changed.");
 	if (p_idx < 0) {
 		p_idx += get_item_count();
 	}
@@ -371,49 +406,72 @@ void ItemList::set_item_metadata(int p_idx, const Variant &p_metadata) {
 }
 
 Variant ItemList::get_item_metadata(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), Variant());
-	return items[p_idx].metadata;
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), Variant());
+	return _is_virtual() ? _get_virtual_row(p_idx).metadata : items[p_idx].metadata;
+}
+
+void ItemList::_set_item_selected(int p_idx, bool p_selected) {
+	if (!_is_virtual()) {
+		items.write[p_idx].selected = p_selected;
+	} else if (p_selected) {
+		virtual_selected.insert(p_idx);
+	} else {
+		virtual_selected.erase(p_idx);
+	}
 }
 
 void ItemList::select(int p_idx, bool p_single) {
-	ERR_FAIL_INDEX(p_idx, items.size());
+	ERR_FAIL_INDEX(p_idx, get_item_count());
 
+	bool can_select = false;
+	if (_is_virtual()) {
+		const VirtualRow row = _get_virtual_row(p_idx);
+		can_select = row.selectable && !row.disabled;
+	} else {
+		can_select = items[p_idx].selectable && !items[p_idx].disabled;
+	}
 	if (p_single || select_mode == SELECT_SINGLE) {
-		if (!items[p_idx].selectable || items[p_idx].disabled) {
+		if (!can_select) {
 			return;
 		}
 
-		for (int i = 0; i < items.size(); i++) {
-			items.write[i].selected = p_idx == i;
+		if (_is_virtual()) {
+			virtual_selected.clear();
+			virtual_selected.insert(p_idx);
+		} else {
+			for (int i = 0; i < items.size(); i++) {
+				items.write[i].selected = p_idx == i;
+			}
 		}
 
 		current = p_idx;
 		ensure_selected_visible = false;
 	} else {
-		if (items[p_idx].selectable && !items[p_idx].disabled) {
-			items.write[p_idx].selected = true;
+		if (can_select) {
+			_set_item_selected(p_idx, true);
 		}
 	}
 	queue_redraw();
 }
 
 void ItemList::deselect(int p_idx) {
-	ERR_FAIL_INDEX(p_idx, items.size());
+	ERR_FAIL_INDEX(p_idx, get_item_count());
 
 	if (select_mode != SELECT_MULTI) {
-		items.write[p_idx].selected = false;
+		_set_item_selected(p_idx, false);
 		current = -1;
 	} else {
-		items.write[p_idx].selected = false;
+		_set_item_selected(p_idx, false);
 	}
 	queue_redraw();
 }
 
 void ItemList::deselect_all() {
-	if (items.size() < 1) {
+	if (get_item_count() < 1) {
 		return;
 	}
 
+	virtual_selected.clear();
 	for (int i = 0; i < items.size(); i++) {
 		items.write[i].selected = false;
 	}
@@ -422,13 +480,13 @@ void ItemList::deselect_all() {
 }
 
 bool ItemList::is_selected(int p_idx) const {
-	ERR_FAIL_INDEX_V(p_idx, items.size(), false);
+	ERR_FAIL_INDEX_V(p_idx, get_item_count(), false);
 
-	return items[p_idx].selected;
+	return _is_item_selected(p_idx);
 }
 
 void ItemList::set_current(int p_current) {
-	ERR_FAIL_INDEX(p_current, items.size());
+	ERR_FAIL_INDEX(p_current, get_item_count());
 
 	if (current == p_current) {
 		return;
@@ -466,6 +524,33 @@ void ItemList::move_item(int p_from_idx, int p_to_idx) {
 void ItemList::set_item_count(int p_count) {
 	ERR_FAIL_COND(p_count < 0);
 
+	if (_is_virtual()) {
+		if (virtual_item_count == p_count) {
+			return;
+		}
+
+		virtual_item_count = p_count;
+		LocalVector<int> out_of_range;
+		for (const int &E : virtual_selected) {
+			if (E >= p_count) {
+				out_of_range.push_back(E);
+			}
+		}
+		for (const int &E : out_of_range) {
+			virtual_selected.erase(E);
+		}
+		if (current >= p_count) {
+			current = -1;
+		}
+		if (hovered >= p_count) {
+			hovered = -1;
+		}
+		virtual_items.clear();
+		queue_redraw();
+		shape_changed = true;
+		return;
+	}
+
 	if (items.size() == p_count) {
 		return;
 	}
@@ -477,7 +562,7 @@ void ItemList::set_item_count(int p_count) {
 }
 
 int ItemList::get_item_count() const {
-	return items.size();
+	return _is_virtual() ? virtual_item_count : items.size();
 }
 
 void ItemList::remove_item(int p_idx) {
@@ -495,6 +580,8 @@ void ItemList::remove_item(int p_idx) {
 
 void ItemList::clear() {
 	items.clear();
+	virtual_items.clear();
+	virtual_selected.clear();
 	current = -1;
 	ensure_selected_visible = false;
 	queue_redraw();
@@ -639,7 +726,7 @@ Size2 ItemList::Item::get_icon_size() const {
 void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 	ERR_FAIL_COND(p_event.is_null());
 
-#define CAN_SELECT(i) (items[i].selectable && !items[i].disabled)
+#define CAN_SELECT(i) (is_item_selectable(i) && !is_item_disabled(i))
 #define IS_SAME_ROW(i, row) (i / current_columns == row)
 
 	double prev_scroll = scroll_bar->get_value();
@@ -676,16 +763,16 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 		if (closest != -1 && (mb->get_button_index() == MouseButton::LEFT || (allow_rmb_select && mb->get_button_index() == MouseButton::RIGHT))) {
 			int i = closest;
 
-			if (items[i].disabled) {
+			if (is_item_disabled(i)) {
 				// Don't emit any signal or do any action with clicked item when disabled.
 				return;
 			}
 
-			if (select_mode == SELECT_MULTI && items[i].selected && mb->is_command_or_control_pressed()) {
+			if (select_mode == SELECT_MULTI && _is_item_selected(i) && mb->is_command_or_control_pressed()) {
 				deselect(i);
 				emit_signal(SNAME("multi_selected"), i, false);
 
-			} else if (select_mode == SELECT_MULTI && mb->is_shift_pressed() && current >= 0 && current < items.size() && current != i) {
+			} else if (select_mode == SELECT_MULTI && mb->is_shift_pressed() && current >= 0 && current < get_item_count() && current != i) {
 				// Range selection.
 
 				int from = current;
@@ -698,7 +785,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 						// Item is not selectable during a range selection, so skip it.
 						continue;
 					}
-					bool selected = !items[j].selected;
+					bool selected = !_is_item_selected(j);
 					select(j, false);
 					if (selected) {
 						emit_signal(SNAME("multi_selected"), j, true);
@@ -710,14 +797,14 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 				if (!mb->is_double_click() &&
 						!mb->is_command_or_control_pressed() &&
 						select_mode == SELECT_MULTI &&
-						items[i].selectable &&
-						items[i].selected &&
+						is_item_selectable(i) &&
+						_is_item_selected(i) &&
 						mb->get_button_index() == MouseButton::LEFT) {
 					defer_select_single = i;
 					return;
 				}
 
-				if (items[i].selectable && (!items[i].selected || allow_reselect)) {
+				if (is_item_selectable(i) && (!_is_item_selected(i) || allow_reselect)) {
 					select(i, select_mode == SELECT_SINGLE || !mb->is_command_or_control_pressed());
 
 					if (select_mode == SELECT_SINGLE) {
@@ -736,7 +823,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 
 			return;
 		} else if (closest != -1) {
-			if (!items[closest].disabled) {
+			if (!is_item_disabled(closest)) {
 				emit_signal(SNAME("item_clicked"), closest, get_local_mouse_position(), mb->get_button_index());
 			}
 		} else {
@@ -751,7 +838,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 		scroll_bar->set_value(scroll_bar->get_value() + scroll_bar->get_page() * mb->get_factor() / 8);
 	}
 
-	if (p_event->is_pressed() && items.size() > 0) {
+	if (p_event->is_pressed() && get_item_count() > 0) {
 		if (p_event->is_action("ui_up", true)) {
 			if (!search_string.is_empty()) {
 				uint64_t now = OS::get_singleton()->get_ticks_msec();
@@ -759,7 +846,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 
 				if (diff < uint64_t(GLOBAL_GET("gui/timers/incremental_search_max_interval_msec")) * 2) {
 					for (int i = current - 1; i >= 0; i--) {
-						if (CAN_SELECT(i) && items[i].text.begins_with(search_string)) {
+						if (CAN_SELECT(i) && get_item_text(i).begins_with(search_string)) {
 							set_current(i);
 							ensure_current_is_visible();
 							if (select_mode == SELECT_SINGLE) {
@@ -796,8 +883,8 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 				uint64_t diff = now - search_time_msec;
 
 				if (diff < uint64_t(GLOBAL_GET("gui/timers/incremental_search_max_interval_msec")) * 2) {
-					for (int i = current + 1; i < items.size(); i++) {
-						if (CAN_SELECT(i) && items[i].text.begins_with(search_string)) {
+					for (int i = current + 1; i < get_item_count(); i++) {
+						if (CAN_SELECT(i) && get_item_text(i).begins_with(search_string)) {
 							set_current(i);
 							ensure_current_is_visible();
 							if (select_mode == SELECT_SINGLE) {
@@ -811,12 +898,12 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 				}
 			}
 
-			if (current < items.size() - current_columns) {
+			if (current < get_item_count() - current_columns) {
 				int next = current + current_columns;
-				while (next < items.size() && !CAN_SELECT(next)) {
+				while (next < get_item_count() && !CAN_SELECT(next)) {
 					next = next + current_columns;
 				}
-				if (next >= items.size()) {
+				if (next >= get_item_count()) {
 					accept_event();
 					return;
 				}
@@ -832,7 +919,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 
 			for (int i = 4; i > 0; i--) {
 				int index = current - current_columns * i;
-				if (index >= 0 && index < items.size() && CAN_SELECT(index)) {
+				if (index >= 0 && index < get_item_count() && CAN_SELECT(index)) {
 					set_current(index);
 					ensure_current_is_visible();
 					if (select_mode == SELECT_SINGLE) {
@@ -847,7 +934,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 
 			for (int i = 4; i > 0; i--) {
 				int index = current + current_columns * i;
-				if (index >= 0 && index < items.size() && CAN_SELECT(index)) {
+				if (index >= 0 && index < get_item_count() && CAN_SELECT(index)) {
 					set_current(index);
 					ensure_current_is_visible();
 					if (select_mode == SELECT_SINGLE) {
@@ -881,13 +968,13 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 		} else if (p_event->is_action("ui_right", true)) {
 			search_string = ""; //any mousepress cancels
 
-			if (current % current_columns != (current_columns - 1) && current + 1 < items.size()) {
+			if (current % current_columns != (current_columns - 1) && current + 1 < get_item_count()) {
 				int current_row = current / current_columns;
 				int next = current + 1;
-				while (next < items.size() && !CAN_SELECT(next)) {
+				while (next < get_item_count() && !CAN_SELECT(next)) {
 					next = next + 1;
 				}
-				if (items.size() <= next || !IS_SAME_ROW(next, current_row)) {
+				if (get_item_count() <= next || !IS_SAME_ROW(next, current_row)) {
 					accept_event();
 					return;
 				}
@@ -901,11 +988,11 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 		} else if (p_event->is_action("ui_cancel", true)) {
 			search_string = "";
 		} else if (p_event->is_action("ui_select", true) && select_mode == SELECT_MULTI) {
-			if (current >= 0 && current < items.size()) {
-				if (CAN_SELECT(current) && !items[current].selected) {
+			if (current >= 0 && current < get_item_count()) {
+				if (CAN_SELECT(current) && !_is_item_selected(current)) {
 					select(current, false);
 					emit_signal(SNAME("multi_selected"), current, true);
-				} else if (items[current].selected) {
+				} else if (_is_item_selected(current)) {
 					deselect(current);
 					emit_signal(SNAME("multi_selected"), current, false);
 				}
@@ -913,13 +1000,13 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 		} else if (p_event->is_action("ui_accept", true)) {
 			search_string = ""; //any mousepress cancels
 
-			if (current >= 0 && current < items.size() && !items[current].disabled) {
+			if (current >= 0 && current < get_item_count() && !is_item_disabled(current)) {
 				emit_signal(SNAME("item_activated"), current);
 			}
 		} else {
 			Ref<InputEventKey> k = p_event;
 
-			if (allow_search && k.is_valid() && k->get_unicode()) {
+			if (allow_search && !_is_virtual() && k.is_valid() && k->get_unicode()) {
 				uint64_t now = OS::get_singleton()->get_ticks_msec();
 				uint64_t diff = now - search_time_msec;
 				uint64_t max_interval = uint64_t(GLOBAL_GET("gui/timers/incremental_search_max_interval_msec"));
@@ -933,8 +1020,8 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 					search_string += String::chr(k->get_unicode());
 				}
 
-				for (int i = current + 1; i <= items.size(); i++) {
-					if (i == items.size()) {
+				for (int i = current + 1; i <= get_item_count(); i++) {
+					if (i == get_item_count()) {
 						if (current == 0 || current == -1) {
 							break;
 						} else {
@@ -946,7 +1033,7 @@ void ItemList::gui_input(const Ref<InputEvent> &p_event) {
 						break;
 					}
 
-					if (items[i].text.findn(search_string) == 0) {
+					if (get_item_text(i).findn(search_string) == 0) {
 						set_current(i);
 						ensure_current_is_visible();
 						if (select_mode == SELECT_SINGLE) {
@@ -993,6 +1080,192 @@ static Rect2 _adjust_to_max_size(Size2 p_size, Size2 p_max_size) {
 	return Rect2(ofs_x, ofs_y, tex_width, tex_height);
 }
 
+void ItemList::_draw_item(int p_idx, Item &p_item, bool p_selected, const Rect2 &p_rect, const Vector2 &p_base_ofs, const Size2 &p_size, int p_width, bool p_rtl, const Ref<StyleBox> &p_sbsel, const Ref<StyleBox> &p_cursor) {
+	Rect2 rcache = p_rect;
+
+	if (current_columns == 1) {
+		rcache.size.width = p_width - rcache.position.x;
+	}
+
+	bool should_draw_selected_bg = p_selected;
+	bool should_draw_hovered_bg = hovered == p_idx && !p_selected;
+	bool should_draw_custom_bg = p_item.custom_bg.a > 0.001;
+
+	if (should_draw_selected_bg || should_draw_hovered_bg || should_draw_custom_bg) {
+		Rect2 r = rcache;
+		r.position += p_base_ofs;
+		r.position.y -= theme_cache.v_separation / 2;
+		r.size.y += theme_cache.v_separation;
+		r.position.x -= theme_cache.h_separation / 2;
+		r.size.x += theme_cache.h_separation;
+
+		if (p_rtl) {
+			r.position.x = p_size.width - r.position.x - r.size.x;
+		}
+
+		if (should_draw_selected_bg) {
+			draw_style_box(p_sbsel, r);
+		}
+		if (should_draw_hovered_bg) {
+			draw_style_box(theme_cache.hovered_style, r);
+		}
+		if (should_draw_custom_bg) {
+			draw_rect(r, p_item.custom_bg);
+		}
+	}
+
+	Vector2 text_ofs;
+	if (p_item.icon.is_valid()) {
+		Size2 icon_size;
+		//= _adjust_to_max_size(p_item.get_icon_size(),fixed_icon_size) * icon_scale;
+
+		if (fixed_icon_size.x > 0 && fixed_icon_size.y > 0) {
+			icon_size = fixed_icon_size * icon_scale;
+		} else {
+			icon_size = p_item.get_icon_size() * icon_scale;
+		}
+
+		Vector2 icon_ofs;
+
+		Point2 pos = p_item.rect_cache.position + icon_ofs + p_base_ofs;
+
+		if (icon_mode == ICON_MODE_TOP) {
+			pos.x += Math::floor((p_item.rect_cache.size.width - icon_size.width) / 2);
+			pos.y += theme_cache.icon_margin;
+			text_ofs.y = icon_size.height + theme_cache.icon_margin * 2;
+		} else {
+			pos.y += Math::floor((p_item.rect_cache.size.height - icon_size.height) / 2);
+			text_ofs.x = icon_size.width + theme_cache.icon_margin;
+		}
+
+		Rect2 draw_rect = Rect2(pos, icon_size);
+
+		if (fixed_icon_size.x > 0 && fixed_icon_size.y > 0) {
+			Rect2 adj = _adjust_to_max_size(p_item.get_icon_size() * icon_scale, icon_size);
+			draw_rect.position += adj.position;
+			draw_rect.size = adj.size;
+		}
+
+		Color icon_modulate = p_item.icon_modulate;
+		if (p_item.disabled) {
+			icon_modulate.a *= 0.5;
+		}
+
+		// If the icon is transposed, we have to switch the size so that it is drawn correctly
+		if (p_item.icon_transposed) {
+			Size2 size_tmp = draw_rect.size;
+			draw_rect.size.x = size_tmp.y;
+			draw_rect.size.y = size_tmp.x;
+		}
+
+		Rect2 region = (p_item.icon_region.size.x == 0 || p_item.icon_region.size.y == 0) ? Rect2(Vector2(), p_item.icon->get_size()) : Rect2(p_item.icon_region);
+
+		if (p_rtl) {
+			draw_rect.position.x = p_size.width - draw_rect.position.x - draw_rect.size.x;
+		}
+		draw_texture_rect_region(p_item.icon, draw_rect, region, icon_modulate, p_item.icon_transposed);
+	}
+
+	if (p_item.tag_icon.is_valid()) {
+		Point2 draw_pos = p_item.rect_cache.position;
+		if (p_rtl) {
+			draw_pos.x = p_size.width - draw_pos.x - p_item.tag_icon->get_width();
+		}
+		draw_texture(p_item.tag_icon, draw_pos + p_base_ofs);
+	}
+
+	if (!p_item.text.is_empty()) {
+		int max_len = -1;
+
+		Vector2 size2 = p_item.text_buf->get_size();
+		if (fixed_column_width) {
+			max_len = fixed_column_width;
+		} else if (same_column_width) {
+			max_len = p_item.rect_cache.size.x;
+		} else {
+			max_len = size2.x;
+		}
+
+		Color txt_modulate;
+		if (p_selected) {
+			txt_modulate = theme_cache.font_selected_color;
+		} else if (hovered == p_idx) {
+			txt_modulate = theme_cache.font_hovered_color;
+		} else if (p_item.custom_fg != Color()) {
+			txt_modulate = p_item.custom_fg;
+		} else {
+			txt_modulate = theme_cache.font_color;
+		}
+
+		if (p_item.disabled) {
+			txt_modulate.a *= 0.5;
+		}
+
+		if (icon_mode == ICON_MODE_TOP && max_text_lines > 0) {
+			text_ofs += p_base_ofs;
+			text_ofs += p_item.rect_cache.position;
+
+			if (p_rtl) {
+				text_ofs.x = p_size.width - text_ofs.x - max_len;
+			}
+
+			p_item.text_buf->set_alignment(HORIZONTAL_ALIGNMENT_CENTER);
+
+			if (theme_cache.font_outline_size > 0 && theme_cache.font_outline_color.a > 0) {
+				p_item.text_buf->draw_outline(get_canvas_item(), text_ofs, theme_cache.font_outline_size, theme_cache.font_outline_color);
+			}
+
+			p_item.text_buf->draw(get_canvas_item(), text_ofs, txt_modulate);
+		} else {
+			if (fixed_column_width > 0) {
+				size2.x = MIN(size2.x, fixed_column_width);
+			}
+
+			if (icon_mode == ICON_MODE_TOP) {
+				text_ofs.x += (p_item.rect_cache.size.width - size2.x) / 2;
+			} else {
+				text_ofs.y += (p_item.rect_cache.size.height - size2.y) / 2;
+			}
+
+			text_ofs += p_base_ofs;
+			text_ofs += p_item.rect_cache.position;
+
+			float text_w = p_width - text_ofs.x;
+			p_item.text_buf->set_width(text_w);
+
+			if (p_rtl) {
+				text_ofs.x = p_size.width - p_width;
+				p_item.text_buf->set_alignment(HORIZONTAL_ALIGNMENT_RIGHT);
+			} else {
+				p_item.text_buf->set_alignment(HORIZONTAL_ALIGNMENT_LEFT);
+			}
+
+			if (theme_cache.font_outline_size > 0 && theme_cache.font_outline_color.a > 0) {
+				p_item.text_buf->draw_outline(get_canvas_item(), text_ofs, theme_cache.font_outline_size, theme_cache.font_outline_color);
+			}
+
+			if (p_width - text_ofs.x > 0) {
+				p_item.text_buf->draw(get_canvas_item(), text_ofs, txt_modulate);
+			}
+		}
+	}
+
+	if (select_mode == SELECT_MULTI && p_idx == current) {
+		Rect2 r = rcache;
+		r.position += p_base_ofs;
+		r.position.y -= theme_cache.v_separation / 2;
+		r.size.y += theme_cache.v_separation;
+		r.position.x -= theme_cache.h_separation / 2;
+		r.size.x += theme_cache.h_separation;
+
+		if (p_rtl) {
+			r.position.x = p_size.width - r.position.x - r.size.x;
+		}
+
+		draw_style_box(p_cursor, r);
+	}
+}
+
 void ItemList::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_RESIZED: {
@@ -1006,6 +1279,7 @@ void ItemList::_notification(int p_what) {
 			for (int i = 0; i < items.size(); i++) {
 				_shape_text(i);
 			}
+			virtual_items.clear();
 			shape_changed = true;
 			queue_redraw();
 		} break;
@@ -1045,6 +1319,50 @@ void ItemList::_notification(int p_what) {
 				RenderingServer::get_singleton()->canvas_item_add_clip_ignore(get_canvas_item(), false);
 			}
 
+			if (_is_virtual()) {
+				const double stride = _get_virtual_row_stride();
+				const double page = scroll_bar->get_page();
+
+				if (ensure_selected_visible && current >= 0 && current < virtual_item_count) {
+					double top = current * stride;
+					double from = scroll_bar->get_value();
+
+					if (top < from) {
+						scroll_bar->set_value(top);
+					} else if (top + virtual_row_height > from + page) {
+						scroll_bar->set_value(top + virtual_row_height - page);
+					}
+				}
+
+				ensure_selected_visible = false;
+
+				_update_virtual_items();
+
+				// Rows are placed relative to the scroll offset rather than to the top of
+				// the list, so positions keep their precision in very long lists.
+				const Vector2 base_ofs = theme_cache.panel_style->get_offset();
+				const double scroll = scroll_bar->get_value();
+
+				for (int i = MAX(0, int(scroll / stride)); i < virtual_item_count; i++) {
+					const double y = i * stride - scroll;
+					if (y > size.height) {
+						break; // done
+					}
+
+					Item *item = _get_cached_virtual_item(i);
+					ERR_CONTINUE(!item);
+
+					item->rect_cache = Rect2(0, y, width, virtual_row_height);
+					_draw_item(i, *item, virtual_selected.has(i), item->rect_cache, base_ofs, size, width, rtl, sbsel, cursor);
+
+					if (icon_mode != ICON_MODE_TOP && i < virtual_item_count - 1) {
+						const int sep_y = base_ofs.y + y + virtual_row_height + theme_cache.v_separation / 2;
+						draw_line(Vector2(theme_cache.panel_style->get_margin(SIDE_LEFT), sep_y), Vector2(width, sep_y), theme_cache.guide_color);
+					}
+				}
+				break;
+			}
+
 			// Ensure_selected_visible needs to be checked before we draw the list.
 			if (ensure_selected_visible && current >= 0 && current < items.size()) {
 				Rect2 r = items[current].rect_cache;
@@ -1130,193 +1448,21 @@ void ItemList::_notification(int p_what) {
 					continue;
 				}
 
-				if (current_columns == 1) {
-					rcache.size.width = width - rcache.position.x;
-				}
-
-				bool should_draw_selected_bg = items[i].selected;
-				bool should_draw_hovered_bg = hovered == i && !items[i].selected;
-				bool should_draw_custom_bg = items[i].custom_bg.a > 0.001;
-
-				if (should_draw_selected_bg || should_draw_hovered_bg || should_draw_custom_bg) {
-					Rect2 r = rcache;
-					r.position += base_ofs;
-					r.position.y -= theme_cache.v_separation / 2;
-					r.size.y += theme_cache.v_separation;
-					r.position.x -= theme_cache.h_separation / 2;
-					r.size.x += theme_cache.h_separation;
-
-					if (rtl) {
-						r.position.x = size.width - r.position.x - r.size.x;
-					}
-
-					if (should_draw_selected_bg) {
-						draw_style_box(sbsel, r);
-					}
-					if (should_draw_hovered_bg) {
-						draw_style_box(theme_cache.hovered_style, r);
-					}
-					if (should_draw_custom_bg) {
-						draw_rect(r, items[i].custom_bg);
-					}
-				}
-
-				Vector2 text_ofs;
-				if (items[i].icon.is_valid()) {
-					Size2 icon_size;
-					//= _adjust_to_max_size(items[i].get_icon_size(),fixed_icon_size) * icon_scale;
-
-					if (fixed_icon_size.x > 0 && fixed_icon_size.y > 0) {
-						icon_size = fixed_icon_size * icon_scale;
-					} else {
-						icon_size = items[i].get_icon_size() * icon_scale;
-					}
-
-					Vector2 icon_ofs;
-
-					Point2 pos = items[i].rect_cache.position + icon_ofs + base_ofs;
-
-					if (icon_mode == ICON_MODE_TOP) {
-						pos.x += Math::floor((items[i].rect_cache.size.width - icon_size.width) / 2);
-						pos.y += theme_cache.icon_margin;
-						text_ofs.y = icon_size.height + theme_cache.icon_margin * 2;
-					} else {
-						pos.y += Math::floor((items[i].rect_cache.size.height - icon_size.height) / 2);
-						text_ofs.x = icon_size.width + theme_cache.icon_margin;
-					}
-
-					Rect2 draw_rect = Rect2(pos, icon_size);
-
-					if (fixed_icon_size.x > 0 && fixed_icon_size.y > 0) {
-						Rect2 adj = _adjust_to_max_size(items[i].get_icon_size() * icon_scale, icon_size);
-						draw_rect.position += adj.position;
-						draw_rect.size = adj.size;
-					}
-
-					Color icon_modulate = items[i].icon_modulate;
-					if (items[i].disabled) {
-						icon_modulate.a *= 0.5;
-					}
-
-					// If the icon is transposed, we have to switch the size so that it is drawn correctly
-					if (items[i].icon_transposed) {
-						Size2 size_tmp = draw_rect.size;
-						draw_rect.size.x = size_tmp.y;
-						draw_rect.size.y = size_tmp.x;
-					}
-
-					Rect2 region = (items[i].icon_region.size.x == 0 || items[i].icon_region.size.y == 0) ? Rect2(Vector2(), items[i].icon->get_size()) : Rect2(items[i].icon_region);
-
-					if (rtl) {
-						draw_rect.position.x = size.width - draw_rect.position.x - draw_rect.size.x;
-					}
-					draw_texture_rect_region(items[i].icon, draw_rect, region, icon_modulate, items[i].icon_transposed);
-				}
-
-				if (items[i].tag_icon.is_valid()) {
-					Point2 draw_pos = items[i].rect_cache.position;
-					if (rtl) {
-						draw_pos.x = size.width - draw_pos.x - items[i].tag_icon->get_width();
-					}
-					draw_texture(items[i].tag_icon, draw_pos + base_ofs);
-				}
-
-				if (!items[i].text.is_empty()) {
-					int max_len = -1;
-
-					Vector2 size2 = items[i].text_buf->get_size();
-					if (fixed_column_width) {
-						max_len = fixed_column_width;
-					} else if (same_column_width) {
-						max_len = items[i].rect_cache.size.x;
-					} else {
-						max_len = size2.x;
-					}
-
-					Color txt_modulate;
-					if (items[i].selected) {
-						txt_modulate = theme_cache.font_selected_color;
-					} else if (hovered == i) {
-						txt_modulate = theme_cache.font_hovered_color;
-					} else if (items[i].custom_fg != Color()) {
-						txt_modulate = items[i].custom_fg;
-					} else {
-						txt_modulate = theme_cache.font_color;
-					}
-
-					if (items[i].disabled) {
-						txt_modulate.a *= 0.5;
-					}
-
-					if (icon_mode == ICON_MODE_TOP && max_text_lines > 0) {
-						text_ofs += base_ofs;
-						text_ofs += items[i].rect_cache.position;
-
-						if (rtl) {
-							text_ofs.x = size.width - text_ofs.x - max_len;
-						}
-
-						items.write[i].text_buf->set_alignment(HORIZONTAL_ALIGNMENT_CENTER);
-
-						if (theme_cache.font_outline_size > 0 && theme_cache.font_outline_color.a > 0) {
-							items[i].text_buf->draw_outline(get_canvas_item(), text_ofs, theme_cache.font_outline_size, theme_cache.font_outline_color);
-						}
-
-						items[i].text_buf->draw(get_canvas_item(), text_ofs, txt_modulate);
-					} else {
-						if (fixed_column_width > 0) {
-							size2.x = MIN(size2.x, fixed_column_width);
-						}
-
-						if (icon_mode == ICON_MODE_TOP) {
-							text_ofs.x += (items[i].rect_cache.size.width - size2.x) / 2;
-						} else {
-							text_ofs.y += (items[i].rect_cache.size.height - size2.y) / 2;
-						}
-
-						text_ofs += base_ofs;
-						text_ofs += items[i].rect_cache.position;
-
-						float text_w = width - text_ofs.x;
-						items.write[i].text_buf->set_width(text_w);
-
-						if (rtl) {
-							text_ofs.x = size.width - width;
-							items.write[i].text_buf->set_alignment(HORIZONTAL_ALIGNMENT_RIGHT);
-						} else {
-							items.write[i].text_buf->set_alignment(HORIZONTAL_ALIGNMENT_LEFT);
-						}
-
-						if (theme_cache.font_outline_size > 0 && theme_cache.font_outline_color.a > 0) {
-							items[i].text_buf->draw_outline(get_canvas_item(), text_ofs, theme_cache.font_outline_size, theme_cache.font_outline_color);
-						}
-
-						if (width - text_ofs.x > 0) {
-							items[i].text_buf->draw(get_canvas_item(), text_ofs, txt_modulate);
-						}
-					}
-				}
-
-				if (select_mode == SELECT_MULTI && i == current) {
-					Rect2 r = rcache;
-					r.position += base_ofs;
-					r.position.y -= theme_cache.v_separation / 2;
-					r.size.y += theme_cache.v_separation;
-					r.position.x -= theme_cache.h_separation / 2;
-					r.size.x += theme_cache.h_separation;
-
-					if (rtl) {
-						r.position.x = size.width - r.position.x - r.size.x;
-					}
-
-					draw_style_box(cursor, r);
-				}
+				_draw_item(i, items.write[i], items[i].selected, rcache, base_ofs, size, width, rtl, sbsel, cursor);
 			}
 		} break;
 	}
 }
 
 void ItemList::force_update_list_size() {
+	if (_is_virtual()) {
+		if (shape_changed) {
+			_update_virtual_list_size();
+		}
+		_update_virtual_items();
+		return;
+	}
+
 	if (!shape_changed) {
 		return;
 	}
@@ -1461,6 +1607,177 @@ void ItemList::force_update_list_size() {
 	shape_changed = false;
 }
 
+void ItemList::_fetch_virtual_row(int p_idx, VirtualRow &r_row) const {
+	Variant data = item_source.call(p_idx);
+
+	if (data.get_type() == Variant::DICTIONARY) {
+		Dictionary d = data;
+		r_row.text = d.get("text", String());
+		r_row.icon = d.get("icon", Ref<Texture2D>());
+		r_row.tooltip = d.get("tooltip", String());
+		r_row.selectable = d.get("selectable", true);
+		r_row.disabled = d.get("disabled", false);
+		r_row.metadata = d.get("metadata", Variant());
+		r_row.custom_fg = d.get("custom_fg_color", Color());
+		r_row.custom_bg = d.get("custom_bg_color", Color(0.0, 0.0, 0.0, 0.0));
+	} else {
+		r_row.text = data;
+	}
+}
+
+ItemList::Item *ItemList::_get_cached_virtual_item(int p_idx) const {
+	if (p_idx < virtual_window_from || p_idx >= virtual_window_to) {
+		return nullptr;
+	}
+
+	Item *cached = virtual_items.getptr(p_idx);
+	if (cached) {
+		return cached;
+	}
+
+	VirtualRow row;
+	_fetch_virtual_row(p_idx, row);
+	Item &item = virtual_items.insert(p_idx, Item())->value;
+	item.icon = row.icon;
+	item.text = row.text;
+	item.selectable = row.selectable;
+	item.disabled = row.disabled;
+	item.metadata = row.metadata;
+	item.tooltip = row.tooltip;
+	item.custom_fg = row.custom_fg;
+	item.custom_bg = row.custom_bg;
+	_shape_item_text(item);
+	return &item;
+}
+
+ItemList::VirtualRow ItemList::_get_virtual_row(int p_idx) const {
+	VirtualRow row;
+	const Item *cached = _get_cached_virtual_item(p_idx);
+	if (cached) {
+		row.icon = cached->icon;
+		row.text = cached->text;
+		row.selectable = cached->selectable;
+		row.disabled = cached->disabled;
+		row.metadata = cached->metadata;
+		row.tooltip = cached->tooltip;
+		row.custom_fg = cached->custom_fg;
+		row.custom_bg = cached->custom_bg;
+		return row;
+	}
+
+	// Rows away from the visible area are only inspected (for selection, tooltips,
+	// keyboard navigation...), so they are neither kept nor shaped.
+	_fetch_virtual_row(p_idx, row);
+	return row;
+}
+
+Rect2 ItemList::_get_virtual_item_rect(int p_idx) const {
+	int width = get_size().width - theme_cache.panel_style->get_minimum_size().width;
+	if (scroll_bar->is_visible()) {
+		width -= scroll_bar->get_minimum_size().x;
+	}
+	return Rect2(0, p_idx * _get_virtual_row_stride(), width, virtual_row_height);
+}
+
+void ItemList::_update_virtual_list_size() {
+	// Every row has the same height, so the layout doesn't depend on the rows themselves.
+	int content_height = 0;
+	if (theme_cache.font.is_valid()) {
+		content_height = theme_cache.font->get_height(theme_cache.font_size);
+	}
+	if (fixed_icon_size.y > 0) {
+		content_height = MAX(content_height, int(fixed_icon_size.y * icon_scale));
+	}
+	virtual_row_height = content_height + theme_cache.v_separation;
+
+	current_columns = 1;
+	separators.clear();
+	virtual_items.clear();
+
+	Size2 size = get_size();
+	double total = virtual_item_count > 0 ? virtual_item_count * _get_virtual_row_stride() - theme_cache.v_separation : 0;
+	double page = MAX(0, size.height - theme_cache.panel_style->get_minimum_size().height);
+	double max = MAX(page, total);
+	if (auto_height) {
+		auto_height_value = total + theme_cache.panel_style->get_minimum_size().height;
+	}
+	scroll_bar->set_max(max);
+	scroll_bar->set_page(page);
+	if (max <= page) {
+		scroll_bar->set_value(0);
+		scroll_bar->hide();
+	} else {
+		scroll_bar->show();
+
+		if (do_autoscroll_to_bottom) {
+			scroll_bar->set_value(max);
+		}
+	}
+
+	update_minimum_size();
+	shape_changed = false;
+}
+
+void ItemList::_update_virtual_items() {
+	const double stride = _get_virtual_row_stride();
+	if (stride <= 0 || virtual_item_count == 0) {
+		virtual_window_from = 0;
+		virtual_window_to = 0;
+		virtual_items.clear();
+		return;
+	}
+
+	const double scroll = scroll_bar->get_value();
+	int first = CLAMP(int(scroll / stride), 0, virtual_item_count - 1);
+	int last = CLAMP(int((scroll + scroll_bar->get_page()) / stride), first, virtual_item_count - 1);
+
+	// Keep a page worth of rows on each side, so scrolling by small steps reuses
+	// the rows that were already requested and shaped.
+	int margin = last - first + 1;
+	virtual_window_from = MAX(0, first - margin);
+	virtual_window_to = MIN(virtual_item_count, last + 1 + margin);
+
+	LocalVector<int> evicted;
+	for (const KeyValue<int, Item> &E : virtual_items) {
+		if (E.key < virtual_window_from || E.key >= virtual_window_to) {
+			evicted.push_back(E.key);
+		}
+	}
+	for (const int &E : evicted) {
+		virtual_items.erase(E);
+	}
+}
+
+void ItemList::set_item_source(const Callable &p_source) {
+	if (item_source == p_source) {
+		return;
+	}
+
+	item_source = p_source;
+	if (!_is_virtual()) {
+		virtual_item_count = 0;
+	}
+
+	virtual_items.clear();
+	virtual_selected.clear();
+	virtual_window_from = 0;
+	virtual_window_to = 0;
+	current = -1;
+	hovered = -1;
+	defer_select_single = -1;
+	queue_redraw();
+	shape_changed = true;
+}
+
+Callable ItemList::get_item_source() const {
+	return item_source;
+}
+
+void ItemList::refresh_virtual_items() {
+	virtual_items.clear();
+	queue_redraw();
+}
+
 void ItemList::_scroll_changed(double) {
 	queue_redraw();
 }
@@ -1481,6 +1798,21 @@ int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
 		pos.x = get_size().width - pos.x;
 	}
 
+	if (_is_virtual()) {
+		if (virtual_item_count == 0) {
+			return -1;
+		}
+
+		// Computed from the scroll offset in double precision, see NOTIFICATION_DRAW.
+		const double stride = _get_virtual_row_stride();
+		const double y = p_pos.y - theme_cache.panel_style->get_offset().y + scroll_bar->get_value();
+		int row = CLAMP(int(Math::floor(y / stride)), 0, virtual_item_count - 1);
+		if (p_exact && (y < 0 || y >= virtual_item_count * stride || y - row * stride > virtual_row_height)) {
+			return -1;
+		}
+		return row;
+	}
+
 	int closest = -1;
 	int closest_dist = 0x7FFFFFFF;
 
@@ -1506,10 +1838,15 @@ int ItemList::get_item_at_position(const Point2 &p_pos, bool p_exact) const {
 }
 
 bool ItemList::is_pos_at_end_of_items(const Point2 &p_pos) const {
-	if (items.is_empty()) {
+	if (get_item_count() == 0) {
 		return true;
 	}
 
+	if (_is_virtual()) {
+		const double y = p_pos.y - theme_cache.panel_style->get_offset().y + scroll_bar->get_value();
+		return y > (virtual_item_count - 1) * _get_virtual_row_stride() + virtual_row_height;
+	}
+
 	Vector2 pos = p_pos;
 	pos -= theme_cache.panel_style->get_offset();
 	pos.y += scroll_bar->get_value();
@@ -1526,14 +1863,19 @@ String ItemList::get_tooltip(const Point2 &p_pos) const {
 	int closest = get_item_at_position(p_pos, true);
 
 	if (closest != -1) {
-		if (!items[closest].tooltip_enabled) {
+		if (_is_virtual()) {
+			const VirtualRow row = _get_virtual_row(closest);
+			return row.tooltip.is_empty() ? row.text : row.tooltip;
+		}
+		const Item &item = items[closest];
+		if (!item.tooltip_enabled) {
 			return "";
 		}
-		if (!items[closest].tooltip.is_empty()) {
-			return items[closest].tooltip;
+		if (!item.tooltip.is_empty()) {
+			return item.tooltip;
 		}
-		if (!items[closest].text.is_empty()) {
-			return items[closest].text;
+		if (!item.text.is_empty()) {
+			return item.text;
 		}
 	}
 
@@ -1607,6 +1949,14 @@ real_t ItemList::get_icon_scale() const {
 
 Vector<int> ItemList::get_selected_items() {
 	Vector<int> selected;
+	if (_is_virtual()) {
+		for (const int &E : virtual_selected) {
+			selected.push_back(E);
+		}
+		selected.sort();
+		return selected;
+	}
+
 	for (int i = 0; i < items.size(); i++) {
 		if (items[i].selected) {
 			selected.push_back(i);
@@ -1619,6 +1969,10 @@ Vector<int> ItemList::get_selected_items() {
 }
 
 bool ItemList::is_anything_selected() {
+	if (_is_virtual()) {
+		return !virtual_selected.is_empty();
+	}
+
 	for (int i = 0; i < items.size(); i++) {
 		if (items[i].selected) {
 			return true;
@@ -1789,6 +2143,10 @@ void ItemList::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_item_count"), &ItemList::get_item_count);
 	ClassDB::bind_method(D_METHOD("remove_item", "idx"), &ItemList::remove_item);
 
+	ClassDB::bind_method(D_METHOD("set_item_source", "source"), &ItemList::set_item_source);
+	ClassDB::bind_method(D_METHOD("get_item_source"), &ItemList::get_item_source);
+	ClassDB::bind_method(D_METHOD("refresh_virtual_items"), &ItemList::refresh_virtual_items);
+
 	ClassDB::bind_method(D_METHOD("clear"), &ItemList::clear);
 	ClassDB::bind_method(D_METHOD("sort_items_by_text"), &ItemList::sort_items_by_text);
 
@@ -1848,6 +2206,7 @@ void ItemList::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_text_lines", PROPERTY_HINT_RANGE, "1,10,1,or_greater"), "set_max_text_lines", "get_max_text_lines");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "auto_height"), "set_auto_height", "has_auto_height");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "text_overrun_behavior", PROPERTY_HINT_ENUM, "Trim Nothing,Trim Characters,Trim Words,Ellipsis,Word Ellipsis"), "set_text_overrun_behavior", "get_text_overrun_behavior");
+	ADD_PROPERTY(PropertyInfo(Variant::CALLABLE, "item_source", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NONE), "set_item_source", "get_item_source");
 	ADD_ARRAY_COUNT("Items", "item_count", "set_item_count", "get_item_count", "item_");
 	ADD_GROUP("Columns", "");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_columns", PROPERTY_HINT_RANGE, "0,10,1,or_greater"), "set_max_columns", "get_max_columns");
@@ -83,6 +83,19 @@ private:
 		}
 	};
 
+	// The fields of an item that item_source can provide. Rows away from the visible area
+	// are read into this instead of an Item, which would also allocate a text buffer.
+	struct VirtualRow {
+		Ref<Texture2D> icon;
+		String text;
+		bool selectable = true;
+		bool disabled = false;
+		Variant metadata;
+		String tooltip;
+		Color custom_fg;
+		Color custom_bg = Color(0.0, 0.0, 0.0, 0.0);
+	};
+
 	int current = -1;
 	int hovered = -1;
 
@@ -122,6 +135,17 @@ private:
 
 	bool do_autoscroll_to_bottom = false;
 
+	// Virtual mode. Rows are requested from item_source when needed instead of being
+	// stored, and only the rows around the visible area keep shaped text, so memory
+	// stays proportional to the visible rows rather than to the item count.
+	Callable item_source;
+	int virtual_item_count = 0;
+	int virtual_row_height = 0; // Like rect_cache, includes v_separation.
+	int virtual_window_from = 0;
+	int virtual_window_to = 0;
+	mutable HashMap<int, Item> virtual_items;
+	HashSet<int> virtual_selected;
+
 	struct ThemeCache {
 		int h_separation = 0;
 		int v_separation = 0;
@@ -149,8 +173,23 @@ private:
 
 	void _scroll_changed(double);
 	void _shape_text(int p_idx);
+	void _shape_item_text(Item &p_item) const;
 	void _mouse_exited();
 
+	_FORCE_INLINE_ bool _is_virtual() const { return item_source.is_valid(); }
+	void _fetch_virtual_row(int p_idx, VirtualRow &r_row) const;
+	Item *_get_cached_virtual_item(int p_idx) const;
+	VirtualRow _get_virtual_row(int p_idx) const;
+	double _get_virtual_row_stride() const { return virtual_row_height + theme_cache.v_separation; }
+	Rect2 _get_virtual_item_rect(int p_idx) const;
+	void _update_virtual_list_size();
+	void _update_virtual_items();
+
+	_FORCE_INLINE_ bool _is_item_selected(int p_idx) const { return _is_virtual() ? virtual_selected.has(p_idx) : items[p_idx].selected; }
+	void _set_item_selected(int p_idx, bool p_selected);
+
+	void _draw_item(int p_idx, Item &p_item, bool p_selected, const Rect2 &p_rect, const Vector2 &p_base_ofs, const Size2 &p_size, int p_width, bool p_rtl, const Ref<StyleBox> &p_sbsel, const Ref<StyleBox> &p_cursor);
+
 protected:
 	void _notification(int p_what);
 	bool _set(const StringName &p_name, const Variant &p_value);
@@ -227,6 +266,11 @@ public:
 
 	void set_item_count(int p_count);
 	int get_item_count() const;
+
+	void set_item_source(const Callable &p_source);
+	Callable get_item_source() const;
+	void refresh_virtual_items();
+	int get_cached_virtual_item_count() const { return virtual_items.size(); }
 	void remove_item(int p_idx);
 
 	void clear();
@@ -1855,7 +1855,12 @@ void RichTextLabel::_notification(int p_what) {
 
 		case NOTIFICATION_RESIZED: {
 			_stop_thread();
-			main->first_resized_line.store(0); //invalidate ALL
+			if (_get_text_rect().size.width != layout_width) {
+				main->first_resized_line.store(0); //invalidate ALL
+			} else {
+				// Only the height has changed, the last paragraph is enough to update the scroll bar.
+				main->first_resized_line.store(MIN(main->first_resized_line.load(), (int)main->lines.size() - 1));
+			}
 			queue_redraw();
 		} break;
 
@@ -2867,7 +2872,7 @@ int RichTextLabel::get_progress_bar_delay() const {
 	return progress_delay;
 }
 
-_FORCE_INLINE_ float RichTextLabel::_update_scroll_exceeds(float p_total_height, float p_ctrl_height, float p_width, int p_idx, float p_old_scroll, float p_text_rect_height) {
+_FORCE_INLINE_ float RichTextLabel::_update_scroll_exceeds(float p_total_height, float p_ctrl_height, float p_width, int p_idx, float p_old_scroll, float p_text_rect_height, bool p_update_range) {
 	updating_scroll = true;
 
 	float total_height = p_total_height;
@@ -2892,12 +2897,14 @@ _FORCE_INLINE_ float RichTextLabel::_update_scroll_exceeds(float p_total_height,
 			main->first_resized_line.store(j);
 		}
 	}
-	vscroll->set_max(total_height);
-	vscroll->set_page(p_text_rect_height);
-	if (scroll_follow && scroll_following) {
-		vscroll->set_value(total_height);
-	} else {
-		vscroll->set_value(p_old_scroll);
+	if (p_update_range) {
+		vscroll->set_max(total_height);
+		vscroll->set_page(p_text_rect_height);
+		if (scroll_follow && scroll_following) {
+			vscroll->set_value(total_height);
+		} else {
+			vscroll->set_value(p_old_scroll);
+		}
 	}
 	updating_scroll = false;
 
@@ -2936,11 +2943,13 @@ bool RichTextLabel::_validate_line_caches() {
 
 		// Resize lines without reshaping.
 		int fi = main->first_resized_line.load();
+		layout_width = text_rect.size.width;
 
 		float total_height = (fi == 0) ? 0 : _calculate_line_vertical_offset(main->lines[fi - 1]);
 		for (int i = fi; i < (int)main->lines.size(); i++) {
 			total_height = _resize_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, total_height);
-			total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i, old_scroll, text_rect.size.height);
+			// Nothing is drawn until the pass is over, so the scroll range is only needed for the last line.
+			total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i, old_scroll, text_rect.size.height, i == (int)main->lines.size() - 1);
 			main->first_resized_line.store(i);
 		}
 
@@ -2987,6 +2996,7 @@ void RichTextLabel::_process_line_caches() {
 
 	float ctrl_height = get_size().height;
 	int fi = main->first_invalid_line.load();
+	layout_width = text_rect.size.width;
 	int total_chars = main->lines[fi].char_offset;
 	float old_scroll = vscroll->get_value();
 
@@ -3012,7 +3022,7 @@ void RichTextLabel::_process_line_caches() {
 
 		for (int i = sr; i < fi; i++) {
 			total_height = _resize_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, total_height);
-			total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i, old_scroll, text_rect.size.height);
+			total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i, old_scroll, text_rect.size.height, threaded);
 
 			main->first_resized_line.store(i);
 
@@ -3025,7 +3035,8 @@ void RichTextLabel::_process_line_caches() {
 	total_height = (fi == 0) ? 0 : _calculate_line_vertical_offset(main->lines[fi - 1]);
 	for (int i = fi; i < (int)main->lines.size(); i++) {
 		total_height = _shape_line(main, i, theme_cache.normal_font, theme_cache.normal_font_size, text_rect.get_size().width - scroll_w, total_height, &total_chars);
-		total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i, old_scroll, text_rect.size.height);
+		// When threaded, the range is kept up to date so the text can be scrolled while it is being shaped.
+		total_height = _update_scroll_exceeds(total_height, ctrl_height, text_rect.get_size().width, i, old_scroll, text_rect.size.height, threaded || i == (int)main->lines.size() - 1);
 
 		main->first_invalid_line.store(i);
 		main->first_resized_line.store(i);
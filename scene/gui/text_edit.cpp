@@ -94,6 +94,7 @@ void TextEdit::Text::set_draw_control_chars(bool p_enabled) {
 
 int TextEdit::Text::get_line_width(int p_line, int p_wrap_index) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), 0);
+	_ensure_line_layout(p_line);
 	if (p_wrap_index != -1) {
 		return text[p_line].data_buf->get_line_width(p_wrap_index);
 	}
@@ -105,6 +106,9 @@ int TextEdit::Text::get_line_height() const {
 }
 
 void TextEdit::Text::set_width(float p_width) {
+	if (width != p_width) {
+		layout_dirty = true;
+	}
 	width = p_width;
 }
 
@@ -113,6 +117,9 @@ float TextEdit::Text::get_width() const {
 }
 
 void TextEdit::Text::set_brk_flags(BitField<TextServer::LineBreakFlag> p_flags) {
+	if (brk_flags != p_flags) {
+		layout_dirty = true;
+	}
 	brk_flags = p_flags;
 }
 
@@ -122,6 +129,7 @@ BitField<TextServer::LineBreakFlag> TextEdit::Text::get_brk_flags() const {
 
 int TextEdit::Text::get_line_wrap_amount(int p_line) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), 0);
+	_ensure_line_layout(p_line);
 
 	return text[p_line].data_buf->get_line_count() - 1;
 }
@@ -129,6 +137,7 @@ int TextEdit::Text::get_line_wrap_amount(int p_line) const {
 Vector<Vector2i> TextEdit::Text::get_line_wrap_ranges(int p_line) const {
 	Vector<Vector2i> ret;
 	ERR_FAIL_INDEX_V(p_line, text.size(), ret);
+	_ensure_line_layout(p_line);
 
 	for (int i = 0; i < text[p_line].data_buf->get_line_count(); i++) {
 		ret.push_back(text[p_line].data_buf->get_line_range(i));
@@ -138,6 +147,7 @@ Vector<Vector2i> TextEdit::Text::get_line_wrap_ranges(int p_line) const {
 
 const Ref<TextParagraph> TextEdit::Text::get_line_data(int p_line) const {
 	ERR_FAIL_INDEX_V(p_line, text.size(), Ref<TextParagraph>());
+	_ensure_line_layout(p_line);
 	return text[p_line].data_buf;
 }
 
@@ -145,7 +155,7 @@ _FORCE_INLINE_ const String &TextEdit::Text::operator[](int p_line) const {
 	return text[p_line].data;
 }
 
-void TextEdit::Text::_calculate_line_height() {
+void TextEdit::Text::_calculate_line_height() const {
 	int height = 0;
 	for (const Line &l : text) {
 		// Found another line with the same height...nothing to update.
@@ -158,7 +168,7 @@ void TextEdit::Text::_calculate_line_height() {
 	line_height = height;
 }
 
-void TextEdit::Text::_calculate_max_line_width() {
+void TextEdit::Text::_calculate_max_line_width() const {
 	int line_width = 0;
 	for (const Line &l : text) {
 		if (l.hidden) {
@@ -182,7 +192,16 @@ void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_chan
 		return; // Not in tree?
 	}
 
-	if (p_text_changed) {
+	if (_is_layout_lazy() && p_ime_text.is_empty()) {
+		// The text is added back, with the current settings, when the line is laid out.
+		_drop_line_buffer(p_line);
+		_mark_layout_pending(p_line);
+		return;
+	}
+
+	// A line dropped while the document was large needs its text back.
+	const bool refill = p_text_changed || text[p_line].buffer_pending;
+	if (refill) {
 		text.write[p_line].data_buf->clear();
 	}
 
@@ -191,14 +210,14 @@ void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_chan
 	text.write[p_line].data_buf->set_break_flags(brk_flags);
 	text.write[p_line].data_buf->set_preserve_control(draw_control_chars);
 	if (p_ime_text.length() > 0) {
-		if (p_text_changed) {
+		if (refill) {
 			text.write[p_line].data_buf->add_string(p_ime_text, font, font_size, language);
 		}
 		if (!p_bidi_override.is_empty()) {
 			TS->shaped_text_set_bidi_override(text.write[p_line].data_buf->get_rid(), p_bidi_override);
 		}
 	} else {
-		if (p_text_changed) {
+		if (refill) {
 			text.write[p_line].data_buf->add_string(text[p_line].data, font, font_size, language);
 		}
 		if (!text[p_line].bidi_override.is_empty()) {
@@ -206,7 +225,7 @@ void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_chan
 		}
 	}
 
-	if (!p_text_changed) {
+	if (!refill) {
 		RID r = text.write[p_line].data_buf->get_rid();
 		int spans = TS->shaped_get_span_count(r);
 		for (int i = 0; i < spans; i++) {
@@ -221,6 +240,58 @@ void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_chan
 		text.write[p_line].data_buf->tab_align(tabs);
 	}
 
+	text.write[p_line].buffer_pending = false;
+	_update_line_layout(p_line);
+}
+
+bool TextEdit::Text::_is_layout_lazy() const {
+	// Wrapped lines are always needed to place the lines that follow them.
+	return text.size() >= LAZY_LAYOUT_MIN_LINES && !brk_flags.has_flag(TextServer::BREAK_WORD_BOUND) && !brk_flags.has_flag(TextServer::BREAK_GRAPHEME_BOUND);
+}
+
+void TextEdit::Text::_mark_layout_pending(int p_line) {
+	// Until it is laid out, the line keeps its previous size, and is at least as tall as the font.
+	text.write[p_line].layout_pending = true;
+	line_height = MAX(line_height, font_height);
+}
+
+void TextEdit::Text::_drop_line_buffer(int p_line) const {
+	Line &line = text.write[p_line];
+	if (!line.buffer_pending) {
+		line.data_buf->clear();
+		line.buffer_pending = true;
+	}
+}
+
+void TextEdit::Text::_fill_line_buffer(int p_line) const {
+	Line &line = text.write[p_line];
+	line.buffer_pending = false;
+	line.data_buf->clear();
+	line.data_buf->set_width(width);
+	line.data_buf->set_direction((TextServer::Direction)direction);
+	line.data_buf->set_break_flags(brk_flags);
+	line.data_buf->set_preserve_control(draw_control_chars);
+	line.data_buf->add_string(line.data, font, font_size, language);
+	if (!line.bidi_override.is_empty()) {
+		TS->shaped_text_set_bidi_override(line.data_buf->get_rid(), line.bidi_override);
+	}
+	if (tab_size > 0) {
+		Vector<float> tabs;
+		tabs.push_back(font->get_char_size(' ', font_size).width * tab_size);
+		line.data_buf->tab_align(tabs);
+	}
+	shaped_since_eviction++;
+}
+
+void TextEdit::Text::_update_line_layout(int p_line) const {
+	if (text[p_line].buffer_pending) {
+		_fill_line_buffer(p_line);
+		if (!text[p_line].layout_pending) {
+			return; // Dropped away from the view, but the size didn't change.
+		}
+	}
+	text.write[p_line].layout_pending = false;
+
 	// Update height.
 	const int old_height = text.write[p_line].height;
 	const int wrap_amount = get_line_wrap_amount(p_line);
@@ -251,7 +322,17 @@ void TextEdit::Text::invalidate_cache(int p_line, int p_column, bool p_text_chan
 }
 
 void TextEdit::Text::invalidate_all_lines() {
+	const bool lazy = _is_layout_lazy();
+	if (lazy && !layout_dirty && !tab_size_dirty) {
+		return; // Nothing that affects the line sizes has changed.
+	}
+
 	for (int i = 0; i < text.size(); i++) {
+		if (lazy) {
+			_drop_line_buffer(i);
+			_mark_layout_pending(i);
+			continue;
+		}
 		text.write[i].data_buf->set_width(width);
 		text.write[i].data_buf->set_break_flags(brk_flags);
 		if (tab_size_dirty) {
@@ -261,13 +342,35 @@ void TextEdit::Text::invalidate_all_lines() {
 				text.write[i].data_buf->tab_align(tabs);
 			}
 		}
-		text.write[i].width = get_line_width(i);
+		if (text[i].layout_pending || text[i].buffer_pending) {
+			_update_line_layout(i);
+		} else {
+			text.write[i].width = get_line_width(i);
+		}
 	}
 	tab_size_dirty = false;
+	layout_dirty = false;
 
 	_calculate_max_line_width();
 }
 
+void TextEdit::Text::evict_layout(int p_keep_from, int p_keep_to) {
+	// Going through every line is only worth it once enough of them were shaped.
+	if (shaped_since_eviction < LAZY_LAYOUT_EVICT_LINES || !_is_layout_lazy()) {
+		return;
+	}
+	shaped_since_eviction = 0;
+
+	// The sizes of the dropped lines stay valid, only their shaped text is freed.
+	for (int i = 0; i < text.size(); i++) {
+		if (i >= p_keep_from && i <= p_keep_to) {
+			i = p_keep_to;
+			continue;
+		}
+		_drop_line_buffer(i);
+	}
+}
+
 void TextEdit::Text::invalidate_font() {
 	if (!is_dirty) {
 		return;
@@ -306,6 +409,7 @@ void TextEdit::Text::invalidate_all() {
 
 void TextEdit::Text::clear() {
 	text.clear();
+	shaped_since_eviction = 0;
 
 	max_width = -1;
 	line_height = -1;
@@ -517,6 +621,11 @@ void TextEdit::_notification(int p_what) {
 			}
 
 			_update_scrollbars();
+			{
+				// Keep the shaped text of a screen's worth of lines (or of what the minimap shows) on each side of the view.
+				const int margin = MAX(get_visible_line_count(), draw_minimap ? get_minimap_visible_lines() : 0);
+				text.evict_layout(get_first_visible_line() - margin, get_last_full_visible_line() + margin);
+			}
 
 			RID ci = get_canvas_item();
 			RenderingServer::get_singleton()->canvas_item_set_clip(get_canvas_item(), true);
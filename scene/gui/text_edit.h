@@ -153,6 +153,8 @@ private:
 
 			Color background_color = Color(0, 0, 0, 0);
 			bool hidden = false;
+			bool layout_pending = false; // Size not measured since the last change.
+			bool buffer_pending = false; // Text not added to data_buf yet, or dropped since.
 			int height = 0;
 			int width = 0;
 
@@ -162,8 +164,15 @@ private:
 		};
 
 	private:
+		// Past this many lines, and as long as lines aren't wrapped, lines are only shaped and
+		// measured when they are needed, and only the lines around the view keep their shaped text.
+		static const int LAZY_LAYOUT_MIN_LINES = 10000;
+		// How many lines may be shaped before the ones away from the view are dropped, see evict_layout().
+		static const int LAZY_LAYOUT_EVICT_LINES = 4096;
+
 		bool is_dirty = false;
 		bool tab_size_dirty = false;
+		bool layout_dirty = false;
 
 		mutable Vector<Line> text;
 		Ref<Font> font;
@@ -175,15 +184,28 @@ private:
 		BitField<TextServer::LineBreakFlag> brk_flags = TextServer::BREAK_MANDATORY;
 		bool draw_control_chars = false;
 
-		int line_height = -1;
-		int max_width = -1;
+		mutable int line_height = -1;
+		mutable int max_width = -1;
 		int width = -1;
 
 		int tab_size = 4;
 		int gutter_count = 0;
 
-		void _calculate_line_height();
-		void _calculate_max_line_width();
+		mutable int shaped_since_eviction = 0;
+
+		void _calculate_line_height() const;
+		void _calculate_max_line_width() const;
+
+		bool _is_layout_lazy() const;
+		void _mark_layout_pending(int p_line);
+		void _drop_line_buffer(int p_line) const;
+		void _fill_line_buffer(int p_line) const;
+		void _update_line_layout(int p_line) const;
+		_FORCE_INLINE_ void _ensure_line_layout(int p_line) const {
+			if (text[p_line].layout_pending || text[p_line].buffer_pending) {
+				_update_line_layout(p_line);
+			}
+		}
 
 	public:
 		void set_tab_size(int p_tab_size);
@@ -229,6 +251,8 @@ private:
 		void invalidate_all();
 		void invalidate_all_lines();
 
+		void evict_layout(int p_keep_from, int p_keep_to);
+
 		_FORCE_INLINE_ const String &operator[](int p_line) const;
 
 		/* Gutters. */
@@ -3345,6 +3345,8 @@ Rect2 Tree::_get_content_rect() const {
 void Tree::gui_input(const Ref<InputEvent> &p_event) {
 	ERR_FAIL_COND(p_event.is_null());
 
+	_update_virtual_rows();
+
 	Ref<InputEventKey> k = p_event;
 
 	bool is_command = k.is_valid() && k->is_command_or_control_pressed();
@@ -3572,7 +3574,7 @@ void Tree::gui_input(const Ref<InputEvent> &p_event) {
 					mpos.x += h_scroll->get_value();
 				}
 				if (v_scroll->is_visible_in_tree()) {
-					mpos.y += v_scroll->get_value();
+					mpos.y += _get_v_scroll_offset();
 				}
 
 				TreeItem *old_it = cache.hover_item;
@@ -4017,7 +4019,9 @@ void Tree::set_editor_selection(int p_from_line, int p_to_line, int p_from_colum
 
 Size2 Tree::get_internal_min_size() const {
 	Size2i size;
-	if (root) {
+	if (_is_virtual()) {
+		size.height = int(MIN(double(virtual_row_count) * virtual_row_height, double(INT_MAX)));
+	} else if (root) {
 		size.height += get_item_height(root);
 	}
 	for (int i = 0; i < columns.size(); i++) {
@@ -4061,10 +4065,10 @@ void Tree::update_scrollbars() {
 		v_scroll->show();
 		v_scroll->set_max(internal_min_size.height);
 		v_scroll->set_page(tree_content_size.height);
-		theme_cache.offset.y = v_scroll->get_value();
+		theme_cache.offset.y = _get_v_scroll_offset();
 	} else {
 		v_scroll->hide();
-		theme_cache.offset.y = 0;
+		theme_cache.offset.y = -_get_virtual_origin();
 	}
 
 	if (display_hscroll) {
@@ -4192,6 +4196,7 @@ void Tree::_notification(int p_what) {
 		case NOTIFICATION_DRAW: {
 			v_scroll->set_custom_step(theme_cache.font->get_height(theme_cache.font_size));
 
+			_update_virtual_rows();
 			update_scrollbars();
 			RID ci = get_canvas_item();
 
@@ -4269,6 +4274,9 @@ void Tree::_notification(int p_what) {
 		case NOTIFICATION_LAYOUT_DIRECTION_CHANGED:
 		case NOTIFICATION_TRANSLATION_CHANGED: {
 			_update_all();
+			if (_is_virtual()) {
+				refresh_virtual_rows();
+			}
 		} break;
 
 		case NOTIFICATION_RESIZED:
@@ -4442,6 +4450,9 @@ void Tree::deselect_all() {
 
 	selected_item = nullptr;
 	selected_col = -1;
+	virtual_selected.clear();
+	virtual_cursor_row = -1;
+	virtual_cursor_column = -1;
 
 	queue_redraw();
 }
@@ -4471,6 +4482,7 @@ void Tree::clear() {
 	edited_item = nullptr;
 	popup_edited_item = nullptr;
 	popup_pressing_edited_item = nullptr;
+	virtual_first_row = 0;
 
 	queue_redraw();
 };
@@ -4488,6 +4500,269 @@ bool Tree::is_root_hidden() const {
 	return hide_root;
 }
 
+void Tree::_fill_virtual_row(TreeItem *p_item, int p_row) {
+	Variant data = item_source.call(p_row);
+
+	Array cells;
+	if (data.get_type() == Variant::ARRAY) {
+		cells = data;
+	} else {
+		cells.push_back(data);
+	}
+
+	for (int i = 0; i < MIN(cells.size(), columns.size()); i++) {
+		const Variant &cell = cells[i];
+		if (cell.get_type() == Variant::DICTIONARY) {
+			Dictionary d = cell;
+			p_item->set_text(i, d.get("text", String()));
+			p_item->set_icon(i, Ref<Texture2D>(d.get("icon", Ref<Texture2D>())));
+			p_item->set_tooltip_text(i, d.get("tooltip", String()));
+			p_item->set_selectable(i, d.get("selectable", true));
+		} else {
+			p_item->set_text(i, cell);
+		}
+	}
+
+	if (virtual_row_height > 0) {
+		// Rows must not grow past the measured height, or the row coordinates would drift.
+		p_item->set_custom_minimum_height(virtual_row_height - 2 * theme_cache.v_separation);
+	}
+
+	// Restore the selection without emitting signals, the row was selected before.
+	for (int i = 0; i < columns.size(); i++) {
+		p_item->cells.write[i].selected = virtual_selected.has(Vector2i(i, p_row));
+	}
+	if (p_row == virtual_cursor_row) {
+		selected_item = p_item;
+		selected_col = virtual_cursor_column;
+	}
+}
+
+void Tree::_sync_virtual_selection() const {
+	if (!root) {
+		return;
+	}
+
+	bool pool_has_selection = false;
+	int cursor_row = -1;
+	int row = virtual_first_row;
+	for (TreeItem *it = root->get_first_child(); it; it = it->get_next(), row++) {
+		for (int i = 0; i < it->cells.size(); i++) {
+			if (it->cells[i].selected) {
+				virtual_selected.insert(Vector2i(i, row));
+				pool_has_selection = true;
+			} else {
+				virtual_selected.erase(Vector2i(i, row));
+			}
+		}
+		if (it == selected_item) {
+			cursor_row = row;
+		}
+	}
+
+	// Keep the cursor of a row that was dropped from the pool, unless it moved since.
+	if (cursor_row >= 0 || (virtual_cursor_row >= virtual_first_row && virtual_cursor_row < row)) {
+		virtual_cursor_row = cursor_row;
+		virtual_cursor_column = cursor_row >= 0 ? selected_col : -1;
+	}
+
+	if (pool_has_selection && select_mode != SELECT_MULTI) {
+		// Single selection, the pooled rows replaced any selection made before scrolling.
+		const int pool_end = row;
+		LocalVector<Vector2i> stale;
+		for (const Vector2i &E : virtual_selected) {
+			if (E.y < virtual_first_row || E.y >= pool_end) {
+				stale.push_back(E);
+			}
+		}
+		for (const Vector2i &E : stale) {
+			virtual_selected.erase(E);
+		}
+	}
+}
+
+void Tree::_clear_virtual_rows() {
+	_sync_virtual_selection();
+	while (root && root->get_first_child()) {
+		memdelete(root->get_first_child());
+	}
+	virtual_first_row = 0;
+}
+
+void Tree::_update_virtual_rows() {
+	if (!_is_virtual() || virtual_updating || blocked > 0 || !is_inside_tree() || theme_cache.font.is_null()) {
+		return;
+	}
+	virtual_updating = true;
+
+	if (!root) {
+		create_item();
+	}
+
+	if (virtual_row_height <= 0 && virtual_row_count > 0) {
+		// Every row is as tall as the first one.
+		_clear_virtual_rows();
+		TreeItem *probe = create_item(root);
+		_fill_virtual_row(probe, 0);
+		virtual_row_height = compute_item_height(probe) + theme_cache.v_separation;
+		memdelete(probe);
+	}
+	update_scrollbars(); // Clamps the scroll position to the row count.
+
+	int from = 0;
+	int to = 0;
+	if (virtual_row_height > 0 && virtual_row_count > 0) {
+		const double scroll = v_scroll->is_visible() ? v_scroll->get_value() : 0.0;
+		const double page = MAX(_get_content_rect().size.height - _get_title_button_height(), 0.0);
+		const int first = CLAMP(int(scroll / virtual_row_height), 0, virtual_row_count - 1);
+		const int last = CLAMP(int((scroll + page) / virtual_row_height), first, virtual_row_count - 1);
+
+		// Keep a page worth of rows on each side, so small scroll steps reuse shaped rows.
+		const int margin = last - first + 1;
+		from = MAX(0, first - margin);
+		to = MIN(virtual_row_count, last + 1 + margin);
+	}
+
+	int pool_from = virtual_first_row;
+	int pool_to = pool_from + root->get_child_count();
+	if (from != pool_from || to != pool_to) {
+		_sync_virtual_selection();
+
+		if (to <= pool_from || from >= pool_to) {
+			while (root->get_first_child()) {
+				memdelete(root->get_first_child());
+			}
+			pool_from = from;
+			pool_to = from;
+		} else {
+			for (; pool_from < from; pool_from++) {
+				memdelete(root->get_first_child());
+			}
+			for (; pool_to > to; pool_to--) {
+				memdelete(root->get_child(-1));
+			}
+		}
+
+		for (int i = pool_from - 1; i >= from; i--) {
+			_fill_virtual_row(create_item(root, 0), i);
+		}
+		for (int i = pool_to; i < to; i++) {
+			_fill_virtual_row(create_item(root), i);
+		}
+		virtual_first_row = from;
+		update_scrollbars();
+	}
+
+	virtual_updating = false;
+}
+
+void Tree::set_item_source(const Callable &p_source) {
+	if (item_source == p_source) {
+		return;
+	}
+
+	clear();
+	item_source = p_source;
+	virtual_selected.clear();
+	virtual_cursor_row = -1;
+	virtual_cursor_column = -1;
+	virtual_row_height = 0;
+	if (_is_virtual()) {
+		set_hide_root(true);
+	} else {
+		virtual_row_count = 0;
+	}
+
+	_update_virtual_rows();
+	queue_redraw();
+}
+
+Callable Tree::get_item_source() const {
+	return item_source;
+}
+
+void Tree::set_virtual_row_count(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+	if (virtual_row_count == p_count) {
+		return;
+	}
+
+	_sync_virtual_selection();
+	virtual_row_count = p_count;
+
+	LocalVector<Vector2i> removed;
+	for (const Vector2i &E : virtual_selected) {
+		if (E.y >= p_count) {
+			removed.push_back(E);
+		}
+	}
+	for (const Vector2i &E : removed) {
+		virtual_selected.erase(E);
+	}
+	if (virtual_cursor_row >= p_count) {
+		virtual_cursor_row = -1;
+		virtual_cursor_column = -1;
+	}
+
+	if (virtual_row_height <= 0 || virtual_first_row >= p_count) {
+		_clear_virtual_rows();
+	}
+	_update_virtual_rows();
+	queue_redraw();
+}
+
+int Tree::get_virtual_row_count() const {
+	return virtual_row_count;
+}
+
+int Tree::get_virtual_row(TreeItem *p_item) const {
+	ERR_FAIL_NULL_V(p_item, -1);
+	if (!_is_virtual() || p_item->get_parent() != root) {
+		return -1;
+	}
+	return virtual_first_row + p_item->get_index();
+}
+
+TreeItem *Tree::get_virtual_row_item(int p_row) const {
+	if (!_is_virtual() || !root || p_row < virtual_first_row) {
+		return nullptr;
+	}
+	const int index = p_row - virtual_first_row;
+	return index < root->get_child_count() ? root->get_child(index) : nullptr;
+}
+
+PackedInt32Array Tree::get_selected_virtual_rows() const {
+	_sync_virtual_selection();
+
+	HashSet<int> rows;
+	for (const Vector2i &E : virtual_selected) {
+		rows.insert(E.y);
+	}
+
+	PackedInt32Array ret;
+	for (const int &E : rows) {
+		ret.push_back(E);
+	}
+	ret.sort();
+	return ret;
+}
+
+void Tree::scroll_to_virtual_row(int p_row) {
+	ERR_FAIL_COND(!_is_virtual());
+	ERR_FAIL_INDEX(p_row, virtual_row_count);
+
+	_update_virtual_rows();
+	update_scrollbars();
+	v_scroll->set_value(double(p_row) * virtual_row_height);
+}
+
+void Tree::refresh_virtual_rows() {
+	_clear_virtual_rows();
+	virtual_row_height = 0;
+	_update_virtual_rows();
+	queue_redraw();
+}
+
 void Tree::set_column_custom_minimum_width(int p_column, int p_min_width) {
 	ERR_FAIL_INDEX(p_column, columns.size());
 
@@ -4712,6 +4987,9 @@ void Tree::set_columns(int p_columns) {
 	if (selected_col >= p_columns) {
 		selected_col = p_columns - 1;
 	}
+	if (_is_virtual()) {
+		refresh_virtual_rows();
+	}
 	queue_redraw();
 }
 
@@ -4720,6 +4998,7 @@ int Tree::get_columns() const {
 }
 
 void Tree::_scroll_moved(float) {
+	_update_virtual_rows();
 	queue_redraw();
 }
 
@@ -4777,6 +5056,7 @@ void Tree::ensure_cursor_is_visible() {
 
 	int y_offset = get_item_offset(selected_item);
 	if (y_offset != -1) {
+		y_offset += _get_virtual_origin();
 		const int tbh = _get_title_button_height();
 		y_offset -= tbh;
 
@@ -4829,7 +5109,7 @@ Rect2 Tree::get_item_rect(TreeItem *p_item, int p_column, int p_button) const {
 	int ofs = get_item_offset(p_item);
 	int height = compute_item_height(p_item);
 	Rect2 r;
-	r.position.y = ofs;
+	r.position.y = ofs + _get_virtual_origin();
 	r.size.height = height;
 
 	if (p_column == -1) {
@@ -4961,6 +5241,7 @@ void Tree::scroll_to_item(TreeItem *p_item, bool p_center_on_item) {
 
 	int y_offset = get_item_offset(p_item);
 	if (y_offset != -1) {
+		y_offset += _get_virtual_origin();
 		const int tbh = _get_title_button_height();
 		y_offset -= tbh;
 
@@ -5180,7 +5461,7 @@ int Tree::get_column_at_position(const Point2 &p_pos) const {
 			pos.x += h_scroll->get_value();
 		}
 		if (v_scroll->is_visible_in_tree()) {
-			pos.y += v_scroll->get_value();
+			pos.y += _get_v_scroll_offset();
 		}
 
 		int col, h, section;
@@ -5210,7 +5491,7 @@ int Tree::get_drop_section_at_position(const Point2 &p_pos) const {
 			pos.x += h_scroll->get_value();
 		}
 		if (v_scroll->is_visible_in_tree()) {
-			pos.y += v_scroll->get_value();
+			pos.y += _get_v_scroll_offset();
 		}
 
 		int col, h, section;
@@ -5240,7 +5521,7 @@ TreeItem *Tree::get_item_at_position(const Point2 &p_pos) const {
 			pos.x += h_scroll->get_value();
 		}
 		if (v_scroll->is_visible_in_tree()) {
-			pos.y += v_scroll->get_value();
+			pos.y += _get_v_scroll_offset();
 		}
 
 		int col, h, section;
@@ -5267,7 +5548,7 @@ int Tree::get_button_id_at_position(const Point2 &p_pos) const {
 			pos.x += h_scroll->get_value();
 		}
 		if (v_scroll->is_visible_in_tree()) {
-			pos.y += v_scroll->get_value();
+			pos.y += _get_v_scroll_offset();
 		}
 
 		int col, h, section;
@@ -5309,7 +5590,7 @@ String Tree::get_tooltip(const Point2 &p_pos) const {
 			pos.x += h_scroll->get_value();
 		}
 		if (v_scroll->is_visible_in_tree()) {
-			pos.y += v_scroll->get_value();
+			pos.y += _get_v_scroll_offset();
 		}
 
 		int col, h, section;
@@ -5428,6 +5709,17 @@ void Tree::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("set_hide_root", "enable"), &Tree::set_hide_root);
 	ClassDB::bind_method(D_METHOD("is_root_hidden"), &Tree::is_root_hidden);
+
+	ClassDB::bind_method(D_METHOD("set_item_source", "source"), &Tree::set_item_source);
+	ClassDB::bind_method(D_METHOD("get_item_source"), &Tree::get_item_source);
+	ClassDB::bind_method(D_METHOD("set_virtual_row_count", "count"), &Tree::set_virtual_row_count);
+	ClassDB::bind_method(D_METHOD("get_virtual_row_count"), &Tree::get_virtual_row_count);
+	ClassDB::bind_method(D_METHOD("get_virtual_row", "item"), &Tree::get_virtual_row);
+	ClassDB::bind_method(D_METHOD("get_virtual_row_item", "row"), &Tree::get_virtual_row_item);
+	ClassDB::bind_method(D_METHOD("get_selected_virtual_rows"), &Tree::get_selected_virtual_rows);
+	ClassDB::bind_method(D_METHOD("scroll_to_virtual_row", "row"), &Tree::scroll_to_virtual_row);
+	ClassDB::bind_method(D_METHOD("refresh_virtual_rows"), &Tree::refresh_virtual_rows);
+
 	ClassDB::bind_method(D_METHOD("get_next_selected", "from"), &Tree::get_next_selected);
 	ClassDB::bind_method(D_METHOD("get_selected"), &Tree::get_selected);
 	ClassDB::bind_method(D_METHOD("set_selected", "item", "column"), &Tree::set_selected);
@@ -5502,6 +5794,8 @@ void Tree::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "hide_folding"), "set_hide_folding", "is_folding_hidden");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "enable_recursive_folding"), "set_enable_recursive_folding", "is_recursive_folding_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "hide_root"), "set_hide_root", "is_root_hidden");
+	ADD_PROPERTY(PropertyInfo(Variant::CALLABLE, "item_source", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NONE), "set_item_source", "get_item_source");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "virtual_row_count", PROPERTY_HINT_RANGE, "0,1,1,or_greater"), "set_virtual_row_count", "get_virtual_row_count");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "drop_mode_flags", PROPERTY_HINT_FLAGS, "On Item,In Between"), "set_drop_mode_flags", "get_drop_mode_flags");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "select_mode", PROPERTY_HINT_ENUM, "Single,Row,Multi"), "set_select_mode", "get_select_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "scroll_horizontal_enabled"), "set_h_scroll_enabled", "is_h_scroll_enabled");
@@ -443,6 +443,18 @@ private:
 	bool hide_root = false;
 	SelectMode select_mode = SELECT_SINGLE;
 
+	// Virtual mode. Rows are requested from item_source by index, and only the rows around
+	// the visible area exist as TreeItems, under a hidden root. The vertical scroll bar keeps
+	// row coordinates; the pooled rows are drawn relative to the first of them.
+	Callable item_source;
+	int virtual_row_count = 0;
+	int virtual_row_height = 0; // Distance between two rows, like get_item_offset() steps.
+	int virtual_first_row = 0;
+	bool virtual_updating = false;
+	mutable HashSet<Vector2i> virtual_selected; // (column, row) of the selected cells.
+	mutable int virtual_cursor_row = -1;
+	mutable int virtual_cursor_column = -1;
+
 	int blocked = 0;
 
 	int drop_mode_flags = 0;
@@ -671,6 +683,14 @@ private:
 	Rect2 _get_scrollbar_layout_rect() const;
 	Rect2 _get_content_rect() const; // Considering the background stylebox and scrollbars.
 
+	_FORCE_INLINE_ bool _is_virtual() const { return item_source.is_valid(); }
+	double _get_virtual_origin() const { return _is_virtual() ? double(virtual_first_row) * virtual_row_height : 0.0; }
+	double _get_v_scroll_offset() const { return v_scroll->get_value() - _get_virtual_origin(); }
+	void _fill_virtual_row(TreeItem *p_item, int p_row);
+	void _sync_virtual_selection() const;
+	void _clear_virtual_rows();
+	void _update_virtual_rows();
+
 protected:
 	virtual void _update_theme_item_cache() override;
 
@@ -706,6 +726,17 @@ public:
 
 	void set_hide_root(bool p_enabled);
 	bool is_root_hidden() const;
+
+	void set_item_source(const Callable &p_source);
+	Callable get_item_source() const;
+	void set_virtual_row_count(int p_count);
+	int get_virtual_row_count() const;
+	int get_virtual_row(TreeItem *p_item) const;
+	TreeItem *get_virtual_row_item(int p_row) const;
+	PackedInt32Array get_selected_virtual_rows() const;
+	void scroll_to_virtual_row(int p_row);
+	void refresh_virtual_rows();
+	int get_cached_virtual_row_count() const { return root && _is_virtual() ? root->get_child_count() : 0; }
 	TreeItem *get_next_selected(TreeItem *p_item);
 	TreeItem *get_selected() const;
 	void set_selected(TreeItem *p_item, int p_column = 0);
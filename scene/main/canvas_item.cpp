@@ -1473,6 +1473,7 @@ CanvasItem::TextureRepeat CanvasItem::get_texture_repeat_in_tree() const {
 CanvasItem::CanvasItem() :
 		xform_change(this) {
 	canvas_item = RenderingServer::get_singleton()->canvas_item_create();
+	RenderingServer::get_singleton()->canvas_item_attach_object_instance_id(canvas_item, get_instance_id());
 }
 
 CanvasItem::~CanvasItem() {
@@ -451,6 +451,9 @@ void Node::_move_child(Node *p_child, int p_index, bool p_ignore_end) {
 	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
 	emit_signal(SNAME("child_order_changed"));
 	p_child->_propagate_groups_dirty();
+	if (data.tree) {
+		p_child->_propagate_process_order_changed();
+	}
 
 	data.blocked--;
 }
@@ -467,6 +470,14 @@ void Node::_propagate_groups_dirty() {
 	}
 }
 
+void Node::_propagate_process_order_changed() {
+	data.tree->_node_process_order_changed(this, data.process_thread_group_owner);
+
+	for (KeyValue<StringName, Node *> &K : data.children) {
+		K.value->_propagate_process_order_changed();
+	}
+}
+
 void Node::add_child_notify(Node *p_child) {
 	// to be used when not wanted
 }
@@ -844,6 +855,25 @@ int Node::get_process_thread_group_order() const {
 	return data.process_thread_group_order;
 }
 
+void Node::set_process_thread_group_chunk_size(int p_size) {
+	ERR_THREAD_GUARD
+	ERR_FAIL_COND(p_size < 0);
+	data.process_thread_group_chunk_size = p_size;
+}
+
+int Node::get_process_thread_group_chunk_size() const {
+	return data.process_thread_group_chunk_size;
+}
+
+#ifdef DEBUG_ENABLED
+void Node::_check_thread_group_read() const {
+	// Reading nodes of groups running at the same time on other threads is a race.
+	if (data.tree && data.process_group) {
+		data.tree->_check_thread_group_access(current_process_thread_group, this);
+	}
+}
+#endif
+
 void Node::set_process_priority(int p_priority) {
 	ERR_THREAD_GUARD
 	if (data.process_priority == p_priority) {
@@ -2000,17 +2030,13 @@ void Node::add_to_group(const StringName &p_identifier, bool p_persistent) {
 		return;
 	}
 
-	GroupData gd;
+	// Insert first, the tree keeps track of the member index in it.
+	GroupData &gd = data.grouped[p_identifier];
+	gd.persistent = p_persistent;
 
 	if (data.tree) {
 		gd.group = data.tree->add_to_group(p_identifier, this);
-	} else {
-		gd.group = nullptr;
 	}
-
-	gd.persistent = p_persistent;
-
-	data.grouped[p_identifier] = gd;
 }
 
 void Node::remove_from_group(const StringName &p_identifier) {
@@ -3052,6 +3078,9 @@ void Node::_validate_property(PropertyInfo &p_property) const {
 	if ((p_property.name == "process_thread_group_order" || p_property.name == "process_thread_messages") && data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
 		p_property.usage = 0;
 	}
+	if (p_property.name == "process_thread_group_chunk_size" && data.process_thread_group != PROCESS_THREAD_GROUP_SUB_THREAD) {
+		p_property.usage = 0;
+	}
 }
 
 void Node::input(const Ref<InputEvent> &p_event) {
@@ -3231,6 +3260,9 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_process_thread_group_order", "order"), &Node::set_process_thread_group_order);
 	ClassDB::bind_method(D_METHOD("get_process_thread_group_order"), &Node::get_process_thread_group_order);
 
+	ClassDB::bind_method(D_METHOD("set_process_thread_group_chunk_size", "size"), &Node::set_process_thread_group_chunk_size);
+	ClassDB::bind_method(D_METHOD("get_process_thread_group_chunk_size"), &Node::get_process_thread_group_chunk_size);
+
 	ClassDB::bind_method(D_METHOD("set_display_folded", "fold"), &Node::set_display_folded);
 	ClassDB::bind_method(D_METHOD("is_displayed_folded"), &Node::is_displayed_folded);
 
@@ -3388,6 +3420,7 @@ void Node::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group", PROPERTY_HINT_ENUM, "Inherit,Main Thread,Sub Thread"), "set_process_thread_group", "get_process_thread_group");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group_order"), "set_process_thread_group_order", "get_process_thread_group_order");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_messages", PROPERTY_HINT_FLAGS, "Process,Physics Process"), "set_process_thread_messages", "get_process_thread_messages");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "process_thread_group_chunk_size", PROPERTY_HINT_RANGE, "0,65536,1,or_greater"), "set_process_thread_group_chunk_size", "get_process_thread_group_chunk_size");
 
 	ADD_GROUP("Editor Description", "editor_");
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "editor_description", PROPERTY_HINT_MULTILINE_TEXT), "set_editor_description", "get_editor_description");
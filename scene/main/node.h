@@ -120,6 +120,7 @@ private:
 	struct GroupData {
 		bool persistent = false;
 		SceneTree::Group *group = nullptr;
+		uint32_t index = 0; // Position in the group members, maintained by the SceneTree.
 	};
 
 	struct ComparatorByIndex {
@@ -183,6 +184,7 @@ private:
 		ProcessThreadGroup process_thread_group = PROCESS_THREAD_GROUP_INHERIT;
 		Node *process_thread_group_owner = nullptr;
 		int process_thread_group_order = 0;
+		int process_thread_group_chunk_size = 0;
 		BitField<ProcessThreadMessages> process_thread_messages;
 		void *process_group = nullptr; // to avoid cyclic dependency
 
@@ -192,6 +194,9 @@ private:
 		bool process = false;
 		int process_priority = 0;
 		int physics_process_priority = 0;
+		// Position in the process group lists, -1 if not merged into them yet.
+		int32_t process_list_index = -1;
+		int32_t physics_process_list_index = -1;
 
 		bool physics_process_internal = false;
 		bool process_internal = false;
@@ -230,6 +235,7 @@ private:
 	void _propagate_after_exit_tree();
 	void _propagate_process_owner(Node *p_owner, int p_pause_notification, int p_enabled_notification);
 	void _propagate_groups_dirty();
+	void _propagate_process_order_changed();
 	Array _get_node_and_resource(const NodePath &p_path);
 
 	void _duplicate_signals(const Node *p_original, Node *p_copy) const;
@@ -268,6 +274,10 @@ private:
 
 	static thread_local Node *current_process_thread_group;
 
+#ifdef DEBUG_ENABLED
+	void _check_thread_group_read() const;
+#endif
+
 	Variant _call_deferred_thread_group_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	Variant _call_thread_safe_bind(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
@@ -516,6 +526,9 @@ public:
 	void set_process_thread_group_order(int p_order);
 	int get_process_thread_group_order() const;
 
+	void set_process_thread_group_chunk_size(int p_size);
+	int get_process_thread_group_chunk_size() const;
+
 	void set_physics_process_priority(int p_priority);
 	int get_physics_process_priority() const;
 
@@ -552,6 +565,11 @@ public:
 			return is_current_thread_safe_for_nodes();
 		} else {
 			// Thread processing.
+#ifdef DEBUG_ENABLED
+			if (current_process_thread_group != data.process_thread_group_owner) {
+				_check_thread_group_read();
+			}
+#endif
 			return true;
 		}
 	}
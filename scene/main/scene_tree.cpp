@@ -31,6 +31,7 @@
 #include "scene_tree.h"
 
 #include "core/config/project_settings.h"
+#include "core/core_string_names.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/input/input.h"
 #include "core/io/dir_access.h"
@@ -38,6 +39,7 @@
 #include "core/io/marshalls.h"
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
+#include "core/object/script_language.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/keyboard.h"
 #include "core/os/os.h"
@@ -45,6 +47,7 @@
 #include "node.h"
 #include "scene/animation/tween.h"
 #include "scene/debugger/scene_debugger.h"
+#include "scene/gui/container.h"
 #include "scene/gui/control.h"
 #include "scene/main/viewport.h"
 #include "scene/resources/font.h"
@@ -137,16 +140,22 @@ void SceneTree::node_renamed(Node *p_node) {
 SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_node) {
 	_THREAD_SAFE_METHOD_
 
+	Node::GroupData *gd = p_node->data.grouped.getptr(p_group);
+	ERR_FAIL_NULL_V(gd, nullptr);
+
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (!E) {
 		E = group_map.insert(p_group, Group());
 	}
 
-	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
-	E->value.nodes.push_back(p_node);
-	//E->value.last_tree_version=0;
-	E->value.changed = true;
-	return &E->value;
+	Group &g = E->value;
+	ERR_FAIL_COND_V_MSG(gd->group == &g, &g, "Already in group: " + p_group + ".");
+
+	// Appended out of order, merged into tree order the next time the group is used.
+	gd->index = g.nodes.size();
+	g.nodes.push_back(p_node);
+	g.member_indices.push_back(&gd->index);
+	return &g;
 }
 
 void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
@@ -154,9 +163,18 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
+	Group &g = E->value;
 
-	E->value.nodes.erase(p_node);
-	if (E->value.nodes.is_empty()) {
+	Node::GroupData *gd = p_node->data.grouped.getptr(p_group);
+	ERR_FAIL_NULL(gd);
+	ERR_FAIL_COND(gd->index >= uint32_t(g.nodes.size()) || g.nodes[gd->index] != p_node);
+
+	// Leave a hole, so the order is kept without moving the other members.
+	g.nodes.set(gd->index, nullptr);
+	g.member_indices[gd->index] = nullptr;
+	g.removed_count++;
+
+	if (g.get_member_count() == 0) {
 		group_map.remove(E);
 	}
 }
@@ -203,20 +221,117 @@ void SceneTree::_flush_ugc() {
 }
 
 void SceneTree::_update_group_order(Group &g) {
-	if (!g.changed) {
+	if (g.removed_count == 0 && !g.changed && g.sorted_count == uint32_t(g.nodes.size())) {
 		return;
 	}
-	if (g.nodes.is_empty()) {
+	_sort_group(g);
+}
+
+struct GroupMember {
+	Node *node = nullptr;
+	uint32_t *index = nullptr;
+};
+
+struct GroupMemberComparator {
+	_FORCE_INLINE_ bool operator()(const GroupMember &p_a, const GroupMember &p_b) const { return p_b.node->is_greater_than(p_a.node); }
+};
+
+void SceneTree::_sort_group(Group &g) {
+	Node **gr_nodes = g.nodes.ptrw();
+
+	if (g.removed_count) {
+		// Close the holes left by removed members, keeping the order.
+		uint32_t to = 0;
+		uint32_t sorted_count = 0;
+		for (uint32_t i = 0; i < uint32_t(g.nodes.size()); i++) {
+			if (!gr_nodes[i]) {
+				continue;
+			}
+			if (i < g.sorted_count) {
+				sorted_count++;
+			}
+			gr_nodes[to] = gr_nodes[i];
+			g.member_indices[to] = g.member_indices[i];
+			*g.member_indices[to] = to;
+			to++;
+		}
+		g.nodes.resize(to);
+		g.member_indices.resize(to);
+		gr_nodes = g.nodes.ptrw();
+		g.sorted_count = sorted_count;
+		g.removed_count = 0;
+	}
+
+	if (g.changed) {
+		g.sorted_count = 0;
+		g.changed = false;
+	}
+
+	uint32_t count = g.nodes.size();
+	if (g.sorted_count == count) {
 		return;
 	}
 
-	Node **gr_nodes = g.nodes.ptrw();
-	int gr_node_count = g.nodes.size();
+	// Sort the members added since the last update, then merge them from the back into the sorted ones.
+	LocalVector<GroupMember> added;
+	added.resize(count - g.sorted_count);
+	for (uint32_t i = g.sorted_count; i < count; i++) {
+		added[i - g.sorted_count] = { gr_nodes[i], g.member_indices[i] };
+	}
+	added.sort_custom<GroupMemberComparator>();
 
-	SortArray<Node *, Node::Comparator> node_sort;
-	node_sort.sort(gr_nodes, gr_node_count);
+	int64_t from_sorted = int64_t(g.sorted_count) - 1;
+	int64_t from_added = int64_t(added.size()) - 1;
+	int64_t to = int64_t(count) - 1;
+	while (from_added >= 0) {
+		if (from_sorted >= 0 && Node::Comparator()(added[from_added].node, gr_nodes[from_sorted])) {
+			gr_nodes[to] = gr_nodes[from_sorted];
+			g.member_indices[to] = g.member_indices[from_sorted];
+			from_sorted--;
+		} else {
+			gr_nodes[to] = added[from_added].node;
+			g.member_indices[to] = added[from_added].index;
+			from_added--;
+		}
+		*g.member_indices[to] = to;
+		to--;
+	}
 
-	g.changed = false;
+	g.sorted_count = count;
+}
+
+MethodBind *SceneTree::_get_group_call_method(const StringName &p_class, const StringName &p_method) {
+	MutexLock lock(group_call_method_cache_mutex);
+
+	Pair<StringName, StringName> key(p_class, p_method);
+	MethodBind **method = group_call_method_cache.getptr(key);
+	if (method) {
+		return *method;
+	}
+
+	MethodBind *mb = ClassDB::get_method(p_class, p_method);
+	group_call_method_cache.insert(key, mb);
+	return mb;
+}
+
+void SceneTree::_group_callp(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, bool p_use_method_cache, const StringName *&r_last_class, MethodBind *&r_last_method) {
+	Callable::CallError ce;
+	if (!p_use_method_cache || p_node->get_script_instance() || p_node->_get_extension()) {
+		p_node->callp(p_function, p_args, p_argcount, ce);
+		return;
+	}
+
+	// Native members resolve to the same method as long as the class does not change, which is
+	// common in groups; skip the ClassDB lookup done by Object::callp().
+	const StringName &class_name = p_node->get_class_name();
+	if (!r_last_class || *r_last_class != class_name) {
+		r_last_class = &class_name;
+		r_last_method = _get_group_call_method(class_name, p_function);
+	}
+
+	if (r_last_method) {
+		r_last_method->call(p_node, p_args, p_argcount, ce);
+	}
 }
 
 void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
@@ -230,7 +345,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			return;
 		}
 		Group &g = E->value;
-		if (g.nodes.is_empty()) {
+		if (g.get_member_count() == 0) {
 			return;
 		}
 
@@ -266,6 +381,10 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 		nodes_removed_on_group_call_lock++;
 	}
 
+	bool use_method_cache = p_function != CoreStringNames::get_singleton()->_free;
+	const StringName *last_class = nullptr;
+	MethodBind *last_method = nullptr;
+
 	if (p_call_flags & GROUP_CALL_REVERSE) {
 		for (int i = gr_node_count - 1; i >= 0; i--) {
 			if (nodes_removed_on_group_call_lock && nodes_removed_on_group_call.has(gr_nodes[i])) {
@@ -273,8 +392,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				gr_nodes[i]->callp(p_function, p_args, p_argcount, ce);
+				_group_callp(gr_nodes[i], p_function, p_args, p_argcount, use_method_cache, last_class, last_method);
 			} else {
 				MessageQueue::get_singleton()->push_callp(gr_nodes[i], p_function, p_args, p_argcount);
 			}
@@ -287,8 +405,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
-				Callable::CallError ce;
-				gr_nodes[i]->callp(p_function, p_args, p_argcount, ce);
+				_group_callp(gr_nodes[i], p_function, p_args, p_argcount, use_method_cache, last_class, last_method);
 			} else {
 				MessageQueue::get_singleton()->push_callp(gr_nodes[i], p_function, p_args, p_argcount);
 			}
@@ -313,7 +430,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 			return;
 		}
 		Group &g = E->value;
-		if (g.nodes.is_empty()) {
+		if (g.get_member_count() == 0) {
 			return;
 		}
 
@@ -376,7 +493,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 			return;
 		}
 		Group &g = E->value;
-		if (g.nodes.is_empty()) {
+		if (g.get_member_count() == 0) {
 			return;
 		}
 
@@ -483,6 +600,11 @@ bool SceneTree::process(double p_time) {
 
 	process_time = p_time;
 
+	layout_measured_last_frame = layout_measured_count;
+	layout_arranged_last_frame = layout_arranged_count;
+	layout_measured_count = 0;
+	layout_arranged_count = 0;
+
 	emit_signal(SNAME("process_frame"));
 
 	MessageQueue::get_singleton()->flush(); //small little hack
@@ -704,73 +826,299 @@ bool SceneTree::is_paused() const {
 	return paused;
 }
 
-void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
-	// When reading this function, keep in mind that this code must work in a way where
-	// if any node is removed, this needs to continue working.
+void SceneTree::_resolve_process_callback(ProcessEntry &r_entry, bool p_physics) {
+	const Node *node = r_entry.node;
 
-	p_group->call_queue.flush(); // Flush messages before processing.
+	if (r_entry.native_callback == PROCESS_CALLBACK_UNRESOLVED) {
+		// Any native class may handle the public process notifications in _notification(), so only a plain
+		// Node is known to just forward them to the virtual call. Everything else keeps the notification path.
+		r_entry.native_callback = PROCESS_CALLBACK_NOTIFICATION;
+		if (!node->_get_extension() && node->get_class_name() == SNAME("Node")) {
+			r_entry.native_callback = PROCESS_CALLBACK_NONE;
+		}
+	}
 
-	Vector<Node *> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
-	if (nodes.is_empty()) {
+	ScriptInstance *si = node->get_script_instance();
+	r_entry.script_instance = si;
+	r_entry.script_instance_version = node->get_script_instance_version();
+	r_entry.script_version = ScriptServer::get_script_version();
+
+	if (r_entry.native_callback == PROCESS_CALLBACK_NOTIFICATION) {
+		r_entry.callback = PROCESS_CALLBACK_NOTIFICATION;
+	} else if (!si || si->is_placeholder()) {
+		r_entry.callback = PROCESS_CALLBACK_NONE;
+	} else if (si->has_method(SNAME("_notification"))) {
+		r_entry.callback = PROCESS_CALLBACK_NOTIFICATION;
+	} else {
+		r_entry.callback = si->has_method(p_physics ? SNAME("_physics_process") : SNAME("_process")) ? PROCESS_CALLBACK_SCRIPT : PROCESS_CALLBACK_NONE;
+	}
+}
+
+void SceneTree::_process_list_remove(ProcessList &p_list, Node *p_node, bool p_physics) {
+	int32_t &index = p_physics ? p_node->data.physics_process_list_index : p_node->data.process_list_index;
+	if (index < 0) {
+		int64_t pending_index = p_list.pending.find(p_node);
+		ERR_FAIL_COND(pending_index < 0);
+		p_list.pending.remove_at_unordered(pending_index);
 		return;
 	}
 
-	if (p_physics) {
-		if (p_group->physics_node_order_dirty) {
-			nodes.sort_custom<Node::ComparatorWithPhysicsPriority>();
-			p_group->physics_node_order_dirty = false;
+	ERR_FAIL_COND(uint32_t(index) >= p_list.entries.size() || p_list.entries[index].node != p_node);
+	// Keep the entry in place, as the list may be iterated right now.
+	p_list.entries[index].removed = true;
+	p_list.removed_count++;
+	index = -1;
+}
+
+void SceneTree::_process_list_update(ProcessList &p_list, bool p_physics) {
+	LocalVector<ProcessEntry> &entries = p_list.entries;
+
+	if (p_list.removed_count) {
+		uint32_t to = 0;
+		for (uint32_t i = 0; i < entries.size(); i++) {
+			if (entries[i].removed) {
+				continue;
+			}
+			if (to != i) {
+				entries[to] = entries[i];
+			}
+			if (p_physics) {
+				entries[to].node->data.physics_process_list_index = to;
+			} else {
+				entries[to].node->data.process_list_index = to;
+			}
+			to++;
+		}
+		entries.resize(to);
+		p_list.removed_count = 0;
+	}
+
+	if (p_list.order_dirty) {
+		// Moving a node changes the tree order of its whole subtree, so the entries are sorted again.
+		if (p_physics) {
+			entries.sort_custom<ProcessEntryComparator<Node::ComparatorWithPhysicsPriority>>();
+		} else {
+			entries.sort_custom<ProcessEntryComparator<Node::ComparatorWithPriority>>();
+		}
+		for (uint32_t i = 0; i < entries.size(); i++) {
+			if (p_physics) {
+				entries[i].node->data.physics_process_list_index = i;
+			} else {
+				entries[i].node->data.process_list_index = i;
+			}
 		}
+		p_list.order_dirty = false;
+	}
+
+	if (p_list.pending.is_empty()) {
+		return;
+	}
+
+	// Sort only what was added, then merge it from the back into the already sorted entries.
+	if (p_physics) {
+		p_list.pending.sort_custom<Node::ComparatorWithPhysicsPriority>();
 	} else {
-		if (p_group->node_order_dirty) {
-			nodes.sort_custom<Node::ComparatorWithPriority>();
-			p_group->node_order_dirty = false;
+		p_list.pending.sort_custom<Node::ComparatorWithPriority>();
+	}
+
+	int64_t from_entries = int64_t(entries.size()) - 1;
+	int64_t from_pending = int64_t(p_list.pending.size()) - 1;
+	int64_t to = int64_t(entries.size() + p_list.pending.size()) - 1;
+	entries.resize(entries.size() + p_list.pending.size());
+
+	while (from_pending >= 0) {
+		Node *added = p_list.pending[from_pending];
+		bool added_first = from_entries >= 0 && (p_physics ? Node::ComparatorWithPhysicsPriority()(added, entries[from_entries].node) : Node::ComparatorWithPriority()(added, entries[from_entries].node));
+		if (added_first) {
+			entries[to] = entries[from_entries--];
+		} else {
+			entries[to] = ProcessEntry();
+			entries[to].node = added;
+			from_pending--;
+		}
+		if (p_physics) {
+			entries[to].node->data.physics_process_list_index = to;
+		} else {
+			entries[to].node->data.process_list_index = to;
 		}
+		to--;
 	}
 
-	// Make a copy, so if nodes are added/removed from process, this does not break
-	Vector<Node *> nodes_copy = nodes;
+	p_list.pending.clear();
+}
 
-	uint32_t node_count = nodes_copy.size();
-	Node **nodes_ptr = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
+void SceneTree::_process_entries(ProcessList &p_list, uint32_t p_from, uint32_t p_to, bool p_physics) {
+	// When reading this function, keep in mind that this code must work in a way where
+	// if any node is removed, this needs to continue working.
+
+	// Entries are never reallocated while iterating: nodes added during the pass are pending until the
+	// next one, and removed ones are only flagged.
+	ProcessEntry *entries_ptr = p_list.entries.ptr();
 
-	for (uint32_t i = 0; i < node_count; i++) {
-		Node *n = nodes_ptr[i];
+	const uint32_t script_version = ScriptServer::get_script_version();
+	const StringName &callback_name = p_physics ? SNAME("_physics_process") : SNAME("_process");
+	const Variant delta = p_physics ? physics_process_time : process_time;
+	const Variant *args[1] = { &delta };
+
+	for (uint32_t i = p_from; i < p_to; i++) {
+		ProcessEntry &entry = entries_ptr[i];
+		Node *n = entry.node;
 		if (nodes_removed_on_group_call.has(n)) {
 			// Node may have been removed during process, skip it.
 			// Keep in mind removals can only happen on the main thread.
 			continue;
 		}
 
+		bool internal = p_physics ? n->data.physics_process_internal : n->data.process_internal;
+		bool process = p_physics ? n->data.physics_process : n->data.process;
+
+		if (process) {
+			if (entry.callback == PROCESS_CALLBACK_UNRESOLVED || entry.script_instance_version != n->get_script_instance_version() || entry.script_version != script_version) {
+				_resolve_process_callback(entry, p_physics);
+			}
+			if (entry.callback == PROCESS_CALLBACK_NONE) {
+				process = false;
+			}
+		}
+
+		if (!internal && !process) {
+			continue; // Nothing to do for this node.
+		}
+
 		if (!n->can_process() || !n->is_inside_tree()) {
 			continue;
 		}
 
-		if (p_physics) {
-			if (n->is_physics_processing_internal()) {
-				n->notification(Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
-			}
-			if (n->is_physics_processing()) {
-				n->notification(Node::NOTIFICATION_PHYSICS_PROCESS);
-			}
-		} else {
-			if (n->is_processing_internal()) {
-				n->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
-			}
-			if (n->is_processing()) {
-				n->notification(Node::NOTIFICATION_PROCESS);
+		if (internal) {
+			n->notification(p_physics ? Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS : Node::NOTIFICATION_INTERNAL_PROCESS);
+		}
+
+		if (process) {
+			if (entry.callback == PROCESS_CALLBACK_SCRIPT && entry.script_instance_version == n->get_script_instance_version() && entry.script_version == ScriptServer::get_script_version()) {
+				Callable::CallError ce;
+				entry.script_instance->callp(callback_name, args, 1, ce);
+			} else {
+				n->notification(p_physics ? Node::NOTIFICATION_PHYSICS_PROCESS : Node::NOTIFICATION_PROCESS);
 			}
 		}
 	}
+}
+
+void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
+	uint64_t from_usec = process_groups_profiling ? OS::get_singleton()->get_ticks_usec() : 0;
+
+	p_group->call_queue.flush(); // Flush messages before processing.
+
+	ProcessList &list = p_physics ? p_group->physics_process_list : p_group->process_list;
+	if (!list.is_empty()) {
+		_process_list_update(list, p_physics);
+		_process_entries(list, 0, list.entries.size(), p_physics);
+
+		p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
+	}
 
-	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
+	if (process_groups_profiling) {
+		p_group->process_usec.add(OS::get_singleton()->get_ticks_usec() - from_usec);
+	}
 }
 
 void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
-	Node::current_process_thread_group = local_process_group_cache[p_index]->owner;
-	_process_group(local_process_group_cache[p_index], p_physics);
+	const ProcessChunk &chunk = local_process_chunk_cache[p_index];
+	Node::current_process_thread_group = chunk.group->owner;
+	if (chunk.to == 0) {
+		_process_group(chunk.group, p_physics);
+	} else {
+		uint64_t from_usec = process_groups_profiling ? OS::get_singleton()->get_ticks_usec() : 0;
+		_process_entries(p_physics ? chunk.group->physics_process_list : chunk.group->process_list, chunk.from, chunk.to, p_physics);
+		if (process_groups_profiling) {
+			chunk.group->process_usec.add(OS::get_singleton()->get_ticks_usec() - from_usec);
+		}
+	}
 	Node::current_process_thread_group = nullptr;
 }
 
+void SceneTree::_process_groups_threaded(bool p_physics) {
+	// Groups with a chunk size have their nodes split over several tasks, so a single large group
+	// does not serialize the whole batch. Their lists and messages are handled here instead.
+	local_process_chunk_cache.clear();
+	for (ProcessGroup *pg : local_process_group_cache) {
+		pg->running_on_thread = true;
+
+		ProcessList &list = p_physics ? pg->physics_process_list : pg->process_list;
+		uint32_t chunk_size = pg->owner->data.process_thread_group_chunk_size;
+		uint32_t node_count = list.entries.size() - list.removed_count + list.pending.size();
+		if (chunk_size == 0 || node_count <= chunk_size) {
+			local_process_chunk_cache.push_back({ pg, 0, 0 });
+			continue;
+		}
+
+		Node::current_process_thread_group = pg->owner;
+		pg->call_queue.flush();
+		Node::current_process_thread_group = nullptr;
+
+		_process_list_update(list, p_physics);
+		for (uint32_t from = 0; from < list.entries.size(); from += chunk_size) {
+			local_process_chunk_cache.push_back({ pg, from, MIN(from + chunk_size, list.entries.size()) });
+		}
+	}
+
+	WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_chunk_cache.size(), -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+
+	for (ProcessGroup *pg : local_process_group_cache) {
+		pg->running_on_thread = false;
+	}
+
+	for (const ProcessChunk &chunk : local_process_chunk_cache) {
+		if (chunk.to != 0 && chunk.from == 0) {
+			// Flush messages of split groups once all their chunks are done.
+			Node::current_process_thread_group = chunk.group->owner;
+			chunk.group->call_queue.flush();
+			Node::current_process_thread_group = nullptr;
+		}
+	}
+}
+
+void SceneTree::_add_process_group_times(bool p_physics) {
+	Array values;
+	values.push_back(p_physics ? "physics_process_groups" : "process_groups");
+
+	for (ProcessGroup *pg : process_groups) {
+		uint64_t usec = pg->process_usec.get();
+		if (pg->removed || usec == 0) {
+			continue;
+		}
+		pg->process_usec.set(0);
+		values.push_back(pg->owner ? String(pg->owner->get_path()) : String("Default"));
+		values.push_back(USEC_TO_SEC(usec));
+	}
+
+	if (values.size() > 1) {
+		EngineDebugger::profiler_add_frame_data(SNAME("servers"), values);
+	}
+}
+
+#ifdef DEBUG_ENABLED
+void SceneTree::_check_thread_group_access(const Node *p_accessor_group, const Node *p_node) {
+	const ProcessGroup *pg = (const ProcessGroup *)p_node->data.process_group;
+	if (!pg->running_on_thread || pg->owner == p_accessor_group) {
+		return;
+	}
+
+	// Report each pair of groups only once.
+	uint64_t key = hash_murmur3_one_64(uint64_t(p_accessor_group->get_instance_id()), hash_murmur3_one_64(uint64_t(pg->owner->get_instance_id())));
+	{
+		MutexLock lock(thread_group_conflict_mutex);
+		if (thread_group_conflicts_reported.has(key)) {
+			return;
+		}
+		thread_group_conflicts_reported.insert(key);
+	}
+
+	WARN_PRINT(vformat("Thread group of node %s accessed node %s, which belongs to thread group of node %s processing at the same time. Use call_deferred_thread_group() or set a different process_thread_group_order instead.", p_accessor_group->get_description(), p_node->get_description(), pg->owner->get_description()));
+}
+#endif
+
 void SceneTree::_process(bool p_physics) {
 	if (process_groups_dirty) {
 		{
@@ -810,6 +1158,7 @@ void SceneTree::_process(bool p_physics) {
 	}
 
 	process_last_pass++; // Increment pass
+	process_groups_profiling = EngineDebugger::is_active() && EngineDebugger::is_profiling(SNAME("servers"));
 	uint32_t from = 0;
 	uint32_t process_count = 0;
 	nodes_removed_on_group_call_lock++;
@@ -840,8 +1189,7 @@ void SceneTree::_process(bool p_physics) {
 				}
 
 				if (using_threads) {
-					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
-					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+					_process_groups_threaded(p_physics);
 				}
 			}
 
@@ -864,13 +1212,13 @@ void SceneTree::_process(bool p_physics) {
 		// Validate group for processing
 		bool process_valid = false;
 		if (p_physics) {
-			if (!pg->physics_nodes.is_empty()) {
+			if (!pg->physics_process_list.is_empty()) {
 				process_valid = true;
 			} else if ((pg == &default_process_group || (pg->owner != nullptr && pg->owner->data.process_thread_messages.has_flag(Node::FLAG_PROCESS_THREAD_MESSAGES_PHYSICS))) && pg->call_queue.has_messages()) {
 				process_valid = true;
 			}
 		} else {
-			if (!pg->nodes.is_empty()) {
+			if (!pg->process_list.is_empty()) {
 				process_valid = true;
 			} else if ((pg == &default_process_group || (pg->owner != nullptr && pg->owner->data.process_thread_messages.has_flag(Node::FLAG_PROCESS_THREAD_MESSAGES))) && pg->call_queue.has_messages()) {
 				process_valid = true;
@@ -883,6 +1231,10 @@ void SceneTree::_process(bool p_physics) {
 		}
 	}
 
+	if (process_groups_profiling) {
+		_add_process_group_times(p_physics);
+	}
+
 	nodes_removed_on_group_call_lock--;
 	if (nodes_removed_on_group_call_lock == 0) {
 		nodes_removed_on_group_call.clear();
@@ -932,13 +1284,11 @@ void SceneTree::_remove_node_from_process_group(Node *p_node, Node *p_owner) {
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
-		bool found = pg->nodes.erase(p_node);
-		ERR_FAIL_COND(!found);
+		_process_list_remove(pg->process_list, p_node, false);
 	}
 
 	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
-		bool found = pg->physics_nodes.erase(p_node);
-		ERR_FAIL_COND(!found);
+		_process_list_remove(pg->physics_process_list, p_node, true);
 	}
 }
 
@@ -947,13 +1297,24 @@ void SceneTree::_add_node_to_process_group(Node *p_node, Node *p_owner) {
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
-		pg->nodes.push_back(p_node);
-		pg->node_order_dirty = true;
+		pg->process_list.pending.push_back(p_node);
 	}
 
 	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
-		pg->physics_nodes.push_back(p_node);
-		pg->physics_node_order_dirty = true;
+		pg->physics_process_list.pending.push_back(p_node);
+	}
+}
+
+void SceneTree::_node_process_order_changed(Node *p_node, Node *p_owner) {
+	_THREAD_SAFE_METHOD_
+	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
+
+	if (p_node->is_processing() || p_node->is_processing_internal()) {
+		pg->process_list.order_dirty = true;
+	}
+
+	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
+		pg->physics_process_list.order_dirty = true;
 	}
 }
 
@@ -967,7 +1328,7 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 			return;
 		}
 		Group &g = E->value;
-		if (g.nodes.is_empty()) {
+		if (g.get_member_count() == 0) {
 			return;
 		}
 
@@ -1157,6 +1518,77 @@ void SceneTree::_flush_delete_queue() {
 	}
 }
 
+void SceneTree::_queue_layout_flush() {
+	if (layout_flush_queued) {
+		return;
+	}
+
+	// Runs where the individual deferred updates used to run, so code relying on
+	// layout being done by the next deferred call keeps working.
+	MessageQueue::get_singleton()->push_callable(callable_mp(this, &SceneTree::_flush_layout));
+	layout_flush_queued = true;
+}
+
+void SceneTree::_queue_layout_measure(Control *p_control) {
+	LayoutEntry entry;
+	entry.id = p_control->get_instance_id();
+	entry.depth = static_cast<Node *>(p_control)->data.depth;
+
+	layout_measure_queue.push_back(entry);
+	SortArray<LayoutEntry, LayoutMeasureOrder> sorter;
+	sorter.push_heap(0, layout_measure_queue.size() - 1, 0, entry, layout_measure_queue.ptr());
+
+	_queue_layout_flush();
+}
+
+void SceneTree::_queue_layout_arrange(Container *p_container) {
+	LayoutEntry entry;
+	entry.id = p_container->get_instance_id();
+	entry.depth = static_cast<Node *>(p_container)->data.depth;
+
+	layout_arrange_queue.push_back(entry);
+	SortArray<LayoutEntry, LayoutArrangeOrder> sorter;
+	sorter.push_heap(0, layout_arrange_queue.size() - 1, 0, entry, layout_arrange_queue.ptr());
+
+	_queue_layout_flush();
+}
+
+void SceneTree::_flush_layout() {
+	SortArray<LayoutEntry, LayoutMeasureOrder> measure_sorter;
+	SortArray<LayoutEntry, LayoutArrangeOrder> arrange_sorter;
+
+	// Sorting can change minimum sizes again (e.g. wrapped text), and minimum size
+	// changes queue new sorts, so alternate until both queues are drained. Anything
+	// queued while flushing is handled here rather than in another deferred call.
+	while (!layout_measure_queue.is_empty() || !layout_arrange_queue.is_empty()) {
+		while (!layout_measure_queue.is_empty()) {
+			LayoutEntry entry = layout_measure_queue[0];
+			measure_sorter.pop_heap(0, layout_measure_queue.size(), layout_measure_queue.ptr());
+			layout_measure_queue.resize(layout_measure_queue.size() - 1);
+
+			Control *control = Object::cast_to<Control>(ObjectDB::get_instance(entry.id));
+			if (control) {
+				control->_update_minimum_size();
+				layout_measured_count++;
+			}
+		}
+
+		while (!layout_arrange_queue.is_empty() && layout_measure_queue.is_empty()) {
+			LayoutEntry entry = layout_arrange_queue[0];
+			arrange_sorter.pop_heap(0, layout_arrange_queue.size(), layout_arrange_queue.ptr());
+			layout_arrange_queue.resize(layout_arrange_queue.size() - 1);
+
+			Container *container = Object::cast_to<Container>(ObjectDB::get_instance(entry.id));
+			if (container) {
+				container->_sort_children();
+				layout_arranged_count++;
+			}
+		}
+	}
+
+	layout_flush_queued = false;
+}
+
 void SceneTree::queue_delete(Object *p_object) {
 	_THREAD_SAFE_METHOD_
 	ERR_FAIL_NULL(p_object);
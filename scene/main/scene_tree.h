@@ -38,6 +38,8 @@
 
 #undef Window
 
+class Container;
+class Control;
 class PackedScene;
 class Node;
 class Window;
@@ -86,15 +88,52 @@ public:
 private:
 	CallQueue::Allocator *process_group_call_queue_allocator = nullptr;
 
+	enum ProcessCallback : uint8_t {
+		PROCESS_CALLBACK_UNRESOLVED,
+		PROCESS_CALLBACK_NONE, // Nothing would handle the notification, skip it.
+		PROCESS_CALLBACK_SCRIPT, // Only the script implements the callback, call it directly.
+		PROCESS_CALLBACK_NOTIFICATION, // Send the notification through the whole class hierarchy.
+	};
+
+	struct ProcessEntry {
+		Node *node = nullptr;
+		ScriptInstance *script_instance = nullptr; // Instance the callback was resolved for.
+		uint32_t script_instance_version = 0;
+		uint32_t script_version = 0;
+		ProcessCallback callback = PROCESS_CALLBACK_UNRESOLVED;
+		ProcessCallback native_callback = PROCESS_CALLBACK_UNRESOLVED; // Resolved once, the class never changes.
+		bool removed = false; // Left the list, dropped before the next pass.
+	};
+
+	template <class C>
+	struct ProcessEntryComparator {
+		_FORCE_INLINE_ bool operator()(const ProcessEntry &p_a, const ProcessEntry &p_b) const { return C()(p_a.node, p_b.node); }
+	};
+
+	struct ProcessList {
+		LocalVector<ProcessEntry> entries; // Kept sorted by priority and tree order.
+		LocalVector<Node *> pending; // Added since the last pass, merged into entries before processing.
+		uint32_t removed_count = 0;
+		bool order_dirty = false; // Nodes were moved in the tree, entries must be sorted again.
+
+		_FORCE_INLINE_ bool is_empty() const { return entries.size() == removed_count && pending.is_empty(); }
+	};
+
 	struct ProcessGroup {
 		CallQueue call_queue;
-		Vector<Node *> nodes;
-		Vector<Node *> physics_nodes;
-		bool node_order_dirty = true;
-		bool physics_node_order_dirty = true;
+		ProcessList process_list;
+		ProcessList physics_process_list;
 		bool removed = false;
+		bool running_on_thread = false; // Processed concurrently with the other groups of its batch.
 		Node *owner = nullptr;
 		uint64_t last_pass = 0;
+		SafeNumeric<uint64_t> process_usec; // Only measured while profiling.
+	};
+
+	struct ProcessChunk {
+		ProcessGroup *group = nullptr;
+		uint32_t from = 0;
+		uint32_t to = 0; // Zero to process the whole group, including its messages.
 	};
 
 	struct ProcessGroupSort {
@@ -106,15 +145,27 @@ private:
 	LocalVector<ProcessGroup *> process_groups;
 	bool process_groups_dirty = true;
 	LocalVector<ProcessGroup *> local_process_group_cache; // Used when processing to group what needs to
+	LocalVector<ProcessChunk> local_process_chunk_cache; // Work items of the sub-thread groups being processed.
 	uint64_t process_last_pass = 1;
+	bool process_groups_profiling = false;
+
+#ifdef DEBUG_ENABLED
+	BinaryMutex thread_group_conflict_mutex;
+	HashSet<uint64_t> thread_group_conflicts_reported;
+#endif
 
 	ProcessGroup default_process_group;
 
 	bool node_threading_disabled = false;
 
 	struct Group {
-		Vector<Node *> nodes;
-		bool changed = false;
+		Vector<Node *> nodes; // Removed members are left as nullptr until the next order update.
+		LocalVector<uint32_t *> member_indices; // Where each member keeps its position in nodes.
+		uint32_t sorted_count = 0; // Members at the front already in tree order, added ones follow.
+		uint32_t removed_count = 0;
+		bool changed = false; // Tree order changed, everything must be sorted again.
+
+		_FORCE_INLINE_ uint32_t get_member_count() const { return nodes.size() - removed_count; }
 	};
 
 	Window *root = nullptr;
@@ -168,6 +219,12 @@ private:
 	void _flush_ugc();
 
 	_FORCE_INLINE_ void _update_group_order(Group &g);
+	void _sort_group(Group &g);
+
+	BinaryMutex group_call_method_cache_mutex;
+	HashMap<Pair<StringName, StringName>, MethodBind *, PairHash<StringName, StringName>> group_call_method_cache;
+	MethodBind *_get_group_call_method(const StringName &p_class, const StringName &p_method);
+	void _group_callp(Node *p_node, const StringName &p_function, const Variant **p_args, int p_argcount, bool p_use_method_cache, const StringName *&r_last_class, MethodBind *&r_last_method);
 
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
 
@@ -197,19 +254,66 @@ private:
 	void remove_from_group(const StringName &p_group, Node *p_node);
 	void make_group_changed(const StringName &p_group);
 
+	static void _resolve_process_callback(ProcessEntry &r_entry, bool p_physics);
+	static void _process_list_remove(ProcessList &p_list, Node *p_node, bool p_physics);
+	static void _process_list_update(ProcessList &p_list, bool p_physics);
+
+	void _process_entries(ProcessList &p_list, uint32_t p_from, uint32_t p_to, bool p_physics);
 	void _process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
+	void _process_groups_threaded(bool p_physics);
+	void _add_process_group_times(bool p_physics);
+#ifdef DEBUG_ENABLED
+	void _check_thread_group_access(const Node *p_accessor_group, const Node *p_node);
+#endif
 	void _process(bool p_physics);
 
 	void _remove_process_group(Node *p_node);
 	void _add_process_group(Node *p_node);
 	void _remove_node_from_process_group(Node *p_node, Node *p_owner);
 	void _add_node_to_process_group(Node *p_node, Node *p_owner);
+	void _node_process_order_changed(Node *p_node, Node *p_owner);
 
 	void _call_group_flags(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 	void _call_group(const Variant **p_args, int p_argcount, Callable::CallError &r_error);
 
 	void _flush_delete_queue();
+
+	// Batched GUI layout. Controls whose minimum size may have changed and containers
+	// that need to sort their children are collected here and handled in a single
+	// deferred pass: minimum sizes are computed deepest first (so each parent sees
+	// all of its children's changes at once), then containers are sorted shallowest
+	// first (so children are sorted after their final rect is known).
+	struct LayoutEntry {
+		ObjectID id;
+		int depth = 0;
+	};
+
+	struct LayoutMeasureOrder {
+		_FORCE_INLINE_ bool operator()(const LayoutEntry &p_a, const LayoutEntry &p_b) const { return p_a.depth < p_b.depth; }
+	};
+
+	struct LayoutArrangeOrder {
+		_FORCE_INLINE_ bool operator()(const LayoutEntry &p_a, const LayoutEntry &p_b) const { return p_a.depth > p_b.depth; }
+	};
+
+	LocalVector<LayoutEntry> layout_measure_queue;
+	LocalVector<LayoutEntry> layout_arrange_queue;
+	bool layout_flush_queued = false;
+
+	uint32_t layout_measured_count = 0;
+	uint32_t layout_arranged_count = 0;
+	uint32_t layout_measured_last_frame = 0;
+	uint32_t layout_arranged_last_frame = 0;
+
+	friend class Control;
+	friend class Container;
+
+	void _queue_layout_flush();
+	void _queue_layout_measure(Control *p_control);
+	void _queue_layout_arrange(Container *p_container);
+	void _flush_layout();
+
 	// Optimization.
 	friend class CanvasItem;
 	friend class Viewport;
@@ -334,6 +438,9 @@ public:
 
 	int get_node_count() const;
 
+	uint32_t get_layout_measured_count() const { return layout_measured_last_frame; }
+	uint32_t get_layout_arranged_count() const { return layout_arranged_last_frame; }
+
 	void queue_delete(Object *p_object);
 
 	void get_nodes_in_group(const StringName &p_group, List<Node *> *p_list);
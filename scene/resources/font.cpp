@@ -914,6 +914,7 @@ void FontFile::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_size_cache_list", "cache_index"), &FontFile::get_size_cache_list);
 	ClassDB::bind_method(D_METHOD("clear_size_cache", "cache_index"), &FontFile::clear_size_cache);
 	ClassDB::bind_method(D_METHOD("remove_size_cache", "cache_index", "size"), &FontFile::remove_size_cache);
+	ClassDB::bind_method(D_METHOD("compact_size_cache", "cache_index", "size", "max_unused_frames"), &FontFile::compact_size_cache, DEFVAL(-1));
 
 	ClassDB::bind_method(D_METHOD("set_variation_coordinates", "cache_index", "variation_coordinates"), &FontFile::set_variation_coordinates);
 	ClassDB::bind_method(D_METHOD("get_variation_coordinates", "cache_index"), &FontFile::get_variation_coordinates);
@@ -2268,6 +2269,14 @@ void FontFile::remove_size_cache(int p_cache_index, const Vector2i &p_size) {
 	TS->font_remove_size_cache(cache[p_cache_index], p_size);
 }
 
+void FontFile::compact_size_cache(int p_cache_index, const Vector2i &p_size, int64_t p_max_unused_frames) {
+	ERR_FAIL_COND(p_cache_index < 0);
+	_ensure_rid(p_cache_index);
+	TS->font_compact_size_cache(cache[p_cache_index], p_size, p_max_unused_frames);
+	// The glyphs moved to new textures, everything that drew them must be redrawn.
+	emit_changed();
+}
+
 void FontFile::set_variation_coordinates(int p_cache_index, const Dictionary &p_variation_coordinates) {
 	ERR_FAIL_COND(p_cache_index < 0);
 	_ensure_rid(p_cache_index);
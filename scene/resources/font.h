@@ -277,6 +277,7 @@ public:
 	virtual TypedArray<Vector2i> get_size_cache_list(int p_cache_index) const;
 	virtual void clear_size_cache(int p_cache_index);
 	virtual void remove_size_cache(int p_cache_index, const Vector2i &p_size);
+	virtual void compact_size_cache(int p_cache_index, const Vector2i &p_size, int64_t p_max_unused_frames = -1);
 
 	virtual void set_variation_coordinates(int p_cache_index, const Dictionary &p_variation_coordinates);
 	virtual Dictionary get_variation_coordinates(int p_cache_index) const;
@@ -122,6 +122,105 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 	return remap_resource;
 }
 
+const SceneState::InstantiationPlan *SceneState::_get_instantiation_plan() const {
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan) {
+		return instantiation_plan;
+	}
+
+	InstantiationPlan *plan = memnew(InstantiationPlan);
+
+	int nc = nodes.size();
+	const NodeData *nd = nodes.ptr();
+	plan->nodes.resize(nc);
+	{
+		RWLockRead read_lock(ClassDB::lock);
+
+		for (int i = 0; i < nc; i++) {
+			const NodeData &n = nd[i];
+			InstantiationPlan::NodePlan &node_plan = plan->nodes[i];
+
+			if (i > 0 && n.parent >= 0 && !(n.parent & FLAG_ID_IS_PATH) && n.parent < nc) {
+				plan->nodes[n.parent].child_count++;
+			}
+
+			if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANTIATED) {
+				continue; // Not created from its class.
+			}
+			ERR_CONTINUE(n.type < 0 || n.type >= names.size());
+
+			const ClassDB::ClassInfo *ti = ClassDB::classes.getptr(names[n.type]);
+			if (!ti || ti->disabled || !ti->creation_func || ti->gdextension) {
+				continue; // Let ClassDB::instantiate() handle it, including reporting errors.
+			}
+#ifdef TOOLS_ENABLED
+			if (ti->api == ClassDB::API_EDITOR) {
+				continue;
+			}
+#endif
+			node_plan.creation_func = ti->creation_func;
+
+			int nprop_count = n.properties.size();
+			node_plan.setters.resize(nprop_count);
+			for (int j = 0; j < nprop_count; j++) {
+				const NodeData::Property &prop = n.properties[j];
+				node_plan.setters[j] = nullptr;
+
+				if ((prop.name & FLAG_PATH_PROPERTY_IS_NODE) || prop.name >= names.size() || prop.value < 0 || prop.value >= variants.size()) {
+					continue;
+				}
+				const StringName &prop_name = names[prop.name];
+				if (prop_name == CoreStringNames::get_singleton()->_script) {
+					continue;
+				}
+				// Resources and arrays may need to be adapted before being set.
+				Variant::Type value_type = variants[prop.value].get_type();
+				if (value_type == Variant::OBJECT || value_type == Variant::ARRAY) {
+					continue;
+				}
+
+				// Same lookup as ClassDB::set_property().
+				for (const ClassDB::ClassInfo *check = ti; check; check = check->inherits_ptr) {
+					const ClassDB::PropertySetGet *psg = check->property_setget.getptr(prop_name);
+					if (psg) {
+						if (psg->_setptr) {
+							node_plan.setters[j] = psg;
+						}
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	int cc = connections.size();
+	const ConnectionData *cdata = connections.ptr();
+	plan->connection_binds.resize(cc);
+	for (int i = 0; i < cc; i++) {
+		const ConnectionData &c = cdata[i];
+		if (c.unbinds > 0) {
+			continue;
+		}
+		Vector<Variant> &binds = plan->connection_binds[i];
+		binds.resize(c.binds.size());
+		for (int j = 0; j < c.binds.size(); j++) {
+			ERR_CONTINUE(c.binds[j] < 0 || c.binds[j] >= variants.size());
+			binds.write[j] = variants[c.binds[j]];
+		}
+	}
+
+	instantiation_plan = plan;
+	return plan;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan) {
+		memdelete(instantiation_plan);
+		instantiation_plan = nullptr;
+	}
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -159,6 +258,9 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	bool gen_node_path_cache = p_edit_state != GEN_EDIT_STATE_DISABLED && node_path_cache.is_empty();
 
+	// The editor states do extra work per node, so only plain runtime instantiation uses the plan.
+	const InstantiationPlan *plan = p_edit_state == GEN_EDIT_STATE_DISABLED ? _get_instantiation_plan() : nullptr;
+
 	HashMap<Ref<Resource>, Ref<Resource>> resources_local_to_scene;
 
 	LocalVector<DeferredNodePathProperties> deferred_node_paths;
@@ -188,6 +290,7 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 		Node *node = nullptr;
 		MissingNode *missing_node = nullptr;
+		const InstantiationPlan::NodePlan *node_plan = nullptr; // Only set if the node was created from the plan.
 
 		if (i == 0 && base_scene_idx >= 0) {
 			//scene inheritance on root node
@@ -233,10 +336,22 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			}
 		} else {
 			//node belongs to this scene and must be created
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+			Object *obj = nullptr;
+			if (plan && plan->nodes[i].creation_func) {
+				obj = plan->nodes[i].creation_func();
+			} else {
+				obj = ClassDB::instantiate(snames[n.type]);
+			}
 
 			node = Object::cast_to<Node>(obj);
 
+			if (node && plan && plan->nodes[i].creation_func) {
+				node_plan = &plan->nodes[i];
+				if (node_plan->child_count) {
+					node->data.children.reserve(node_plan->child_count);
+				}
+			}
+
 			if (!node) {
 				if (obj) {
 					memdelete(obj);
@@ -315,6 +430,18 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						for (const Pair<StringName, Variant> &E : old_state) {
 							node->set(E.first, E.second);
 						}
+					} else if (node_plan && node_plan->setters[j] && !node->get_script_instance()) {
+						// Plain value and a known setter, call it directly.
+						const ClassDB::PropertySetGet *psg = node_plan->setters[j];
+						Callable::CallError ce;
+						if (psg->index >= 0) {
+							Variant index = psg->index;
+							const Variant *args[2] = { &index, &props[nprops[j].value] };
+							psg->_setptr->call(node, args, 2, ce);
+						} else {
+							const Variant *args[1] = { &props[nprops[j].value] };
+							psg->_setptr->call(node, args, 1, ce);
+						}
 					} else {
 						Variant value = props[nprops[j].value];
 
@@ -526,7 +653,9 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			callable = callable.unbind(c.unbinds);
 		} else if (!c.binds.is_empty()) {
 			Vector<Variant> binds;
-			if (c.binds.size()) {
+			if (plan) {
+				binds = plan->connection_binds[i];
+			} else if (c.binds.size()) {
 				binds.resize(c.binds.size());
 				for (int j = 0; j < c.binds.size(); j++) {
 					binds.write[j] = props[c.binds[j]];
@@ -1115,6 +1244,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1168,6 +1298,7 @@ Ref<SceneState> SceneState::get_base_scene_state() const {
 }
 
 void SceneState::update_instance_resource(String p_path, Ref<PackedScene> p_packed_scene) {
+	_clear_instantiation_plan();
 	ERR_FAIL_COND(p_packed_scene.is_null());
 
 	for (const NodeData &nd : nodes) {
@@ -1315,6 +1446,7 @@ bool SceneState::is_connection(int p_node, const StringName &p_signal, int p_to_
 }
 
 void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
+	_clear_instantiation_plan();
 	ERR_FAIL_COND(!p_dictionary.has("names"));
 	ERR_FAIL_COND(!p_dictionary.has("variants"));
 	ERR_FAIL_COND(!p_dictionary.has("node_count"));
@@ -1784,6 +1916,7 @@ int SceneState::add_node_path(const NodePath &p_path) {
 }
 
 int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int p_instance, int p_index) {
+	_clear_instantiation_plan();
 	NodeData nd;
 	nd.parent = p_parent;
 	nd.owner = p_owner;
@@ -1798,6 +1931,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 }
 
 void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_deferred_node_path) {
+	_clear_instantiation_plan();
 	ERR_FAIL_INDEX(p_node, nodes.size());
 	ERR_FAIL_INDEX(p_name, names.size());
 	ERR_FAIL_INDEX(p_value, variants.size());
@@ -1818,11 +1952,13 @@ void SceneState::add_node_group(int p_node, int p_group) {
 }
 
 void SceneState::set_base_scene(int p_idx) {
+	_clear_instantiation_plan();
 	ERR_FAIL_INDEX(p_idx, variants.size());
 	base_scene_idx = p_idx;
 }
 
 void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method, int p_flags, int p_unbinds, const Vector<int> &p_binds) {
+	_clear_instantiation_plan();
 	ERR_FAIL_INDEX(p_signal, names.size());
 	ERR_FAIL_INDEX(p_method, names.size());
 
@@ -1889,9 +2025,14 @@ void SceneState::_bind_methods() {
 SceneState::SceneState() {
 }
 
+SceneState::~SceneState() {
+	_clear_instantiation_plan();
+}
+
 ////////////////
 
 void PackedScene::_set_bundled_scene(const Dictionary &p_scene) {
+	clear_pool();
 	state->set_bundled_scene(p_scene);
 }
 
@@ -1900,10 +2041,12 @@ Dictionary PackedScene::_get_bundled_scene() const {
 }
 
 Error PackedScene::pack(Node *p_scene) {
+	clear_pool();
 	return state->pack(p_scene);
 }
 
 void PackedScene::clear() {
+	clear_pool();
 	state->clear();
 }
 
@@ -1927,6 +2070,7 @@ void PackedScene::reload_from_file() {
 	copy_from(s);
 	// Then, we copy the backed-up loaded_state to state
 	state->copy_from(loaded_state);
+	clear_pool();
 }
 
 bool PackedScene::can_instantiate() const {
@@ -1957,6 +2101,7 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 }
 
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	clear_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -1965,6 +2110,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	clear_pool();
 	state = Ref<SceneState>(memnew(SceneState));
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -1972,6 +2118,252 @@ void PackedScene::recreate_state() {
 #endif
 }
 
+void PackedScene::_pool_record_node(Node *p_root, Node *p_node, Vector<PoolNodeTemplate> &r_template) {
+	PoolNodeTemplate node_template;
+	node_template.path = p_root->get_path_to(p_node);
+	node_template.child_count = p_node->get_child_count();
+
+	List<PropertyInfo> plist;
+	p_node->get_property_list(&plist);
+	for (const PropertyInfo &E : plist) {
+		if (!(E.usage & PROPERTY_USAGE_STORAGE) || E.name == CoreStringNames::get_singleton()->_script) {
+			continue;
+		}
+		PoolNodeTemplate::Property property;
+		property.name = E.name;
+		property.value = p_node->get(E.name);
+		Object *obj = property.value.get_validated_object();
+		if (obj) {
+			Node *node = Object::cast_to<Node>(obj);
+			Ref<Resource> res = property.value;
+			if (node) {
+				// Every instance must point to its own copy of the node.
+				if (node != p_root && !p_root->is_ancestor_of(node)) {
+					continue;
+				}
+				property.value = p_root->get_path_to(node);
+				property.node_path = true;
+			} else if (res.is_null() || res->is_local_to_scene()) {
+				// Each instance has its own copy of these, so they can't be shared.
+				continue;
+			}
+		} else {
+			property.value = property.value.duplicate(true);
+		}
+		node_template.properties.push_back(property);
+	}
+	r_template.push_back(node_template);
+
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_pool_record_node(p_root, p_node->get_child(i), r_template);
+	}
+}
+
+// Puts back the properties that changed since instantiation. Returns false, changing nothing,
+// if the node hierarchy itself changed, since then the instance can't be reused.
+bool PackedScene::_pool_reset_instance(Node *p_root, const StringName &p_root_name, const Vector<PoolNodeTemplate> &p_template, uint64_t &r_reset_properties) {
+	const PoolNodeTemplate *templates = p_template.ptr();
+	LocalVector<Node *> template_nodes;
+	template_nodes.resize(p_template.size());
+	for (int i = 0; i < p_template.size(); i++) {
+		Node *node = p_root->get_node_or_null(templates[i].path);
+		if (!node || node->get_child_count() != templates[i].child_count) {
+			return false;
+		}
+		template_nodes[i] = node;
+	}
+
+	p_root->set_name(p_root_name);
+	for (int i = 0; i < p_template.size(); i++) {
+		Node *node = template_nodes[i];
+		for (const PoolNodeTemplate::Property &E : templates[i].properties) {
+			if (E.node_path) {
+				Variant value = p_root->get_node_or_null(E.value);
+				if (node->get(E.name) != value) {
+					node->set(E.name, value);
+					r_reset_properties++;
+				}
+			} else if (node->get(E.name) != E.value) {
+				node->set(E.name, E.value.duplicate(true));
+				r_reset_properties++;
+			}
+		}
+	}
+	return true;
+}
+
+// Instances freed without release_pooled() would stay in the set forever, so drop them
+// whenever it doubled in size since the last time.
+void PackedScene::_pool_prune_instances() {
+	LocalVector<ObjectID> freed;
+	for (const KeyValue<ObjectID, uint32_t> &E : pool_instances) {
+		if (!ObjectDB::get_instance(E.key)) {
+			freed.push_back(E.key);
+		}
+	}
+	for (const ObjectID &id : freed) {
+		pool_instances.erase(id);
+	}
+	pool_instances_prune_size = MAX(64u, pool_instances.size() * 2);
+}
+
+Node *PackedScene::instantiate_pooled(bool p_request_ready) {
+	Node *node = nullptr;
+	{
+		MutexLock lock(pool_mutex);
+		while (!node && !pool.is_empty()) {
+			ObjectID id = pool[pool.size() - 1];
+			pool.resize(pool.size() - 1);
+			node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		}
+		if (node) {
+			pool_stats.hits++;
+			pool_instances.insert(node->get_instance_id(), pool_generation);
+		}
+	}
+
+	if (node) {
+		if (p_request_ready) {
+			node->propagate_call(SNAME("request_ready"));
+		}
+		return node;
+	}
+
+	node = instantiate();
+	ERR_FAIL_NULL_V(node, nullptr);
+
+	bool needs_template = false;
+	uint32_t generation = 0;
+	{
+		MutexLock lock(pool_mutex);
+		needs_template = pool_template.is_empty();
+		generation = pool_generation;
+	}
+
+	// Nobody touched it yet, so this is what every released instance must look like.
+	// Recorded outside the lock, since reading properties may run scripts.
+	Vector<PoolNodeTemplate> node_template;
+	if (needs_template) {
+		_pool_record_node(node, node, node_template);
+	}
+
+	MutexLock lock(pool_mutex);
+	pool_stats.misses++;
+	if (needs_template && pool_template.is_empty() && generation == pool_generation) {
+		pool_root_name = node->get_name();
+		pool_template = node_template;
+	}
+	pool_instances.insert(node->get_instance_id(), pool_generation);
+	if (pool_instances.size() >= pool_instances_prune_size) {
+		_pool_prune_instances();
+	}
+	return node;
+}
+
+void PackedScene::release_pooled(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+
+	StringName root_name;
+	Vector<PoolNodeTemplate> node_template;
+	uint32_t generation = 0;
+	bool reused = false;
+	{
+		MutexLock lock(pool_mutex);
+		const uint32_t *instance_generation = pool_instances.getptr(p_node->get_instance_id());
+		ERR_FAIL_NULL_MSG(instance_generation, "Node was not instantiated with instantiate_pooled() from this scene, or it was already released.");
+		// Instances from before the last clear_pool() may not match the scene anymore.
+		generation = *instance_generation;
+		reused = generation == pool_generation && !pool_template.is_empty() && (int)pool.size() < pool_max_size;
+		pool_instances.erase(p_node->get_instance_id());
+		if (reused) {
+			root_name = pool_root_name;
+			node_template = pool_template;
+		}
+	}
+
+	if (p_node->get_parent()) {
+		p_node->get_parent()->remove_child(p_node);
+	}
+
+	// Setters may run scripts, which must be free to use the pool meanwhile.
+	uint64_t reset_properties = 0;
+	uint64_t reset_start = OS::get_singleton()->get_ticks_usec();
+	if (reused) {
+		reused = _pool_reset_instance(p_node, root_name, node_template, reset_properties);
+	}
+	uint64_t reset_usec = OS::get_singleton()->get_ticks_usec() - reset_start;
+
+	{
+		MutexLock lock(pool_mutex);
+		pool_stats.reset_properties += reset_properties;
+		pool_stats.reset_usec += reset_usec;
+		// The pool may have been filled or cleared while resetting.
+		if (reused && generation == pool_generation && (int)pool.size() < pool_max_size) {
+			pool.push_back(p_node->get_instance_id());
+			pool_stats.released++;
+			return;
+		}
+		pool_stats.discarded++;
+	}
+	memdelete(p_node);
+}
+
+// Only idle instances are freed. Instances still in use can be released later, but won't be reused.
+void PackedScene::clear_pool() {
+	LocalVector<ObjectID> idle;
+	{
+		MutexLock lock(pool_mutex);
+		idle = pool;
+		pool.clear();
+		pool_template.clear();
+		pool_root_name = StringName();
+		pool_stats = PoolStats();
+		pool_generation++;
+	}
+	for (const ObjectID &id : idle) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (node) {
+			memdelete(node);
+		}
+	}
+}
+
+void PackedScene::set_pool_max_size(int p_size) {
+	ERR_FAIL_COND(p_size < 0);
+	LocalVector<ObjectID> excess;
+	{
+		MutexLock lock(pool_mutex);
+		pool_max_size = p_size;
+		while ((int)pool.size() > pool_max_size) {
+			excess.push_back(pool[pool.size() - 1]);
+			pool.resize(pool.size() - 1);
+		}
+	}
+	for (const ObjectID &id : excess) {
+		Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (node) {
+			memdelete(node);
+		}
+	}
+}
+
+int PackedScene::get_pool_max_size() const {
+	return pool_max_size;
+}
+
+Dictionary PackedScene::get_pool_stats() const {
+	MutexLock lock(pool_mutex);
+	Dictionary stats;
+	stats["hits"] = pool_stats.hits;
+	stats["misses"] = pool_stats.misses;
+	stats["released"] = pool_stats.released;
+	stats["discarded"] = pool_stats.discarded;
+	stats["pooled"] = pool.size();
+	stats["reset_properties"] = pool_stats.reset_properties;
+	stats["reset_usec"] = pool_stats.reset_usec;
+	return stats;
+}
+
 Ref<SceneState> PackedScene::get_state() const {
 	return state;
 }
@@ -1988,6 +2380,12 @@ void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
+	ClassDB::bind_method(D_METHOD("instantiate_pooled", "request_ready"), &PackedScene::instantiate_pooled, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("release_pooled", "node"), &PackedScene::release_pooled);
+	ClassDB::bind_method(D_METHOD("clear_pool"), &PackedScene::clear_pool);
+	ClassDB::bind_method(D_METHOD("set_pool_max_size", "size"), &PackedScene::set_pool_max_size);
+	ClassDB::bind_method(D_METHOD("get_pool_max_size"), &PackedScene::get_pool_max_size);
+	ClassDB::bind_method(D_METHOD("get_pool_stats"), &PackedScene::get_pool_stats);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
@@ -2003,3 +2401,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state = Ref<SceneState>(memnew(SceneState));
 }
+
+PackedScene::~PackedScene() {
+	clear_pool();
+}
@@ -32,6 +32,9 @@
 #define PACKED_SCENE_H
 
 #include "core/io/resource.h"
+#include "core/object/class_db.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -89,6 +92,25 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Built on the first runtime instantiation and reused after, so creating
+	// the same scene many times avoids looking up classes and setters by name.
+	struct InstantiationPlan {
+		struct NodePlan {
+			Object *(*creation_func)() = nullptr; // Only set if the node type can be created directly.
+			uint32_t child_count = 0;
+			LocalVector<const ClassDB::PropertySetGet *> setters; // One per property, null if it must go through Object::set().
+		};
+
+		LocalVector<NodePlan> nodes;
+		LocalVector<Vector<Variant>> connection_binds;
+	};
+
+	mutable InstantiationPlan *instantiation_plan = nullptr;
+	mutable BinaryMutex instantiation_plan_mutex;
+
+	const InstantiationPlan *_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -215,6 +237,7 @@ public:
 #endif
 
 	SceneState();
+	~SceneState();
 };
 
 VARIANT_ENUM_CAST(SceneState::GenEditState)
@@ -225,6 +248,42 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	// What a fresh instance looks like, used to reset released instances before reusing them.
+	struct PoolNodeTemplate {
+		struct Property {
+			StringName name;
+			Variant value;
+			bool node_path = false; // Nodes of the instance are kept as a path from its root and looked up per instance.
+		};
+
+		NodePath path;
+		int child_count = 0;
+		LocalVector<Property> properties;
+	};
+
+	struct PoolStats {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t released = 0;
+		uint64_t discarded = 0;
+		uint64_t reset_properties = 0;
+		uint64_t reset_usec = 0;
+	};
+
+	StringName pool_root_name;
+	Vector<PoolNodeTemplate> pool_template; // Shared, not copied, when resetting instances outside the lock.
+	LocalVector<ObjectID> pool;
+	HashMap<ObjectID, uint32_t> pool_instances; // Handed out by instantiate_pooled() and not released yet, with the pool generation they came from.
+	uint32_t pool_instances_prune_size = 64;
+	uint32_t pool_generation = 0;
+	int pool_max_size = 64;
+	PoolStats pool_stats;
+	mutable Mutex pool_mutex;
+
+	static void _pool_record_node(Node *p_root, Node *p_node, Vector<PoolNodeTemplate> &r_template);
+	static bool _pool_reset_instance(Node *p_root, const StringName &p_root_name, const Vector<PoolNodeTemplate> &p_template, uint64_t &r_reset_properties);
+	void _pool_prune_instances();
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -248,6 +307,13 @@ public:
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
+	Node *instantiate_pooled(bool p_request_ready = false);
+	void release_pooled(Node *p_node);
+	void clear_pool();
+	void set_pool_max_size(int p_size);
+	int get_pool_max_size() const;
+	Dictionary get_pool_stats() const;
+
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
 
@@ -264,6 +330,7 @@ public:
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
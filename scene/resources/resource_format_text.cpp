@@ -495,6 +495,11 @@ Error ResourceLoaderText::load() {
 			break;
 		}
 
+		if (ResourceLoader::is_load_cancelled()) {
+			error = ERR_SKIP;
+			return error;
+		}
+
 		if (!next_tag.fields.has("type")) {
 			error = ERR_FILE_CORRUPT;
 			error_text = "Missing 'type' in external resource tag";
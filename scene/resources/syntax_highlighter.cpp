@@ -34,8 +34,15 @@
 #include "scene/gui/text_edit.h"
 
 Dictionary SyntaxHighlighter::get_line_syntax_highlighting(int p_line) {
-	if (highlighting_cache.has(p_line)) {
-		return highlighting_cache[p_line];
+	// Check the lines after the last edit in order, until one ends in the same state as before.
+	while (unverified_line != -1 && p_line >= unverified_line) {
+		highlighting_cache.erase(unverified_line - 1);
+		get_line_syntax_highlighting(unverified_line - 1);
+	}
+
+	RBMap<int, Dictionary>::Element *E = highlighting_cache.find(p_line);
+	if (E) {
+		return E->get();
 	}
 
 	Dictionary color_map;
@@ -48,24 +55,74 @@ Dictionary SyntaxHighlighter::get_line_syntax_highlighting(int p_line) {
 	}
 
 	highlighting_cache[p_line] = color_map;
+
+	if (unverified_line != -1 && p_line == unverified_line - 1) {
+		int state = 0;
+		int next_state = 0;
+		if ((_get_line_end_state(p_line, state) && state == unverified_state) || p_line + 1 >= text_edit->get_line_count()) {
+			unverified_line = -1;
+		} else if (_get_line_end_state(p_line + 1, next_state)) {
+			// The state has changed, so the next line has to be highlighted again as well.
+			highlighting_cache.erase(p_line + 1);
+			unverified_line = p_line + 2;
+			unverified_state = next_state;
+		} else {
+			unverified_line = -1;
+			_erase_cached_lines(p_line + 1);
+			_clear_line_states(p_line + 1);
+		}
+	}
 	return color_map;
 }
 
+void SyntaxHighlighter::_erase_cached_lines(int p_from_line) {
+	RBMap<int, Dictionary>::Element *E = highlighting_cache.back();
+	while (E && E->key() >= p_from_line) {
+		RBMap<int, Dictionary>::Element *prev = E->prev();
+		highlighting_cache.erase(E);
+		E = prev;
+	}
+}
+
 void SyntaxHighlighter::_lines_edited_from(int p_from_line, int p_to_line) {
-	if (highlighting_cache.size() < 1) {
+	// The lines up to p_from_line before the edit are now the lines up to p_to_line,
+	// and the lines after them have moved by the difference.
+	const int first_line = MIN(p_from_line, p_to_line) - 1;
+	const int line_delta = p_to_line - p_from_line;
+
+	int old_state = 0;
+	if (unverified_line != -1 || GDVIRTUAL_IS_OVERRIDDEN(_get_line_syntax_highlighting) || !_get_line_end_state(p_from_line, old_state)) {
+		// Without a state to compare to, every line after the edit has to be highlighted again.
+		unverified_line = -1;
+		_erase_cached_lines(first_line);
+		_clear_line_states(first_line);
 		return;
 	}
 
-	int cache_size = highlighting_cache.back()->key();
-	for (int i = MIN(p_from_line, p_to_line) - 1; i <= cache_size; i++) {
-		if (highlighting_cache.has(i)) {
+	if (line_delta == 0) {
+		for (int i = first_line; i <= p_from_line; i++) {
 			highlighting_cache.erase(i);
 		}
+	} else {
+		RBMap<int, Dictionary> moved;
+		for (const KeyValue<int, Dictionary> &E : highlighting_cache) {
+			if (E.key < first_line) {
+				moved.insert(E.key, E.value);
+			} else if (E.key > p_from_line) {
+				moved.insert(E.key + line_delta, E.value);
+			}
+		}
+		highlighting_cache = moved;
 	}
+	_move_line_states(p_from_line, p_to_line);
+
+	unverified_line = p_to_line + 1;
+	unverified_state = old_state;
 }
 
 void SyntaxHighlighter::clear_highlighting_cache() {
 	highlighting_cache.clear();
+	unverified_line = -1;
 
 	if (GDVIRTUAL_CALL(_clear_highlighting_cache)) {
 		return;
@@ -418,6 +475,49 @@ void CodeHighlighter::_clear_highlighting_cache() {
 	color_region_cache.clear();
 }
 
+bool CodeHighlighter::_get_line_end_state(int p_line, int &r_state) const {
+	const int *state = color_region_cache.getptr(p_line);
+	if (!state) {
+		return false;
+	}
+	r_state = *state;
+	return true;
+}
+
+void CodeHighlighter::_clear_line_states(int p_from_line) {
+	LocalVector<int> erased;
+	for (const KeyValue<int, int> &E : color_region_cache) {
+		if (E.key >= p_from_line) {
+			erased.push_back(E.key);
+		}
+	}
+	for (const int &E : erased) {
+		color_region_cache.erase(E);
+	}
+}
+
+void CodeHighlighter::_move_line_states(int p_from_line, int p_to_line) {
+	const int first_line = MIN(p_from_line, p_to_line) - 1;
+	const int line_delta = p_to_line - p_from_line;
+
+	if (line_delta == 0) {
+		for (int i = first_line; i <= p_from_line; i++) {
+			color_region_cache.erase(i);
+		}
+		return;
+	}
+
+	HashMap<int, int> moved;
+	for (const KeyValue<int, int> &E : color_region_cache) {
+		if (E.key < first_line) {
+			moved.insert(E.key, E.value);
+		} else if (E.key > p_from_line) {
+			moved.insert(E.key + line_delta, E.value);
+		}
+	}
+	color_region_cache = moved;
+}
+
 void CodeHighlighter::_update_cache() {
 	font_color = text_edit->get_font_color();
 }
@@ -41,6 +41,12 @@ class SyntaxHighlighter : public Resource {
 
 private:
 	RBMap<int, Dictionary> highlighting_cache;
+
+	// After an edit, the cached lines from this one on are only valid if the line before it still ends in unverified_state.
+	int unverified_line = -1;
+	int unverified_state = 0;
+
+	void _erase_cached_lines(int p_from_line);
 	void _lines_edited_from(int p_from_line, int p_to_line);
 
 protected:
@@ -59,6 +65,12 @@ public:
 	void clear_highlighting_cache();
 	virtual void _clear_highlighting_cache() {}
 
+	// Highlighters carrying a state from one line to the next (e.g. an unterminated string) can report the state a line ends in,
+	// so edits only highlight again the lines that state reaches, instead of every line after the edit.
+	virtual bool _get_line_end_state(int p_line, int &r_state) const { return false; }
+	virtual void _clear_line_states(int p_from_line) {}
+	virtual void _move_line_states(int p_from_line, int p_to_line) {}
+
 	void update_cache();
 	virtual void _update_cache() {}
 
@@ -102,6 +114,10 @@ public:
 	virtual void _clear_highlighting_cache() override;
 	virtual void _update_cache() override;
 
+	virtual bool _get_line_end_state(int p_line, int &r_state) const override;
+	virtual void _clear_line_states(int p_from_line) override;
+	virtual void _move_line_states(int p_from_line, int p_to_line) override;
+
 	void add_keyword_color(const String &p_keyword, const Color &p_color);
 	void remove_keyword_color(const String &p_keyword);
 	bool has_keyword_color(const String &p_keyword) const;
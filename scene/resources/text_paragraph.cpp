@@ -292,6 +292,20 @@ void TextParagraph::_shape_lines() {
 	}
 }
 
+bool TextParagraph::_is_layout_width_independent(float p_width) const {
+	// The lines only have to be broken again if the paragraph doesn't fit the width, or if they are justified or trimmed to it.
+	if (lines_dirty || alignment == HORIZONTAL_ALIGNMENT_FILL || overrun_behavior != TextServer::OVERRUN_NO_TRIMMING || max_lines_visible >= 0) {
+		return false;
+	}
+	if (!TS->shaped_text_is_ready(rid) || !TS->shaped_text_is_ready(dropcap_rid)) {
+		return false;
+	}
+	if (TS->shaped_text_get_orientation(rid) != TextServer::ORIENTATION_HORIZONTAL || TS->shaped_text_get_size(dropcap_rid) != Size2()) {
+		return false;
+	}
+	return p_width <= 0 || p_width > TS->shaped_text_get_size(rid).x + 1.0;
+}
+
 RID TextParagraph::get_rid() const {
 	return rid;
 }
@@ -317,6 +331,7 @@ void TextParagraph::clear() {
 	lines_rid.clear();
 	TS->shaped_text_clear(rid);
 	TS->shaped_text_clear(dropcap_rid);
+	lines_dirty = true;
 }
 
 void TextParagraph::set_preserve_invalid(bool p_enabled) {
@@ -458,8 +473,10 @@ HorizontalAlignment TextParagraph::get_alignment() const {
 void TextParagraph::tab_align(const Vector<float> &p_tab_stops) {
 	_THREAD_SAFE_METHOD_
 
-	tab_stops = p_tab_stops;
-	lines_dirty = true;
+	if (tab_stops != p_tab_stops) {
+		tab_stops = p_tab_stops;
+		lines_dirty = true;
+	}
 }
 
 void TextParagraph::set_justification_flags(BitField<TextServer::JustificationFlag> p_flags) {
@@ -505,8 +522,10 @@ void TextParagraph::set_width(float p_width) {
 	_THREAD_SAFE_METHOD_
 
 	if (width != p_width) {
+		if (!_is_layout_width_independent(width) || !_is_layout_width_independent(p_width)) {
+			lines_dirty = true;
+		}
 		width = p_width;
-		lines_dirty = true;
 	}
 }
 
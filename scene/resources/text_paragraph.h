@@ -66,6 +66,7 @@ protected:
 	static void _bind_methods();
 
 	void _shape_lines();
+	bool _is_layout_width_independent(float p_width) const;
 
 public:
 	RID get_rid() const;
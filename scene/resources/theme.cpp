@@ -33,6 +33,8 @@
 #include "core/string/print_string.h"
 #include "scene/theme/theme_db.h"
 
+SafeNumeric<uint64_t> Theme::last_version;
+
 // Dynamic properties.
 bool Theme::_set(const StringName &p_name, const Variant &p_value) {
 	String sname = p_name;
@@ -1526,6 +1528,10 @@ Vector<String> Theme::_get_type_list() const {
 
 // Theme bulk manipulations.
 void Theme::_emit_theme_changed(bool p_notify_list_changed) {
+	// Bumped even while propagation is frozen, so resolved items cached in
+	// the meantime are never mistaken for the final state.
+	version = last_version.increment();
+
 	if (no_change_propagation) {
 		return;
 	}
@@ -1764,6 +1770,7 @@ void Theme::_bind_methods() {
 }
 
 Theme::Theme() {
+	version = last_version.increment();
 }
 
 Theme::~Theme() {
@@ -67,6 +67,10 @@ public:
 private:
 	bool no_change_propagation = false;
 
+	// Unique across all themes; changes whenever this theme's data changes.
+	static SafeNumeric<uint64_t> last_version;
+	uint64_t version = 0;
+
 	void _emit_theme_changed(bool p_notify_list_changed = false);
 
 	Vector<String> _get_icon_list(const String &p_theme_type) const;
@@ -118,6 +122,8 @@ public:
 	static bool is_valid_type_name(const String &p_name);
 	static bool is_valid_item_name(const String &p_name);
 
+	uint64_t get_version() const { return version; }
+
 	void set_default_base_scale(float p_base_scale);
 	float get_default_base_scale() const;
 	bool has_default_base_scale() const;
@@ -106,6 +106,7 @@ void ThemeDB::finalize_theme() {
 	}
 
 	_finalize_theme_contexts();
+	clear_theme_item_cache();
 	default_theme.unref();
 
 	fallback_font.unref();
@@ -139,6 +140,7 @@ void ThemeDB::set_fallback_base_scale(float p_base_scale) {
 	}
 
 	fallback_base_scale = p_base_scale;
+	clear_theme_item_cache();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -152,6 +154,7 @@ void ThemeDB::set_fallback_font(const Ref<Font> &p_font) {
 	}
 
 	fallback_font = p_font;
+	clear_theme_item_cache();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -165,6 +168,7 @@ void ThemeDB::set_fallback_font_size(int p_font_size) {
 	}
 
 	fallback_font_size = p_font_size;
+	clear_theme_item_cache();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -178,6 +182,7 @@ void ThemeDB::set_fallback_icon(const Ref<Texture2D> &p_icon) {
 	}
 
 	fallback_icon = p_icon;
+	clear_theme_item_cache();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -191,6 +196,7 @@ void ThemeDB::set_fallback_stylebox(const Ref<StyleBox> &p_stylebox) {
 	}
 
 	fallback_stylebox = p_stylebox;
+	clear_theme_item_cache();
 	emit_signal(SNAME("fallback_changed"));
 }
 
@@ -398,6 +404,53 @@ void ThemeDB::get_class_own_items(const StringName &p_class_name, List<ThemeItem
 	}
 }
 
+// Resolved theme item cache.
+
+uint32_t ThemeDB::ThemeItemCacheKey::hash(const ThemeItemCacheKey &p_key) {
+	uint32_t h = hash_murmur3_one_64(p_key.chain_signature);
+	h = hash_murmur3_one_32(p_key.type_name.hash(), h);
+	h = hash_murmur3_one_32(p_key.type_variation.hash(), h);
+	h = hash_murmur3_one_32(p_key.theme_type.hash(), h);
+	h = hash_murmur3_one_32(p_key.item_name.hash(), h);
+	h = hash_murmur3_one_32(p_key.data_type, h);
+	return hash_fmix32(h);
+}
+
+bool ThemeDB::ThemeItemCacheKey::operator==(const ThemeItemCacheKey &p_key) const {
+	return chain_signature == p_key.chain_signature && data_type == p_key.data_type && item_name == p_key.item_name && theme_type == p_key.theme_type && type_name == p_key.type_name && type_variation == p_key.type_variation;
+}
+
+bool ThemeDB::get_cached_theme_item(const ThemeItemCacheKey &p_key, Variant &r_value, bool &r_found) {
+	MutexLock lock(theme_item_cache_mutex);
+
+	const ThemeItemCacheEntry *entry = theme_item_cache.getptr(p_key);
+	if (!entry) {
+		return false;
+	}
+
+	r_value = entry->value;
+	r_found = entry->found;
+	return true;
+}
+
+void ThemeDB::cache_theme_item(const ThemeItemCacheKey &p_key, const Variant &p_value, bool p_found) {
+	MutexLock lock(theme_item_cache_mutex);
+
+	if (theme_item_cache.size() >= THEME_ITEM_CACHE_MAX_SIZE) {
+		theme_item_cache.clear();
+	}
+
+	ThemeItemCacheEntry entry;
+	entry.value = p_value;
+	entry.found = p_found;
+	theme_item_cache.insert(p_key, entry);
+}
+
+void ThemeDB::clear_theme_item_cache() {
+	MutexLock lock(theme_item_cache_mutex);
+	theme_item_cache.clear();
+}
+
 // Object methods.
 
 void ThemeDB::_bind_methods() {
@@ -443,6 +496,7 @@ ThemeDB::~ThemeDB() {
 	// frees any objects that can be recreated by initialize_theme*().
 
 	_finalize_theme_contexts();
+	clear_theme_item_cache();
 
 	default_theme.unref();
 	project_theme.unref();
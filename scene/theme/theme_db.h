@@ -109,9 +109,37 @@ public:
 		ThemeItemSetter setter;
 	};
 
+	// Shared cache of resolved theme items. Lookups made by different nodes that
+	// share the same chain of themes (and the same state of those themes) resolve
+	// to the same value, so they are stored once, keyed by a signature of the chain.
+
+	struct ThemeItemCacheKey {
+		uint64_t chain_signature = 0;
+		StringName type_name;
+		StringName type_variation;
+		StringName theme_type;
+		StringName item_name;
+		Theme::DataType data_type = Theme::DATA_TYPE_MAX;
+
+		static uint32_t hash(const ThemeItemCacheKey &p_key);
+		bool operator==(const ThemeItemCacheKey &p_key) const;
+	};
+
 private:
 	HashMap<StringName, HashMap<StringName, ThemeItemBind>> theme_item_binds;
 
+	struct ThemeItemCacheEntry {
+		Variant value;
+		bool found = false;
+	};
+
+	// Entries for stale chain signatures are never hit again, so the cache is
+	// simply dropped once it grows past this size.
+	static const uint32_t THEME_ITEM_CACHE_MAX_SIZE = 65536;
+
+	BinaryMutex theme_item_cache_mutex;
+	HashMap<ThemeItemCacheKey, ThemeItemCacheEntry, ThemeItemCacheKey> theme_item_cache;
+
 protected:
 	static void _bind_methods();
 
@@ -164,6 +192,12 @@ public:
 
 	void get_class_own_items(const StringName &p_class_name, List<ThemeItemBind> *r_list);
 
+	// Resolved theme item cache.
+
+	bool get_cached_theme_item(const ThemeItemCacheKey &p_key, Variant &r_value, bool &r_found);
+	void cache_theme_item(const ThemeItemCacheKey &p_key, const Variant &p_value, bool p_found);
+	void clear_theme_item_cache();
+
 	// Memory management, reference, and initialization.
 
 	static ThemeDB *get_singleton();
@@ -249,8 +249,8 @@ void ThemeOwner::get_theme_type_dependencies(const Node *p_for_node, const Strin
 	ThemeDB::get_singleton()->get_native_type_dependencies(p_theme_type, r_list);
 }
 
-Variant ThemeOwner::get_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, List<StringName> p_theme_types) {
-	ERR_FAIL_COND_V_MSG(p_theme_types.size() == 0, Variant(), "At least one theme type must be specified.");
+Variant ThemeOwner::_find_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types, bool &r_found) {
+	r_found = true;
 
 	// First, look through each control or window node in the branch, until no valid parent can be found.
 	// Only nodes with a theme resource attached are considered.
@@ -258,11 +258,13 @@ Variant ThemeOwner::get_theme_item_in_types(Theme::DataType p_data_type, const S
 
 	while (owner_node) {
 		// For each theme resource check the theme types provided and see if p_name exists with any of them.
-		for (const StringName &E : p_theme_types) {
-			Ref<Theme> owner_theme = _get_owner_node_theme(owner_node);
+		Ref<Theme> owner_theme = _get_owner_node_theme(owner_node);
 
-			if (owner_theme.is_valid() && owner_theme->has_theme_item(p_data_type, p_name, E)) {
-				return owner_theme->get_theme_item(p_data_type, p_name, E);
+		if (owner_theme.is_valid()) {
+			for (const StringName &E : p_theme_types) {
+				if (owner_theme->has_theme_item(p_data_type, p_name, E)) {
+					return owner_theme->get_theme_item(p_data_type, p_name, E);
+				}
 			}
 		}
 
@@ -281,44 +283,116 @@ Variant ThemeOwner::get_theme_item_in_types(Theme::DataType p_data_type, const S
 		}
 	}
 
+	r_found = false;
+	return Variant();
+}
+
+Variant ThemeOwner::get_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, List<StringName> p_theme_types) {
+	ERR_FAIL_COND_V_MSG(p_theme_types.size() == 0, Variant(), "At least one theme type must be specified.");
+
+	bool found = false;
+	Variant value = _find_theme_item_in_types(p_data_type, p_name, p_theme_types, found);
+	if (found) {
+		return value;
+	}
+
 	// Finally, if no match exists, use any type to return the default/empty value.
-	return global_context->get_fallback_theme()->get_theme_item(p_data_type, p_name, StringName());
+	return _get_active_owner_context()->get_fallback_theme()->get_theme_item(p_data_type, p_name, StringName());
 }
 
 bool ThemeOwner::has_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, List<StringName> p_theme_types) {
 	ERR_FAIL_COND_V_MSG(p_theme_types.size() == 0, false, "At least one theme type must be specified.");
 
-	// First, look through each control or window node in the branch, until no valid parent can be found.
-	// Only nodes with a theme resource attached are considered.
-	Node *owner_node = get_owner_node();
+	bool found = false;
+	_find_theme_item_in_types(p_data_type, p_name, p_theme_types, found);
+	return found;
+}
 
-	while (owner_node) {
-		// For each theme resource check the theme types provided and see if p_name exists with any of them.
-		for (const StringName &E : p_theme_types) {
-			Ref<Theme> owner_theme = _get_owner_node_theme(owner_node);
+uint64_t ThemeOwner::_get_theme_chain_signature() const {
+	// Theme versions are unique across all themes and change with every edit, so
+	// hashing them in lookup order identifies both the themes and their state.
+	// Two independent 32-bit hashes are combined to make collisions negligible.
+	uint32_t lo = HASH_MURMUR3_SEED;
+	uint32_t hi = 0x5C6E9A1;
 
-			if (owner_theme.is_valid() && owner_theme->has_theme_item(p_data_type, p_name, E)) {
-				return true;
-			}
+	Node *owner_node = get_owner_node();
+	while (owner_node) {
+		Ref<Theme> owner_theme = _get_owner_node_theme(owner_node);
+		if (owner_theme.is_valid()) {
+			lo = hash_murmur3_one_64(owner_theme->get_version(), lo);
+			hi = hash_murmur3_one_64(owner_theme->get_version(), hi);
 		}
 
 		owner_node = _get_next_owner_node(owner_node);
 	}
 
-	// Second, check global themes from the appropriate context.
+	// Separates owner themes from context themes; versions are never zero.
+	lo = hash_murmur3_one_64(0, lo);
+	hi = hash_murmur3_one_64(0, hi);
+
 	ThemeContext *global_context = _get_active_owner_context();
 	for (const Ref<Theme> &theme : global_context->get_themes()) {
 		if (theme.is_valid()) {
-			for (const StringName &E : p_theme_types) {
-				if (theme->has_theme_item(p_data_type, p_name, E)) {
-					return true;
-				}
-			}
+			lo = hash_murmur3_one_64(theme->get_version(), lo);
+			hi = hash_murmur3_one_64(theme->get_version(), hi);
 		}
 	}
 
-	// Finally, if no match exists, return false.
-	return false;
+	Ref<Theme> fallback_theme = global_context->get_fallback_theme();
+	if (fallback_theme.is_valid()) {
+		lo = hash_murmur3_one_64(fallback_theme->get_version(), lo);
+		hi = hash_murmur3_one_64(fallback_theme->get_version(), hi);
+	}
+
+	return ((uint64_t)hash_fmix32(hi) << 32) | hash_fmix32(lo);
+}
+
+Variant ThemeOwner::_resolve_theme_item(const Node *p_for_node, Theme::DataType p_data_type, const StringName &p_name, const StringName &p_theme_type, bool &r_found) {
+	const Control *for_c = Object::cast_to<Control>(p_for_node);
+	const Window *for_w = Object::cast_to<Window>(p_for_node);
+	ERR_FAIL_COND_V_MSG(!for_c && !for_w, Variant(), "Only Control and Window nodes and derivatives can be polled for theming.");
+
+	ThemeDB::ThemeItemCacheKey key;
+	key.chain_signature = _get_theme_chain_signature();
+	key.data_type = p_data_type;
+	key.item_name = p_name;
+
+	// Mirrors get_theme_type_dependencies(): the class and variation of the node
+	// only affect the result when the lookup is made for them.
+	const StringName &type_name = p_for_node->get_class_name();
+	StringName type_variation = for_c ? for_c->get_theme_type_variation() : for_w->get_theme_type_variation();
+	if (p_theme_type == StringName() || p_theme_type == type_name || p_theme_type == type_variation) {
+		key.type_name = type_name;
+		key.type_variation = type_variation;
+	} else {
+		key.theme_type = p_theme_type;
+	}
+
+	Variant value;
+	if (ThemeDB::get_singleton()->get_cached_theme_item(key, value, r_found)) {
+		return value;
+	}
+
+	List<StringName> theme_types;
+	get_theme_type_dependencies(p_for_node, p_theme_type, &theme_types);
+	value = _find_theme_item_in_types(p_data_type, p_name, theme_types, r_found);
+	if (!r_found) {
+		value = _get_active_owner_context()->get_fallback_theme()->get_theme_item(p_data_type, p_name, StringName());
+	}
+
+	ThemeDB::get_singleton()->cache_theme_item(key, value, r_found);
+	return value;
+}
+
+Variant ThemeOwner::get_theme_item(const Node *p_for_node, Theme::DataType p_data_type, const StringName &p_name, const StringName &p_theme_type) {
+	bool found = false;
+	return _resolve_theme_item(p_for_node, p_data_type, p_name, p_theme_type, found);
+}
+
+bool ThemeOwner::has_theme_item(const Node *p_for_node, Theme::DataType p_data_type, const StringName &p_name, const StringName &p_theme_type) {
+	bool found = false;
+	_resolve_theme_item(p_for_node, p_data_type, p_name, p_theme_type, found);
+	return found;
 }
 
 float ThemeOwner::get_theme_default_base_scale() {
@@ -52,6 +52,10 @@ class ThemeOwner : public Object {
 	Node *_get_next_owner_node(Node *p_from_node) const;
 	Ref<Theme> _get_owner_node_theme(Node *p_owner_node) const;
 
+	uint64_t _get_theme_chain_signature() const;
+	Variant _find_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, const List<StringName> &p_theme_types, bool &r_found);
+	Variant _resolve_theme_item(const Node *p_for_node, Theme::DataType p_data_type, const StringName &p_name, const StringName &p_theme_type, bool &r_found);
+
 public:
 	// Theme owner node.
 
@@ -74,6 +78,11 @@ public:
 	Variant get_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, List<StringName> p_theme_types);
 	bool has_theme_item_in_types(Theme::DataType p_data_type, const StringName &p_name, List<StringName> p_theme_types);
 
+	// Same as above, for the type dependencies of p_for_node, but going through the
+	// resolved item cache of ThemeDB first.
+	Variant get_theme_item(const Node *p_for_node, Theme::DataType p_data_type, const StringName &p_name, const StringName &p_theme_type);
+	bool has_theme_item(const Node *p_for_node, Theme::DataType p_data_type, const StringName &p_name, const StringName &p_theme_type);
+
 	float get_theme_default_base_scale();
 	Ref<Font> get_theme_default_font();
 	int get_theme_default_font_size();
@@ -30,10 +30,12 @@
 
 #include "servers_debugger.h"
 
+#include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/debugger/engine_debugger.h"
 #include "core/debugger/engine_profiler.h"
 #include "core/io/marshalls.h"
+#include "core/io/resource_loader.h"
 #include "servers/display_server.h"
 
 #define CHECK_SIZE(arr, expected, what) ERR_FAIL_COND_V_MSG((uint32_t)arr.size() < (uint32_t)(expected), false, String("Malformed ") + what + " message from script debugger, message too short. Expected size: " + itos(expected) + ", actual size: " + itos(arr.size()))
@@ -191,6 +193,43 @@ bool ServersDebugger::VisualProfilerFrame::deserialize(const Array &p_arr) {
 	CHECK_END(p_arr, idx, "VisualProfilerFrame");
 	return true;
 }
+
+Array ServersDebugger::CanvasProfilerFrame::serialize() {
+	Array arr;
+	arr.push_back(frame_number);
+	arr.push_back(items.size() * 6);
+	for (int i = 0; i < items.size(); i++) {
+		arr.push_back(items[i].name);
+		arr.push_back(items[i].instance_id);
+		arr.push_back(items[i].instances);
+		arr.push_back(items[i].batch_breaks);
+		arr.push_back(items[i].batch_break_mask);
+		arr.push_back(items[i].cull_msec);
+	}
+	return arr;
+}
+
+bool ServersDebugger::CanvasProfilerFrame::deserialize(const Array &p_arr) {
+	CHECK_SIZE(p_arr, 2, "CanvasProfilerFrame");
+	frame_number = p_arr[0];
+	int size = p_arr[1];
+	ERR_FAIL_COND_V(size % 6, false);
+	CHECK_SIZE(p_arr, 2 + size, "CanvasProfilerFrame");
+	int idx = 2;
+	items.resize(size / 6);
+	CanvasItemInfo *w = items.ptrw();
+	for (int i = 0; i < size / 6; i++) {
+		w[i].name = p_arr[idx];
+		w[i].instance_id = ObjectID(uint64_t(p_arr[idx + 1]));
+		w[i].instances = p_arr[idx + 2];
+		w[i].batch_breaks = p_arr[idx + 3];
+		w[i].batch_break_mask = p_arr[idx + 4];
+		w[i].cull_msec = p_arr[idx + 5];
+		idx += 6;
+	}
+	CHECK_END(p_arr, idx, "CanvasProfilerFrame");
+	return true;
+}
 class ServersDebugger::ScriptsProfiler : public EngineProfiler {
 	typedef ServersDebugger::ScriptFunctionSignature FunctionSignature;
 	typedef ServersDebugger::ScriptFunctionInfo FunctionInfo;
@@ -287,6 +326,22 @@ class ServersDebugger::ServersProfiler : public EngineProfiler {
 	double physics_time = 0;
 	double physics_frame_time = 0;
 
+	void _add_resource_load_times() {
+		Vector<ResourceLoader::LoadTimeInfo> load_times;
+		ResourceLoader::take_load_times(load_times);
+		if (load_times.is_empty()) {
+			return;
+		}
+
+		Array values;
+		values.push_back("resource_loader");
+		for (const ResourceLoader::LoadTimeInfo &E : load_times) {
+			values.push_back(E.path);
+			values.push_back(USEC_TO_SEC(E.usec));
+		}
+		add(values);
+	}
+
 	void _send_frame_data(bool p_final) {
 		ServersDebugger::ServersProfilerFrame frame;
 		frame.frame_number = Engine::get_singleton()->get_process_frames();
@@ -324,6 +379,7 @@ public:
 		} else {
 			_send_frame_data(true); // Send final frame.
 		}
+		ResourceLoader::set_load_time_tracking(p_enable);
 		scripts_profiler.toggle(p_enable, p_opts);
 	}
 
@@ -349,6 +405,7 @@ public:
 		process_time = p_process_time;
 		physics_time = p_physics_time;
 		physics_frame_time = p_physics_frame_time;
+		_add_resource_load_times();
 		_send_frame_data(false);
 	}
 
@@ -383,6 +440,58 @@ public:
 	}
 };
 
+class ServersDebugger::CanvasProfiler : public EngineProfiler {
+	struct ProfileSort {
+		bool operator()(const RS::CanvasItemProfile &p_a, const RS::CanvasItemProfile &p_b) const {
+			if (p_a.batch_breaks != p_b.batch_breaks) {
+				return p_a.batch_breaks > p_b.batch_breaks;
+			}
+			if (p_a.instances != p_b.instances) {
+				return p_a.instances > p_b.instances;
+			}
+			return p_a.cull_msec > p_b.cull_msec;
+		}
+	};
+
+	int max_items = 256;
+
+public:
+	void toggle(bool p_enable, const Array &p_opts) {
+		if (p_enable && p_opts.size() == 1 && p_opts[0].get_type() == Variant::INT) {
+			max_items = CLAMP(int(p_opts[0]), 16, 4096);
+		}
+		RS::get_singleton()->set_canvas_item_profiling_enabled(p_enable);
+	}
+
+	void add(const Array &p_data) {}
+
+	void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) {
+		Vector<RS::CanvasItemProfile> profile = RS::get_singleton()->get_canvas_item_profile();
+		if (!profile.size()) {
+			return;
+		}
+
+		// Only send the worst offenders, the rest would flood the connection for nothing.
+		profile.sort_custom<ProfileSort>();
+
+		ServersDebugger::CanvasProfilerFrame frame;
+		frame.frame_number = Engine::get_singleton()->get_frames_drawn();
+		frame.items.resize(MIN(profile.size(), max_items));
+		ServersDebugger::CanvasItemInfo *w = frame.items.ptrw();
+		for (int i = 0; i < frame.items.size(); i++) {
+			const RS::CanvasItemProfile &item_profile = profile[i];
+			Object *obj = ObjectDB::get_instance(item_profile.instance_id);
+			w[i].name = obj ? obj->to_string() : vformat("CanvasItem(%d)", item_profile.item.get_id());
+			w[i].instance_id = item_profile.instance_id;
+			w[i].instances = item_profile.instances;
+			w[i].batch_breaks = item_profile.batch_breaks;
+			w[i].batch_break_mask = item_profile.batch_break_mask;
+			w[i].cull_msec = item_profile.cull_msec;
+		}
+		EngineDebugger::get_singleton()->send_message("canvas:profile_frame", frame.serialize());
+	}
+};
+
 ServersDebugger *ServersDebugger::singleton = nullptr;
 
 void ServersDebugger::initialize() {
@@ -458,6 +567,10 @@ ServersDebugger::ServersDebugger() {
 	visual_profiler.instantiate();
 	visual_profiler->bind("visual");
 
+	// Canvas Profiler (per canvas item batch breaks/instances/cull time)
+	canvas_profiler.instantiate();
+	canvas_profiler->bind("canvas");
+
 	EngineDebugger::Capture servers_cap(nullptr, &_capture);
 	EngineDebugger::register_message_capture("servers", servers_cap);
 }
@@ -105,14 +105,34 @@ public:
 		bool deserialize(const Array &p_arr);
 	};
 
+	// Canvas Profiler
+	struct CanvasItemInfo {
+		String name;
+		ObjectID instance_id;
+		uint32_t instances = 0;
+		uint32_t batch_breaks = 0;
+		uint32_t batch_break_mask = 0;
+		double cull_msec = 0;
+	};
+
+	struct CanvasProfilerFrame {
+		uint64_t frame_number = 0;
+		Vector<CanvasItemInfo> items;
+
+		Array serialize();
+		bool deserialize(const Array &p_arr);
+	};
+
 private:
 	class ScriptsProfiler;
 	class ServersProfiler;
 	class VisualProfiler;
+	class CanvasProfiler;
 
 	double last_draw_time = 0.0;
 	Ref<ServersProfiler> servers_profiler;
 	Ref<VisualProfiler> visual_profiler;
+	Ref<CanvasProfiler> canvas_profiler;
 
 	static ServersDebugger *singleton;
 
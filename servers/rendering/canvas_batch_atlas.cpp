@@ -0,0 +1,325 @@
+/**************************************************************************/
+/*  canvas_batch_atlas.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "canvas_batch_atlas.h"
+
+#include "core/math/geometry_2d.h"
+#include "core/templates/local_vector.h"
+#include "servers/rendering/renderer_canvas_render.h"
+
+struct _CanvasBatchAtlasPackItem {
+	RID texture;
+	Size2i size;
+
+	bool operator<(const _CanvasBatchAtlasPackItem &p_item) const {
+		return size.width * size.height < p_item.size.width * p_item.size.height;
+	}
+};
+
+void CanvasBatchAtlas::set_max_size(const Size2i &p_size) {
+	ERR_FAIL_COND(p_size.width <= 0 || p_size.height <= 0);
+	if (max_size == p_size) {
+		return;
+	}
+	max_size = p_size;
+	dirty = true;
+}
+
+void CanvasBatchAtlas::set_max_texture_size(int p_size) {
+	ERR_FAIL_COND(p_size <= 0);
+	if (max_texture_size == p_size) {
+		return;
+	}
+	max_texture_size = p_size;
+
+	// Forget about the textures that are not eligible anymore.
+	LocalVector<RID> to_erase;
+	for (const KeyValue<RID, Entry> &E : entries) {
+		if (!is_size_eligible(E.value.size)) {
+			to_erase.push_back(E.key);
+		}
+	}
+	for (const RID &rid : to_erase) {
+		entries.erase(rid);
+	}
+	dirty = true;
+}
+
+void CanvasBatchAtlas::set_padding(int p_padding) {
+	ERR_FAIL_COND(p_padding < 0);
+	if (padding == p_padding) {
+		return;
+	}
+	padding = p_padding;
+	dirty = true;
+}
+
+bool CanvasBatchAtlas::is_size_eligible(const Size2i &p_size) const {
+	if (p_size.width <= 0 || p_size.height <= 0) {
+		return false;
+	}
+	if (p_size.width > max_texture_size || p_size.height > max_texture_size) {
+		return false;
+	}
+	return p_size.width + padding * 2 <= max_size.width && p_size.height + padding * 2 <= max_size.height;
+}
+
+bool CanvasBatchAtlas::can_draw_rect(RID p_texture, bool p_has_material, uint32_t p_rect_flags, RS::CanvasItemTextureFilter p_filter, RS::CanvasItemTextureRepeat p_repeat) {
+	if (p_texture.is_null() || p_has_material) {
+		return false;
+	}
+	if (p_rect_flags & (RendererCanvasRender::CANVAS_RECT_TILE | RendererCanvasRender::CANVAS_RECT_MSDF | RendererCanvasRender::CANVAS_RECT_LCD)) {
+		return false;
+	}
+	if (p_repeat != RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED) {
+		return false;
+	}
+	return p_filter == RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST || p_filter == RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR;
+}
+
+bool CanvasBatchAtlas::rect_breaks_batch(const BatchTexture &p_batch, const BatchTexture &p_rect) {
+	if (p_batch.use_atlas != p_rect.use_atlas) {
+		return true;
+	}
+	return !p_rect.use_atlas && p_batch.texture != p_rect.texture;
+}
+
+bool CanvasBatchAtlas::request(RID p_texture, const Size2i &p_size) {
+	Entry *e = entries.getptr(p_texture);
+	if (e) {
+		e->last_used_frame = frame;
+		if (e->size != p_size) {
+			// The texture was resized, it needs a new place in the atlas.
+			if (!is_size_eligible(p_size)) {
+				if (e->packed) {
+					packed_count--;
+				}
+				entries.erase(p_texture);
+				dirty = true;
+				return false;
+			}
+			if (e->packed) {
+				packed_count--;
+			}
+			e->size = p_size;
+			e->packed = false;
+			_request_repack();
+			return false;
+		}
+		return e->packed;
+	}
+
+	if (!is_size_eligible(p_size)) {
+		return false;
+	}
+
+	Entry entry;
+	entry.size = p_size;
+	entry.last_used_frame = frame;
+	entries.insert(p_texture, entry);
+	_request_repack();
+	return false;
+}
+
+void CanvasBatchAtlas::_request_repack() {
+	if (full) {
+		repack_requested = true;
+	} else {
+		dirty = true;
+	}
+}
+
+void CanvasBatchAtlas::erase(RID p_texture) {
+	Entry *e = entries.getptr(p_texture);
+	if (!e) {
+		return;
+	}
+	if (e->packed) {
+		packed_count--;
+	}
+	entries.erase(p_texture);
+	// Freed space is reclaimed on the next repack, no need to trigger one just for that.
+}
+
+void CanvasBatchAtlas::mark_dirty(RID p_texture) {
+	Entry *e = entries.getptr(p_texture);
+	if (e && e->packed) {
+		// The region keeps its place, so textures updated every frame (video, viewports) don't cause a repack.
+		e->contents_dirty = true;
+		contents_dirty = true;
+	}
+}
+
+void CanvasBatchAtlas::clear() {
+	entries.clear();
+	size = Size2i();
+	packed_count = 0;
+	dirty = true;
+	contents_dirty = false;
+	full = false;
+	repack_requested = false;
+}
+
+bool CanvasBatchAtlas::is_packed(RID p_texture) const {
+	const Entry *e = entries.getptr(p_texture);
+	return e && e->packed;
+}
+
+bool CanvasBatchAtlas::get_uv_rect(RID p_texture, Rect2 &r_uv_rect) {
+	Entry *e = entries.getptr(p_texture);
+	if (!e) {
+		return false;
+	}
+	e->last_used_frame = frame;
+	if (!e->packed) {
+		return false;
+	}
+	r_uv_rect = e->uv_rect;
+	return true;
+}
+
+void CanvasBatchAtlas::clear_dirty_contents() {
+	for (KeyValue<RID, Entry> &E : entries) {
+		E.value.contents_dirty = false;
+	}
+	contents_dirty = false;
+}
+
+void CanvasBatchAtlas::_evict_unused() {
+	if (eviction_frames == 0) {
+		return;
+	}
+	LocalVector<RID> to_erase;
+	for (const KeyValue<RID, Entry> &E : entries) {
+		if (frame - E.value.last_used_frame > eviction_frames) {
+			to_erase.push_back(E.key);
+		}
+	}
+	for (const RID &rid : to_erase) {
+		entries.erase(rid);
+	}
+}
+
+void CanvasBatchAtlas::pack() {
+	dirty = false;
+	repack_requested = false;
+	pack_frame = frame;
+	full = false;
+	size = Size2i();
+	packed_count = 0;
+
+	// Everything is copied again after packing.
+	contents_dirty = false;
+
+	_evict_unused();
+
+	LocalVector<_CanvasBatchAtlasPackItem> items;
+	items.reserve(entries.size());
+
+	for (KeyValue<RID, Entry> &E : entries) {
+		E.value.packed = false;
+		E.value.contents_dirty = false;
+		E.value.rect = Rect2i();
+		E.value.uv_rect = Rect2();
+
+		_CanvasBatchAtlasPackItem item;
+		item.texture = E.key;
+		item.size = E.value.size + Size2i(padding * 2, padding * 2);
+		items.push_back(item);
+	}
+
+	if (items.is_empty()) {
+		return;
+	}
+
+	// Smallest first, so the largest textures are the ones left out when the atlas is full.
+	items.sort();
+
+	int64_t max_area = int64_t(max_size.width) * int64_t(max_size.height);
+	int64_t area = 0;
+	uint32_t max_count = 0;
+	while (max_count < items.size()) {
+		int64_t item_area = int64_t(items[max_count].size.width) * int64_t(items[max_count].size.height);
+		if (area + item_area > max_area) {
+			break;
+		}
+		area += item_area;
+		max_count++;
+	}
+
+	Vector<Size2i> rects;
+	Vector<Point2i> positions;
+	Size2i atlas_size;
+
+	// Find how many of the smallest textures fit with a binary search, each attempt costs a full make_atlas().
+	uint32_t count = 0;
+	uint32_t low = 1;
+	uint32_t high = max_count;
+	while (low <= high) {
+		uint32_t mid = low + (high - low) / 2;
+		rects.resize(mid);
+		Size2i *rects_ptrw = rects.ptrw();
+		for (uint32_t i = 0; i < mid; i++) {
+			rects_ptrw[i] = items[i].size;
+		}
+
+		Geometry2D::make_atlas(rects, positions, atlas_size);
+		if (positions.size() == int(mid) && atlas_size.width <= max_size.width && atlas_size.height <= max_size.height) {
+			count = mid;
+			low = mid + 1;
+		} else {
+			high = mid - 1;
+		}
+	}
+
+	full = count < items.size();
+	if (count == 0) {
+		return;
+	}
+
+	if (rects.size() != int(count)) {
+		rects.resize(count);
+		Size2i *rects_ptrw = rects.ptrw();
+		for (uint32_t i = 0; i < count; i++) {
+			rects_ptrw[i] = items[i].size;
+		}
+		Geometry2D::make_atlas(rects, positions, atlas_size);
+	}
+
+	size = atlas_size;
+	packed_count = count;
+
+	for (uint32_t i = 0; i < count; i++) {
+		Entry *e = entries.getptr(items[i].texture);
+		e->packed = true;
+		e->rect = Rect2i(positions[i] + Point2i(padding, padding), e->size);
+		e->uv_rect = Rect2(Point2(e->rect.position) / Size2(size), Size2(e->rect.size) / Size2(size));
+	}
+}
@@ -0,0 +1,138 @@
+/**************************************************************************/
+/*  canvas_batch_atlas.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef CANVAS_BATCH_ATLAS_H
+#define CANVAS_BATCH_ATLAS_H
+
+#include "core/math/rect2.h"
+#include "core/math/rect2i.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/rid.h"
+#include "servers/rendering_server.h"
+
+// Layout of the runtime atlas used by canvas renderers to merge rects that sample
+// different small textures into a single batch. This class only decides which
+// textures are packed and where; uploading the pixels is left to the renderer,
+// which keeps the batching decisions testable without a GPU.
+class CanvasBatchAtlas {
+public:
+	struct Entry {
+		Size2i size;
+		Rect2i rect; // Texel rect inside the atlas, padding excluded.
+		Rect2 uv_rect;
+		bool packed = false;
+		bool contents_dirty = false;
+		uint64_t last_used_frame = 0;
+	};
+
+	// Texture sampled by a batch or a rect, as seen by the batching logic.
+	struct BatchTexture {
+		RID texture;
+		bool use_atlas = false;
+	};
+
+private:
+	HashMap<RID, Entry> entries;
+
+	Size2i max_size = Size2i(2048, 2048);
+	int max_texture_size = 256;
+	int padding = 1;
+	uint32_t eviction_frames = 600;
+	uint32_t full_repack_frames = 60;
+
+	Size2i size;
+	uint32_t packed_count = 0;
+	uint64_t frame = 0;
+	bool dirty = false;
+	bool contents_dirty = false;
+
+	// Set when the last pack left textures out. New textures then wait for a throttled repack and are drawn
+	// unbatched meanwhile, instead of repacking and copying the whole atlas for every texture requested.
+	bool full = false;
+	bool repack_requested = false;
+	uint64_t pack_frame = 0;
+
+	void _evict_unused();
+	void _request_repack();
+
+public:
+	void set_max_size(const Size2i &p_size);
+	Size2i get_max_size() const { return max_size; }
+
+	void set_max_texture_size(int p_size);
+	int get_max_texture_size() const { return max_texture_size; }
+
+	void set_padding(int p_padding);
+	int get_padding() const { return padding; }
+
+	// Textures not drawn for this many frames are removed when the atlas is packed again, 0 keeps them forever.
+	void set_eviction_frames(uint32_t p_frames) { eviction_frames = p_frames; }
+	uint32_t get_eviction_frames() const { return eviction_frames; }
+
+	// Minimum number of frames between repacks caused by new textures while the atlas is full.
+	void set_full_repack_frames(uint32_t p_frames) { full_repack_frames = p_frames; }
+	uint32_t get_full_repack_frames() const { return full_repack_frames; }
+
+	bool is_size_eligible(const Size2i &p_size) const;
+
+	// Whether a rect drawn with these settings may sample from the atlas. Custom materials may rely on
+	// UV and TEXTURE_PIXEL_SIZE matching the original texture, and the atlas has no mipmaps and can't repeat.
+	static bool can_draw_rect(RID p_texture, bool p_has_material, uint32_t p_rect_flags, RS::CanvasItemTextureFilter p_filter, RS::CanvasItemTextureRepeat p_repeat);
+	// Rects using the atlas share a batch regardless of their texture, other rects need the same texture.
+	static bool rect_breaks_batch(const BatchTexture &p_batch, const BatchTexture &p_rect);
+
+	// Registers the texture if needed. Returns true only if the texture is already packed,
+	// newly requested textures become available after the next call to pack().
+	bool request(RID p_texture, const Size2i &p_size);
+	void erase(RID p_texture);
+	// The contents of a packed texture changed, only its own region needs to be copied again.
+	void mark_dirty(RID p_texture);
+	void clear();
+
+	bool has(RID p_texture) const { return entries.has(p_texture); }
+	bool is_packed(RID p_texture) const;
+	// Also marks the texture as used in the current frame.
+	bool get_uv_rect(RID p_texture, Rect2 &r_uv_rect);
+
+	void advance_frame() { frame++; }
+
+	bool is_dirty() const { return dirty || (repack_requested && frame - pack_frame >= full_repack_frames); }
+	bool is_full() const { return full; }
+	void pack();
+
+	bool has_dirty_contents() const { return contents_dirty; }
+	void clear_dirty_contents();
+
+	Size2i get_size() const { return size; }
+	uint32_t get_packed_count() const { return packed_count; }
+	const HashMap<RID, Entry> &get_entries() const { return entries; }
+};
+
+#endif // CANVAS_BATCH_ATLAS_H
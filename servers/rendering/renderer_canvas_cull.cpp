@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/math/geometry_2d.h"
+#include "core/os/os.h"
 #include "renderer_viewport.h"
 #include "rendering_server_default.h"
 #include "rendering_server_globals.h"
@@ -223,8 +224,30 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 	}
 }
 
+RendererCanvasCull::ItemCullProfile::ItemCullProfile(RendererCanvasCull *p_canvas_cull, const Item *p_item) {
+	if (!RSG::canvas_render->item_profiling) {
+		return;
+	}
+	canvas_cull = p_canvas_cull;
+	item = p_item;
+	begin_usec = OS::get_singleton()->get_ticks_usec();
+	parent_children_usec = canvas_cull->item_cull_children_usec;
+	canvas_cull->item_cull_children_usec = 0;
+}
+
+RendererCanvasCull::ItemCullProfile::~ItemCullProfile() {
+	if (!canvas_cull) {
+		return;
+	}
+	uint64_t total_usec = OS::get_singleton()->get_ticks_usec() - begin_usec;
+	// Children report their own time, only keep what was spent on this item.
+	RSG::canvas_render->get_item_profile(item)->cull_usec += total_usec - MIN(total_usec, canvas_cull->item_cull_children_usec);
+	canvas_cull->item_cull_children_usec = parent_children_usec + total_usec;
+}
+
 void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, Item *p_canvas_clip, Item *p_material_owner, bool allow_y_sort, uint32_t canvas_cull_mask) {
 	Item *ci = p_canvas_item;
+	ItemCullProfile cull_profile(this, ci);
 
 	if (!ci->visible) {
 		return;
@@ -449,6 +472,8 @@ RID RendererCanvasCull::canvas_item_allocate() {
 }
 void RendererCanvasCull::canvas_item_initialize(RID p_rid) {
 	canvas_item_owner.initialize_rid(p_rid);
+	Item *canvas_item = canvas_item_owner.get_or_null(p_rid);
+	canvas_item->self = p_rid;
 }
 
 void RendererCanvasCull::canvas_item_set_parent(RID p_item, RID p_parent) {
@@ -1552,6 +1577,13 @@ bool RendererCanvasCull::canvas_item_get_debug_redraw() const {
 	return debug_redraw;
 }
 
+void RendererCanvasCull::canvas_item_attach_object_instance_id(RID p_item, ObjectID p_id) {
+	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
+	ERR_FAIL_NULL(canvas_item);
+
+	canvas_item->instance_id = p_id;
+}
+
 void RendererCanvasCull::canvas_item_set_canvas_group_mode(RID p_item, RS::CanvasGroupMode p_mode, float p_clear_margin, bool p_fit_empty, float p_fit_margin, bool p_blur_mipmaps) {
 	Item *canvas_item = canvas_item_owner.get_or_null(p_item);
 	ERR_FAIL_NULL(canvas_item);
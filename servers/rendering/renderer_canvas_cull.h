@@ -187,6 +187,19 @@ public:
 	_FORCE_INLINE_ void _attach_canvas_item_for_draw(Item *ci, Item *p_canvas_clip, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, const Transform2D &xform, const Rect2 &p_clip_rect, Rect2 global_rect, const Color &modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *canvas_group_from, const Transform2D &p_xform);
 
 private:
+	// Attributes the time spent culling an item, excluding its children, to the item profile.
+	struct ItemCullProfile {
+		RendererCanvasCull *canvas_cull = nullptr;
+		const Item *item = nullptr;
+		uint64_t begin_usec = 0;
+		uint64_t parent_children_usec = 0;
+
+		ItemCullProfile(RendererCanvasCull *p_canvas_cull, const Item *p_item);
+		~ItemCullProfile();
+	};
+
+	uint64_t item_cull_children_usec = 0;
+
 	void _render_canvas_item_tree(RID p_to_render_target, Canvas::ChildItem *p_child_items, int p_child_item_count, Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, uint32_t canvas_cull_mask);
 	void _cull_canvas_item(Item *p_canvas_item, const Transform2D &p_transform, const Rect2 &p_clip_rect, const Color &p_modulate, int p_z, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, Item *p_canvas_clip, Item *p_material_owner, bool allow_y_sort, uint32_t canvas_cull_mask);
 
@@ -266,6 +279,8 @@ public:
 	void canvas_item_set_debug_redraw(bool p_enabled);
 	bool canvas_item_get_debug_redraw() const;
 
+	void canvas_item_attach_object_instance_id(RID p_item, ObjectID p_id);
+
 	RID canvas_light_allocate();
 	void canvas_light_initialize(RID p_rid);
 
@@ -276,6 +276,9 @@ public:
 			Rect2 rect;
 		};
 
+		RID self;
+		ObjectID instance_id;
+
 		Transform2D xform;
 		bool clip;
 		bool visible;
@@ -448,6 +451,46 @@ public:
 		}
 	};
 
+	enum BatchBreakReason {
+		BATCH_BREAK_TEXTURE,
+		BATCH_BREAK_MATERIAL,
+		BATCH_BREAK_CLIP,
+		BATCH_BREAK_BLEND,
+		BATCH_BREAK_PRIMITIVE,
+		BATCH_BREAK_BUFFER_FULL,
+		BATCH_BREAK_MAX,
+	};
+
+	struct BatchingInfo {
+		uint64_t draw_calls = 0;
+		uint64_t batches = 0;
+		uint64_t batch_breaks[BATCH_BREAK_MAX] = {};
+	};
+
+	// Filled by the renderer while drawing, collected and reset once per frame by RendererViewport.
+	BatchingInfo batching_info;
+
+	struct ItemProfile {
+		ObjectID instance_id;
+		uint32_t instances = 0;
+		uint32_t batch_breaks[BATCH_BREAK_MAX] = {};
+		uint64_t cull_usec = 0;
+	};
+
+	// Per canvas item costs, only collected while item profiling is enabled.
+	// Filled by RendererCanvasCull and the renderer, collected and reset once per frame by RenderingServerDefault.
+	bool item_profiling = false;
+	HashMap<RID, ItemProfile> item_profile;
+
+	_FORCE_INLINE_ ItemProfile *get_item_profile(const Item *p_item) {
+		HashMap<RID, ItemProfile>::Iterator E = item_profile.find(p_item->self);
+		if (!E) {
+			E = item_profile.insert(p_item->self, ItemProfile());
+			E->value.instance_id = p_item->instance_id;
+		}
+		return &E->value;
+	}
+
 	virtual void canvas_render_items(RID p_to_render_target, Item *p_item_list, const Color &p_modulate, Light *p_light_list, Light *p_directional_list, const Transform2D &p_canvas_transform, RS::CanvasItemTextureFilter p_default_filter, RS::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_vertices_to_pixel, bool &r_sdf_used) = 0;
 
 	struct LightOccluderInstance {
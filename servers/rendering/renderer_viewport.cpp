@@ -137,6 +137,8 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 		}
 	}
 
+	uint64_t draw_calls_before = RSG::canvas_render->batching_info.draw_calls;
+
 	if (!p_viewport->disable_2d) {
 		RBMap<Viewport::CanvasKey, Viewport::CanvasData *> canvas_map;
 
@@ -404,6 +406,8 @@ void RendererViewport::_draw_viewport(Viewport *p_viewport) {
 		RSG::texture_storage->render_target_do_clear_request(p_viewport->render_target);
 	}
 
+	p_viewport->render_info.info[RS::VIEWPORT_RENDER_INFO_TYPE_VISIBLE][RS::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME] += RSG::canvas_render->batching_info.draw_calls - draw_calls_before;
+
 	if (p_viewport->measure_render_time) {
 		String rt_id = "vp_end_" + itos(p_viewport->self.get_id());
 		RSG::utilities->capture_timestamp(rt_id);
@@ -471,6 +475,8 @@ void RendererViewport::draw_viewports(bool p_swap_buffers) {
 	int objects_drawn = 0;
 	int draw_calls_used = 0;
 
+	RSG::canvas_render->batching_info = RendererCanvasRender::BatchingInfo();
+
 	for (int i = 0; i < sorted_active_viewports.size(); i++) {
 		Viewport *vp = sorted_active_viewports[i];
 
@@ -525,6 +531,7 @@ void RendererViewport::draw_viewports(bool p_swap_buffers) {
 	total_objects_drawn = objects_drawn;
 	total_vertices_drawn = vertices_drawn;
 	total_draw_calls_used = draw_calls_used;
+	total_canvas_batching_info = RSG::canvas_render->batching_info;
 
 	RENDER_TIMESTAMP("< Render Viewports");
 
@@ -899,6 +906,10 @@ int RendererViewport::get_total_draw_calls_used() const {
 	return total_draw_calls_used;
 }
 
+const RendererCanvasRender::BatchingInfo &RendererViewport::get_total_canvas_batching_info() const {
+	return total_canvas_batching_info;
+}
+
 int RendererViewport::get_num_viewports_with_motion_vectors() const {
 	return num_viewports_with_motion_vectors;
 }
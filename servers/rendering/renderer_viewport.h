@@ -34,6 +34,7 @@
 #include "core/templates/local_vector.h"
 #include "core/templates/rid_owner.h"
 #include "core/templates/self_list.h"
+#include "servers/rendering/renderer_canvas_render.h"
 #include "servers/rendering_server.h"
 
 class RendererViewport {
@@ -155,6 +156,7 @@ public:
 	int total_objects_drawn = 0;
 	int total_vertices_drawn = 0;
 	int total_draw_calls_used = 0;
+	RendererCanvasRender::BatchingInfo total_canvas_batching_info;
 
 	int num_viewports_with_motion_vectors = 0;
 
@@ -224,6 +226,7 @@ public:
 	int get_total_objects_drawn() const;
 	int get_total_primitives_drawn() const;
 	int get_total_draw_calls_used() const;
+	const RendererCanvasRender::BatchingInfo &get_total_canvas_batching_info() const;
 	int get_num_viewports_with_motion_vectors() const;
 
 	// Workaround for setting this on thread.
@@ -60,6 +60,27 @@ void RenderingServerDefault::_free(RID p_rid) {
 
 /* EVENT QUEUING */
 
+void RenderingServerDefault::_collect_canvas_item_profile() {
+	canvas_item_profile.resize(RSG::canvas_render->item_profile.size());
+	CanvasItemProfile *w = canvas_item_profile.ptrw();
+	int idx = 0;
+	for (const KeyValue<RID, RendererCanvasRender::ItemProfile> &E : RSG::canvas_render->item_profile) {
+		CanvasItemProfile &profile = w[idx++];
+		profile.item = E.key;
+		profile.instance_id = E.value.instance_id;
+		profile.instances = E.value.instances;
+		// Breaks caused by a full instance buffer are not the fault of the item being recorded.
+		for (int i = 0; i < RendererCanvasRender::BATCH_BREAK_BUFFER_FULL; i++) {
+			if (E.value.batch_breaks[i]) {
+				profile.batch_breaks += E.value.batch_breaks[i];
+				profile.batch_break_mask |= 1 << i;
+			}
+		}
+		profile.cull_msec = double(E.value.cull_usec) / 1000.0;
+	}
+	RSG::canvas_render->item_profile.clear();
+}
+
 void RenderingServerDefault::request_frame_drawn_callback(const Callable &p_callable) {
 	frame_drawn_callbacks.push_back(p_callable);
 }
@@ -83,6 +104,13 @@ void RenderingServerDefault::_draw(bool p_swap_buffers, double frame_step) {
 	RSG::viewport->draw_viewports(p_swap_buffers);
 	// RSG::canvas_render->update();
 
+	if (RSG::canvas_render->item_profiling) {
+		_collect_canvas_item_profile();
+	} else if (!canvas_item_profile.is_empty()) {
+		RSG::canvas_render->item_profile.clear();
+		canvas_item_profile.clear();
+	}
+
 	if (!OS::get_singleton()->get_current_rendering_driver_name().begins_with("opengl3")) {
 		// Already called for gl_compatibility renderer.
 		RSG::rasterizer->end_frame(p_swap_buffers);
@@ -236,6 +264,11 @@ uint64_t RenderingServerDefault::get_rendering_info(RenderingInfo p_info) {
 		return RSG::viewport->get_total_primitives_drawn();
 	} else if (p_info == RENDERING_INFO_TOTAL_DRAW_CALLS_IN_FRAME) {
 		return RSG::viewport->get_total_draw_calls_used();
+	} else if (p_info == RENDERING_INFO_CANVAS_BATCHES_IN_FRAME) {
+		return RSG::viewport->get_total_canvas_batching_info().batches;
+	} else if (p_info >= RENDERING_INFO_CANVAS_BATCH_BREAKS_TEXTURE && p_info <= RENDERING_INFO_CANVAS_BATCH_BREAKS_PRIMITIVE) {
+		// The break reasons are laid out in the same order as RendererCanvasRender::BatchBreakReason.
+		return RSG::viewport->get_total_canvas_batching_info().batch_breaks[p_info - RENDERING_INFO_CANVAS_BATCH_BREAKS_TEXTURE];
 	}
 	return RSG::utilities->get_rendering_info(p_info);
 }
@@ -252,6 +285,14 @@ Vector<RenderingServer::FrameProfileArea> RenderingServerDefault::get_frame_prof
 	return frame_profile;
 }
 
+void RenderingServerDefault::set_canvas_item_profiling_enabled(bool p_enable) {
+	RSG::canvas_render->item_profiling = p_enable;
+}
+
+Vector<RenderingServer::CanvasItemProfile> RenderingServerDefault::get_canvas_item_profile() {
+	return canvas_item_profile;
+}
+
 /* TESTING */
 
 void RenderingServerDefault::set_boot_image(const Ref<Image> &p_image, const Color &p_color, bool p_scale, bool p_use_filter) {
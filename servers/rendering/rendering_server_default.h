@@ -61,6 +61,7 @@ class RenderingServerDefault : public RenderingServer {
 
 	uint64_t frame_profile_frame;
 	Vector<FrameProfileArea> frame_profile;
+	Vector<CanvasItemProfile> canvas_item_profile;
 
 	double frame_setup_time = 0;
 
@@ -89,6 +90,7 @@ class RenderingServerDefault : public RenderingServer {
 	Mutex alloc_mutex;
 
 	void _draw(bool p_swap_buffers, double frame_step);
+	void _collect_canvas_item_profile();
 	void _init();
 	void _finish();
 
@@ -375,6 +377,8 @@ public:
 	FUNC1(canvas_item_set_debug_redraw, bool)
 	FUNC0RC(bool, canvas_item_get_debug_redraw)
 
+	FUNC2(canvas_item_attach_object_instance_id, RID, ObjectID)
+
 	FUNCRIDSPLIT(canvas_light)
 
 	FUNC2(canvas_light_set_mode, RID, CanvasLightMode)
@@ -456,6 +460,9 @@ public:
 	virtual Vector<FrameProfileArea> get_frame_profile() override;
 	virtual uint64_t get_frame_profile_frame() override;
 
+	virtual void set_canvas_item_profiling_enabled(bool p_enable) override;
+	virtual Vector<CanvasItemProfile> get_canvas_item_profile() override;
+
 	/* FREE */
 
 	virtual void free(RID p_rid) override {
@@ -654,6 +654,12 @@ void RenderingServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(RENDERING_INFO_TEXTURE_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDERING_INFO_BUFFER_MEM_USED);
 	BIND_ENUM_CONSTANT(RENDERING_INFO_VIDEO_MEM_USED);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_CANVAS_BATCHES_IN_FRAME);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_CANVAS_BATCH_BREAKS_TEXTURE);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_CANVAS_BATCH_BREAKS_MATERIAL);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_CANVAS_BATCH_BREAKS_CLIP);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_CANVAS_BATCH_BREAKS_BLEND);
+	BIND_ENUM_CONSTANT(RENDERING_INFO_CANVAS_BATCH_BREAKS_PRIMITIVE);
 
 	BIND_ENUM_CONSTANT(FEATURE_SHADERS);
 	BIND_ENUM_CONSTANT(FEATURE_MULTITHREADED);
@@ -710,6 +716,10 @@ void RenderingServer::init() {
 	// Number of commands that can be drawn per frame.
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/gl_compatibility/item_buffer_size", PROPERTY_HINT_RANGE, "128,1048576,1"), 16384);
 
+	GLOBAL_DEF_RST("rendering/2d/batching/use_texture_atlas", false);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/2d/batching/atlas_size", PROPERTY_HINT_RANGE, "256,8192,1"), 2048);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/2d/batching/atlas_max_texture_size", PROPERTY_HINT_RANGE, "8,1024,1"), 256);
+
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/enabled", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/compress", true);
 	GLOBAL_DEF("rendering/shader_compiler/shader_cache/use_zstd_compression", true);
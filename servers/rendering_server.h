@@ -516,6 +516,8 @@ public:
 	virtual void canvas_item_set_debug_redraw(bool p_enabled) = 0;
 	virtual bool canvas_item_get_debug_redraw() const = 0;
 
+	virtual void canvas_item_attach_object_instance_id(RID p_item, ObjectID p_id) = 0;
+
 	/* CANVAS LIGHT */
 	virtual RID canvas_light_create() = 0;
 
@@ -660,6 +662,12 @@ public:
 		RENDERING_INFO_TEXTURE_MEM_USED,
 		RENDERING_INFO_BUFFER_MEM_USED,
 		RENDERING_INFO_VIDEO_MEM_USED,
+		RENDERING_INFO_CANVAS_BATCHES_IN_FRAME,
+		RENDERING_INFO_CANVAS_BATCH_BREAKS_TEXTURE,
+		RENDERING_INFO_CANVAS_BATCH_BREAKS_MATERIAL,
+		RENDERING_INFO_CANVAS_BATCH_BREAKS_CLIP,
+		RENDERING_INFO_CANVAS_BATCH_BREAKS_BLEND,
+		RENDERING_INFO_CANVAS_BATCH_BREAKS_PRIMITIVE,
 		RENDERING_INFO_MAX
 	};
 
@@ -678,6 +686,19 @@ public:
 	virtual Vector<FrameProfileArea> get_frame_profile() = 0;
 	virtual uint64_t get_frame_profile_frame() = 0;
 
+	struct CanvasItemProfile {
+		RID item;
+		ObjectID instance_id;
+		uint32_t instances = 0;
+		uint32_t batch_breaks = 0;
+		// One bit per break reason, in the order of RENDERING_INFO_CANVAS_BATCH_BREAKS_*.
+		uint32_t batch_break_mask = 0;
+		double cull_msec = 0.0;
+	};
+
+	virtual void set_canvas_item_profiling_enabled(bool p_enable) = 0;
+	virtual Vector<CanvasItemProfile> get_canvas_item_profile() = 0;
+
 	virtual double get_frame_setup_time_cpu() const = 0;
 
 	/* TESTING */
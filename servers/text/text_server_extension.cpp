@@ -128,6 +128,8 @@ void TextServerExtension::_bind_methods() {
 	GDVIRTUAL_BIND(_font_get_size_cache_list, "font_rid");
 	GDVIRTUAL_BIND(_font_clear_size_cache, "font_rid");
 	GDVIRTUAL_BIND(_font_remove_size_cache, "font_rid", "size");
+	GDVIRTUAL_BIND(_font_get_size_cache_info, "font_rid");
+	GDVIRTUAL_BIND(_font_compact_size_cache, "font_rid", "size", "max_unused_frames");
 
 	GDVIRTUAL_BIND(_font_set_ascent, "font_rid", "size", "ascent");
 	GDVIRTUAL_BIND(_font_get_ascent, "font_rid", "size");
@@ -267,6 +269,7 @@ void TextServerExtension::_bind_methods() {
 	GDVIRTUAL_BIND(_shaped_text_update_justification_ops, "shaped");
 
 	GDVIRTUAL_BIND(_shaped_text_is_ready, "shaped");
+	GDVIRTUAL_BIND(_get_shaped_text_cache_info, "info");
 
 	GDVIRTUAL_BIND(_shaped_text_get_glyphs, "shaped");
 	GDVIRTUAL_BIND(_shaped_text_sort_logical, "shaped");
@@ -676,6 +679,16 @@ void TextServerExtension::font_remove_size_cache(const RID &p_font_rid, const Ve
 	GDVIRTUAL_CALL(_font_remove_size_cache, p_font_rid, p_size);
 }
 
+TypedArray<Dictionary> TextServerExtension::font_get_size_cache_info(const RID &p_font_rid) const {
+	TypedArray<Dictionary> ret;
+	GDVIRTUAL_CALL(_font_get_size_cache_info, p_font_rid, ret);
+	return ret;
+}
+
+void TextServerExtension::font_compact_size_cache(const RID &p_font_rid, const Vector2i &p_size, int64_t p_max_unused_frames) {
+	GDVIRTUAL_CALL(_font_compact_size_cache, p_font_rid, p_size, p_max_unused_frames);
+}
+
 void TextServerExtension::font_set_ascent(const RID &p_font_rid, int64_t p_size, double p_ascent) {
 	GDVIRTUAL_CALL(_font_set_ascent, p_font_rid, p_size, p_ascent);
 }
@@ -1170,6 +1183,12 @@ bool TextServerExtension::shaped_text_is_ready(const RID &p_shaped) const {
 	return ret;
 }
 
+int64_t TextServerExtension::get_shaped_text_cache_info(ShapedTextCacheInfo p_info) const {
+	int64_t ret = 0;
+	GDVIRTUAL_CALL(_get_shaped_text_cache_info, p_info, ret);
+	return ret;
+}
+
 const Glyph *TextServerExtension::shaped_text_get_glyphs(const RID &p_shaped) const {
 	GDExtensionConstPtr<const Glyph> ret;
 	GDVIRTUAL_CALL(_shaped_text_get_glyphs, p_shaped, ret);
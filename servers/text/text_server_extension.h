@@ -206,9 +206,13 @@ public:
 	virtual TypedArray<Vector2i> font_get_size_cache_list(const RID &p_font_rid) const override;
 	virtual void font_clear_size_cache(const RID &p_font_rid) override;
 	virtual void font_remove_size_cache(const RID &p_font_rid, const Vector2i &p_size) override;
+	virtual TypedArray<Dictionary> font_get_size_cache_info(const RID &p_font_rid) const override;
+	virtual void font_compact_size_cache(const RID &p_font_rid, const Vector2i &p_size, int64_t p_max_unused_frames) override;
 	GDVIRTUAL1RC(TypedArray<Vector2i>, _font_get_size_cache_list, RID);
 	GDVIRTUAL1(_font_clear_size_cache, RID);
 	GDVIRTUAL2(_font_remove_size_cache, RID, const Vector2i &);
+	GDVIRTUAL1RC(TypedArray<Dictionary>, _font_get_size_cache_info, RID);
+	GDVIRTUAL3(_font_compact_size_cache, RID, const Vector2i &, int64_t);
 
 	virtual void font_set_ascent(const RID &p_font_rid, int64_t p_size, double p_ascent) override;
 	virtual double font_get_ascent(const RID &p_font_rid, int64_t p_size) const override;
@@ -445,6 +449,9 @@ public:
 	virtual bool shaped_text_is_ready(const RID &p_shaped) const override;
 	GDVIRTUAL1RC(bool, _shaped_text_is_ready, RID);
 
+	virtual int64_t get_shaped_text_cache_info(ShapedTextCacheInfo p_info) const override;
+	GDVIRTUAL1RC(int64_t, _get_shaped_text_cache_info, ShapedTextCacheInfo);
+
 	virtual const Glyph *shaped_text_get_glyphs(const RID &p_shaped) const override;
 	virtual const Glyph *shaped_text_sort_logical(const RID &p_shaped) override;
 	virtual int64_t shaped_text_get_glyph_count(const RID &p_shaped) const override;
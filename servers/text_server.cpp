@@ -282,6 +282,8 @@ void TextServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("font_get_size_cache_list", "font_rid"), &TextServer::font_get_size_cache_list);
 	ClassDB::bind_method(D_METHOD("font_clear_size_cache", "font_rid"), &TextServer::font_clear_size_cache);
 	ClassDB::bind_method(D_METHOD("font_remove_size_cache", "font_rid", "size"), &TextServer::font_remove_size_cache);
+	ClassDB::bind_method(D_METHOD("font_get_size_cache_info", "font_rid"), &TextServer::font_get_size_cache_info);
+	ClassDB::bind_method(D_METHOD("font_compact_size_cache", "font_rid", "size", "max_unused_frames"), &TextServer::font_compact_size_cache);
 
 	ClassDB::bind_method(D_METHOD("font_set_ascent", "font_rid", "size", "ascent"), &TextServer::font_set_ascent);
 	ClassDB::bind_method(D_METHOD("font_get_ascent", "font_rid", "size"), &TextServer::font_get_ascent);
@@ -417,6 +419,7 @@ void TextServer::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("shaped_text_shape", "shaped"), &TextServer::shaped_text_shape);
 	ClassDB::bind_method(D_METHOD("shaped_text_is_ready", "shaped"), &TextServer::shaped_text_is_ready);
+	ClassDB::bind_method(D_METHOD("get_shaped_text_cache_info", "info"), &TextServer::get_shaped_text_cache_info);
 	ClassDB::bind_method(D_METHOD("shaped_text_has_visible_chars", "shaped"), &TextServer::shaped_text_has_visible_chars);
 
 	ClassDB::bind_method(D_METHOD("shaped_text_get_glyphs", "shaped"), &TextServer::_shaped_text_get_glyphs_wrapper);
@@ -627,6 +630,11 @@ void TextServer::_bind_methods() {
 	BIND_ENUM_CONSTANT(FIXED_SIZE_SCALE_DISABLE);
 	BIND_ENUM_CONSTANT(FIXED_SIZE_SCALE_INTEGER_ONLY);
 	BIND_ENUM_CONSTANT(FIXED_SIZE_SCALE_ENABLED);
+
+	/* Shaped text cache info */
+	BIND_ENUM_CONSTANT(SHAPED_TEXT_CACHE_HITS);
+	BIND_ENUM_CONSTANT(SHAPED_TEXT_CACHE_MISSES);
+	BIND_ENUM_CONSTANT(SHAPED_TEXT_CACHE_MEMORY_USED);
 }
 
 Vector2 TextServer::get_hex_code_box_size(int64_t p_size, int64_t p_index) const {
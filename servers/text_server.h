@@ -213,6 +213,12 @@ public:
 		FIXED_SIZE_SCALE_ENABLED,
 	};
 
+	enum ShapedTextCacheInfo {
+		SHAPED_TEXT_CACHE_HITS,
+		SHAPED_TEXT_CACHE_MISSES,
+		SHAPED_TEXT_CACHE_MEMORY_USED,
+	};
+
 	void _draw_hex_code_box_number(const RID &p_canvas, int64_t p_size, const Vector2 &p_pos, uint8_t p_index, const Color &p_color) const;
 
 protected:
@@ -320,6 +326,8 @@ public:
 	virtual TypedArray<Vector2i> font_get_size_cache_list(const RID &p_font_rid) const = 0;
 	virtual void font_clear_size_cache(const RID &p_font_rid) = 0;
 	virtual void font_remove_size_cache(const RID &p_font_rid, const Vector2i &p_size) = 0;
+	virtual TypedArray<Dictionary> font_get_size_cache_info(const RID &p_font_rid) const = 0;
+	virtual void font_compact_size_cache(const RID &p_font_rid, const Vector2i &p_size, int64_t p_max_unused_frames) = 0;
 
 	virtual void font_set_ascent(const RID &p_font_rid, int64_t p_size, double p_ascent) = 0;
 	virtual double font_get_ascent(const RID &p_font_rid, int64_t p_size) const = 0;
@@ -458,6 +466,7 @@ public:
 	virtual bool shaped_text_update_justification_ops(const RID &p_shaped) = 0;
 
 	virtual bool shaped_text_is_ready(const RID &p_shaped) const = 0;
+	virtual int64_t get_shaped_text_cache_info(ShapedTextCacheInfo p_info) const = 0;
 	bool shaped_text_has_visible_chars(const RID &p_shaped) const;
 
 	virtual const Glyph *shaped_text_get_glyphs(const RID &p_shaped) const = 0;
@@ -630,6 +639,7 @@ VARIANT_ENUM_CAST(TextServer::StructuredTextParser);
 VARIANT_ENUM_CAST(TextServer::FontAntialiasing);
 VARIANT_ENUM_CAST(TextServer::FontLCDSubpixelLayout);
 VARIANT_ENUM_CAST(TextServer::FixedSizeScaleMode);
+VARIANT_ENUM_CAST(TextServer::ShapedTextCacheInfo);
 
 GDVIRTUAL_NATIVE_PTR(Glyph);
 GDVIRTUAL_NATIVE_PTR(CaretInfo);
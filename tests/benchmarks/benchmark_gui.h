@@ -0,0 +1,236 @@
+/**************************************************************************/
+/*  benchmark_gui.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_GUI_H
+#define BENCHMARK_GUI_H
+
+#include "core/os/os.h"
+#include "core/string/string_builder.h"
+#include "scene/gui/item_list.h"
+#include "scene/gui/rich_text_label.h"
+#include "scene/gui/text_edit.h"
+#include "scene/gui/tree.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace BenchmarkGUI {
+
+static const int virtual_row_count = 1000000;
+static const int scroll_steps = 2000;
+
+class RowSource : public Object {
+public:
+	Variant get_row(int p_row) {
+		return vformat("Row %d", p_row);
+	}
+};
+
+static double _usec_per_step(uint64_t p_begin_usec) {
+	return double(OS::get_singleton()->get_ticks_usec() - p_begin_usec) / scroll_steps;
+}
+
+TEST_SUITE("[Benchmark]") {
+	TEST_CASE("[SceneTree][ItemList] Scrolling through 1M virtual rows") {
+		RowSource *source = memnew(RowSource);
+		ItemList *list = memnew(ItemList);
+		list->set_size(Size2(400, 800));
+		list->set_item_source(callable_mp(source, &RowSource::get_row));
+		list->set_item_count(virtual_row_count);
+		SceneTree::get_singleton()->get_root()->add_child(list);
+		list->force_update_list_size();
+
+		VScrollBar *scroll = list->get_v_scroll_bar();
+		const double page = scroll->get_page();
+		const double max = scroll->get_max() - page;
+
+		// Page by page from the top, then jumps spread over the whole list. Reading
+		// the visible rows fetches and shapes them like drawing does.
+		for (int pass = 0; pass < 2; pass++) {
+			int max_cached = 0;
+			uint64_t begin = OS::get_singleton()->get_ticks_usec();
+			for (int i = 0; i < scroll_steps; i++) {
+				scroll->set_value(pass == 0 ? i * page : max * i / (scroll_steps - 1));
+				list->force_update_list_size();
+				const int first = list->get_item_at_position(Point2(10, 10), true);
+				const int last = list->get_item_at_position(Point2(10, list->get_size().height - 10), true);
+				for (int j = first; j <= last; j++) {
+					list->get_item_text(j);
+				}
+				max_cached = MAX(max_cached, list->get_cached_virtual_item_count());
+			}
+			MESSAGE("ItemList ", pass == 0 ? "paging" : "jumping", ": ", _usec_per_step(begin), " usec per scroll, at most ", max_cached, " cached rows.");
+		}
+
+		memdelete(list);
+		memdelete(source);
+	}
+
+	TEST_CASE("[SceneTree][Tree] Scrolling through 1M virtual rows") {
+		RowSource *source = memnew(RowSource);
+		Tree *tree = memnew(Tree);
+		tree->set_size(Size2(400, 800));
+		SceneTree::get_singleton()->get_root()->add_child(tree);
+		tree->set_item_source(callable_mp(source, &RowSource::get_row));
+		tree->set_virtual_row_count(virtual_row_count);
+
+		const int page_rows = tree->get_cached_virtual_row_count() / 2;
+		REQUIRE(page_rows > 0);
+
+		for (int pass = 0; pass < 2; pass++) {
+			int max_cached = 0;
+			uint64_t begin = OS::get_singleton()->get_ticks_usec();
+			for (int i = 0; i < scroll_steps; i++) {
+				const int row = pass == 0 ? i * page_rows : int(int64_t(virtual_row_count - 1) * i / (scroll_steps - 1));
+				tree->scroll_to_virtual_row(row);
+				// Measuring the visible rows shapes them like drawing does.
+				for (int j = row; j < row + page_rows; j++) {
+					TreeItem *item = tree->get_virtual_row_item(j);
+					if (item) {
+						tree->get_item_rect(item);
+					}
+				}
+				max_cached = MAX(max_cached, tree->get_cached_virtual_row_count());
+			}
+			MESSAGE("Tree ", pass == 0 ? "paging" : "jumping", ": ", _usec_per_step(begin), " usec per scroll, at most ", max_cached, " cached rows.");
+		}
+
+		memdelete(tree);
+		memdelete(source);
+	}
+
+	TEST_CASE("[SceneTree][RichTextLabel] Streaming 10,000 chat messages") {
+		const int messages = 10000;
+		const int per_frame = 10;
+		const int resizes = 20;
+
+		RichTextLabel *label = memnew(RichTextLabel);
+		label->set_size(Size2(400, 800));
+		label->set_scroll_follow(true);
+		SceneTree::get_singleton()->get_root()->add_child(label);
+
+		// A few messages per frame, each frame laying out what was appended like a redraw does.
+		// With incremental layout the last frames should cost about as much as the first ones.
+		const int report_frames = 50;
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		double first_frames = 0.0;
+		for (int i = 0; i < messages; i++) {
+			label->append_text(vformat("[b]User %d:[/b] message number %d, with enough words to wrap at this width now and then.\n", i % 7, i));
+			if (i % per_frame == per_frame - 1) {
+				label->get_content_height();
+			}
+			if (i == report_frames * per_frame - 1) {
+				first_frames = double(OS::get_singleton()->get_ticks_usec() - begin) / report_frames;
+			}
+			if (i == messages - report_frames * per_frame) {
+				begin = OS::get_singleton()->get_ticks_usec();
+			}
+		}
+		const double last_frames = double(OS::get_singleton()->get_ticks_usec() - begin) / report_frames;
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < resizes; i++) {
+			label->set_size(Size2(400, 600 + (i % 2) * 200));
+			label->get_content_height();
+		}
+		const double height_resize = double(OS::get_singleton()->get_ticks_usec() - begin) / resizes;
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < resizes; i++) {
+			label->set_size(Size2(400 + (i % 2) * 100, 800));
+			label->get_content_height();
+		}
+		const double width_resize = double(OS::get_singleton()->get_ticks_usec() - begin) / resizes;
+
+		MESSAGE("RichTextLabel appending ", per_frame, " messages per frame: ", first_frames, " usec per frame for the first ", report_frames, " frames, ", last_frames, " usec for the last ", report_frames, ".");
+		MESSAGE("RichTextLabel with ", messages, " paragraphs: ", height_resize, " usec per height change, ", width_resize, " usec per width change.");
+
+		memdelete(label);
+	}
+
+	TEST_CASE("[SceneTree][TextEdit] Opening, scrolling and typing in 100,000 lines") {
+		const int line_count = 100000;
+		const int frames = 200;
+
+		TextEdit *text_edit = memnew(TextEdit);
+		text_edit->set_size(Size2(800, 600));
+		SceneTree::get_singleton()->get_root()->add_child(text_edit);
+
+		StringBuilder source;
+		for (int i = 0; i < line_count; i++) {
+			source.append(vformat("\tfunc_%d(argument, \"a string literal\", %d) # and a comment\n", i, i * 7));
+		}
+		const String source_text = source.as_string();
+
+		// Processing a frame flushes the queued redraw, which lays out the visible lines.
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		text_edit->set_text(source_text);
+		text_edit->queue_redraw();
+		SceneTree::get_singleton()->process(0);
+		const double open = double(OS::get_singleton()->get_ticks_usec() - begin) / 1000.0;
+
+		const int page = text_edit->get_visible_line_count();
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < frames; i++) {
+			text_edit->set_v_scroll(i * page);
+			text_edit->queue_redraw();
+			SceneTree::get_singleton()->process(0);
+		}
+		const double paging = double(OS::get_singleton()->get_ticks_usec() - begin) / frames;
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < frames; i++) {
+			text_edit->set_v_scroll(int64_t(line_count - page) * ((i * 7919) % frames) / frames);
+			text_edit->queue_redraw();
+			SceneTree::get_singleton()->process(0);
+		}
+		const double jumping = double(OS::get_singleton()->get_ticks_usec() - begin) / frames;
+
+		text_edit->set_caret_line(line_count / 2);
+		text_edit->set_caret_column(1);
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < frames; i++) {
+			text_edit->insert_text_at_caret(i % 40 == 39 ? "\n" : "x");
+			text_edit->queue_redraw();
+			SceneTree::get_singleton()->process(0);
+		}
+		const double typing = double(OS::get_singleton()->get_ticks_usec() - begin) / frames;
+
+		MESSAGE("TextEdit with ", line_count, " lines: opened and drawn in ", open, " ms.");
+		MESSAGE("TextEdit scrolling: ", paging, " usec per page, ", jumping, " usec per jump.");
+		MESSAGE("TextEdit typing in the middle: ", typing, " usec per character.");
+
+		memdelete(text_edit);
+	}
+}
+
+} // namespace BenchmarkGUI
+
+#endif // BENCHMARK_GUI_H
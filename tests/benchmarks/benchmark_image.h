@@ -0,0 +1,170 @@
+/**************************************************************************/
+/*  benchmark_image.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_IMAGE_H
+#define BENCHMARK_IMAGE_H
+
+#include "core/io/image.h"
+#include "core/io/image_kernels.h"
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace BenchmarkImage {
+
+static Ref<Image> _make_benchmark_image(int p_width, int p_height, Image::Format p_format) {
+	Vector<uint8_t> data;
+	data.resize(p_width * p_height * 4);
+	uint8_t *w = data.ptrw();
+	for (int i = 0; i < data.size(); i++) {
+		w[i] = (i * 7 + (i >> 10) * 13) & 0xFF;
+	}
+	Ref<Image> image = memnew(Image(p_width, p_height, false, Image::FORMAT_RGBA8, data));
+	image->convert(p_format);
+	return image;
+}
+
+static double _megapixels_per_second(double p_pixels, uint64_t p_begin_usec) {
+	double seconds = MAX(OS::get_singleton()->get_ticks_usec() - p_begin_usec, (uint64_t)1) / 1000000.0;
+	return p_pixels / seconds / 1000000.0;
+}
+
+TEST_SUITE("[Benchmark]") {
+	TEST_CASE("[Image] Conversion, resizing and blending throughput") {
+		// 4K images, the float ones are smaller to keep memory use reasonable.
+		const int size = 4096;
+		const int float_size = 2048;
+
+		Ref<Image> rgba8 = _make_benchmark_image(size, size, Image::FORMAT_RGBA8);
+		Ref<Image> rgb8 = _make_benchmark_image(size, size, Image::FORMAT_RGB8);
+		Ref<Image> rgbaf = _make_benchmark_image(float_size, float_size, Image::FORMAT_RGBAF);
+
+		enum OperationType {
+			CONVERT,
+			RESIZE,
+			BLEND,
+		};
+		struct Operation {
+			const char *name;
+			OperationType type;
+			Ref<Image> source;
+			Image::Format format;
+			Image::Interpolation interpolation;
+			bool has_kernels; // Runs once per supported ImageKernels level.
+		};
+		const Operation operations[] = {
+			{ "convert RGBA8 -> RGB8", CONVERT, rgba8, Image::FORMAT_RGB8, Image::INTERPOLATE_NEAREST, true },
+			{ "convert RGB8 -> RGBA8", CONVERT, rgb8, Image::FORMAT_RGBA8, Image::INTERPOLATE_NEAREST, true },
+			{ "convert RGBA8 -> RGBAF", CONVERT, rgba8, Image::FORMAT_RGBAF, Image::INTERPOLATE_NEAREST, false },
+			{ "resize bilinear RGBA8", RESIZE, rgba8, Image::FORMAT_MAX, Image::INTERPOLATE_BILINEAR, true },
+			{ "resize cubic RGBA8", RESIZE, rgba8, Image::FORMAT_MAX, Image::INTERPOLATE_CUBIC, false },
+			{ "resize lanczos RGBA8", RESIZE, rgba8, Image::FORMAT_MAX, Image::INTERPOLATE_LANCZOS, false },
+			{ "resize bilinear RGB8", RESIZE, rgb8, Image::FORMAT_MAX, Image::INTERPOLATE_BILINEAR, false },
+			{ "resize bilinear RGBAF", RESIZE, rgbaf, Image::FORMAT_MAX, Image::INTERPOLATE_BILINEAR, false },
+			{ "resize lanczos RGBAF", RESIZE, rgbaf, Image::FORMAT_MAX, Image::INTERPOLATE_LANCZOS, false },
+			{ "blend_rect RGBA8", BLEND, rgba8, Image::FORMAT_MAX, Image::INTERPOLATE_NEAREST, true },
+		};
+
+		Ref<Image> overlay = _make_benchmark_image(size, size, Image::FORMAT_RGBA8);
+		overlay->fill(Color(1.0, 0.0, 0.0, 0.5));
+
+		const ImageKernels::Level native_level = ImageKernels::get_level();
+		for (const Operation &op : operations) {
+			for (int level = 0; level < ImageKernels::LEVEL_MAX; level++) {
+				if (!ImageKernels::is_level_supported(ImageKernels::Level(level)) || (!op.has_kernels && level != native_level)) {
+					continue;
+				}
+				ImageKernels::set_level(ImageKernels::Level(level));
+
+				Ref<Image> image = op.source->duplicate();
+				uint64_t begin = OS::get_singleton()->get_ticks_usec();
+				switch (op.type) {
+					case CONVERT:
+						image->convert(op.format);
+						break;
+					case RESIZE:
+						image->resize(image->get_width() * 3 / 2, image->get_height() * 3 / 2, op.interpolation);
+						break;
+					case BLEND:
+						image->blend_rect(overlay, Rect2i(0, 0, size, size), Point2i());
+						break;
+				}
+				double throughput = _megapixels_per_second((double)image->get_width() * image->get_height(), begin);
+				if (op.has_kernels) {
+					MESSAGE(op.name, " (", ImageKernels::get_level_name(ImageKernels::Level(level)), "): ", throughput, " Mpx/s.");
+				} else {
+					MESSAGE(op.name, ": ", throughput, " Mpx/s.");
+				}
+			}
+			ImageKernels::set_level(ImageKernels::LEVEL_MAX);
+		}
+	}
+
+	TEST_CASE("[Image] Texture compression throughput") {
+		Ref<Image> source = _make_benchmark_image(2048, 2048, Image::FORMAT_RGBA8);
+		source->generate_mipmaps();
+		const double pixels = source->get_data().size() / 4.0;
+
+		struct Compressor {
+			const char *name;
+			bool available;
+			Image::CompressMode mode;
+		};
+		const Compressor compressors[] = {
+			{ "S3TC", Image::_image_compress_bc_func != nullptr, Image::COMPRESS_S3TC },
+			{ "ETC2", Image::_image_compress_etc2_func != nullptr, Image::COMPRESS_ETC2 },
+			{ "BPTC", Image::_image_compress_bptc_func != nullptr, Image::COMPRESS_BPTC },
+			{ "ASTC", Image::_image_compress_astc_func != nullptr, Image::COMPRESS_ASTC },
+		};
+		for (const Compressor &compressor : compressors) {
+			if (!compressor.available) {
+				MESSAGE(compressor.name, ": not available in this build.");
+				continue;
+			}
+
+			// Single threaded first, then with every worker thread.
+			double throughput[2];
+			for (int i = 0; i < 2; i++) {
+				Image::set_compression_thread_limit(i == 0 ? 1 : 0);
+				Ref<Image> image = source->duplicate();
+				uint64_t begin = OS::get_singleton()->get_ticks_usec();
+				image->compress_from_channels(compressor.mode, Image::USED_CHANNELS_RGBA);
+				throughput[i] = _megapixels_per_second(pixels, begin);
+			}
+			MESSAGE(compressor.name, ": ", throughput[0], " Mpx/s on 1 thread, ",
+					throughput[1], " Mpx/s on ", Image::get_compression_thread_count(), " threads.");
+		}
+		Image::set_compression_thread_limit(0);
+	}
+}
+
+} // namespace BenchmarkImage
+
+#endif // BENCHMARK_IMAGE_H
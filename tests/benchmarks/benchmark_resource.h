@@ -0,0 +1,184 @@
+/**************************************************************************/
+/*  benchmark_resource.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_RESOURCE_H
+#define BENCHMARK_RESOURCE_H
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access_pack.h"
+#include "core/io/pck_packer.h"
+#include "core/io/resource_format_binary.h"
+#include "core/io/resource_saver.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace BenchmarkResource {
+
+struct PoolLoad {
+	String path;
+	double msec = 0.0;
+};
+
+static double _load_msec(const String &p_path) {
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	Ref<Resource> resource = loader->load(p_path, "", nullptr, false, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	double msec = (OS::get_singleton()->get_ticks_usec() - begin) / 1000.0;
+	CHECK(resource.is_valid());
+	return msec;
+}
+
+// Loads on the pool decode serially, which gives the baseline.
+static void _load_on_pool_thread(void *p_userdata) {
+	PoolLoad *load = (PoolLoad *)p_userdata;
+	load->msec = _load_msec(load->path);
+}
+
+// Resident set size in KiB, 0 where /proc isn't available.
+static uint64_t _rss_kib() {
+	Ref<FileAccess> f = FileAccess::open("/proc/self/status", FileAccess::READ);
+	if (f.is_null()) {
+		return 0;
+	}
+	while (!f->eof_reached()) {
+		String line = f->get_line();
+		if (line.begins_with("VmRSS:")) {
+			return line.get_slice(":", 1).to_int();
+		}
+	}
+	return 0;
+}
+
+TEST_SUITE("[Benchmark]") {
+	TEST_CASE("[Resource] Binary sub-resource decoding") {
+		const int counts[] = { 100, 1000, 10000 };
+		const int runs = 5;
+
+		for (int count : counts) {
+			Ref<Resource> resource = memnew(Resource);
+			Array children;
+			for (int i = 0; i < count; i++) {
+				Ref<Resource> child = memnew(Resource);
+				child->set_name(vformat("Child %d", i));
+				PackedVector2Array points;
+				points.resize(256);
+				for (int j = 0; j < points.size(); j++) {
+					points.write[j] = Vector2(i, j);
+				}
+				child->set_meta("points", points);
+				child->set_meta("path", NodePath("Parent/Child:position:x"));
+				Dictionary dict;
+				dict["index"] = i;
+				dict["label"] = vformat("Label %d", i);
+				child->set_meta("dict", dict);
+				children.push_back(child);
+			}
+			resource->set_meta("children", children);
+
+			const String path = OS::get_singleton()->get_cache_path().path_join(vformat("benchmark_resource_%d.res", count));
+			REQUIRE(ResourceSaver::save(resource, path) == OK);
+
+			// Best of several runs, the first one also warms up the file system cache.
+			double serial = 1e20;
+			double parallel = 1e20;
+			for (int run = 0; run < runs; run++) {
+				PoolLoad load;
+				load.path = path;
+				WorkerThreadPool::TaskID task = WorkerThreadPool::get_singleton()->add_native_task(&_load_on_pool_thread, &load);
+				WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+				serial = MIN(serial, load.msec);
+
+				parallel = MIN(parallel, _load_msec(path));
+			}
+			MESSAGE(count, " sub-resources: serial ", serial, " ms, parallel ", parallel, " ms (", WorkerThreadPool::get_singleton()->get_thread_count(), " pool threads), ", serial / parallel, "x.");
+
+			DirAccess::remove_absolute(path);
+		}
+	}
+	TEST_CASE("[Resource] Binary loads from a mapped pack") {
+		const int arrays = 64;
+		const int runs = 5;
+
+		// Large packed arrays, so the loader copies them out of the mapping.
+		Ref<Resource> resource = memnew(Resource);
+		for (int i = 0; i < arrays; i++) {
+			PackedFloat32Array values;
+			values.resize(65536);
+			for (int j = 0; j < values.size(); j++) {
+				values.write[j] = i + j;
+			}
+			resource->set_meta(vformat("values_%d", i), values);
+		}
+
+		const String cache = OS::get_singleton()->get_cache_path();
+		const String path = cache.path_join("benchmark_mapped.res");
+		const String pck_path = cache.path_join("benchmark_mapped.pck");
+		REQUIRE(ResourceSaver::save(resource, path) == OK);
+
+		Ref<PCKPacker> packer;
+		packer.instantiate();
+		REQUIRE(packer->pck_start(pck_path) == OK);
+		REQUIRE(packer->add_file("res://benchmark_mapped.res", path) == OK);
+		REQUIRE(packer->flush() == OK);
+
+		// Mounting the pack is what an exported game does at startup.
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		REQUIRE(PackedData::get_singleton()->add_pack(pck_path, true, 0) == OK);
+		const double mount = (OS::get_singleton()->get_ticks_usec() - begin) / 1000.0;
+
+		// The first load of each file includes setting up the mapping.
+		uint64_t rss = _rss_kib();
+		const double buffered_first = _load_msec(path);
+		const int64_t buffered_rss = int64_t(_rss_kib()) - int64_t(rss);
+		rss = _rss_kib();
+		const double mapped_first = _load_msec("res://benchmark_mapped.res");
+		const int64_t mapped_rss = int64_t(_rss_kib()) - int64_t(rss);
+
+		double buffered = 1e20;
+		double mapped = 1e20;
+		for (int run = 0; run < runs; run++) {
+			buffered = MIN(buffered, _load_msec(path));
+			mapped = MIN(mapped, _load_msec("res://benchmark_mapped.res"));
+		}
+		MESSAGE((FileAccess::get_file_as_bytes(path).size() / 1024), " KiB resource, pack mounted in ", mount, " ms.");
+		MESSAGE("Buffered: first load ", buffered_first, " ms, best ", buffered, " ms, RSS ", buffered_rss, " KiB.");
+		MESSAGE("Mapped pack: first load ", mapped_first, " ms, best ", mapped, " ms, RSS ", mapped_rss, " KiB.");
+
+		DirAccess::remove_absolute(path);
+		DirAccess::remove_absolute(pck_path);
+	}
+}
+
+} // namespace BenchmarkResource
+
+#endif // BENCHMARK_RESOURCE_H
@@ -0,0 +1,263 @@
+/**************************************************************************/
+/*  benchmark_scene.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_SCENE_H
+#define BENCHMARK_SCENE_H
+
+#include "core/os/os.h"
+#include "scene/2d/node_2d.h"
+#include "scene/main/window.h"
+#include "scene/resources/packed_scene.h"
+
+#include "tests/test_macros.h"
+
+namespace BenchmarkScene {
+
+static double _usec_per(uint64_t p_begin_usec, int p_count) {
+	return double(OS::get_singleton()->get_ticks_usec() - p_begin_usec) / p_count;
+}
+
+// A root, 7 groups and 6 leaves per group, each with a few plain properties.
+static Ref<PackedScene> _make_scene_50() {
+	Node2D *root = memnew(Node2D);
+	root->set_name("Root");
+	for (int i = 0; i < 7; i++) {
+		Node2D *group = memnew(Node2D);
+		group->set_name(vformat("Group%d", i));
+		group->set_position(Vector2(i * 10, 0));
+		root->add_child(group);
+		group->set_owner(root);
+		for (int j = 0; j < 6; j++) {
+			Node2D *leaf = memnew(Node2D);
+			leaf->set_name(vformat("Leaf%d", j));
+			leaf->set_position(Vector2(j, i));
+			leaf->set_rotation(0.1 * j);
+			leaf->set_scale(Vector2(2, 2));
+			leaf->set_z_index(j);
+			leaf->set_modulate(Color(1, 0, 0));
+			group->add_child(leaf);
+			leaf->set_owner(root);
+		}
+	}
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(root);
+	memdelete(root);
+	return packed_scene;
+}
+
+// A native class handling the notification itself, which must not be skipped.
+class ProcessCounter : public Node {
+	GDCLASS(ProcessCounter, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS) {
+			count++;
+		}
+	}
+
+public:
+	uint64_t count = 0;
+};
+
+// Average cost of a SceneTree process frame with p_count processing nodes of type T under the root.
+template <typename T>
+static double _usec_per_process_frame(int p_count, int p_frames) {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+	for (int i = 0; i < p_count; i++) {
+		T *node = memnew(T);
+		parent->add_child(node);
+		node->set_process(true);
+	}
+
+	// The first frame sorts the new entries into the process list.
+	SceneTree::get_singleton()->process(0);
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < p_frames; i++) {
+		SceneTree::get_singleton()->process(0);
+	}
+	const double usec = _usec_per(begin, p_frames);
+
+	memdelete(parent);
+	return usec;
+}
+
+TEST_SUITE("[Benchmark]") {
+	TEST_CASE("[SceneTree][PackedScene] Instantiating a 50-node scene 10,000 times") {
+		const int instances = 10000;
+
+		Ref<PackedScene> packed_scene = _make_scene_50();
+		Ref<SceneState> state = packed_scene->get_state();
+		const int node_count = state->get_node_count();
+		REQUIRE(node_count == 50);
+
+		// The first instantiation builds the plan.
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		memdelete(packed_scene->instantiate());
+		const double first = _usec_per(begin, 1);
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < instances; i++) {
+			memdelete(packed_scene->instantiate());
+		}
+		const double planned = _usec_per(begin, instances);
+
+		// Baseline: the same tree built by class and property name, which is
+		// what instantiation interpreted before the plan existed.
+		HashMap<String, int> index_by_path;
+		LocalVector<int> parents;
+		parents.resize(node_count);
+		for (int i = 0; i < node_count; i++) {
+			index_by_path[String(state->get_node_path(i))] = i;
+			const NodePath parent_path = state->get_node_path(i, true);
+			parents[i] = parent_path.is_empty() ? -1 : index_by_path[String(parent_path)];
+		}
+
+		LocalVector<Node *> created;
+		created.resize(node_count);
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < instances; i++) {
+			for (int j = 0; j < node_count; j++) {
+				Node *node = Object::cast_to<Node>(ClassDB::instantiate(state->get_node_type(j)));
+				for (int k = 0; k < state->get_node_property_count(j); k++) {
+					node->set(state->get_node_property_name(j, k), state->get_node_property_value(j, k));
+				}
+				node->set_name(state->get_node_name(j));
+				if (parents[j] >= 0) {
+					created[parents[j]]->add_child(node);
+					node->set_owner(created[0]);
+				}
+				created[j] = node;
+			}
+			memdelete(created[0]);
+		}
+		const double by_name = _usec_per(begin, instances);
+
+		MESSAGE("First instantiation (builds the plan): ", first, " usec.");
+		MESSAGE("Planned: ", planned, " usec per instance, ", instances * planned / 1000000.0, " s total.");
+		MESSAGE("By class and property name: ", by_name, " usec per instance, ", by_name / planned, "x the planned time.");
+	}
+
+	TEST_CASE("[SceneTree][Node] Processing 100,000 nodes") {
+		const int count = 100000;
+		const int frames = 60;
+
+		GDREGISTER_CLASS(ProcessCounter);
+
+		// Only plain nodes are known to do nothing on the process notification and are skipped.
+		// Native subclasses keep the notification, whether they handle it or not.
+		const double empty = _usec_per_process_frame<Node>(0, frames);
+		const double plain = _usec_per_process_frame<Node>(count, frames);
+		const double node_2d = _usec_per_process_frame<Node2D>(count, frames);
+		const double counter = _usec_per_process_frame<ProcessCounter>(count, frames);
+
+		MESSAGE("Empty tree: ", empty, " usec per frame.");
+		MESSAGE("Plain Node: ", plain, " usec per frame.");
+		MESSAGE("Node2D, notification path: ", node_2d, " usec per frame.");
+		MESSAGE("Native class handling NOTIFICATION_PROCESS: ", counter, " usec per frame.");
+	}
+
+	TEST_CASE("[SceneTree][Node] Adding, removing and calling group members") {
+		const int count = 10000;
+		const int calls = 100;
+		const StringName group = "benchmark_group";
+		const StringName method = "get_child_count";
+
+		Node *parent = memnew(Node);
+		SceneTree::get_singleton()->get_root()->add_child(parent);
+		LocalVector<Node *> nodes;
+		for (int i = 0; i < count; i++) {
+			Node *node = memnew(Node);
+			parent->add_child(node);
+			nodes.push_back(node);
+		}
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (Node *node : nodes) {
+			node->add_to_group(group);
+		}
+		const double add = _usec_per(begin, count);
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < calls; i++) {
+			SceneTree::get_singleton()->call_group(group, method);
+		}
+		const double call = _usec_per(begin, calls);
+
+		// What each member costs without the cached method lookups.
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < calls; i++) {
+			for (Node *node : nodes) {
+				node->call(method);
+			}
+		}
+		const double call_by_name = _usec_per(begin, calls);
+
+		// Every other member leaves, then the group is used, which closes the holes.
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < count; i += 2) {
+			nodes[i]->remove_from_group(group);
+		}
+		const double remove = _usec_per(begin, count / 2);
+		begin = OS::get_singleton()->get_ticks_usec();
+		SceneTree::get_singleton()->call_group(group, method);
+		const double compact = _usec_per(begin, 1);
+
+		// Members coming and going between calls, like spawned and freed enemies.
+		const int churn = count / 10;
+		begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < calls; i++) {
+			for (int j = 0; j < churn; j++) {
+				Node *node = nodes[(i * churn + j) % count];
+				if (node->is_in_group(group)) {
+					node->remove_from_group(group);
+				} else {
+					node->add_to_group(group);
+				}
+			}
+			SceneTree::get_singleton()->call_group(group, method);
+		}
+		const double churned = _usec_per(begin, calls);
+
+		MESSAGE(count, " members: add_to_group() ", add, " usec, remove_from_group() ", remove, " usec per node.");
+		MESSAGE("call_group(): ", call, " usec per call, ", call_by_name, " usec calling every member by name.");
+		MESSAGE("First call_group() after removing half the members: ", compact, " usec.");
+		MESSAGE("Toggling ", churn, " members then call_group(): ", churned, " usec per round.");
+
+		memdelete(parent);
+	}
+}
+
+} // namespace BenchmarkScene
+
+#endif // BENCHMARK_SCENE_H
@@ -0,0 +1,217 @@
+/**************************************************************************/
+/*  benchmark_text_server.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef BENCHMARK_TEXT_SERVER_H
+#define BENCHMARK_TEXT_SERVER_H
+
+#ifdef TOOLS_ENABLED
+
+#include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "editor/builtin_fonts.gen.h"
+#include "servers/text_server.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace BenchmarkTextServer {
+
+struct ShapingData {
+	TextServer *ts = nullptr;
+	LocalVector<RID> texts;
+};
+
+static void _shape_paragraph(void *p_userdata, uint32_t p_index) {
+	ShapingData *data = (ShapingData *)p_userdata;
+	data->ts->shaped_text_shape(data->texts[p_index]);
+}
+
+struct StartupFont {
+	const uint8_t *data = nullptr;
+	size_t data_size = 0;
+	bool msdf = false;
+	int64_t first = 0;
+	int64_t last = 0;
+};
+
+// Creates the fonts and renders the glyphs a project typically needs at startup, returns the time taken in ms.
+static double _startup_fonts(const Ref<TextServer> &p_ts, const LocalVector<StartupFont> &p_fonts) {
+	const int sizes[] = { 12, 16, 24 };
+
+	LocalVector<RID> rids;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (const StartupFont &E : p_fonts) {
+		RID font = p_ts->create_font();
+		p_ts->font_set_data_ptr(font, E.data, E.data_size);
+		p_ts->font_set_multichannel_signed_distance_field(font, E.msdf);
+		for (int size : sizes) {
+			p_ts->font_render_range(font, Vector2i(size, 0), E.first, E.last);
+			if (E.msdf) {
+				break; // MSDF glyphs are shared by all sizes.
+			}
+		}
+		rids.push_back(font);
+	}
+	double msec = (OS::get_singleton()->get_ticks_usec() - begin) / 1000.0;
+
+	for (const RID &E : rids) {
+		p_ts->free_rid(E);
+	}
+	return msec;
+}
+
+TEST_SUITE("[Benchmark]") {
+	TEST_CASE("[TextServer] Concurrent shaping scaling") {
+		const int paragraphs = 512;
+		const uint32_t max_threads = WorkerThreadPool::get_singleton()->get_thread_count();
+
+		for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+			Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+			if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC) || !ts->has_feature(TextServer::FEATURE_SHAPING)) {
+				continue;
+			}
+
+			RID font1 = ts->create_font();
+			ts->font_set_data_ptr(font1, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+			ts->font_set_allow_system_fallback(font1, false);
+			RID font2 = ts->create_font();
+			ts->font_set_data_ptr(font2, _font_NotoNaskhArabicUI_Regular, _font_NotoNaskhArabicUI_Regular_size);
+			ts->font_set_allow_system_fallback(font2, false);
+			Array font;
+			font.push_back(font1);
+			font.push_back(font2);
+
+			double single_thread_rate = 0.0;
+			for (uint32_t threads = 1; threads <= max_threads; threads *= 2) {
+				// New text for every run, so shaped results cached by an earlier run aren't reused.
+				ShapingData data;
+				data.ts = ts.ptr();
+				for (int j = 0; j < paragraphs; j++) {
+					RID ctx = ts->create_shaped_text();
+					String text;
+					for (int k = 0; k < 8; k++) {
+						text += vformat(U"Paragraph %d.%d.%d, sentence %d: the quick brown fox الحمد لله jumps. ", threads, j, k, j * 31 + k);
+					}
+					ts->shaped_text_add_string(ctx, text, font, 16);
+					data.texts.push_back(ctx);
+				}
+
+				uint64_t begin = OS::get_singleton()->get_ticks_usec();
+				WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(_shape_paragraph, &data, paragraphs, threads, true);
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+				double seconds = MAX(OS::get_singleton()->get_ticks_usec() - begin, (uint64_t)1) / 1000000.0;
+
+				double rate = paragraphs / seconds;
+				if (threads == 1) {
+					single_thread_rate = rate;
+				}
+				MESSAGE(ts->get_name(), ": ", threads, " threads, ", rate, " paragraphs/s, ", rate / single_thread_rate, "x.");
+
+				for (const RID &E : data.texts) {
+					ts->free_rid(E);
+				}
+			}
+
+			ts->free_rid(font1);
+			ts->free_rid(font2);
+		}
+	}
+
+	TEST_CASE("[TextServer] Glyph pre-warming") {
+		// 5000 CJK ideographs, rendered in batches on the worker threads where supported.
+		const int64_t first = 0x4E00;
+		const int64_t count = 5000;
+
+		for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+			Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+			if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC)) {
+				continue;
+			}
+
+			RID font = ts->create_font();
+			ts->font_set_data_ptr(font, _font_DroidSansFallback, _font_DroidSansFallback_size);
+			ts->font_set_subpixel_positioning(font, TextServer::SUBPIXEL_POSITIONING_DISABLED);
+
+			uint64_t begin = OS::get_singleton()->get_ticks_usec();
+			ts->font_render_range(font, Vector2i(16, 0), first, first + count - 1);
+			double msec = (OS::get_singleton()->get_ticks_usec() - begin) / 1000.0;
+			MESSAGE(ts->get_name(), ": pre-warming ", count, " CJK glyphs took ", msec, " ms.");
+
+			ts->free_rid(font);
+		}
+	}
+
+	TEST_CASE("[TextServer] Startup with the persistent glyph cache") {
+		// 4 fonts covering 3 scripts: Latin (bitmap and MSDF), Arabic and CJK.
+		LocalVector<StartupFont> fonts;
+		fonts.push_back({ _font_NotoSans_Regular, (size_t)_font_NotoSans_Regular_size, false, 0x20, 0x7E });
+		fonts.push_back({ _font_NotoSans_Regular, (size_t)_font_NotoSans_Regular_size, true, 0x20, 0x7E });
+		fonts.push_back({ _font_NotoNaskhArabicUI_Regular, (size_t)_font_NotoNaskhArabicUI_Regular_size, false, 0x0620, 0x0669 });
+		fonts.push_back({ _font_DroidSansFallback, (size_t)_font_DroidSansFallback_size, false, 0x4E00, 0x4E00 + 1999 });
+
+		const String cache_path = TestUtils::get_temp_path("startup_glyph_cache");
+		const Variant prev_enabled = ProjectSettings::get_singleton()->get_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache");
+		const Variant prev_path = ProjectSettings::get_singleton()->get_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache_path");
+		ProjectSettings::get_singleton()->set_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache", true);
+		ProjectSettings::get_singleton()->set_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache_path", cache_path);
+
+		for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+			Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+			if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC) || !ts->has_feature(TextServer::FEATURE_FONT_MSDF)) {
+				continue;
+			}
+
+			// The first run rasterizes and saves the glyphs when the fonts are freed. The second one waits for the
+			// queued writes and is not measured, the third one is a regular startup with the cache on disk.
+			double cold = _startup_fonts(ts, fonts);
+			_startup_fonts(ts, fonts);
+			double warm = _startup_fonts(ts, fonts);
+			MESSAGE(ts->get_name(), ": startup without cache ", cold, " ms, with cache ", warm, " ms, ", cold - warm, " ms saved.");
+		}
+
+		ProjectSettings::get_singleton()->set_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache", prev_enabled);
+		ProjectSettings::get_singleton()->set_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache_path", prev_path);
+		Ref<DirAccess> da = DirAccess::open(cache_path);
+		if (da.is_valid()) {
+			for (const String &file : da->get_files()) {
+				da->remove(file);
+			}
+			DirAccess::remove_absolute(cache_path);
+		}
+	}
+}
+
+} // namespace BenchmarkTextServer
+
+#endif // TOOLS_ENABLED
+
+#endif // BENCHMARK_TEXT_SERVER_H
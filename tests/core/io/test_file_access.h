@@ -107,6 +107,42 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr == "Hello darkness\rMy old friend\rI've come to talk\rWith you again\r");
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
+
+TEST_CASE("[FileAccess] Mapped buffer") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("line_endings_lf.test.txt"), FileAccess::READ);
+	REQUIRE(!f.is_null());
+
+	// Plain files may be truncated by someone else while open, so they are read through buffers.
+	f->seek(6);
+	CHECK(f->get_mapped_buffer(8) == nullptr);
+	CHECK(f->get_position() == 6);
+
+	f->set_read_only_data(true);
+	const uint8_t *mapped = f->get_mapped_buffer(8);
+	if (mapped == nullptr) {
+		// Not every platform can map files, the position must then be left alone.
+		CHECK(f->get_position() == 6);
+		return;
+	}
+	CHECK(String::utf8((const char *)mapped, 8) == "darkness");
+	CHECK(f->get_position() == 14);
+	CHECK(f->get_8() == '\n');
+
+	// Views past the end of the file can't be provided.
+	CHECK(f->get_mapped_buffer(f->get_length()) == nullptr);
+	CHECK(f->get_position() == 15);
+
+	// Another handle on the same file shares the mapping.
+	Ref<FileAccess> f2 = FileAccess::open(TestUtils::get_data_path("line_endings_lf.test.txt"), FileAccess::READ);
+	REQUIRE(!f2.is_null());
+	f2->set_read_only_data(true);
+	f2->seek(6);
+	CHECK(f2->get_mapped_buffer(8) == mapped);
+
+	// The view stays valid while any handle is open.
+	f.unref();
+	CHECK(String::utf8((const char *)mapped, 8) == "darkness");
+}
 } // namespace TestFileAccess
 
 #endif // TEST_FILE_ACCESS_H
@@ -32,10 +32,12 @@
 #define TEST_IMAGE_H
 
 #include "core/io/image.h"
+#include "core/io/image_kernels.h"
+#include "core/io/image_loader.h"
 #include "core/os/os.h"
 
+#include "tests/test_macros.h"
 #include "tests/test_utils.h"
-#include "thirdparty/doctest/doctest.h"
 
 namespace TestImage {
 
@@ -163,6 +165,60 @@ TEST_CASE("[Image] Saving and loading") {
 			"The TGA image should load successfully.");
 }
 
+TEST_CASE("[Image] Loading a region") {
+	const String extensions[] = { "png", "jpg", "webp" };
+	for (const String &extension : extensions) {
+		const String path = TestUtils::get_data_path("images/icon." + extension);
+		Ref<Image> full = Image::load_from_file(path);
+		REQUIRE(full.is_valid());
+
+		const Rect2i region(3, 5, full->get_width() / 2, full->get_height() / 2 + 1);
+		Ref<Image> cropped = memnew(Image());
+		CHECK_MESSAGE(
+				cropped->load_region(path, region) == OK,
+				vformat("The region should load successfully from a .%s file.", extension));
+		CHECK(cropped->get_size() == region.size);
+		CHECK(cropped->get_format() == full->get_format());
+
+		Ref<Image> shrunk = memnew(Image());
+		CHECK(shrunk->load_region(path, region, 4) == OK);
+		CHECK(shrunk->get_size() == region.size / 4);
+
+		Ref<Image> whole = memnew(Image());
+		CHECK(whole->load_region(path, Rect2i(), 2) == OK);
+		CHECK(whole->get_size() == full->get_size() / 2);
+
+		if (extension != "webp") {
+			// The row decoders produce the same pixels as a full decode, webp scales with libwebp.
+			CHECK_MESSAGE(
+					cropped->get_data() == full->get_region(region)->get_data(),
+					vformat("The region of a .%s file should match the same region of the whole image.", extension));
+			Ref<Image> expected = full->duplicate();
+			CHECK(ImageRegionWriter::apply(expected, region, 4) == OK);
+			CHECK_MESSAGE(
+					shrunk->get_data() == expected->get_data(),
+					vformat("The shrunk region of a .%s file should be box-filtered.", extension));
+		}
+	}
+
+	// Regions are clipped to the image.
+	Ref<Image> image = memnew(Image());
+	const String png_path = TestUtils::get_data_path("images/icon.png");
+	CHECK(image->load_region(png_path, Rect2i(200, 200, 100, 100)) == OK);
+	CHECK(image->get_size() == Size2i(56, 56));
+	ERR_PRINT_OFF;
+	CHECK(image->load_region(png_path, Rect2i(300, 300, 10, 10)) != OK);
+	CHECK(image->load_region(png_path, Rect2i(), 0) != OK);
+	ERR_PRINT_ON;
+
+	// Box filter of a 3x3 image shrunk by 2 keeps the top left 2x2 box.
+	Vector<uint8_t> data = { 0, 10, 255, 20, 30, 255, 255, 255, 255 };
+	Ref<Image> small = memnew(Image(3, 3, false, Image::FORMAT_L8, data));
+	CHECK(ImageRegionWriter::apply(small, Rect2i(), 2) == OK);
+	CHECK(small->get_size() == Size2i(1, 1));
+	CHECK(small->get_data()[0] == 15);
+}
+
 TEST_CASE("[Image] Basic getters") {
 	Ref<Image> image = memnew(Image(8, 4, false, Image::FORMAT_LA8));
 	CHECK(image->get_width() == 8);
@@ -406,6 +462,163 @@ TEST_CASE("[Image] Custom mipmaps") {
 	}
 }
 
+static Ref<Image> _make_test_image(int p_width, int p_height, Image::Format p_format) {
+	Vector<uint8_t> data;
+	data.resize(p_width * p_height * 4);
+	uint8_t *w = data.ptrw();
+	for (int i = 0; i < data.size(); i++) {
+		w[i] = (i * 7 + (i >> 10) * 13) & 0xFF;
+	}
+	Ref<Image> image = memnew(Image(p_width, p_height, false, Image::FORMAT_RGBA8, data));
+	image->convert(p_format);
+	return image;
+}
+
+TEST_CASE("[Image] Processing large images") {
+	// Large enough to be split in rows across the worker thread pool.
+	const int size = 1024;
+
+	Ref<Image> rgba8 = _make_test_image(size, size, Image::FORMAT_RGBA8);
+	Ref<Image> rgb8 = rgba8->duplicate();
+	rgb8->convert(Image::FORMAT_RGB8);
+	Ref<Image> rgbaf = rgba8->duplicate();
+	rgbaf->convert(Image::FORMAT_RGBAF);
+
+	for (int i = 0; i < 64; i++) {
+		int x = (i * 97) % size;
+		int y = (i * 389) % size;
+		Color c = rgba8->get_pixel(x, y);
+		CHECK(rgb8->get_pixel(x, y) == Color(c.r, c.g, c.b, 1.0));
+		CHECK(rgbaf->get_pixel(x, y).is_equal_approx(c));
+	}
+
+	Ref<Image> nearest = rgba8->duplicate();
+	nearest->resize(size * 2, size, Image::INTERPOLATE_NEAREST);
+	for (int i = 0; i < 64; i++) {
+		int x = (i * 193) % (size * 2);
+		int y = (i * 389) % size;
+		CHECK(nearest->get_pixel(x, y) == rgba8->get_pixel(x / 2, y));
+	}
+
+	Ref<Image> blended = rgba8->duplicate();
+	Ref<Image> overlay = _make_test_image(size, size, Image::FORMAT_RGBA8);
+	overlay->fill(Color(1.0, 0.0, 0.0, 0.5));
+	blended->blend_rect(overlay, Rect2i(0, 0, size, size), Point2i());
+	Ref<Image> expected = Image::create_empty(1, 1, false, Image::FORMAT_RGBA8);
+	for (int i = 0; i < 64; i++) {
+		int x = (i * 97) % size;
+		int y = (i * 389) % size;
+		expected->set_pixel(0, 0, rgba8->get_pixel(x, y).blend(Color(1.0, 0.0, 0.0, 0.5)));
+		CHECK(blended->get_pixel(x, y) == expected->get_pixel(0, 0));
+	}
+}
+
+TEST_CASE("[Image] SIMD kernels") {
+	// Odd sizes so every kernel also goes through its scalar tail.
+	Ref<Image> rgba8 = _make_test_image(67, 13, Image::FORMAT_RGBA8);
+	Ref<Image> overlay = _make_test_image(61, 11, Image::FORMAT_RGBA8);
+	for (int i = 0; i < 61; i += 3) {
+		// Some fully transparent pixels, which must leave the destination untouched.
+		overlay->set_pixel(i, i % 11, Color(0, 0, 0, 0));
+	}
+
+	Vector<uint8_t> results[ImageKernels::LEVEL_MAX][5];
+	for (int level = 0; level < ImageKernels::LEVEL_MAX; level++) {
+		if (!ImageKernels::is_level_supported(ImageKernels::Level(level))) {
+			continue;
+		}
+		ImageKernels::set_level(ImageKernels::Level(level));
+
+		Ref<Image> image = rgba8->duplicate();
+		image->convert(Image::FORMAT_RGB8);
+		results[level][0] = image->get_data();
+		image->convert(Image::FORMAT_RGBA8);
+		results[level][1] = image->get_data();
+
+		image = rgba8->duplicate();
+		image->resize(101, 29, Image::INTERPOLATE_BILINEAR);
+		results[level][2] = image->get_data();
+		image = rgba8->duplicate();
+		image->resize(23, 5, Image::INTERPOLATE_BILINEAR);
+		results[level][3] = image->get_data();
+
+		image = rgba8->duplicate();
+		image->blend_rect(overlay, Rect2i(1, 1, 60, 10), Point2i(3, 2));
+		results[level][4] = image->get_data();
+	}
+	ImageKernels::set_level(ImageKernels::LEVEL_MAX);
+
+	const char *operations[5] = { "RGBA8 to RGB8 conversion", "RGB8 to RGBA8 conversion", "Bilinear upscaling", "Bilinear downscaling", "Blending" };
+	for (int level = ImageKernels::LEVEL_SCALAR + 1; level < ImageKernels::LEVEL_MAX; level++) {
+		if (!ImageKernels::is_level_supported(ImageKernels::Level(level))) {
+			continue;
+		}
+		for (int i = 0; i < 5; i++) {
+			CHECK_MESSAGE(
+					results[level][i] == results[ImageKernels::LEVEL_SCALAR][i],
+					vformat("%s with %s should give the same result as the scalar code.", operations[i], ImageKernels::get_level_name(ImageKernels::Level(level))));
+		}
+	}
+
+	// The scalar kernels give the same result as the generic code.
+	const Vector<uint8_t> source = rgba8->get_data();
+	Vector<uint8_t> rgb;
+	for (int i = 0; i < source.size(); i++) {
+		if (i % 4 != 3) {
+			rgb.push_back(source[i]);
+		}
+	}
+	CHECK(results[ImageKernels::LEVEL_SCALAR][0] == rgb);
+	Ref<Image> expected = rgba8->duplicate();
+	for (int y = 0; y < 10; y++) {
+		for (int x = 0; x < 60; x++) {
+			Color over = overlay->get_pixel(x + 1, y + 1);
+			if (over.a != 0) {
+				expected->set_pixel(x + 3, y + 2, expected->get_pixel(x + 3, y + 2).blend(over));
+			}
+		}
+	}
+	CHECK(results[ImageKernels::LEVEL_SCALAR][4] == expected->get_data());
+}
+
+TEST_CASE("[Image] Texture compression threads") {
+	Ref<Image> source = _make_test_image(512, 512, Image::FORMAT_RGBA8);
+	source->generate_mipmaps();
+
+	struct Compressor {
+		const char *name;
+		bool available;
+		Image::CompressMode mode;
+	};
+	const Compressor compressors[] = {
+		{ "S3TC", Image::_image_compress_bc_func != nullptr, Image::COMPRESS_S3TC },
+		{ "ETC2", Image::_image_compress_etc2_func != nullptr, Image::COMPRESS_ETC2 },
+		{ "BPTC", Image::_image_compress_bptc_func != nullptr, Image::COMPRESS_BPTC },
+		{ "ASTC", Image::_image_compress_astc_func != nullptr, Image::COMPRESS_ASTC },
+	};
+	for (const Compressor &compressor : compressors) {
+		if (!compressor.available) {
+			continue;
+		}
+
+		// Single threaded first, then with every worker thread.
+		Vector<uint8_t> data[2];
+		for (int i = 0; i < 2; i++) {
+			Image::set_compression_thread_limit(i == 0 ? 1 : 0);
+			Ref<Image> image = source->duplicate();
+			CHECK(image->compress_from_channels(compressor.mode, Image::USED_CHANNELS_RGBA) == OK);
+			CHECK(image->is_compressed());
+			CHECK(image->has_mipmaps());
+			data[i] = image->get_data();
+		}
+
+		CHECK_MESSAGE(
+				data[0] == data[1],
+				vformat("%s compression should give the same result regardless of the number of threads.", compressor.name));
+	}
+	Image::set_compression_thread_limit(0);
+}
+
 } // namespace TestImage
 
 #endif // TEST_IMAGE_H
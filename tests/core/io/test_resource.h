@@ -32,8 +32,10 @@
 #define TEST_RESOURCE_H
 
 #include "core/io/resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
@@ -161,6 +163,155 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+
+TEST_CASE("[Resource] Loading binary resources with sub-resources decoded in parallel") {
+	// Enough sub-resources for the loader to decode them on the WorkerThreadPool.
+	const int child_count = 100;
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Root");
+	Array children;
+	Ref<Resource> previous_child;
+	for (int i = 0; i < child_count; i++) {
+		Ref<Resource> child_resource = memnew(Resource);
+		child_resource->set_name(vformat("Child %d", i));
+		PackedFloat32Array values;
+		values.resize(64);
+		for (int j = 0; j < values.size(); j++) {
+			values.write[j] = i * 1000 + j;
+		}
+		child_resource->set_meta("values", values);
+		child_resource->set_meta("path", NodePath("Parent/Child:position:x"));
+		if (previous_child.is_valid()) {
+			child_resource->set_meta("previous", previous_child);
+		}
+		children.push_back(child_resource);
+		previous_child = child_resource;
+	}
+	resource->set_meta("children", children);
+
+	const String save_path_binary = OS::get_singleton()->get_cache_path().path_join("resource_parallel.res");
+	REQUIRE(ResourceSaver::save(resource, save_path_binary) == OK);
+
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+	Error err = FAILED;
+	const uint64_t parallel_decodes = ResourceFormatLoaderBinary::get_parallel_decode_count();
+	const Ref<Resource> loaded_resource = loader->load(save_path_binary, "", &err, true, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(err == OK);
+	REQUIRE(loaded_resource.is_valid());
+	CHECK(loaded_resource->get_name() == "Root");
+	CHECK_MESSAGE(ResourceFormatLoaderBinary::get_parallel_decode_count() == parallel_decodes + 1, "The sub-resources should have been decoded in parallel.");
+
+	const Array loaded_children = loaded_resource->get_meta("children");
+	REQUIRE(loaded_children.size() == child_count);
+	bool all_match = true;
+	for (int i = 0; i < child_count; i++) {
+		const Ref<Resource> child_resource = loaded_children[i];
+		const PackedFloat32Array values = child_resource->get_meta("values");
+		all_match = all_match && child_resource->get_name() == vformat("Child %d", i);
+		all_match = all_match && values.size() == 64 && values[0] == i * 1000 && values[63] == i * 1000 + 63;
+		all_match = all_match && NodePath(child_resource->get_meta("path")) == NodePath("Parent/Child:position:x");
+		if (i > 0) {
+			// References between sub-resources must point to the same instances.
+			all_match = all_match && Ref<Resource>(child_resource->get_meta("previous")) == Ref<Resource>(loaded_children[i - 1]);
+		}
+	}
+	CHECK_MESSAGE(all_match, "All sub-resources decoded in parallel should match the saved ones.");
+}
+
+struct ResourcePoolLoad {
+	String path;
+	Ref<Resource> resource;
+};
+
+static void _load_on_pool_thread(void *p_userdata) {
+	ResourcePoolLoad *load = (ResourcePoolLoad *)p_userdata;
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+	load->resource = loader->load(load->path, "", nullptr, true, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+}
+
+TEST_CASE("[Resource] Loads running on the WorkerThreadPool decode sub-resources serially") {
+	Ref<Resource> resource = memnew(Resource);
+	Array children;
+	for (int i = 0; i < 100; i++) {
+		Ref<Resource> child_resource = memnew(Resource);
+		child_resource->set_name(vformat("Child %d", i));
+		children.push_back(child_resource);
+	}
+	resource->set_meta("children", children);
+
+	ResourcePoolLoad load;
+	load.path = OS::get_singleton()->get_cache_path().path_join("resource_pool_thread.res");
+	REQUIRE(ResourceSaver::save(resource, load.path) == OK);
+
+	// Waiting for a decode group from a pool thread could starve the pool, like load_threaded_request() would.
+	const uint64_t parallel_decodes = ResourceFormatLoaderBinary::get_parallel_decode_count();
+	WorkerThreadPool::TaskID task = WorkerThreadPool::get_singleton()->add_native_task(&_load_on_pool_thread, &load);
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+	REQUIRE(load.resource.is_valid());
+	CHECK(Array(load.resource->get_meta("children")).size() == 100);
+	CHECK(ResourceFormatLoaderBinary::get_parallel_decode_count() == parallel_decodes);
+}
+
+// Load tasks leave the queue on their own thread, possibly after their result was handed out or dropped.
+static bool wait_for_empty_load_queue() {
+	const uint64_t timeout_usec = 5000000;
+	const uint64_t start_usec = OS::get_singleton()->get_ticks_usec();
+	while (ResourceLoader::get_load_queue_depth() > 0) {
+		if (OS::get_singleton()->get_ticks_usec() - start_usec > timeout_usec) {
+			return false;
+		}
+		OS::get_singleton()->delay_usec(1000);
+	}
+	return true;
+}
+
+TEST_CASE("[Resource] Threaded loading with priorities and cancellation") {
+	Ref<Resource> dependency = memnew(Resource);
+	dependency->set_name("Dependency");
+	const String dependency_path = OS::get_singleton()->get_cache_path().path_join("resource_dependency.res");
+	REQUIRE(ResourceSaver::save(dependency, dependency_path) == OK);
+	dependency->set_path(dependency_path);
+
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Root");
+	resource->set_meta("dependency", dependency);
+	const String save_path = OS::get_singleton()->get_cache_path().path_join("resource_threaded.res");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+
+	// Nothing must be cached, so the dependency is prefetched and loaded too.
+	resource.unref();
+	dependency.unref();
+
+	SUBCASE("High priority loads with sub-threads load their dependencies") {
+		CHECK(ResourceLoader::load_threaded_request(save_path, "", true, ResourceFormatLoader::CACHE_MODE_REUSE, ResourceLoader::LOAD_PRIORITY_HIGH) == OK);
+		const Ref<Resource> loaded_resource = ResourceLoader::load_threaded_get(save_path);
+		REQUIRE(loaded_resource.is_valid());
+		CHECK(loaded_resource->get_name() == "Root");
+		const Ref<Resource> loaded_dependency = loaded_resource->get_meta("dependency");
+		REQUIRE(loaded_dependency.is_valid());
+		CHECK(loaded_dependency->get_name() == "Dependency");
+		CHECK(wait_for_empty_load_queue());
+	}
+
+	SUBCASE("High priority loads can't be cancelled") {
+		CHECK(ResourceLoader::load_threaded_request(save_path, "", false, ResourceFormatLoader::CACHE_MODE_REUSE, ResourceLoader::LOAD_PRIORITY_HIGH) == OK);
+		ERR_PRINT_OFF;
+		CHECK(ResourceLoader::load_threaded_cancel(save_path) == ERR_UNAVAILABLE);
+		ERR_PRINT_ON;
+		CHECK(ResourceLoader::load_threaded_get(save_path).is_valid());
+	}
+
+	SUBCASE("Low priority loads can be cancelled") {
+		CHECK(ResourceLoader::load_threaded_request(save_path, "", true) == OK);
+		CHECK(ResourceLoader::load_threaded_cancel(save_path) == OK);
+		CHECK(ResourceLoader::load_threaded_get_status(save_path) == ResourceLoader::THREAD_LOAD_INVALID_RESOURCE);
+		CHECK(ResourceLoader::load_threaded_cancel(save_path) == ERR_INVALID_PARAMETER);
+		CHECK(wait_for_empty_load_queue());
+	}
+}
 } // namespace TestResource
 
 #endif // TEST_RESOURCE_H
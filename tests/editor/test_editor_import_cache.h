@@ -0,0 +1,191 @@
+/**************************************************************************/
+/*  test_editor_import_cache.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_EDITOR_IMPORT_CACHE_H
+#define TEST_EDITOR_IMPORT_CACHE_H
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "editor/editor_import_cache.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestEditorImportCache {
+
+class ImportCacheTestImporter : public ResourceImporter {
+	GDCLASS(ImportCacheTestImporter, ResourceImporter);
+
+public:
+	virtual String get_importer_name() const override { return "import_cache_test"; }
+	virtual String get_visible_name() const override { return "Import Cache Test"; }
+	virtual void get_recognized_extensions(List<String> *p_extensions) const override {}
+	virtual String get_save_extension() const override { return "res"; }
+	virtual String get_resource_type() const override { return "Resource"; }
+
+	virtual void get_import_options(const String &p_path, List<ImportOption> *r_options, int p_preset = 0) const override {
+		r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "compress"), 0));
+		r_options->push_back(ImportOption(PropertyInfo(Variant::ARRAY, "fallbacks"), Array()));
+	}
+	virtual bool get_option_visibility(const String &p_path, const String &p_option, const HashMap<StringName, Variant> &p_options) const override { return true; }
+
+	virtual Error import(const String &p_source_file, const String &p_save_path, const HashMap<StringName, Variant> &p_options, List<String> *r_platform_variants, List<String> *r_gen_files = nullptr, Variant *r_metadata = nullptr) override { return OK; }
+};
+
+static void _write_file(const String &p_path, const String &p_text) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_string(p_text);
+}
+
+static String _make_temp_dir(const String &p_name) {
+	const String path = TestUtils::get_temp_path(p_name);
+	REQUIRE(DirAccess::make_dir_recursive_absolute(path) == OK);
+	return path;
+}
+
+static void _remove_temp_dir(const String &p_path) {
+	Ref<DirAccess> da = DirAccess::open(p_path);
+	if (da.is_valid()) {
+		da->erase_contents_recursive();
+	}
+	DirAccess::remove_absolute(p_path);
+}
+
+TEST_CASE("[EditorImportCache] Keys") {
+	const String dir = _make_temp_dir("import_cache_keys");
+	const String source = dir.path_join("font.ttf");
+	const String fallback_path = dir.path_join("fallback.ttf");
+	_write_file(source, "font");
+	_write_file(fallback_path, "fallback");
+
+	Ref<ImportCacheTestImporter> importer;
+	importer.instantiate();
+	List<ResourceImporter::ImportOption> options;
+	importer->get_import_options(source, &options);
+
+	// Like the fallbacks of a dynamic font, an array of resources loaded from files.
+	Ref<Resource> fallback;
+	fallback.instantiate();
+	fallback->set_path_cache(fallback_path);
+	Array fallbacks;
+	fallbacks.push_back(fallback);
+
+	HashMap<StringName, Variant> params;
+	params["compress"] = 1;
+	params["fallbacks"] = fallbacks;
+
+	const String key = EditorImportCache::get_key(source, importer, options, params, Variant());
+	CHECK(key.length() == 32);
+	CHECK_MESSAGE(
+			EditorImportCache::get_key(source, importer, options, params, Variant()) == key,
+			"The same inputs should give the same key.");
+
+	params["compress"] = 2;
+	CHECK_MESSAGE(
+			EditorImportCache::get_key(source, importer, options, params, Variant()) != key,
+			"Options should be part of the key.");
+	params["compress"] = 1;
+
+	_write_file(source, "modified font");
+	CHECK_MESSAGE(
+			EditorImportCache::get_key(source, importer, options, params, Variant()) != key,
+			"The source contents should be part of the key.");
+	_write_file(source, "font");
+	CHECK(EditorImportCache::get_key(source, importer, options, params, Variant()) == key);
+
+	_write_file(fallback_path, "modified fallback");
+	CHECK_MESSAGE(
+			EditorImportCache::get_key(source, importer, options, params, Variant()) != key,
+			"The contents of resources referenced by options should be part of the key.");
+
+	_remove_temp_dir(dir);
+}
+
+TEST_CASE("[EditorImportCache] Restoring entries") {
+	const String dir = _make_temp_dir("import_cache_restore");
+	const String cache_path = dir.path_join("cache");
+	const String base_path = dir.path_join("icon.png-0123");
+	const String restored_path = dir.path_join("restored");
+	const String key = "0123456789abcdef0123456789abcdef";
+
+	EditorImportCache cache;
+	cache.configure(cache_path, 1024 * 1024);
+	REQUIRE(cache.is_enabled());
+
+	List<String> variants;
+	Variant metadata;
+	CHECK_FALSE(cache.restore(key, restored_path, &variants, &metadata));
+
+	_write_file(base_path + ".res", "imported");
+	cache.store(key, base_path, "res", List<String>(), "metadata");
+
+	CHECK(cache.restore(key, restored_path, &variants, &metadata));
+	CHECK(FileAccess::get_file_as_string(restored_path + ".res") == "imported");
+	CHECK(variants.is_empty());
+	CHECK(metadata == Variant("metadata"));
+
+	// An artifact that doesn't have the stored size (e.g. from an interrupted copy) invalidates the entry.
+	_write_file(cache_path.path_join("01").path_join(key).path_join("artifact.res"), "imported, but longer");
+	CHECK_FALSE(cache.restore(key, restored_path, &variants, &metadata));
+
+	_remove_temp_dir(dir);
+}
+
+TEST_CASE("[EditorImportCache] Evicting least recently used entries") {
+	const String dir = _make_temp_dir("import_cache_eviction");
+	const String cache_path = dir.path_join("cache");
+	const String base_path = dir.path_join("sound.wav-0123");
+	const String restored_path = dir.path_join("restored");
+	const String keys[3] = { String("a").repeat(32), String("b").repeat(32), String("c").repeat(32) };
+
+	// Room for two entries of 40 KiB, not three.
+	EditorImportCache cache;
+	cache.configure(cache_path, 100 * 1024);
+	_write_file(base_path + ".res", String("x").repeat(40 * 1024));
+
+	List<String> variants;
+	Variant metadata;
+	cache.store(keys[0], base_path, "res", List<String>(), Variant());
+	cache.store(keys[1], base_path, "res", List<String>(), Variant());
+	// Using the first entry makes the second one the least recently used.
+	CHECK(cache.restore(keys[0], restored_path, &variants, &metadata));
+	cache.store(keys[2], base_path, "res", List<String>(), Variant());
+
+	CHECK(cache.restore(keys[0], restored_path, &variants, &metadata));
+	CHECK_FALSE(cache.restore(keys[1], restored_path, &variants, &metadata));
+	CHECK(cache.restore(keys[2], restored_path, &variants, &metadata));
+
+	_remove_temp_dir(dir);
+}
+
+} // namespace TestEditorImportCache
+
+#endif // TEST_EDITOR_IMPORT_CACHE_H
@@ -31,7 +31,10 @@
 #ifndef TEST_CONTROL_H
 #define TEST_CONTROL_H
 
+#include "scene/gui/box_container.h"
 #include "scene/gui/control.h"
+#include "scene/main/window.h"
+#include "scene/resources/theme.h"
 
 #include "tests/test_macros.h"
 
@@ -61,6 +64,107 @@ TEST_CASE("[SceneTree][Control]") {
 	}
 }
 
+TEST_CASE("[SceneTree][Control] Theme item resolution") {
+	Ref<Theme> outer_theme;
+	outer_theme.instantiate();
+	outer_theme->set_constant("separation", "Control", 4);
+	outer_theme->set_color("font_color", "Control", Color(1, 0, 0));
+
+	Ref<Theme> inner_theme;
+	inner_theme.instantiate();
+	inner_theme->set_constant("separation", "Control", 12);
+
+	Control *outer = memnew(Control);
+	outer->set_theme(outer_theme);
+	Control *inner = memnew(Control);
+	inner->set_theme(inner_theme);
+	Control *first = memnew(Control);
+	Control *second = memnew(Control);
+	Control *nested = memnew(Control);
+
+	outer->add_child(first);
+	outer->add_child(second);
+	outer->add_child(inner);
+	inner->add_child(nested);
+	SceneTree::get_singleton()->get_root()->add_child(outer);
+
+	SUBCASE("Controls sharing a theme chain resolve the same items") {
+		CHECK(first->get_theme_constant("separation") == 4);
+		CHECK(second->get_theme_constant("separation") == 4);
+		CHECK(first->has_theme_color("font_color"));
+		CHECK_FALSE(first->has_theme_color("missing_color"));
+		CHECK(nested->get_theme_constant("separation") == 12);
+		CHECK(nested->get_theme_color("font_color") == Color(1, 0, 0));
+	}
+
+	SUBCASE("Changing a theme only affects controls using it") {
+		CHECK(first->get_theme_constant("separation") == 4);
+		CHECK(nested->get_theme_constant("separation") == 12);
+
+		inner_theme->set_constant("separation", "Control", 20);
+		MessageQueue::get_singleton()->flush();
+		CHECK(first->get_theme_constant("separation") == 4);
+		CHECK(nested->get_theme_constant("separation") == 20);
+
+		outer_theme->set_constant("separation", "Control", 6);
+		outer_theme->set_color("font_color", "Control", Color(0, 1, 0));
+		MessageQueue::get_singleton()->flush();
+		CHECK(first->get_theme_constant("separation") == 6);
+		CHECK(second->get_theme_constant("separation") == 6);
+		CHECK(nested->get_theme_constant("separation") == 20);
+		CHECK(nested->get_theme_color("font_color") == Color(0, 1, 0));
+	}
+
+	SUBCASE("Type variations are resolved per control") {
+		outer_theme->set_type_variation("WideControl", "Control");
+		outer_theme->set_constant("separation", "WideControl", 32);
+		MessageQueue::get_singleton()->flush();
+
+		second->set_theme_type_variation("WideControl");
+		CHECK(first->get_theme_constant("separation") == 4);
+		CHECK(second->get_theme_constant("separation") == 32);
+		CHECK(first->get_theme_constant("separation", "WideControl") == 32);
+	}
+
+	memdelete(outer);
+}
+
+TEST_CASE("[SceneTree][Control] Batched layout pass") {
+	VBoxContainer *outer = memnew(VBoxContainer);
+	VBoxContainer *middle = memnew(VBoxContainer);
+	VBoxContainer *inner = memnew(VBoxContainer);
+	Control *deep_leaf = memnew(Control);
+	Control *shallow_leaf = memnew(Control);
+
+	inner->add_child(deep_leaf);
+	middle->add_child(inner);
+	outer->add_child(middle);
+	outer->add_child(shallow_leaf);
+	SceneTree::get_singleton()->get_root()->add_child(outer);
+	MessageQueue::get_singleton()->flush();
+
+	SIGNAL_WATCH(outer, "sort_children");
+
+	// Changes at different depths bubble up to the same container, which should
+	// still only be sorted once, after every minimum size is known.
+	deep_leaf->set_custom_minimum_size(Size2(0, 60));
+	shallow_leaf->set_custom_minimum_size(Size2(0, 40));
+	MessageQueue::get_singleton()->flush();
+
+	Array one_sort;
+	one_sort.push_back(Array());
+	SIGNAL_CHECK("sort_children", one_sort);
+
+	int separation = outer->get_theme_constant("separation");
+	CHECK(outer->get_combined_minimum_size().y == 100 + separation);
+	CHECK(middle->get_size().y == 60);
+	CHECK(deep_leaf->get_size().y == 60);
+	CHECK(shallow_leaf->get_position().y == 60 + separation);
+
+	SIGNAL_UNWATCH(outer, "sort_children");
+	memdelete(outer);
+}
+
 } // namespace TestControl
 
 #endif // TEST_CONTROL_H
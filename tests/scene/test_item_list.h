@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*  test_item_list.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_ITEM_LIST_H
+#define TEST_ITEM_LIST_H
+
+#include "scene/gui/item_list.h"
+#include "scene/gui/scroll_bar.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestItemList {
+
+class RowSource : public Object {
+public:
+	int requests = 0;
+
+	Variant get_row(int p_idx) {
+		requests++;
+		if (p_idx % 2 == 0) {
+			return vformat("Row %d", p_idx);
+		}
+		Dictionary row;
+		row["text"] = vformat("Row %d", p_idx);
+		row["disabled"] = true;
+		row["metadata"] = p_idx;
+		return row;
+	}
+};
+
+TEST_CASE("[SceneTree][ItemList] Virtual item source") {
+	RowSource *source = memnew(RowSource);
+
+	ItemList *list = memnew(ItemList);
+	list->set_select_mode(ItemList::SELECT_MULTI);
+	list->set_fixed_icon_size(Size2i(0, 20));
+	list->set_item_source(callable_mp(source, &RowSource::get_row));
+	list->set_item_count(1000000);
+	list->set_size(Size2(200, 400));
+	SceneTree::get_singleton()->get_root()->add_child(list);
+	list->force_update_list_size();
+
+	SUBCASE("[ItemList] Rows are requested from the source") {
+		CHECK(list->get_item_count() == 1000000);
+		CHECK(list->get_item_text(0) == "Row 0");
+		CHECK(list->get_item_text(500001) == "Row 500001");
+		CHECK(list->is_item_disabled(500001));
+		CHECK_FALSE(list->is_item_disabled(500000));
+
+		source->requests = 0;
+		list->get_item_text(0);
+		list->get_item_text(0);
+		CHECK_MESSAGE(source->requests == 0, "Visible rows should be cached.");
+	}
+
+	SUBCASE("[ItemList] Rows far from the view are read without being kept") {
+		const int cached = list->get_cached_virtual_item_count();
+		CHECK(list->get_item_text(700001) == "Row 700001");
+		CHECK(list->is_item_selectable(700001));
+		CHECK(list->is_item_disabled(700001));
+		CHECK(int(list->get_item_metadata(700001)) == 700001);
+		CHECK(list->get_item_metadata(700000) == Variant());
+		CHECK(list->get_item_icon_modulate(700001) == Color(1, 1, 1, 1));
+		CHECK(list->get_cached_virtual_item_count() == cached);
+
+		// Disabled rows can't be selected, wherever they are.
+		list->select(700001);
+		CHECK_FALSE(list->is_selected(700001));
+	}
+
+	SUBCASE("[ItemList] Items can't be changed through the setters") {
+		ERR_PRINT_OFF;
+		list->set_item_text(0, "Changed");
+		list->set_item_metadata(0, 1);
+		ERR_PRINT_ON;
+		CHECK(list->get_item_text(0) == "Row 0");
+		CHECK(list->get_item_metadata(0) == Variant());
+	}
+
+	SUBCASE("[ItemList] Only rows around the visible area are kept") {
+		const Rect2 row_rect = list->get_item_rect(0);
+		const double stride = list->get_item_rect(1).position.y - row_rect.position.y;
+		REQUIRE(stride > 0);
+		const int visible_rows = int(Math::ceil(400 / stride)) + 1;
+
+		const double positions[] = { 0.0, 1234.0, stride * 500000, list->get_v_scroll_bar()->get_max() };
+		for (const double position : positions) {
+			list->get_v_scroll_bar()->set_value(position);
+			list->force_update_list_size();
+
+			const int first = list->get_item_at_position(Point2(10, 10), true);
+			REQUIRE(first >= 0);
+			for (int i = first; i < MIN(first + visible_rows, list->get_item_count()); i++) {
+				CHECK(list->get_item_text(i) == vformat("Row %d", i));
+			}
+			CHECK(list->get_cached_virtual_item_count() <= visible_rows * 3 + 3);
+
+			// Rows far away from the view are answered without being kept.
+			list->get_item_text(first > 500000 ? 0 : 999999);
+			CHECK(list->get_cached_virtual_item_count() <= visible_rows * 3 + 3);
+		}
+	}
+
+	SUBCASE("[ItemList] Selection and hit testing") {
+		list->select(3);
+		list->select(999998, false);
+		CHECK(list->is_selected(3));
+		CHECK(list->is_selected(999998));
+		CHECK(list->get_selected_items().size() == 2);
+
+		list->get_v_scroll_bar()->set_value(list->get_item_rect(500000).position.y);
+		list->force_update_list_size();
+		CHECK(list->get_item_at_position(list->get_item_rect(500002).get_center() - Vector2(0, list->get_v_scroll_bar()->get_value())) == 500002);
+
+		list->set_item_count(10);
+		CHECK(list->is_selected(3));
+		CHECK(list->get_selected_items().size() == 1);
+	}
+
+	memdelete(list);
+	memdelete(source);
+}
+
+} // namespace TestItemList
+
+#endif // TEST_ITEM_LIST_H
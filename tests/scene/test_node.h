@@ -756,12 +756,200 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 		CHECK_EQ(E->get(), node3);
 	}
 
+	SUBCASE("Process priority changed between frames") {
+		node->set_process(true);
+		node->set_process_priority(20);
+		node2->set_process(true);
+		node2->set_process_priority(10);
+		node3->set_process(true);
+		node3->set_process_priority(40);
+
+		SceneTree::get_singleton()->process(0);
+		CHECK_EQ(3, process_order.size());
+		process_order.clear();
+
+		// Moved entries and newly added ones are merged into the existing order.
+		node3->set_process_priority(0);
+		node4->set_process(true);
+		node4->set_process_priority(15);
+		node2->set_process(false);
+
+		SceneTree::get_singleton()->process(0);
+
+		CHECK_EQ(3, process_order.size());
+		List<Node *>::Element *E = process_order.front();
+		CHECK_EQ(E->get(), node3);
+		E = E->next();
+		CHECK_EQ(E->get(), node4);
+		E = E->next();
+		CHECK_EQ(E->get(), node);
+	}
+
+	SUBCASE("Nodes without process callbacks") {
+		Node *plain = memnew(Node);
+		plain->set_process(true);
+		plain->set_physics_process(true);
+		SceneTree::get_singleton()->get_root()->add_child(plain);
+
+		node->set_process(true);
+		node->set_process_priority(1);
+
+		// Plain nodes have nothing to run and are skipped, without affecting the others.
+		SceneTree::get_singleton()->process(0);
+		SceneTree::get_singleton()->physics_process(0);
+
+		CHECK_EQ(1, process_order.size());
+		CHECK_EQ(process_order.front()->get(), node);
+
+		memdelete(plain);
+		SceneTree::get_singleton()->process(0);
+		CHECK_EQ(2, process_order.size());
+	}
+
+	SUBCASE("Registered classes keep their process notifications") {
+		// Native classes may handle the notifications themselves, they must not be skipped like a plain Node.
+		GDREGISTER_CLASS(TestNode);
+		TestNode *registered = memnew(TestNode);
+		registered->callback_list = &process_order;
+		SceneTree::get_singleton()->get_root()->add_child(registered);
+		registered->set_process(true);
+		registered->set_physics_process(true);
+
+		SceneTree::get_singleton()->process(0);
+		SceneTree::get_singleton()->physics_process(0);
+
+		CHECK_EQ(registered->process_counter, 1);
+		CHECK_EQ(registered->physics_process_counter, 1);
+		CHECK_EQ(2, process_order.size());
+
+		memdelete(registered);
+	}
+
+	SUBCASE("Process order follows moved nodes") {
+		node->set_process(true);
+		node2->set_process(true);
+
+		SceneTree::get_singleton()->process(0);
+		CHECK_EQ(2, process_order.size());
+		CHECK_EQ(process_order.front()->get(), node);
+		process_order.clear();
+
+		// Same priority, so the order comes from the tree and must be updated by the move.
+		SceneTree::get_singleton()->get_root()->move_child(node, -1);
+		SceneTree::get_singleton()->process(0);
+
+		CHECK_EQ(2, process_order.size());
+		CHECK_EQ(process_order.front()->get(), node2);
+		CHECK_EQ(process_order.back()->get(), node);
+	}
+
 	memdelete(node);
 	memdelete(node2);
 	memdelete(node3);
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree][Node] Test group membership order") {
+	Node *root = SceneTree::get_singleton()->get_root();
+	LocalVector<Node *> nodes;
+	for (int i = 0; i < 5; i++) {
+		Node *node = memnew(Node);
+		root->add_child(node);
+		nodes.push_back(node);
+	}
+
+	// Added out of tree order.
+	nodes[3]->add_to_group("members");
+	nodes[1]->add_to_group("members");
+	nodes[0]->add_to_group("members");
+	nodes[2]->add_to_group("members");
+
+	List<Node *> members;
+	SceneTree::get_singleton()->get_nodes_in_group("members", &members);
+	CHECK_EQ(members.size(), 4);
+	CHECK_EQ(members[0], nodes[0]);
+	CHECK_EQ(members[1], nodes[1]);
+	CHECK_EQ(members[2], nodes[2]);
+	CHECK_EQ(members[3], nodes[3]);
+
+	SUBCASE("Removed and added members keep tree order") {
+		nodes[1]->remove_from_group("members");
+		nodes[4]->add_to_group("members");
+		nodes[1]->add_to_group("members");
+		nodes[3]->remove_from_group("members");
+
+		members.clear();
+		SceneTree::get_singleton()->get_nodes_in_group("members", &members);
+		CHECK_EQ(members.size(), 4);
+		CHECK_EQ(members[0], nodes[0]);
+		CHECK_EQ(members[1], nodes[1]);
+		CHECK_EQ(members[2], nodes[2]);
+		CHECK_EQ(members[3], nodes[4]);
+		CHECK_EQ(SceneTree::get_singleton()->get_first_node_in_group("members"), nodes[0]);
+	}
+
+	SUBCASE("Moved members are sorted again") {
+		root->move_child(nodes[0], -1);
+
+		members.clear();
+		SceneTree::get_singleton()->get_nodes_in_group("members", &members);
+		CHECK_EQ(members.size(), 4);
+		CHECK_EQ(members[0], nodes[1]);
+		CHECK_EQ(members[3], nodes[0]);
+	}
+
+	SUBCASE("Group calls reach every member") {
+		memdelete(nodes[2]);
+		nodes.remove_at(2);
+
+		SceneTree::get_singleton()->call_group("members", "set_meta", "called", true);
+
+		for (uint32_t i = 0; i < 3; i++) {
+			CHECK(bool(nodes[i]->get_meta("called", false)));
+		}
+		CHECK_FALSE(bool(nodes[3]->get_meta("called", false)));
+	}
+
+	for (Node *node : nodes) {
+		memdelete(node);
+	}
+}
+
+TEST_CASE("[SceneTree][Node] Test sub-thread group processing in chunks") {
+	Node *group_owner = memnew(Node);
+	group_owner->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+	group_owner->set_process_thread_group_chunk_size(2);
+	SceneTree::get_singleton()->get_root()->add_child(group_owner);
+
+	LocalVector<TestNode *> nodes;
+	for (int i = 0; i < 5; i++) {
+		TestNode *node = memnew(TestNode);
+		node->set_process(true);
+		node->set_physics_process(true);
+		group_owner->add_child(node);
+		nodes.push_back(node);
+	}
+
+	SceneTree::get_singleton()->process(0);
+	SceneTree::get_singleton()->physics_process(0);
+
+	// Every node of the split group is processed exactly once.
+	for (TestNode *node : nodes) {
+		CHECK_EQ(1, node->process_counter);
+		CHECK_EQ(1, node->physics_process_counter);
+	}
+
+	memdelete(nodes[0]);
+	group_owner->set_process_thread_group_chunk_size(0);
+	SceneTree::get_singleton()->process(0);
+
+	for (uint32_t i = 1; i < nodes.size(); i++) {
+		CHECK_EQ(2, nodes[i]->process_counter);
+	}
+
+	memdelete(group_owner);
+}
+
 } // namespace TestNode
 
 #endif // TEST_NODE_H
@@ -31,6 +31,8 @@
 #ifndef TEST_PACKED_SCENE_H
 #define TEST_PACKED_SCENE_H
 
+#include "scene/2d/node_2d.h"
+#include "scene/gui/control.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -150,6 +152,153 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene Repeatedly") {
+	// Create a scene to pack.
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Vector2(10, 20));
+	child->set_z_index(3);
+	scene->add_child(child);
+	child->set_owner(scene);
+	child->connect("renamed", Callable(scene, "set_meta").bind("renamed", true), Object::CONNECT_PERSIST);
+
+	// Pack the scene.
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+
+	// Every instance must be set up the same way, whether it's the first one or not.
+	for (int i = 0; i < 3; i++) {
+		Node2D *instance = Object::cast_to<Node2D>(packed_scene->instantiate());
+		REQUIRE(instance != nullptr);
+		REQUIRE(instance->get_child_count() == 1);
+
+		Node2D *instance_child = Object::cast_to<Node2D>(instance->get_child(0));
+		REQUIRE(instance_child != nullptr);
+		CHECK(instance_child->get_position() == Vector2(10, 20));
+		CHECK(instance_child->get_z_index() == 3);
+		CHECK(instance_child->get_owner() == instance);
+
+		instance_child->emit_signal(SNAME("renamed"));
+		CHECK(bool(instance->get_meta("renamed", false)));
+
+		memdelete(instance);
+	}
+
+	// Packing again must not reuse anything from the previous state.
+	child->set_position(Vector2(30, 40));
+	packed_scene->pack(scene);
+	Node *instance = packed_scene->instantiate();
+	REQUIRE(instance != nullptr);
+	CHECK(Object::cast_to<Node2D>(instance->get_child(0))->get_position() == Vector2(30, 40));
+
+	memdelete(instance);
+	memdelete(scene);
+}
+
+TEST_CASE("[PackedScene] Instantiate Pooled") {
+	// Create a scene to pack.
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("TestScene");
+
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	child->set_position(Vector2(10, 20));
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+
+	Node *instance = packed_scene->instantiate_pooled();
+	REQUIRE(instance != nullptr);
+	const ObjectID instance_id = instance->get_instance_id();
+
+	SUBCASE("Released instances are reset and reused") {
+		Node2D *instance_child = Object::cast_to<Node2D>(instance->get_child(0));
+		instance_child->set_position(Vector2(50, 60));
+		instance_child->set_visible(false);
+		instance->set_name("Renamed");
+
+		packed_scene->release_pooled(instance);
+
+		Node *reused = packed_scene->instantiate_pooled();
+		REQUIRE(reused != nullptr);
+		CHECK(reused->get_instance_id() == instance_id);
+		CHECK(reused->get_name() == "TestScene");
+		instance_child = Object::cast_to<Node2D>(reused->get_child(0));
+		CHECK(instance_child->get_position() == Vector2(10, 20));
+		CHECK(instance_child->is_visible());
+
+		const Dictionary stats = packed_scene->get_pool_stats();
+		CHECK(int(stats["hits"]) == 1);
+		CHECK(int(stats["misses"]) == 1);
+		CHECK(int(stats["released"]) == 1);
+		CHECK(int(stats["reset_properties"]) == 2);
+
+		memdelete(reused);
+	}
+
+	SUBCASE("Instances whose nodes changed are not reused") {
+		instance->add_child(memnew(Node));
+		packed_scene->release_pooled(instance);
+
+		CHECK(int(packed_scene->get_pool_stats()["discarded"]) == 1);
+		CHECK(int(packed_scene->get_pool_stats()["pooled"]) == 0);
+		CHECK(ObjectDB::get_instance(instance_id) == nullptr);
+	}
+
+	SUBCASE("Instances in use when the pool is cleared can still be released") {
+		packed_scene->clear_pool();
+		packed_scene->release_pooled(instance);
+
+		CHECK(int(packed_scene->get_pool_stats()["discarded"]) == 1);
+		CHECK(int(packed_scene->get_pool_stats()["pooled"]) == 0);
+		CHECK(ObjectDB::get_instance(instance_id) == nullptr);
+	}
+
+	memdelete(scene);
+}
+
+TEST_CASE("[PackedScene] Instantiate Pooled With Node Properties") {
+	// Create a scene whose root refers to one of its own nodes.
+	Control *scene = memnew(Control);
+	scene->set_name("TestScene");
+
+	Control *child = memnew(Control);
+	child->set_name("Child");
+	scene->add_child(child);
+	child->set_owner(scene);
+	scene->set_shortcut_context(child);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+
+	// The first instance is what the pool remembers, the second one gets reset.
+	Control *first = Object::cast_to<Control>(packed_scene->instantiate_pooled());
+	Control *second = Object::cast_to<Control>(packed_scene->instantiate_pooled());
+	REQUIRE(first != nullptr);
+	REQUIRE(second != nullptr);
+	CHECK(second->get_shortcut_context() == second->get_child(0));
+
+	second->set_shortcut_context(nullptr);
+	packed_scene->release_pooled(second);
+
+	Control *reused = Object::cast_to<Control>(packed_scene->instantiate_pooled());
+	REQUIRE(reused == second);
+	CHECK(reused->get_shortcut_context() == reused->get_child(0));
+	CHECK(first->get_shortcut_context() == first->get_child(0));
+
+	memdelete(reused);
+	memdelete(first);
+	memdelete(scene);
+}
+
 } // namespace TestPackedScene
 
 #endif // TEST_PACKED_SCENE_H
@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*  test_rich_text_label.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RICH_TEXT_LABEL_H
+#define TEST_RICH_TEXT_LABEL_H
+
+#include "scene/gui/rich_text_label.h"
+#include "scene/main/window.h"
+#include "scene/resources/text_paragraph.h"
+#include "scene/theme/theme_db.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRichTextLabel {
+
+TEST_CASE("[SceneTree][TextParagraph] Width changes reuse the line layout") {
+	Ref<TextParagraph> paragraph;
+	paragraph.instantiate();
+	paragraph->set_break_flags(TextServer::BREAK_MANDATORY | TextServer::BREAK_WORD_BOUND);
+	paragraph->add_string("Short message", ThemeDB::get_singleton()->get_fallback_font(), 16);
+	paragraph->set_width(1000);
+
+	REQUIRE(paragraph->get_line_count() == 1);
+	const RID line = paragraph->get_line_rid(0);
+	const Size2 size = paragraph->get_size();
+
+	paragraph->set_width(800);
+	CHECK_MESSAGE(paragraph->get_line_rid(0) == line, "A paragraph that fits both widths should keep its lines.");
+	CHECK(paragraph->get_size() == size);
+
+	Vector<float> tabs;
+	tabs.push_back(32);
+	paragraph->tab_align(tabs);
+	const RID tab_line = paragraph->get_line_rid(0);
+	paragraph->tab_align(tabs);
+	CHECK_MESSAGE(paragraph->get_line_rid(0) == tab_line, "Setting the same tab stops should keep the lines.");
+
+	paragraph->set_width(size.x / 2);
+	CHECK(paragraph->get_line_count() > 1);
+
+	paragraph->set_width(1000);
+	CHECK(paragraph->get_line_count() == 1);
+	CHECK(paragraph->get_size() == size);
+
+	paragraph->set_alignment(HORIZONTAL_ALIGNMENT_FILL);
+	const RID fill_line = paragraph->get_line_rid(0);
+	paragraph->set_width(900);
+	CHECK_MESSAGE(paragraph->get_line_rid(0) != fill_line, "Justified lines depend on the width.");
+}
+
+TEST_CASE("[SceneTree][RichTextLabel] Streaming paragraphs") {
+	RichTextLabel *label = memnew(RichTextLabel);
+	label->set_size(Size2(400, 300));
+	label->set_scroll_follow(true);
+	SceneTree::get_singleton()->get_root()->add_child(label);
+
+	const int count = 2000;
+	for (int i = 0; i < count; i++) {
+		label->add_text(vformat("Message %d\n", i));
+		if (i % 250 == 0) {
+			// Lay out what has been appended so far, like a redraw would.
+			CHECK(label->get_content_height() > 0);
+		}
+	}
+
+	CHECK(label->get_paragraph_count() == count + 1);
+	CHECK(label->is_ready());
+	const int content_height = label->get_content_height();
+	const int line_count = label->get_line_count();
+	CHECK(line_count == count + 1);
+
+	SUBCASE("[RichTextLabel] Height changes keep the layout") {
+		label->set_size(Size2(400, 600));
+		CHECK(label->get_content_height() == content_height);
+		CHECK(label->get_line_count() == line_count);
+		CHECK(Math::abs(label->get_v_scroll_bar()->get_max() - content_height) <= 1);
+	}
+
+	SUBCASE("[RichTextLabel] Width changes wrap the paragraphs again") {
+		label->set_size(Size2(500, 300));
+		CHECK(label->get_content_height() == content_height);
+		CHECK(label->get_line_count() == line_count);
+
+		label->set_size(Size2(40, 300));
+		CHECK(label->get_line_count() > line_count);
+
+		label->set_size(Size2(400, 300));
+		CHECK(label->get_line_count() == line_count);
+		CHECK(label->get_content_height() == content_height);
+	}
+
+	memdelete(label);
+}
+
+} // namespace TestRichTextLabel
+
+#endif // TEST_RICH_TEXT_LABEL_H
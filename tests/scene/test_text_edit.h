@@ -31,7 +31,9 @@
 #ifndef TEST_TEXT_EDIT_H
 #define TEST_TEXT_EDIT_H
 
+#include "core/string/string_builder.h"
 #include "scene/gui/text_edit.h"
+#include "scene/resources/syntax_highlighter.h"
 
 #include "tests/test_macros.h"
 
@@ -4304,6 +4306,116 @@ TEST_CASE("[SceneTree][TextEdit] gutters") {
 	memdelete(text_edit);
 }
 
+TEST_CASE("[SceneTree][TextEdit] large documents") {
+	TextEdit *text_edit = memnew(TextEdit);
+	text_edit->set_size(Size2(800, 600));
+	SceneTree::get_singleton()->get_root()->add_child(text_edit);
+
+	TextEdit *small_edit = memnew(TextEdit);
+	SceneTree::get_singleton()->get_root()->add_child(small_edit);
+	small_edit->set_text("\tline 15000 of the document");
+
+	const int line_count = 20000;
+	StringBuilder source;
+	for (int i = 0; i < line_count; i++) {
+		source.append(vformat("\tline %d of the document\n", i));
+	}
+	text_edit->set_text(source.as_string());
+	CHECK(text_edit->get_line_count() == line_count + 1);
+
+	// Lines far from the view are laid out when they are needed.
+	CHECK(text_edit->get_line_width(15000) == small_edit->get_line_width(0));
+	CHECK(text_edit->get_line_height() == small_edit->get_line_height());
+
+	text_edit->set_caret_line(15000);
+	text_edit->set_caret_column(0);
+	text_edit->insert_text_at_caret("edited ");
+	CHECK(text_edit->get_line(15000) == "edited \tline 15000 of the document");
+	CHECK(text_edit->get_line_width(15000) > small_edit->get_line_width(0));
+
+	text_edit->set_line_wrapping_mode(TextEdit::LineWrappingMode::LINE_WRAPPING_BOUNDARY);
+	CHECK(text_edit->get_line_width(15000) > small_edit->get_line_width(0));
+	CHECK(text_edit->get_total_visible_line_count() >= line_count + 1);
+
+	memdelete(small_edit);
+	memdelete(text_edit);
+}
+
+static void check_highlighting_is_up_to_date(TextEdit *p_text_edit, const Ref<CodeHighlighter> &p_highlighter) {
+	Vector<Dictionary> incremental;
+	for (int i = 0; i < p_text_edit->get_line_count(); i++) {
+		incremental.push_back(p_highlighter->get_line_syntax_highlighting(i));
+	}
+
+	p_highlighter->clear_highlighting_cache();
+	for (int i = 0; i < p_text_edit->get_line_count(); i++) {
+		CHECK_MESSAGE(p_highlighter->get_line_syntax_highlighting(i) == incremental[i], vformat("Line %d should be highlighted as if from scratch.", i));
+	}
+}
+
+TEST_CASE("[SceneTree][TextEdit] incremental syntax highlighting") {
+	TextEdit *text_edit = memnew(TextEdit);
+	SceneTree::get_singleton()->get_root()->add_child(text_edit);
+
+	Ref<CodeHighlighter> highlighter;
+	highlighter.instantiate();
+	highlighter->add_color_region("/*", "*/", Color(0, 1, 0));
+	highlighter->add_color_region("\"", "\"", Color(0, 0, 1));
+	highlighter->add_keyword_color("var", Color(1, 0, 0));
+	text_edit->set_syntax_highlighter(highlighter);
+
+	StringBuilder source;
+	for (int i = 0; i < 100; i++) {
+		source.append(vformat("var a%d = \"%d\"\n", i, i));
+	}
+	text_edit->set_text(source.as_string());
+	check_highlighting_is_up_to_date(text_edit, highlighter);
+
+	SUBCASE("[TextEdit] Edits that don't change the state") {
+		text_edit->insert_text_at_caret("var b = 1", -1);
+		text_edit->set_caret_line(50);
+		text_edit->insert_text_at_caret("1 + ");
+		check_highlighting_is_up_to_date(text_edit, highlighter);
+	}
+
+	SUBCASE("[TextEdit] Edits that open and close a region") {
+		text_edit->set_caret_line(10);
+		text_edit->set_caret_column(0);
+		text_edit->insert_text_at_caret("/*");
+		check_highlighting_is_up_to_date(text_edit, highlighter);
+
+		text_edit->set_caret_line(20);
+		text_edit->set_caret_column(0);
+		text_edit->insert_text_at_caret("*/");
+		check_highlighting_is_up_to_date(text_edit, highlighter);
+
+		text_edit->remove_text(10, 0, 10, 2);
+		check_highlighting_is_up_to_date(text_edit, highlighter);
+	}
+
+	SUBCASE("[TextEdit] Edits that add and remove lines") {
+		// Highlight the lines once, then only look at some of them after each edit.
+		for (int i = 0; i < text_edit->get_line_count(); i++) {
+			highlighter->get_line_syntax_highlighting(i);
+		}
+
+		text_edit->set_caret_line(30);
+		text_edit->set_caret_column(3);
+		text_edit->insert_text_at_caret("\n/*\n\n");
+		CHECK(highlighter->get_line_syntax_highlighting(80) == highlighter->get_line_syntax_highlighting(81));
+		check_highlighting_is_up_to_date(text_edit, highlighter);
+
+		text_edit->remove_text(31, 0, 33, 0);
+		highlighter->get_line_syntax_highlighting(60);
+		check_highlighting_is_up_to_date(text_edit, highlighter);
+
+		text_edit->remove_text(5, 0, 40, 0);
+		check_highlighting_is_up_to_date(text_edit, highlighter);
+	}
+
+	memdelete(text_edit);
+}
+
 } // namespace TestTextEdit
 
 #endif // TEST_TEXT_EDIT_H
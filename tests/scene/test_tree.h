@@ -0,0 +1,142 @@
+/**************************************************************************/
+/*  test_tree.h                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_TREE_H
+#define TEST_TREE_H
+
+#include "scene/gui/tree.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTree {
+
+class RowSource : public Object {
+public:
+	int requests = 0;
+
+	Variant get_row(int p_row) {
+		requests++;
+		Array row;
+		row.push_back(vformat("Row %d", p_row));
+		Dictionary cell;
+		cell["text"] = vformat("Cell %d", p_row);
+		cell["selectable"] = p_row % 2 == 0;
+		row.push_back(cell);
+		return row;
+	}
+};
+
+TEST_CASE("[SceneTree][Tree] Virtual row source") {
+	RowSource *source = memnew(RowSource);
+
+	Tree *tree = memnew(Tree);
+	tree->set_columns(2);
+	tree->set_select_mode(Tree::SELECT_MULTI);
+	tree->set_size(Size2(200, 400));
+	SceneTree::get_singleton()->get_root()->add_child(tree);
+	tree->set_item_source(callable_mp(source, &RowSource::get_row));
+	tree->set_virtual_row_count(1000000);
+
+	SUBCASE("[Tree] Rows are requested from the source") {
+		CHECK(tree->is_root_hidden());
+
+		TreeItem *first = tree->get_virtual_row_item(0);
+		REQUIRE(first != nullptr);
+		CHECK(first->get_text(0) == "Row 0");
+		CHECK(first->get_text(1) == "Cell 0");
+		CHECK(first->is_selectable(1));
+		CHECK(tree->get_virtual_row(first) == 0);
+
+		TreeItem *second = tree->get_virtual_row_item(1);
+		REQUIRE(second != nullptr);
+		CHECK_FALSE(second->is_selectable(1));
+		CHECK(tree->get_virtual_row(second) == 1);
+
+		CHECK(tree->get_virtual_row_item(999999) == nullptr);
+
+		source->requests = 0;
+		tree->scroll_to_virtual_row(1);
+		CHECK_MESSAGE(source->requests <= 2, "Scrolling by one row should reuse the rows already built.");
+	}
+
+	SUBCASE("[Tree] Only rows around the visible area are kept") {
+		const int initial_rows = tree->get_cached_virtual_row_count();
+		CHECK(initial_rows > 0);
+		CHECK(initial_rows < 1000);
+
+		const int rows[] = { 1234, 500000, 999000 };
+		for (const int row : rows) {
+			tree->scroll_to_virtual_row(row);
+			CHECK(tree->get_cached_virtual_row_count() <= initial_rows * 2);
+
+			TreeItem *item = tree->get_item_at_position(Point2(10, 10));
+			REQUIRE(item != nullptr);
+			CHECK(tree->get_virtual_row(item) == row);
+			CHECK(item->get_text(0) == vformat("Row %d", row));
+			CHECK(tree->get_item_rect(item).position.y == doctest::Approx(tree->get_scroll().y));
+		}
+
+		// The last rows are reachable.
+		tree->scroll_to_virtual_row(999999);
+		CHECK(tree->get_virtual_row_item(999999) != nullptr);
+	}
+
+	SUBCASE("[Tree] Selection survives scrolling") {
+		tree->get_virtual_row_item(2)->select(0);
+		tree->scroll_to_virtual_row(500000);
+		CHECK(tree->get_virtual_row_item(2) == nullptr);
+
+		tree->get_virtual_row_item(500001)->select(0);
+		PackedInt32Array selected = tree->get_selected_virtual_rows();
+		REQUIRE(selected.size() == 2);
+		CHECK(selected[0] == 2);
+		CHECK(selected[1] == 500001);
+
+		tree->scroll_to_virtual_row(0);
+		REQUIRE(tree->get_virtual_row_item(2) != nullptr);
+		CHECK(tree->get_virtual_row_item(2)->is_selected(0));
+		CHECK_FALSE(tree->get_virtual_row_item(3)->is_selected(0));
+
+		tree->set_virtual_row_count(10);
+		CHECK(tree->get_cached_virtual_row_count() == 10);
+		CHECK(tree->get_selected_virtual_rows().size() == 1);
+
+		tree->deselect_all();
+		CHECK(tree->get_selected_virtual_rows().is_empty());
+	}
+
+	memdelete(tree);
+	memdelete(source);
+}
+
+} // namespace TestTree
+
+#endif // TEST_TREE_H
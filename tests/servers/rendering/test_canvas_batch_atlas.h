@@ -0,0 +1,257 @@
+/**************************************************************************/
+/*  test_canvas_batch_atlas.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_CANVAS_BATCH_ATLAS_H
+#define TEST_CANVAS_BATCH_ATLAS_H
+
+#include "servers/rendering/canvas_batch_atlas.h"
+#include "servers/rendering/renderer_canvas_render.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCanvasBatchAtlas {
+
+// Same decision as RasterizerCanvasGLES3::_get_canvas_batch_atlas_rect() for a plain rect.
+static CanvasBatchAtlas::BatchTexture _get_rect_texture(CanvasBatchAtlas &p_atlas, RID p_texture) {
+	Rect2 uv_rect;
+	CanvasBatchAtlas::BatchTexture bt;
+	bt.texture = p_texture;
+	bt.use_atlas = CanvasBatchAtlas::can_draw_rect(p_texture, false, 0, RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR, RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED) && p_atlas.get_uv_rect(p_texture, uv_rect);
+	return bt;
+}
+
+static bool _breaks_batch(CanvasBatchAtlas &p_atlas, RID p_texture_a, RID p_texture_b) {
+	return CanvasBatchAtlas::rect_breaks_batch(_get_rect_texture(p_atlas, p_texture_a), _get_rect_texture(p_atlas, p_texture_b));
+}
+
+TEST_CASE("[CanvasBatchAtlas] Requested textures are packed on the next update") {
+	CanvasBatchAtlas atlas;
+	RID a = RID::from_uint64(1);
+	RID b = RID::from_uint64(2);
+
+	CHECK_FALSE(atlas.request(a, Size2i(32, 32)));
+	CHECK_FALSE(atlas.request(b, Size2i(16, 64)));
+	CHECK(atlas.is_dirty());
+	CHECK(_breaks_batch(atlas, a, b));
+
+	atlas.pack();
+	CHECK_FALSE(atlas.is_dirty());
+	CHECK(atlas.get_packed_count() == 2);
+	CHECK(atlas.request(a, Size2i(32, 32)));
+	CHECK(atlas.request(b, Size2i(16, 64)));
+	CHECK_FALSE(_breaks_batch(atlas, a, b));
+	CHECK_FALSE(atlas.is_dirty());
+}
+
+TEST_CASE("[CanvasBatchAtlas] Packed rects are padded and don't overlap") {
+	CanvasBatchAtlas atlas;
+	atlas.set_padding(1);
+
+	for (int i = 0; i < 64; i++) {
+		atlas.request(RID::from_uint64(i + 1), Size2i(8 + (i % 5) * 7, 8 + (i % 3) * 11));
+	}
+	atlas.pack();
+	CHECK(atlas.get_packed_count() == 64);
+
+	const Size2i size = atlas.get_size();
+	Vector<Rect2i> padded;
+	for (const KeyValue<RID, CanvasBatchAtlas::Entry> &E : atlas.get_entries()) {
+		CHECK(E.value.packed);
+		Rect2i r = E.value.rect.grow(1);
+		CHECK(r.position.x >= 0);
+		CHECK(r.position.y >= 0);
+		CHECK(r.get_end().x <= size.width);
+		CHECK(r.get_end().y <= size.height);
+		padded.push_back(r);
+
+		Rect2 uv;
+		CHECK(atlas.get_uv_rect(E.key, uv));
+		CHECK(uv.is_equal_approx(Rect2(Point2(E.value.rect.position) / Size2(size), Size2(E.value.rect.size) / Size2(size))));
+	}
+
+	bool overlap = false;
+	for (int i = 0; i < padded.size(); i++) {
+		for (int j = i + 1; j < padded.size(); j++) {
+			overlap = overlap || padded[i].intersects(padded[j]);
+		}
+	}
+	CHECK_FALSE(overlap);
+}
+
+TEST_CASE("[CanvasBatchAtlas] Oversized and overflowing textures break batches") {
+	CanvasBatchAtlas atlas;
+	atlas.set_max_size(Size2i(128, 128));
+	atlas.set_max_texture_size(64);
+
+	RID too_big = RID::from_uint64(100);
+	CHECK_FALSE(atlas.is_size_eligible(Size2i(65, 8)));
+	CHECK_FALSE(atlas.request(too_big, Size2i(65, 8)));
+	CHECK_FALSE(atlas.has(too_big));
+
+	// Five 62x62 textures (64x64 with padding) can't all fit in 128x128, the largest ones are left out.
+	for (int i = 0; i < 5; i++) {
+		atlas.request(RID::from_uint64(i + 1), Size2i(62, 62));
+	}
+	atlas.request(RID::from_uint64(10), Size2i(4, 4));
+	atlas.pack();
+
+	CHECK(atlas.get_size().width <= 128);
+	CHECK(atlas.get_size().height <= 128);
+	CHECK(atlas.get_packed_count() < 6);
+	CHECK(atlas.is_packed(RID::from_uint64(10)));
+
+	int unpacked = 0;
+	for (int i = 0; i < 5; i++) {
+		if (!atlas.is_packed(RID::from_uint64(i + 1))) {
+			unpacked++;
+			CHECK(_breaks_batch(atlas, RID::from_uint64(i + 1), RID::from_uint64(10)));
+		}
+	}
+	CHECK(unpacked >= 1);
+}
+
+TEST_CASE("[CanvasBatchAtlas] New textures don't repack a full atlas every frame") {
+	CanvasBatchAtlas atlas;
+	atlas.set_max_size(Size2i(128, 128));
+	atlas.set_full_repack_frames(60);
+	for (int i = 0; i < 5; i++) {
+		atlas.request(RID::from_uint64(i + 1), Size2i(62, 62));
+	}
+	atlas.pack();
+	CHECK(atlas.is_full());
+
+	// The new texture is drawn unbatched until the throttled repack.
+	RID c = RID::from_uint64(10);
+	CHECK_FALSE(atlas.request(c, Size2i(4, 4)));
+	CHECK_FALSE(atlas.is_dirty());
+	for (int i = 0; i < 59; i++) {
+		atlas.advance_frame();
+	}
+	CHECK_FALSE(atlas.is_dirty());
+	atlas.advance_frame();
+	CHECK(atlas.is_dirty());
+	atlas.pack();
+	CHECK(atlas.is_packed(c));
+	CHECK_FALSE(atlas.is_dirty());
+}
+
+TEST_CASE("[CanvasBatchAtlas] Resizing or erasing a texture invalidates it") {
+	CanvasBatchAtlas atlas;
+	RID a = RID::from_uint64(1);
+	RID b = RID::from_uint64(2);
+	atlas.request(a, Size2i(16, 16));
+	atlas.request(b, Size2i(16, 16));
+	atlas.pack();
+	CHECK_FALSE(_breaks_batch(atlas, a, b));
+
+	CHECK_FALSE(atlas.request(a, Size2i(32, 16)));
+	CHECK(atlas.is_dirty());
+	CHECK(_breaks_batch(atlas, a, b));
+	atlas.pack();
+	CHECK_FALSE(_breaks_batch(atlas, a, b));
+
+	atlas.erase(b);
+	CHECK_FALSE(atlas.has(b));
+	CHECK(atlas.get_packed_count() == 1);
+	CHECK(_breaks_batch(atlas, a, b));
+	CHECK_FALSE(_breaks_batch(atlas, b, b));
+}
+
+TEST_CASE("[CanvasBatchAtlas] Rects that can't sample the atlas") {
+	const RID texture = RID::from_uint64(1);
+	const RS::CanvasItemTextureFilter linear = RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR;
+	const RS::CanvasItemTextureRepeat no_repeat = RS::CANVAS_ITEM_TEXTURE_REPEAT_DISABLED;
+
+	CHECK(CanvasBatchAtlas::can_draw_rect(texture, false, RendererCanvasRender::CANVAS_RECT_REGION | RendererCanvasRender::CANVAS_RECT_FLIP_H, linear, no_repeat));
+	CHECK(CanvasBatchAtlas::can_draw_rect(texture, false, 0, RS::CANVAS_ITEM_TEXTURE_FILTER_NEAREST, no_repeat));
+
+	CHECK_FALSE(CanvasBatchAtlas::can_draw_rect(RID(), false, 0, linear, no_repeat));
+	CHECK_FALSE(CanvasBatchAtlas::can_draw_rect(texture, true, 0, linear, no_repeat));
+	CHECK_FALSE(CanvasBatchAtlas::can_draw_rect(texture, false, RendererCanvasRender::CANVAS_RECT_TILE, linear, no_repeat));
+	CHECK_FALSE(CanvasBatchAtlas::can_draw_rect(texture, false, RendererCanvasRender::CANVAS_RECT_MSDF, linear, no_repeat));
+	CHECK_FALSE(CanvasBatchAtlas::can_draw_rect(texture, false, RendererCanvasRender::CANVAS_RECT_LCD, linear, no_repeat));
+	CHECK_FALSE(CanvasBatchAtlas::can_draw_rect(texture, false, 0, RS::CANVAS_ITEM_TEXTURE_FILTER_LINEAR_WITH_MIPMAPS, no_repeat));
+	CHECK_FALSE(CanvasBatchAtlas::can_draw_rect(texture, false, 0, linear, RS::CANVAS_ITEM_TEXTURE_REPEAT_ENABLED));
+
+	// A rect that doesn't use the atlas breaks a batch that does, even with the same texture.
+	CHECK(CanvasBatchAtlas::rect_breaks_batch({ texture, true }, { texture, false }));
+	CHECK(CanvasBatchAtlas::rect_breaks_batch({ texture, false }, { RID::from_uint64(2), false }));
+	CHECK_FALSE(CanvasBatchAtlas::rect_breaks_batch({ texture, false }, { texture, false }));
+	CHECK_FALSE(CanvasBatchAtlas::rect_breaks_batch({ texture, true }, { RID::from_uint64(2), true }));
+}
+
+TEST_CASE("[CanvasBatchAtlas] Updated contents don't repack the atlas") {
+	CanvasBatchAtlas atlas;
+	RID a = RID::from_uint64(1);
+	RID b = RID::from_uint64(2);
+	atlas.request(a, Size2i(16, 16));
+	atlas.request(b, Size2i(16, 16));
+	atlas.pack();
+	const Rect2i rect_a = atlas.get_entries()[a].rect;
+
+	atlas.mark_dirty(a);
+	CHECK_FALSE(atlas.is_dirty());
+	CHECK(atlas.has_dirty_contents());
+	CHECK(atlas.get_entries()[a].contents_dirty);
+	CHECK_FALSE(atlas.get_entries()[b].contents_dirty);
+	CHECK(atlas.get_entries()[a].rect == rect_a);
+
+	atlas.clear_dirty_contents();
+	CHECK_FALSE(atlas.has_dirty_contents());
+	CHECK_FALSE(atlas.get_entries()[a].contents_dirty);
+}
+
+TEST_CASE("[CanvasBatchAtlas] Unused textures are evicted on repack") {
+	CanvasBatchAtlas atlas;
+	atlas.set_eviction_frames(10);
+	RID a = RID::from_uint64(1);
+	RID b = RID::from_uint64(2);
+	atlas.request(a, Size2i(16, 16));
+	atlas.request(b, Size2i(16, 16));
+	atlas.pack();
+
+	Rect2 uv_rect;
+	for (int i = 0; i < 20; i++) {
+		atlas.advance_frame();
+		CHECK(atlas.get_uv_rect(a, uv_rect));
+	}
+
+	// Stale entries are only dropped when something else triggers a repack.
+	CHECK(atlas.has(b));
+	atlas.request(RID::from_uint64(3), Size2i(8, 8));
+	atlas.pack();
+	CHECK(atlas.is_packed(a));
+	CHECK_FALSE(atlas.has(b));
+	CHECK(atlas.get_packed_count() == 2);
+}
+
+} // namespace TestCanvasBatchAtlas
+
+#endif // TEST_CANVAS_BATCH_ATLAS_H
@@ -0,0 +1,117 @@
+/**************************************************************************/
+/*  test_canvas_item_profile.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_CANVAS_ITEM_PROFILE_H
+#define TEST_CANVAS_ITEM_PROFILE_H
+
+#include "scene/2d/node_2d.h"
+#include "scene/main/window.h"
+#include "servers/debugger/servers_debugger.h"
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+#include "tests/test_macros.h"
+
+namespace TestCanvasItemProfile {
+
+TEST_CASE("[SceneTree][CanvasItemProfile] Per-item costs are collected once per frame") {
+	Node2D *node = memnew(Node2D);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+
+	// Canvas items know their RID and owner, so costs recorded while drawing can be attributed.
+	RendererCanvasCull::Item *item = RSG::canvas->canvas_item_owner.get_or_null(node->get_canvas_item());
+	REQUIRE(item);
+	CHECK(item->self == node->get_canvas_item());
+	CHECK(item->instance_id == node->get_instance_id());
+
+	RS::get_singleton()->set_canvas_item_profiling_enabled(true);
+	CHECK(RSG::canvas_render->item_profiling);
+
+	// What the renderer and RendererCanvasCull record while the item is drawn.
+	RendererCanvasRender::ItemProfile *profile = RSG::canvas_render->get_item_profile(item);
+	profile->instances = 3;
+	profile->batch_breaks[RendererCanvasRender::BATCH_BREAK_TEXTURE] = 2;
+	profile->batch_breaks[RendererCanvasRender::BATCH_BREAK_CLIP] = 1;
+	profile->batch_breaks[RendererCanvasRender::BATCH_BREAK_BUFFER_FULL] = 4;
+	profile->cull_usec = 1500;
+	CHECK(RSG::canvas_render->get_item_profile(item) == profile);
+
+	RS::get_singleton()->draw(false);
+
+	Vector<RS::CanvasItemProfile> frame = RS::get_singleton()->get_canvas_item_profile();
+	REQUIRE(frame.size() == 1);
+	CHECK(frame[0].item == node->get_canvas_item());
+	CHECK(frame[0].instance_id == node->get_instance_id());
+	CHECK(frame[0].instances == 3);
+	// Breaks caused by a full instance buffer aren't charged to the item.
+	CHECK(frame[0].batch_breaks == 3);
+	CHECK(frame[0].batch_break_mask == ((1 << RendererCanvasRender::BATCH_BREAK_TEXTURE) | (1 << RendererCanvasRender::BATCH_BREAK_CLIP)));
+	CHECK(frame[0].cull_msec == doctest::Approx(1.5));
+	CHECK(RSG::canvas_render->item_profile.is_empty());
+
+	// Nothing recorded in the next frame, nothing reported.
+	RS::get_singleton()->draw(false);
+	CHECK(RS::get_singleton()->get_canvas_item_profile().is_empty());
+
+	RS::get_singleton()->set_canvas_item_profiling_enabled(false);
+	CHECK_FALSE(RSG::canvas_render->item_profiling);
+
+	memdelete(node);
+}
+
+TEST_CASE("[CanvasItemProfile] Profiler frames survive serialization") {
+	ServersDebugger::CanvasProfilerFrame frame;
+	frame.frame_number = 42;
+	frame.items.resize(2);
+	frame.items.write[0].name = "Sprite2D";
+	frame.items.write[0].instance_id = ObjectID(uint64_t(1234));
+	frame.items.write[0].instances = 7;
+	frame.items.write[0].batch_breaks = 2;
+	frame.items.write[0].batch_break_mask = 1 << RendererCanvasRender::BATCH_BREAK_MATERIAL;
+	frame.items.write[0].cull_msec = 0.25;
+	frame.items.write[1].name = "Label";
+
+	ServersDebugger::CanvasProfilerFrame received;
+	CHECK(received.deserialize(frame.serialize()));
+	CHECK(received.frame_number == 42);
+	REQUIRE(received.items.size() == 2);
+	CHECK(received.items[0].name == "Sprite2D");
+	CHECK(received.items[0].instance_id == ObjectID(uint64_t(1234)));
+	CHECK(received.items[0].instances == 7);
+	CHECK(received.items[0].batch_breaks == 2);
+	CHECK(received.items[0].batch_break_mask == (1 << RendererCanvasRender::BATCH_BREAK_MATERIAL));
+	CHECK(received.items[0].cull_msec == doctest::Approx(0.25));
+	CHECK(received.items[1].name == "Label");
+	CHECK(received.items[1].instances == 0);
+}
+
+} // namespace TestCanvasItemProfile
+
+#endif // TEST_CANVAS_ITEM_PROFILE_H
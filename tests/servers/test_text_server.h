@@ -33,12 +33,29 @@
 
 #ifdef TOOLS_ENABLED
 
+#include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 #include "editor/builtin_fonts.gen.h"
 #include "servers/text_server.h"
 #include "tests/test_macros.h"
+#include "tests/test_utils.h"
 
 namespace TestTextServer {
 
+struct ConcurrentShapingData {
+	TextServer *ts = nullptr;
+	LocalVector<RID> texts;
+	LocalVector<RID> substrs;
+};
+
+static void concurrent_shape(void *p_userdata, uint32_t p_index) {
+	ConcurrentShapingData *data = (ConcurrentShapingData *)p_userdata;
+	data->ts->shaped_text_shape(data->texts[p_index]);
+	data->substrs[p_index] = data->ts->shaped_text_substr(data->texts[p_index], 0, 8);
+}
+
 TEST_SUITE("[TextServer]") {
 	TEST_CASE("[TextServer] Init, font loading and shaping") {
 		SUBCASE("[TextServer] Loading fonts") {
@@ -616,6 +633,274 @@ TEST_SUITE("[TextServer]") {
 			}
 		}
 
+		SUBCASE("[TextServer] Batch glyph rendering") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC)) {
+					continue;
+				}
+
+				// Pre-warm 5000 CJK ideographs, then render the first ones one by one in another font.
+				const int64_t first = 0x4E00;
+				const int64_t count = 5000;
+				const Vector2i size = Vector2i(16, 0);
+
+				RID font_batch = ts->create_font();
+				ts->font_set_data_ptr(font_batch, _font_DroidSansFallback, _font_DroidSansFallback_size);
+				ts->font_set_subpixel_positioning(font_batch, TextServer::SUBPIXEL_POSITIONING_DISABLED);
+				RID font_single = ts->create_font();
+				ts->font_set_data_ptr(font_single, _font_DroidSansFallback, _font_DroidSansFallback_size);
+				ts->font_set_subpixel_positioning(font_single, TextServer::SUBPIXEL_POSITIONING_DISABLED);
+
+				ts->font_render_range(font_batch, size, first, first + count - 1);
+
+				for (int64_t c = first; c < first + 500; c++) {
+					int64_t glyph = ts->font_get_glyph_index(font_batch, size.x, c, 0);
+					ts->font_render_glyph(font_single, size, glyph);
+				}
+				for (int64_t c = first; c < first + 500; c++) {
+					int64_t glyph = ts->font_get_glyph_index(font_batch, size.x, c, 0);
+					CHECK(ts->font_get_glyph_texture_idx(font_batch, size, glyph) == ts->font_get_glyph_texture_idx(font_single, size, glyph));
+					CHECK(ts->font_get_glyph_uv_rect(font_batch, size, glyph) == ts->font_get_glyph_uv_rect(font_single, size, glyph));
+					CHECK(ts->font_get_glyph_offset(font_batch, size, glyph) == ts->font_get_glyph_offset(font_single, size, glyph));
+					CHECK(ts->font_get_glyph_advance(font_batch, size.x, glyph) == ts->font_get_glyph_advance(font_single, size.x, glyph));
+				}
+
+				ts->free_rid(font_batch);
+				ts->free_rid(font_single);
+			}
+		}
+
+		SUBCASE("[TextServer] Glyph atlas compaction") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC)) {
+					continue;
+				}
+
+				const Vector2i size = Vector2i(16, 0);
+
+				RID font = ts->create_font();
+				ts->font_set_data_ptr(font, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				ts->font_render_range(font, size, 0x20, 0x24F);
+
+				TypedArray<Dictionary> info = ts->font_get_size_cache_info(font);
+				REQUIRE(info.size() == 1);
+				Dictionary before = info[0];
+				CHECK(Vector2i(before["size"]) == size);
+				CHECK(int(before["glyphs"]) > 0);
+				CHECK(double(before["occupancy"]) > 0.0);
+				CHECK(double(before["occupancy"]) <= 1.0);
+
+				int64_t glyph = ts->font_get_glyph_index(font, size.x, 'A', 0);
+				Rect2 uv_before = ts->font_get_glyph_uv_rect(font, size, glyph);
+				Ref<Image> img_before = ts->font_get_texture_image(font, size, ts->font_get_glyph_texture_idx(font, size, glyph));
+				Ref<Image> glyph_before = img_before->get_region(Rect2i(uv_before));
+
+				RID texture_before = ts->font_get_glyph_texture_rid(font, size, glyph);
+
+				ts->font_compact_size_cache(font, size, -1);
+
+				Dictionary after = ts->font_get_size_cache_info(font)[0];
+				CHECK(int(after["glyphs"]) == int(before["glyphs"]));
+				CHECK(int(after["textures"]) <= int(before["textures"]));
+
+				Rect2 uv_after = ts->font_get_glyph_uv_rect(font, size, glyph);
+				CHECK(uv_after.size == uv_before.size);
+				Ref<Image> img_after = ts->font_get_texture_image(font, size, ts->font_get_glyph_texture_idx(font, size, glyph));
+				Ref<Image> glyph_after = img_after->get_region(Rect2i(uv_after));
+				CHECK(glyph_after->get_data() == glyph_before->get_data());
+				if (texture_before.is_valid()) {
+					// Canvas items may still point at the old texture with the old coordinates, it must not be reused.
+					CHECK(ts->font_get_glyph_texture_rid(font, size, glyph) != texture_before);
+				}
+
+				// Shelf packer data from older versions is converted to the skyline.
+				PackedInt32Array shelves = { 20, 0, 236, 16, 8, 16, 248, 10 };
+				ts->font_set_texture_offsets(font, size, 7, shelves);
+				PackedInt32Array skyline = ts->font_get_texture_offsets(font, size, 7);
+				PackedInt32Array expected = { 0, 26, 8, 0, 8, 16, 248, 0 };
+				CHECK(skyline == expected);
+
+				ts->free_rid(font);
+			}
+		}
+
+		SUBCASE("[TextServer] Persistent glyph cache") {
+			const String cache_path = TestUtils::get_temp_path("glyph_cache");
+			const Variant prev_enabled = ProjectSettings::get_singleton()->get_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache");
+			const Variant prev_path = ProjectSettings::get_singleton()->get_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache_path");
+			ProjectSettings::get_singleton()->set_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache", true);
+			ProjectSettings::get_singleton()->set_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache_path", cache_path);
+
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC) || !ts->has_feature(TextServer::FEATURE_BIDI_LAYOUT)) {
+					continue;
+				}
+
+				const Vector2i size = Vector2i(16, 0);
+
+				// Glyphs are written when the font is freed.
+				RID font_src = ts->create_font();
+				ts->font_set_data_ptr(font_src, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				ts->font_render_range(font_src, size, 0x20, 0x7E);
+				PackedInt32Array glyphs = ts->font_get_glyph_list(font_src, size);
+				Vector<Rect2> uv_rects;
+				for (int j = 0; j < glyphs.size(); j++) {
+					uv_rects.push_back(ts->font_get_glyph_uv_rect(font_src, size, glyphs[j]));
+				}
+				ts->free_rid(font_src);
+				CHECK(glyphs.size() > 0);
+
+				// Same data and settings, glyphs are loaded without rasterization.
+				RID font_cached = ts->create_font();
+				ts->font_set_data_ptr(font_cached, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				PackedInt32Array cached_glyphs = ts->font_get_glyph_list(font_cached, size);
+				CHECK(cached_glyphs.size() == glyphs.size());
+				for (int j = 0; j < glyphs.size(); j++) {
+					CHECK(ts->font_get_glyph_uv_rect(font_cached, size, glyphs[j]) == uv_rects[j]);
+				}
+
+				// Different rasterization settings use another cache file.
+				RID font_other = ts->create_font();
+				ts->font_set_data_ptr(font_other, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				ts->font_set_antialiasing(font_other, TextServer::FONT_ANTIALIASING_NONE);
+				CHECK(ts->font_get_glyph_list(font_other, size).is_empty());
+
+				ts->free_rid(font_cached);
+				ts->free_rid(font_other);
+			}
+
+			ProjectSettings::get_singleton()->set_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache", prev_enabled);
+			ProjectSettings::get_singleton()->set_setting("gui/fonts/dynamic_fonts/persistent_glyph_cache_path", prev_path);
+			Ref<DirAccess> da = DirAccess::open(cache_path);
+			if (da.is_valid()) {
+				for (const String &file : da->get_files()) {
+					da->remove(file);
+				}
+				DirAccess::remove_absolute(cache_path);
+			}
+		}
+
+		SUBCASE("[TextServer] Text layout: Concurrent shaping") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC) || !ts->has_feature(TextServer::FEATURE_BIDI_LAYOUT)) {
+					continue;
+				}
+
+				RID font1 = ts->create_font();
+				ts->font_set_data_ptr(font1, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				ts->font_set_allow_system_fallback(font1, false);
+				RID font2 = ts->create_font();
+				ts->font_set_data_ptr(font2, _font_NotoNaskhArabicUI_Regular, _font_NotoNaskhArabicUI_Regular_size);
+				ts->font_set_allow_system_fallback(font2, false);
+
+				Array font;
+				font.push_back(font1);
+				font.push_back(font2);
+
+				const int count = 64;
+				ConcurrentShapingData data;
+				data.ts = ts.ptr();
+				data.substrs.resize(count);
+				for (int j = 0; j < count; j++) {
+					RID ctx = ts->create_shaped_text();
+					String text = vformat(U"Line %d: test الحمد test %d", j, j * 31);
+					CHECK_FALSE_MESSAGE(!ts->shaped_text_add_string(ctx, text, font, 16 + j % 4), "Adding text to the buffer failed.");
+					data.texts.push_back(ctx);
+				}
+
+				WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(concurrent_shape, &data, count);
+				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+				for (int j = 0; j < count; j++) {
+					// Reshape the same text serially, results must match.
+					RID ref = ts->create_shaped_text();
+					ts->shaped_text_add_string(ref, vformat(U"Line %d: test الحمد test %d", j, j * 31), font, 16 + j % 4);
+					CHECK(ts->shaped_text_is_ready(data.texts[j]));
+					CHECK(ts->shaped_text_get_glyph_count(data.texts[j]) == ts->shaped_text_get_glyph_count(ref));
+					CHECK(ts->shaped_text_get_width(data.texts[j]) == doctest::Approx(ts->shaped_text_get_width(ref)));
+					CHECK(ts->shaped_text_is_ready(data.substrs[j]));
+					ts->free_rid(ref);
+					ts->free_rid(data.substrs[j]);
+					ts->free_rid(data.texts[j]);
+				}
+
+				for (int j = 0; j < font.size(); j++) {
+					ts->free_rid(font[j]);
+				}
+				font.clear();
+			}
+		}
+
+		SUBCASE("[TextServer] Text layout: Shaped text cache") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC) || !ts->has_feature(TextServer::FEATURE_BIDI_LAYOUT)) {
+					continue;
+				}
+
+				RID font1 = ts->create_font();
+				ts->font_set_data_ptr(font1, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				ts->font_set_allow_system_fallback(font1, false);
+
+				Array font;
+				font.push_back(font1);
+
+				String test = U"Cached text test 12345";
+
+				RID ctx1 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx1, test, font, 16);
+				int64_t misses = ts->get_shaped_text_cache_info(TextServer::SHAPED_TEXT_CACHE_MISSES);
+				int64_t hits = ts->get_shaped_text_cache_info(TextServer::SHAPED_TEXT_CACHE_HITS);
+				CHECK(ts->shaped_text_shape(ctx1));
+				CHECK(ts->get_shaped_text_cache_info(TextServer::SHAPED_TEXT_CACHE_MISSES) == misses + 1);
+				CHECK(ts->get_shaped_text_cache_info(TextServer::SHAPED_TEXT_CACHE_MEMORY_USED) > 0);
+
+				// Same text and fonts in another buffer is copied from the cache.
+				RID ctx2 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx2, test, font, 16);
+				CHECK(ts->shaped_text_shape(ctx2));
+				CHECK(ts->get_shaped_text_cache_info(TextServer::SHAPED_TEXT_CACHE_HITS) == hits + 1);
+				CHECK(ts->shaped_text_get_glyph_count(ctx1) == ts->shaped_text_get_glyph_count(ctx2));
+				CHECK(ts->shaped_text_get_width(ctx1) == ts->shaped_text_get_width(ctx2));
+				const Glyph *glyphs1 = ts->shaped_text_get_glyphs(ctx1);
+				const Glyph *glyphs2 = ts->shaped_text_get_glyphs(ctx2);
+				for (int j = 0; j < ts->shaped_text_get_glyph_count(ctx1); j++) {
+					CHECK(glyphs1[j] == glyphs2[j]);
+				}
+
+				// Substrings of cached texts still work.
+				RID sub = ts->shaped_text_substr(ctx2, 0, 6);
+				CHECK(ts->shaped_text_is_ready(sub));
+				ts->free_rid(sub);
+
+				// Font changes must not reuse stale glyphs.
+				ts->font_set_spacing(font1, TextServer::SPACING_GLYPH, 4);
+				RID ctx3 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx3, test, font, 16);
+				CHECK(ts->shaped_text_get_width(ctx3) > ts->shaped_text_get_width(ctx1));
+
+				ts->free_rid(ctx1);
+				ts->free_rid(ctx2);
+				ts->free_rid(ctx3);
+				ts->free_rid(font1);
+				font.clear();
+			}
+		}
+
 		SUBCASE("[TextServer] Unicode identifiers") {
 			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
 				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
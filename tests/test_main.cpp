@@ -96,18 +96,36 @@
 #include "tests/scene/test_curve.h"
 #include "tests/scene/test_curve_2d.h"
 #include "tests/scene/test_gradient.h"
+#include "tests/scene/test_item_list.h"
 #include "tests/scene/test_node.h"
 #include "tests/scene/test_node_2d.h"
 #include "tests/scene/test_packed_scene.h"
 #include "tests/scene/test_path_2d.h"
+#include "tests/scene/test_rich_text_label.h"
 #include "tests/scene/test_sprite_frames.h"
 #include "tests/scene/test_text_edit.h"
 #include "tests/scene/test_theme.h"
+#include "tests/scene/test_tree.h"
 #include "tests/scene/test_viewport.h"
 #include "tests/scene/test_window.h"
+#include "tests/servers/rendering/test_canvas_batch_atlas.h"
+#include "tests/servers/rendering/test_canvas_item_profile.h"
 #include "tests/servers/test_text_server.h"
 #include "tests/test_validate_testing.h"
 
+#ifdef TOOLS_ENABLED
+#include "tests/editor/test_editor_import_cache.h"
+#endif
+
+#ifdef BENCHMARKS_ENABLED
+// Only built with `benchmarks=yes`, run with `--test --test-suite="[Benchmark]"`.
+#include "tests/benchmarks/benchmark_gui.h"
+#include "tests/benchmarks/benchmark_image.h"
+#include "tests/benchmarks/benchmark_resource.h"
+#include "tests/benchmarks/benchmark_scene.h"
+#include "tests/benchmarks/benchmark_text_server.h"
+#endif
+
 #include "modules/modules_tests.gen.h"
 
 #include "tests/display_server_mock.h"
@@ -40,3 +40,18 @@ String TestUtils::get_data_path(const String &p_file) {
 String TestUtils::get_executable_dir() {
 	return OS::get_singleton()->get_executable_path().get_base_dir();
 }
+
+String TestUtils::get_temp_path(const String &p_name) {
+	// Unique per process, tests running in parallel or after a crash don't see each other's files.
+	String temp_dir;
+	for (const String &env : { "TMPDIR", "TEMP", "TMP" }) {
+		if (OS::get_singleton()->has_environment(env)) {
+			temp_dir = OS::get_singleton()->get_environment(env);
+			break;
+		}
+	}
+	if (temp_dir.is_empty()) {
+		temp_dir = OS::get_singleton()->get_cache_path();
+	}
+	return temp_dir.path_join(vformat("godot_test_%d_%d_%s", OS::get_singleton()->get_process_id(), OS::get_singleton()->get_ticks_usec(), p_name));
+}
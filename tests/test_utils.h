@@ -37,6 +37,7 @@ namespace TestUtils {
 
 String get_data_path(const String &p_file);
 String get_executable_dir();
+String get_temp_path(const String &p_name);
 } // namespace TestUtils
 
 #endif // TEST_UTILS_H